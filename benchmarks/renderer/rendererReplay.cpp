@@ -0,0 +1,163 @@
+//// rendererReplay ///////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Replays a captured frame and reports its CPU submission time and bind counts
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef NX_GRAPHICS_API_OPENGL
+    #include <glad/glad.h>
+    #include <GLFW/glfw3.h>
+#endif
+
+#include "renderer/FrameCapture.hpp"
+#include "renderer/GraphicsApi.hpp"
+#include "renderer/Renderer.hpp"
+#include "renderer/Renderer3D.hpp"
+#include "renderer/Window.hpp"
+#include "renderer/headless/HeadlessCommandLog.hpp"
+#include "renderPasses/ForwardPass.hpp"
+#include "renderPasses/GridPass.hpp"
+#include "renderPasses/MaskPass.hpp"
+#include "renderPasses/OutlinePass.hpp"
+
+using namespace nexo::renderer;
+
+namespace {
+
+    // Builds the engine passes back from their captured id and name, the others are left to the generic pass
+    std::shared_ptr<RenderPass> createEnginePass(const NxFrameCapture::Pass &captured)
+    {
+        static const std::vector<std::function<std::shared_ptr<RenderPass>()>> factories = {
+            [] { return std::make_shared<ForwardPass>(); },
+            [] { return std::make_shared<GridPass>(); },
+            [] { return std::make_shared<MaskPass>(); },
+            [] { return std::make_shared<OutlinePass>(); },
+        };
+        for (const auto &factory : factories) {
+            auto pass = factory();
+            if (pass->getId() == captured.id && pass->getName() == captured.name)
+                return pass;
+        }
+        std::cout << std::format("Unknown pass '{}' ({}), replaced by a generic pass\n", captured.name, captured.id);
+        return nullptr;
+    }
+
+    double toMs(const NxFrameReplayStats::Clock::duration duration)
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    void printSummary(const NxFrameCapture &capture)
+    {
+        size_t commands = 0;
+        size_t batches = 0;
+        size_t batchedDraws = 0;
+        for (const auto &list : capture.sharedLists) {
+            commands += list.commands.size();
+            batches += list.batches.size();
+            for (const auto &batch : list.batches)
+                batchedDraws += batch.draws.size();
+        }
+        for (const auto &view : capture.views)
+            commands += view.drawCommands.size();
+        std::cout << std::format("Capture: {} views, {} draw commands, {} batches ({} draws), {} meshes ({} asset "
+                                 "ranges), {} textures, {} shaders\n",
+                                 capture.views.size(), commands, batches, batchedDraws, capture.meshes.size(),
+                                 capture.meshAssets.size(), capture.textures.size(), capture.shaders.size());
+    }
+
+}
+
+int main(const int argc, char **argv)
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <capture file> [iterations]\n"
+                  << "The backend is chosen with NEXO_GRAPHICS_API (opengl or headless)\n";
+        return EXIT_FAILURE;
+    }
+    const unsigned int iterations = argc > 2 ? static_cast<unsigned int>(std::stoul(argv[2])) : 100;
+
+    try {
+        NxFrameCapture capture = NxFrameCapture::load(argv[1]);
+        printSummary(capture);
+
+        unsigned int width = 1280;
+        unsigned int height = 720;
+        if (!capture.views.empty() && capture.views.front().renderTarget.width) {
+            width = capture.views.front().renderTarget.width;
+            height = capture.views.front().renderTarget.height;
+        }
+        const auto window = NxWindow::create(static_cast<int>(width), static_cast<int>(height), "Nexo frame replay");
+        window->init();
+        window->setVsync(false);
+#ifdef NX_GRAPHICS_API_OPENGL
+        if (NxGetGraphicsApi() == NxGraphicsApi::OPENGL && !gladLoadGLLoader((GLADloadproc) glfwGetProcAddress)) {
+            std::cerr << "Failed to initialize OpenGL context with glad\n";
+            return EXIT_FAILURE;
+        }
+#endif
+        NxRenderer::init();
+        // Streamed commands are drawn through its dynamic geometry rings
+        NxRenderer3D::get().init();
+
+        NxFrameReplay replay(std::move(capture), createEnginePass);
+        const auto endFrame = [&] { window->swapBuffers(); };
+
+        // The first submission creates the transient targets and uploads the buffers, it is not measured
+        replay.run(1, endFrame);
+        auto &log = NxHeadlessCommandLog::get();
+        log.clear();
+
+        const NxFrameReplayStats stats = replay.run(iterations, endFrame);
+        if (!stats.iterations)
+            return EXIT_SUCCESS;
+        const double frames = stats.iterations;
+        std::cout << std::format("{} iterations: {:.3f} ms average, {:.3f} ms min, {:.3f} ms max CPU submission\n",
+                                 stats.iterations, toMs(stats.totalTime) / frames, toMs(stats.minTime),
+                                 toMs(stats.maxTime));
+        std::cout << std::format("Per frame: {:.1f} draw calls, {:.1f} shader binds, {:.1f} vertex array binds, "
+                                 "{:.1f} object uploads\n",
+                                 static_cast<double>(stats.drawStats.drawCalls) / frames,
+                                 static_cast<double>(stats.drawStats.shaderBinds) / frames,
+                                 static_cast<double>(stats.drawStats.vertexArrayBinds) / frames,
+                                 static_cast<double>(stats.drawStats.objectUploads) / frames);
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS) {
+            const NxHeadlessStats &headless = log.getStats();
+            std::cout << std::format("Backend per frame: {:.1f} texture binds, {:.1f} framebuffer binds, "
+                                     "{:.1f} storage buffer binds, {:.1f} uniform uploads, {:.1f} state changes, "
+                                     "{:.1f} uploaded bytes\n",
+                                     static_cast<double>(headless.textureBinds) / frames,
+                                     static_cast<double>(headless.framebufferBinds) / frames,
+                                     static_cast<double>(headless.storageBufferBinds) / frames,
+                                     static_cast<double>(headless.uniformUploads) / frames,
+                                     static_cast<double>(headless.stateChanges) / frames,
+                                     static_cast<double>(headless.uploadedBytes) / frames);
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Replay failed: " << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
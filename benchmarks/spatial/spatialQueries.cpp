@@ -0,0 +1,118 @@
+//// spatialQueries.cpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Benchmark of the dynamic bounding volume hierarchy queries against a linear scan
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/spatial/DynamicBvh.hpp"
+
+using namespace nexo::spatial;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    // Boxes of 0.5 to 2 units scattered in a cube of the given half size
+    std::vector<Aabb> randomBoxes(const size_t count, const float halfSize, const unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution position(-halfSize, halfSize);
+        std::uniform_real_distribution size(0.25f, 1.0f);
+        std::vector<Aabb> boxes;
+        boxes.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            const glm::vec3 center(position(rng), position(rng), position(rng));
+            const glm::vec3 extent(size(rng), size(rng), size(rng));
+            boxes.emplace_back(center - extent, center + extent);
+        }
+        return boxes;
+    }
+
+    double toMicroseconds(const Clock::duration duration, const size_t queryCount)
+    {
+        return std::chrono::duration<double, std::micro>(duration).count() / static_cast<double>(queryCount);
+    }
+
+}
+
+// The ids are synthetic: the ECS caps the number of entities below the default count
+int main(const int argc, char **argv)
+{
+    try {
+        const size_t entityCount = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+        const size_t queryCount = argc > 2 ? std::stoul(argv[2]) : 200;
+        const auto boxes = randomBoxes(entityCount, 1000.0f, 42);
+        const auto queries = randomBoxes(queryCount, 1000.0f, 11);
+
+        DynamicBvh bvh;
+        auto start = Clock::now();
+        for (size_t i = 0; i < boxes.size(); ++i)
+            bvh.insert(static_cast<nexo::ecs::Entity>(i), boxes[i]);
+        bvh.refit();
+        const auto buildTime = Clock::now() - start;
+        std::cout << std::format("{} entities inserted in {:.1f} ms, height {}\n", bvh.size(),
+                                 std::chrono::duration<double, std::milli>(buildTime).count(), bvh.height());
+
+        size_t treeHits = 0;
+        start = Clock::now();
+        for (const auto &query : queries)
+            treeHits += bvh.queryAabb(query.inflated(20.0f)).size();
+        const auto treeTime = Clock::now() - start;
+
+        size_t scanHits = 0;
+        start = Clock::now();
+        for (const auto &query : queries) {
+            const Aabb region = query.inflated(20.0f);
+            for (const auto &box : boxes)
+                scanHits += box.inflated(DynamicBvh::DEFAULT_MARGIN).overlaps(region);
+        }
+        const auto scanTime = Clock::now() - start;
+
+        size_t rayHits = 0;
+        start = Clock::now();
+        for (const auto &query : queries)
+            rayHits += bvh.queryRay(query.center(), glm::normalize(-query.center()), 500.0f).size();
+        const auto rayTime = Clock::now() - start;
+
+        start = Clock::now();
+        for (const auto &query : queries)
+            static_cast<void>(bvh.queryNearest(query.center(), 16));
+        const auto nearestTime = Clock::now() - start;
+
+        std::cout << std::format("Per query: {:.1f} us box ({} hits), {:.1f} us linear scan ({} hits), "
+                                 "{:.1f} us ray ({} hits), {:.1f} us 16 nearest\n",
+                                 toMicroseconds(treeTime, queryCount), treeHits, toMicroseconds(scanTime, queryCount),
+                                 scanHits, toMicroseconds(rayTime, queryCount), rayHits,
+                                 toMicroseconds(nearestTime, queryCount));
+        if (treeHits != scanHits) {
+            std::cerr << "The hierarchy and the linear scan disagree\n";
+            return EXIT_FAILURE;
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Benchmark failed: " << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
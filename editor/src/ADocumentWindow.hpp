@@ -37,6 +37,7 @@ namespace nexo::editor {
     #define NEXO_WND_USTRID_DEFAULT_SCENE "###Default Scene"
     #define NEXO_WND_USTRID_BOTTOM_BAR "###CommandsBar"
     #define NEXO_WND_USTRID_TEST "###TestWindow"
+    #define NEXO_WND_USTRID_ECS_STATS "###EcsStats"
     #define NEXO_WND_USTRID_GAME_WINDOW "###GameWindow"
 
     class ADocumentWindow : public IDocumentWindow {
@@ -36,6 +36,7 @@ namespace nexo::editor {
             case assets::AssetType::SCRIPT:
             case assets::AssetType::SHADER:
             case assets::AssetType::SOUND:
+            case assets::AssetType::PREFAB:
             default:
                 return IM_COL32(0, 0, 0, 0);
         }
@@ -0,0 +1,181 @@
+//// Show.cpp /////////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the ECS statistics window rendering
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "EcsStatsWindow.hpp"
+#include "Application.hpp"
+#include "core/memory/FrameArena.hpp"
+
+#include <algorithm>
+#include <format>
+#include <imgui.h>
+
+namespace nexo::editor {
+
+    static std::string formatBytes(const size_t bytes)
+    {
+        if (bytes >= 1024 * 1024)
+            return std::format("{:.2f} MiB", static_cast<double>(bytes) / (1024.0 * 1024.0));
+        if (bytes >= 1024)
+            return std::format("{:.1f} KiB", static_cast<double>(bytes) / 1024.0);
+        return std::format("{} B", bytes);
+    }
+
+    static void counterCell(const uint64_t total, const uint64_t previous)
+    {
+        if (total > previous)
+            ImGui::Text("%llu (+%llu)", static_cast<unsigned long long>(total),
+                        static_cast<unsigned long long>(total - previous));
+        else
+            ImGui::Text("%llu", static_cast<unsigned long long>(total));
+    }
+
+    void EcsStatsWindow::renderComponentTable() const
+    {
+        constexpr ImGuiTableFlags flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV |
+                                          ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollX;
+        if (!ImGui::BeginTable("##EcsComponentStats", 9, flags))
+            return;
+        ImGui::TableSetupColumn("Component", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("Size");
+        ImGui::TableSetupColumn("Count");
+        ImGui::TableSetupColumn("Grouped");
+        ImGui::TableSetupColumn("Memory");
+        ImGui::TableSetupColumn("Inserts");
+        ImGui::TableSetupColumn("Removes");
+        ImGui::TableSetupColumn("Group moves");
+        ImGui::TableSetupColumn("Group swaps");
+        ImGui::TableHeadersRow();
+
+        for (const auto &[type, name, array] : m_current.components) {
+            const auto previous = std::ranges::find(m_previous.components, type, &ecs::ComponentTypeStats::type);
+            const ecs::ComponentArrayCounters last = previous != m_previous.components.end()
+                                                         ? previous->array.counters
+                                                         : ecs::ComponentArrayCounters{};
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(name.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", array.componentSize);
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu / %zu", array.count, array.capacity);
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", array.groupSize);
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(formatBytes(array.totalBytes()).c_str());
+            if (ImGui::IsItemHovered())
+                ImGui::SetTooltip("Data: %s\nSparse: %s\nDense: %s\nChange tracking: %s",
+                                  formatBytes(array.dataBytes).c_str(), formatBytes(array.sparseBytes).c_str(),
+                                  formatBytes(array.denseBytes).c_str(), formatBytes(array.trackerBytes).c_str());
+            ImGui::TableNextColumn();
+            counterCell(array.counters.inserts, last.inserts);
+            ImGui::TableNextColumn();
+            counterCell(array.counters.removes, last.removes);
+            ImGui::TableNextColumn();
+            counterCell(array.counters.groupMoves, last.groupMoves);
+            ImGui::TableNextColumn();
+            counterCell(array.counters.groupSwaps, last.groupSwaps);
+        }
+        ImGui::EndTable();
+    }
+
+    void EcsStatsWindow::renderGroupTable() const
+    {
+        constexpr ImGuiTableFlags flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV |
+                                          ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollX;
+        if (!ImGui::BeginTable("##EcsGroupStats", 7, flags))
+            return;
+        ImGui::TableSetupColumn("Group", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("Size");
+        ImGui::TableSetupColumn("Added");
+        ImGui::TableSetupColumn("Removed");
+        ImGui::TableSetupColumn("Sorts");
+        ImGui::TableSetupColumn("Partitions");
+        ImGui::TableSetupColumn("Rebuild time");
+        ImGui::TableHeadersRow();
+
+        for (const auto &group : m_current.groups) {
+            const auto previous = std::ranges::find_if(m_previous.groups, [&group](const ecs::GroupStats &other) {
+                return other.allSignature == group.allSignature && other.ownedSignature == group.ownedSignature;
+            });
+            const ecs::GroupCounters last = previous != m_previous.groups.end() ? previous->counters : ecs::GroupCounters{};
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(group.name.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", group.size);
+            ImGui::TableNextColumn();
+            counterCell(group.counters.entitiesAdded, last.entitiesAdded);
+            ImGui::TableNextColumn();
+            counterCell(group.counters.entitiesRemoved, last.entitiesRemoved);
+            ImGui::TableNextColumn();
+            counterCell(group.counters.sorts, last.sorts);
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu views, ", group.partitionViews);
+            ImGui::SameLine(0.0f, 0.0f);
+            counterCell(group.counters.partitionRebuilds, last.partitionRebuilds);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f ms (last %.3f ms)", group.counters.partitionRebuildMs, group.counters.lastPartitionRebuildMs);
+        }
+        ImGui::EndTable();
+    }
+
+    void EcsStatsWindow::show()
+    {
+        if (!ImGui::Begin(NEXO_WND_USTRID_ECS_STATS, &m_opened, ImGuiWindowFlags_None)) {
+            ImGui::End();
+            return;
+        }
+        beginRender(NEXO_WND_USTRID_ECS_STATS);
+
+        ImGui::Text("Living entities: %zu", m_current.livingEntities);
+        ImGui::SameLine();
+        ImGui::Text("| Component memory: %s", formatBytes(m_current.totalBytes()).c_str());
+        if (!m_current.countersEnabled)
+            ImGui::TextDisabled("Operation counters are compiled out (configure with -DNEXO_ECS_STATS=ON)");
+
+        const memory::LinearArena &frameArena = memory::FrameArena::get().previous();
+        ImGui::Text("Frame arena: %s / %s (peak %s)", formatBytes(frameArena.used()).c_str(),
+                    formatBytes(frameArena.capacity()).c_str(), formatBytes(frameArena.peak()).c_str());
+        if (memory::isAllocationTrackingEnabled()) {
+            const memory::AllocationStats &frameAllocations = Application::getInstance().getFrameAllocationStats();
+            ImGui::SameLine();
+            ImGui::Text("| Heap allocations last frame: %llu (%s)",
+                        static_cast<unsigned long long>(frameAllocations.allocations),
+                        formatBytes(frameAllocations.allocatedBytes).c_str());
+        }
+
+        ImGui::Checkbox("Pause", &m_paused);
+        ImGui::SameLine();
+        if (ImGui::Button("Reset counters")) {
+            Application::m_coordinator->resetStatCounters();
+            m_current = Application::m_coordinator->collectStats();
+            m_previous = m_current;
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Export JSON"))
+            exportJson();
+
+        ImGui::Separator();
+        if (ImGui::CollapsingHeader("Components", ImGuiTreeNodeFlags_DefaultOpen))
+            renderComponentTable();
+        if (ImGui::CollapsingHeader("Groups", ImGuiTreeNodeFlags_DefaultOpen))
+            renderGroupTable();
+
+        ImGui::End();
+    }
+}
@@ -147,16 +147,24 @@ namespace nexo::editor {
                 // Check if mouse is inside viewport
                 if (!(mx >= 0 && my >= 0 && mx < m_contentSize.x && my < m_contentSize.y))
                     return;
-                const int entityId = sampleEntityTexture(mx, my);
-                if (entityId != -1 && static_cast<ecs::Entity>(entityId) != m_entityHovered)
+                // Hovering reads the entity under the mouse every frame, the highlight follows a frame or two later
+                requestEntityPick(m_hoverPick, mx, my);
+                if (m_hoverPick->ready)
                 {
-                    m_entityHovered = static_cast<ecs::Entity>(entityId);
-                    Application::m_coordinator->addComponent(m_entityHovered, components::SelectedTag{});
-                }
-                if (entityId == -1 && m_entityHovered != ecs::INVALID_ENTITY)
-                {
-                    Application::m_coordinator->removeComponent<components::SelectedTag>(m_entityHovered);
-                    m_entityHovered = ecs::INVALID_ENTITY;
+                    m_hoverPick->ready = false;
+                    const int entityId = m_hoverPick->entityId;
+                    if (entityId != -1 && static_cast<ecs::Entity>(entityId) != m_entityHovered)
+                    {
+                        if (m_entityHovered != ecs::INVALID_ENTITY)
+                            Application::m_coordinator->removeComponent<components::SelectedTag>(m_entityHovered);
+                        m_entityHovered = static_cast<ecs::Entity>(entityId);
+                        Application::m_coordinator->addComponent(m_entityHovered, components::SelectedTag{});
+                    }
+                    if (entityId == -1 && m_entityHovered != ecs::INVALID_ENTITY)
+                    {
+                        Application::m_coordinator->removeComponent<components::SelectedTag>(m_entityHovered);
+                        m_entityHovered = ecs::INVALID_ENTITY;
+                    }
                 }
                 if (!assetPayload->IsDelivery())
                 {
@@ -24,6 +24,7 @@
 #include "Definitions.hpp"
 #include "inputs/WindowState.hpp"
 #include "core/scene/SceneManager.hpp"
+#include "renderer/Framebuffer.hpp"
 #include "../PopupManager.hpp"
 #include "ImNexo/Widgets.hpp"
 #include "DocumentWindows/AssetManager/AssetManagerWindow.hpp"
@@ -110,6 +111,22 @@ namespace nexo::editor
 
         ecs::Entity m_entityHovered = ecs::INVALID_ENTITY;
 
+        /**
+         * @brief Entity id read back asynchronously from the entity attachment of the active camera.
+         *
+         * Shared with the read callback so a read completing after the window is gone stays harmless.
+         */
+        struct EntityPick {
+            bool pending = false;
+            bool ready = false;
+            int entityId = -1;
+        };
+        std::shared_ptr<EntityPick> m_hoverPick = std::make_shared<EntityPick>();
+        std::shared_ptr<EntityPick> m_clickPick = std::make_shared<EntityPick>();
+        bool m_clickShiftPressed = false;
+        bool m_clickCtrlPressed = false;
+        std::shared_ptr<renderer::NxFramebuffer> m_pickTarget;
+
         int m_sceneId = -1;
         std::string m_sceneUuid;
         int m_activeCamera = -1;
@@ -155,6 +172,10 @@ namespace nexo::editor
         void selectAllCallback();
         void unhideAllCallback() const;
         void deleteCallback();
+        /**
+         * @brief Asks for a file and captures the next rendered frame to it, see `Application::captureNextFrame`.
+         */
+        static void captureFrameCallback();
 
         void setupGlobalState();
         void setupGizmoState();
@@ -314,6 +335,9 @@ namespace nexo::editor
         void handleDropTexture(const AssetDragDropPayload &payload) const;
         void handleDropMaterial(const AssetDragDropPayload &payload) const;
         int sampleEntityTexture(float mx, float my) const;
+        void requestEntityPick(const std::shared_ptr<EntityPick> &pick, float mx, float my);
+        void pollEntityPicks() const;
+        void selectPickedEntity(int entityId, bool isShiftPressed, bool isCtrlPressed);
         static ecs::Entity findRootParent(ecs::Entity entityId);
         void selectEntityHierarchy(ecs::Entity entityId, bool isCtrlPressed);
         void selectModelChildren(const std::vector<ecs::Entity>& children, bool isCtrlPressed);
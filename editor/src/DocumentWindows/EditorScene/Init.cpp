@@ -56,9 +56,7 @@ namespace nexo::editor
                                                                 renderTarget));
         auto& cameraComponent = Application::m_coordinator->getComponent<components::CameraComponent>(m_editorCamera);
         cameraComponent.render = true;
-        auto maskPass = std::make_shared<renderer::MaskPass>(
-                                static_cast<unsigned int>(m_contentSize.x),
-                                static_cast<unsigned int>(m_contentSize.y));
+        auto maskPass = std::make_shared<renderer::MaskPass>();
         auto outlinePass = std::make_shared<renderer::OutlinePass>();
         auto gridPass = std::make_shared<renderer::GridPass>();
 
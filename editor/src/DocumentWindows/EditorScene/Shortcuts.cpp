@@ -21,6 +21,8 @@
 #include "context/ActionManager.hpp"
 #include "components/Uuid.hpp"
 
+#include <tinyfiledialogs.h>
+
 namespace nexo::editor {
 
     static void hideCallback()
@@ -130,6 +132,24 @@ namespace nexo::editor {
         actionManager.recordAction(std::move(actionGroup));
     }
 
+    void EditorScene::captureFrameCallback()
+    {
+        const char *patterns[] = {"*.nxfc"};
+        const char *chosenPath = tinyfd_saveFileDialog(
+            "Capture Frame",
+            "FrameCapture.nxfc",
+            1,
+            patterns,
+            "Frame captures (*.nxfc)"
+        );
+        if (!chosenPath) {
+            LOG(NEXO_WARN, "Frame capture cancelled by user");
+            return;
+        }
+        getApp().captureNextFrame(chosenPath);
+        LOG(NEXO_INFO, "Next frame will be captured to {}", chosenPath);
+    }
+
     void EditorScene::setupGlobalState()
     {
         // ================= GLOBAL STATE =============================
@@ -175,6 +195,15 @@ namespace nexo::editor {
                 .onPressed([this]{ this->selectAllCallback(); })
                 .build()
         );
+
+        // Capture the next frame, to be replayed by the renderer benchmark
+        m_globalState.registerCommand(
+            Command::create()
+                .description("Capture frame")
+                .key("F12")
+                .onPressed(&captureFrameCallback)
+                .build()
+        );
     }
 
     void EditorScene::setupGizmoState()
@@ -35,6 +35,32 @@ namespace nexo::editor {
         return entityId;
     }
 
+    void EditorScene::requestEntityPick(const std::shared_ptr<EntityPick> &pick, const float mx, const float my)
+    {
+        if (pick->pending)
+            return;
+        const auto &coord = Application::m_coordinator;
+        const auto &cameraComponent = coord->getComponent<components::CameraComponent>(static_cast<ecs::Entity>(m_activeCamera));
+
+        // Reads still queued on the previous camera would never be polled again
+        if (m_pickTarget && m_pickTarget != cameraComponent.m_renderTarget)
+            m_pickTarget->pollPixelReads(true);
+        m_pickTarget = cameraComponent.m_renderTarget;
+
+        pick->pending = true;
+        m_pickTarget->readPixelAsync(1, static_cast<int>(mx), static_cast<int>(my), [pick](const int entityId) {
+            pick->entityId = entityId;
+            pick->pending = false;
+            pick->ready = true;
+        });
+    }
+
+    void EditorScene::pollEntityPicks() const
+    {
+        if (m_pickTarget)
+            m_pickTarget->pollPixelReads();
+    }
+
     static SelectionType getSelectionType(const int entityId)
     {
         const auto &coord = Application::m_coordinator;
@@ -163,11 +189,18 @@ namespace nexo::editor {
         // Check if mouse is inside viewport
         if (!(mx >= 0 && my >= 0 && mx < m_contentSize.x && my < m_contentSize.y))
             return;
-        const int entityId = sampleEntityTexture(mx, my);
+        if (m_clickPick->pending)
+            return;
 
-        // Check for multi-selection key modifiers
-        const bool isShiftPressed = ImGui::IsKeyDown(ImGuiKey_LeftShift) || ImGui::IsKeyDown(ImGuiKey_RightShift);
-        const bool isCtrlPressed = ImGui::IsKeyDown(ImGuiKey_LeftCtrl) || ImGui::IsKeyDown(ImGuiKey_RightCtrl);
+        // Check for multi-selection key modifiers, as they are when clicking
+        m_clickShiftPressed = ImGui::IsKeyDown(ImGuiKey_LeftShift) || ImGui::IsKeyDown(ImGuiKey_RightShift);
+        m_clickCtrlPressed = ImGui::IsKeyDown(ImGuiKey_LeftCtrl) || ImGui::IsKeyDown(ImGuiKey_RightCtrl);
+        // The selection is applied once the entity id is read back, without stalling on the GPU
+        requestEntityPick(m_clickPick, mx, my);
+    }
+
+    void EditorScene::selectPickedEntity(const int entityId, const bool isShiftPressed, const bool isCtrlPressed)
+    {
         auto &selector = Selector::get();
 
         if (entityId == -1) {
@@ -195,6 +228,11 @@ namespace nexo::editor {
         sceneInfo.viewportBounds[1] = glm::vec2{m_viewportBounds[1].x, m_viewportBounds[1].y};
         runEngine(sceneInfo);
 
+        pollEntityPicks();
+        if (m_clickPick->ready) {
+            m_clickPick->ready = false;
+            selectPickedEntity(m_clickPick->entityId, m_clickShiftPressed, m_clickCtrlPressed);
+        }
 
         // Handle mouse clicks for selection
         if (ImGui::IsMouseClicked(ImGuiMouseButton_Left) && !ImGuizmo::IsUsing() && m_focused)
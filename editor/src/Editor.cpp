@@ -25,10 +25,12 @@
 #include "Logger.hpp"
 #include "Path.hpp"
 #include "backends/ImGuiBackend.hpp"
+#include "renderer/ShaderHotReload.hpp"
 #include "IconsFontAwesome.h"
 #include "ImNexo/Elements.hpp"
 #include "context/ActionManager.hpp"
 #include "DocumentWindows/TestWindow/TestWindow.hpp"
+#include "DocumentWindows/EcsStatsWindow/EcsStatsWindow.hpp"
 
 #include <imgui_internal.h>
 #include "imgui.h"
@@ -42,12 +44,13 @@ namespace nexo::editor {
 
     void Editor::shutdown() const
     {
-        const Application& app = Application::getInstance();
+        Application& app = Application::getInstance();
 
         app.shutdownScripting();
         LOG(NEXO_INFO, "Closing editor");
         LOG(NEXO_INFO, "All windows destroyed");
         m_windowRegistry.shutdown();
+        app.shutdown();
         ImGuiBackend::shutdown();
     }
 
@@ -230,6 +233,7 @@ namespace nexo::editor {
 		setupEngine();
 		setupStyle();
 		m_windowRegistry.setup();
+        renderer::NxShaderHotReloader::get().watch();
 
         const Application& app = Application::getInstance();
         app.initScripting(); // TODO: scripting is init here since it requires a scene, later scenes shouldn't be created in the editor window
@@ -253,6 +257,17 @@ namespace nexo::editor {
 
                 ImGui::EndMenu();
             }
+            if (ImGui::BeginMenu("Rendering"))
+            {
+                auto &app = getApp();
+                if (ImGui::MenuItem("Threaded rendering", nullptr, app.isThreadedRendering(),
+                                    app.getWindow()->supportsContextHandoff()))
+                    app.setThreadedRendering(!app.isThreadedRendering());
+                auto &renderContext = Application::m_coordinator->getSingletonComponent<components::RenderContext>();
+                ImGui::MenuItem("Selection bounds", nullptr, &renderContext.showSelectionBounds);
+
+                ImGui::EndMenu();
+            }
             ImGui::EndMainMenuBar();
         }
     }
@@ -352,6 +367,15 @@ namespace nexo::editor {
                 getWindow<TestWindow>(NEXO_WND_USTRID_TEST).lock()->setup();
             }
         }
+        if (ImGui::IsKeyDown(ImGuiKey_LeftCtrl) && ImGui::IsKeyDown(ImGuiKey_LeftShift) && ImGui::IsKeyPressed(ImGuiKey_E))
+        {
+            if (const auto statsWindow = getWindow<EcsStatsWindow>(NEXO_WND_USTRID_ECS_STATS).lock()) {
+                statsWindow->setOpened(true);
+            } else {
+                registerWindow<EcsStatsWindow>(NEXO_WND_USTRID_ECS_STATS);
+                getWindow<EcsStatsWindow>(NEXO_WND_USTRID_ECS_STATS).lock()->setup();
+            }
+        }
     }
 
     std::vector<CommandInfo> Editor::handleFocusedWindowCommands()
@@ -21,6 +21,7 @@
 #include <core/event/SignalEvent.hpp>
 #include <glad/glad.h>
 #include <sys/types.h>
+#include <boost/uuid/uuid_io.hpp>
 
 #include "Renderer3D.hpp"
 #include "components/BillboardMesh.hpp"
@@ -28,6 +29,7 @@
 #include "components/Light.hpp"
 #include "components/Model.hpp"
 #include "components/Name.hpp"
+#include "components/Occluder.hpp"
 #include "components/Parent.hpp"
 #include "components/RenderContext.hpp"
 #include "components/SceneComponents.hpp"
@@ -38,10 +40,20 @@
 #include "components/Render.hpp"
 #include "components/MaterialComponent.hpp"
 #include "core/event/Input.hpp"
+#include "core/memory/FrameArena.hpp"
 #include "Timestep.hpp"
+#include "assets/AssetCatalog.hpp"
+#include "assets/Assets/Model/Model.hpp"
+#include "assets/Assets/Texture/Texture.hpp"
 #include "exceptions/Exceptions.hpp"
 #include "renderer/RendererExceptions.hpp"
+#include "renderer/FrameCapture.hpp"
+#include "renderer/GraphicsApi.hpp"
 #include "renderer/Renderer.hpp"
+#include "renderer/RenderTargetPool.hpp"
+#include "renderer/RenderThread.hpp"
+#include "renderer/ShaderHotReload.hpp"
+#include "renderer/TextureUploadQueue.hpp"
 #include "scripting/native/Scripting.hpp"
 #include "systems/CameraSystem.hpp"
 #include "systems/RenderBillboardSystem.hpp"
@@ -49,6 +61,7 @@
 #include "systems/TransformHierarchySystem.hpp"
 #include "systems/TransformMatrixSystem.hpp"
 #include "systems/ScriptingSystem.hpp"
+#include "systems/SpatialIndexSystem.hpp"
 #include "systems/lights/DirectionalLightsSystem.hpp"
 #include "systems/lights/PointLightsSystem.hpp"
 
@@ -57,6 +70,49 @@ std::shared_ptr<nexo::ecs::Coordinator> nexo::Application::m_coordinator = nullp
 
 namespace nexo {
 
+    namespace {
+
+        void annotateMeshNode(renderer::NxFrameCapture &capture, const assets::MeshNode &node, const std::string &assetId)
+        {
+            for (const auto &mesh : node.meshes) {
+                if (mesh.vao)
+                    capture.annotateMesh(mesh.vao->getId(), mesh.range, assetId);
+                for (const auto &lod : mesh.lods) {
+                    if (lod.vao)
+                        capture.annotateMesh(lod.vao->getId(), lod.range, assetId);
+                }
+            }
+            for (const auto &child : node.children)
+                annotateMeshNode(capture, child, assetId);
+        }
+
+        // Records the packet before it is submitted, the pipelines still hold the graph the frame was built with
+        void saveFrameCapture(const renderer::NxRenderPacket &packet, const std::filesystem::path &path)
+        {
+            try {
+                renderer::NxFrameCapture capture = renderer::NxFrameCapture::record(packet);
+                const auto &catalog = assets::AssetCatalog::getInstance();
+                for (const auto &ref : catalog.getAssetsOfType<assets::Model>()) {
+                    const auto model = ref.lock();
+                    if (model && model->getData())
+                        annotateMeshNode(capture, *model->getData(), boost::uuids::to_string(model->getID()));
+                }
+                for (const auto &ref : catalog.getAssetsOfType<assets::Texture>()) {
+                    const auto texture = ref.lock();
+                    if (texture && texture->getData() && texture->getData()->texture)
+                        capture.annotateTexture(texture->getData()->texture->getId(),
+                                                boost::uuids::to_string(texture->getID()));
+                }
+                capture.save(path);
+                LOG(NEXO_INFO, "Frame captured to {} ({} views, {} meshes, {} textures)", path.string(),
+                    capture.views.size(), capture.meshes.size(), capture.textures.size());
+            } catch (const std::exception &e) {
+                LOG(NEXO_ERROR, "Frame capture failed: {}", e.what());
+            }
+        }
+
+    }
+
     void Application::registerAllDebugListeners()
     {
         m_eventManager->registerListener<event::EventKey>(this);
@@ -104,6 +160,8 @@ namespace nexo {
         m_coordinator->setRestoreComponent<components::EditorCameraTag>();
         m_coordinator->registerComponent<components::SelectedTag>();
         m_coordinator->registerComponent<components::StaticMeshComponent>();
+        m_coordinator->registerComponent<components::OccluderComponent>();
+        m_coordinator->setRestoreComponent<components::OccluderComponent>();
         m_coordinator->registerComponent<components::ParentComponent>();
         m_coordinator->registerComponent<components::ModelComponent>();
         m_coordinator->registerComponent<components::BillboardComponent>();
@@ -112,6 +170,25 @@ namespace nexo {
         m_coordinator->registerSingletonComponent<components::RenderContext>();
 
         m_coordinator->registerComponent<components::PhysicsBodyComponent>();
+
+        // Entity references and identities have to be rewritten when a template is instantiated
+        m_coordinator->setInstantiateHook<components::ParentComponent>(
+            [](components::ParentComponent &parent, const ecs::EntityRemap &remap) {
+                parent.parent = remap(parent.parent);
+            });
+        m_coordinator->setInstantiateHook<components::TransformComponent>(
+            [](components::TransformComponent &transform, const ecs::EntityRemap &remap) {
+                for (ecs::Entity &child : transform.children)
+                    child = remap(child);
+            });
+        m_coordinator->setInstantiateHook<components::PerspectiveCameraTarget>(
+            [](components::PerspectiveCameraTarget &target, const ecs::EntityRemap &remap) {
+                target.targetEntity = remap(target.targetEntity);
+            });
+        m_coordinator->setInstantiateHook<components::UuidComponent>(
+            [](components::UuidComponent &uuid, const ecs::EntityRemap &) {
+                uuid.uuid = components::genUuid();
+            });
     }
 
     void Application::registerWindowCallbacks() const
@@ -220,6 +297,7 @@ namespace nexo {
         m_transformHierarchySystem = m_coordinator->registerGroupSystem<system::TransformHierarchySystem>();
         m_transformMatrixSystem = m_coordinator->registerQuerySystem<system::TransformMatrixSystem>();
         m_physicsSystem = m_coordinator->registerQuerySystem<system::PhysicsSystem>();
+        m_spatialIndexSystem = m_coordinator->registerQuerySystem<system::SpatialIndexSystem>();
         m_physicsSystem->init();
 
         auto pointLightSystem = m_coordinator->registerGroupSystem<system::PointLightsSystem>();
@@ -281,12 +359,15 @@ namespace nexo {
         m_window->setDarkMode(true);
 
 #ifdef NX_GRAPHICS_API_OPENGL
-        if (!gladLoadGLLoader((GLADloadproc) glfwGetProcAddress))
+        if (renderer::NxGetGraphicsApi() == renderer::NxGraphicsApi::OPENGL)
         {
-            THROW_EXCEPTION(renderer::NxGraphicsApiInitFailure, "Failed to initialize OpenGL context with glad");
+            if (!gladLoadGLLoader((GLADloadproc) glfwGetProcAddress))
+            {
+                THROW_EXCEPTION(renderer::NxGraphicsApiInitFailure, "Failed to initialize OpenGL context with glad");
+            }
+            LOG(NEXO_INFO, "OpenGL context initialized with glad");
+            glViewport(0, 0, static_cast<int>(m_window->getWidth()), static_cast<int>(m_window->getHeight()));
         }
-        LOG(NEXO_INFO, "OpenGL context initialized with glad");
-        glViewport(0, 0, static_cast<int>(m_window->getWidth()), static_cast<int>(m_window->getHeight()));
 #endif
 
         renderer::NxRenderer::init();
@@ -294,23 +375,36 @@ namespace nexo {
         m_coordinator->init();
         registerEcsComponents();
         renderer::NxRenderer3D::get().init();
+        m_renderThread = std::make_unique<renderer::NxRenderThread>(m_window);
         registerSystems();
         m_SceneManager.setCoordinator(m_coordinator);
 
         LOG(NEXO_DEV, "Application initialized");
     }
 
+    void Application::shutdown()
+    {
+        if (m_renderThread)
+            m_renderThread->stop();
+        renderer::NxTextureUploadQueue::get().shutdown();
+        LOG(NEXO_DEV, "Application shut down");
+    }
+
     void Application::beginFrame()
     {
-	    const auto time = glfwGetTime();
+	    const auto time = m_window->getTime();
         m_worldState.time.deltaTime = time - m_worldState.time.totalTime;
         m_worldState.time.totalTime = time;
         m_worldState.stats.frameCount += 1;
+        m_frameAllocationStart = memory::getAllocationStats();
+        renderer::NxTextureUploadQueue::get().processUploads();
+        renderer::NxShaderHotReloader::get().processReloads();
     }
 
     void Application::run(const SceneInfo &sceneInfo)
     {
        	auto &renderContext = m_coordinator->getSingletonComponent<components::RenderContext>();
+        bool presented = false;
 
         if (isInPlayMode()) {
             m_scriptingSystem->update();
@@ -329,16 +423,27 @@ namespace nexo {
 			{
                 m_transformMatrixSystem->update();
                 m_transformHierarchySystem->update();
+                m_spatialIndexSystem->update();
 				m_cameraContextSystem->update();
 				m_lightSystem->update();
 				m_renderCommandSystem->update();
 				m_renderBillboardSystem->update();
+
+				renderer::NxRenderPacket packet;
 				for (auto &camera : renderContext.cameras)
-				    camera.pipeline.execute();
-				// We have to unbind after the whole pipeline since multiple passes can use the same textures
-				// but we cant bind everything beforehand since a resize can be triggered and invalidate the whole state
-                renderer::NxRenderer3D::get().unbindTextures();
-                
+				    packet.addView(*camera.pipeline);
+				packet.textures = renderer::NxRenderer3D::get().takeTextureSlots();
+				if (sceneInfo.renderingType == RenderingType::WINDOW) {
+				    packet.presentWindow = m_window;
+				    presented = true;
+				}
+				if (m_frameCapturePath) {
+				    saveFrameCapture(packet, *m_frameCapturePath);
+				    m_frameCapturePath.reset();
+				}
+				// Executed right away, or by the render thread while the physics and camera controllers run
+				m_renderThread->submit(std::move(packet));
+
                 if (isInPlayMode()) {
                     m_physicsSystem->update();
                 }
@@ -349,9 +454,14 @@ namespace nexo {
 			}
         }
 
-        // Update (swap buffers and poll events)
-        if (sceneInfo.renderingType == RenderingType::WINDOW)
-            m_window->onUpdate();
+        // Update (swap buffers and poll events), the buffers are swapped by the render packet when one was submitted
+        if (sceneInfo.renderingType == RenderingType::WINDOW) {
+            if (!presented)
+                m_window->swapBuffers();
+            m_window->pollEvents();
+        }
+        // Event listeners and the callers of run can issue graphics calls right after, the context is handed back here
+        m_renderThread->sync();
         m_eventManager->dispatchEvents();
         renderContext.reset();
         if (m_displayProfileResult)
@@ -361,6 +471,40 @@ namespace nexo {
     void Application::endFrame()
     {
     	m_eventManager->clearEvents();
+        m_coordinator->advanceTick();
+        m_frameAllocationStats = memory::getAllocationStats() - m_frameAllocationStart;
+        memory::FrameArena::get().endFrame();
+        renderer::NxRenderTargetPool::get().endFrame();
+    }
+
+    void Application::setThreadedRendering(const bool enabled)
+    {
+        if (enabled == m_renderThread->isRunning())
+            return;
+        if (enabled && !m_window->supportsContextHandoff()) {
+            LOG(NEXO_WARN, "Threaded rendering is not supported by this window");
+            return;
+        }
+        if (enabled)
+            m_renderThread->start();
+        else
+            m_renderThread->stop();
+        LOG(NEXO_DEV, "Threaded rendering {}", enabled ? "enabled" : "disabled");
+    }
+
+    void Application::setGameState(const GameState state)
+    {
+        if (state == m_gameState)
+            return;
+        if (state == GameState::PLAY_MODE) {
+            m_playModeSnapshot = m_coordinator->captureWorld();
+        } else if (m_playModeSnapshot) {
+            m_coordinator->restoreWorld(*m_playModeSnapshot);
+            m_playModeSnapshot.reset();
+            m_SceneManager.refreshSceneEntities();
+            m_physicsSystem->rebuildBodies();
+        }
+        m_gameState = state;
     }
 
     ecs::Entity Application::createEntity() const
@@ -18,13 +18,16 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <filesystem>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <glad/glad.h>
 
 #include "Types.hpp"
 #include "renderer/Window.hpp"
+#include "renderer/RenderThread.hpp"
 #include "core/event/WindowEvent.hpp"
 #include "core/event/SignalEvent.hpp"
 #include "ecs/Coordinator.hpp"
@@ -32,6 +35,7 @@
 #include "Logger.hpp"
 #include "Timer.hpp"
 #include "WorldState.hpp"
+#include "core/memory/AllocationCounter.hpp"
 #include "components/Light.hpp"
 #include "components/PhysicsBodyComponent.hpp"
 
@@ -42,6 +46,7 @@
 #include "systems/TransformHierarchySystem.hpp"
 #include "systems/TransformMatrixSystem.hpp"
 #include "systems/PhysicsSystem.hpp"
+#include "systems/SpatialIndexSystem.hpp"
 
 #define NEXO_PROFILE(name) nexo::Timer timer##__LINE__(name, [&](ProfileResult profileResult) {m_profileResults.push_back(profileResult); })
 
@@ -84,10 +89,18 @@ namespace nexo {
 
             void init();
 
+            /**
+             * @brief Releases the graphics resources held outside of the scenes, while the graphics context is alive.
+             *
+             * Stops the render thread and shuts the texture upload queue down, to call once the application stops
+             * rendering.
+             */
+            void shutdown();
+
             /**
              * @brief Begins a new frame by updating the timestep.
              *
-             * Calculates the time elapsed since the last frame using glfwGetTime()
+             * Calculates the time elapsed since the last frame using the window clock (`NxWindow::getTime`)
              * and updates the current timestep. Also updates the last frame time.
              */
             void beginFrame();
@@ -106,7 +119,8 @@ namespace nexo {
              * This function performs the following steps:
              *  - Retrieves the RenderContext singleton and sets the current scene to be rendered.
              *  - If the application window is not minimized:
-             *      - If the scene is marked as rendered, it updates the camera context, light, and render systems.
+             *      - If the scene is marked as rendered, it updates the camera context, light, and render systems,
+             *        then submits the render packet of its cameras (see `setThreadedRendering`).
              *      - If the scene is active, it updates the perspective camera controller system.
              *  - Depending on the rendering type, it triggers a window update (swaps buffers and polls events).
              *  - Dispatches events via the EventManager.
@@ -123,7 +137,8 @@ namespace nexo {
              * @brief Ends the current frame by clearing processed events.
              *
              * Clears all the events that have been dispatched during the frame,
-             * preparing the EventManager for the next frame.
+             * preparing the EventManager for the next frame, advances the ECS change tick,
+             * records the heap allocations of the frame and flips the frame arena.
              */
             void endFrame();
 
@@ -204,6 +219,10 @@ namespace nexo {
                 return m_physicsSystem;
             }
 
+            std::shared_ptr<system::SpatialIndexSystem> getSpatialIndexSystem() const {
+                return m_spatialIndexSystem;
+            }
+
             /**
              * @brief Deletes an existing entity.
              *
@@ -246,12 +265,54 @@ namespace nexo {
             [[nodiscard]] bool isWindowOpen() const { return m_window->isOpen(); }
             [[nodiscard]] WorldState &getWorldState() { return m_worldState; }
 
+            /**
+             * @brief Heap allocations made between the last beginFrame/endFrame pair.
+             *
+             * Only counted when the engine is built with NEXO_TRACK_ALLOCATIONS (see `memory::getAllocationStats`),
+             * a steady-state frame is expected to report zero allocations.
+             */
+            [[nodiscard]] const memory::AllocationStats &getFrameAllocationStats() const { return m_frameAllocationStats; }
+
+            /**
+             * @brief Executes the render packets on a dedicated render thread instead of the main thread.
+             *
+             * The packet of a scene is then executed while its physics, camera controllers and window events update.
+             * `run` waits for the packet before returning, so the caller can keep issuing graphics calls (UI
+             * rendering, read backs...) after it. Disabled by default: there is a single packet in flight and the
+             * context goes back to the main thread at the end of every `run`, so only the physics and camera
+             * controllers overlap the rendering, which seldom pays for the context handoffs. Requires a window
+             * supporting the handoff (see `NxWindow::supportsContextHandoff`).
+             *
+             * @param enabled Whether the render thread should run.
+             */
+            void setThreadedRendering(bool enabled);
+            [[nodiscard]] bool isThreadedRendering() const { return m_renderThread && m_renderThread->isRunning(); }
+
+            [[nodiscard]] renderer::NxRenderThread::Stats getRenderThreadStats() const { return m_renderThread->getStats(); }
+
+            /**
+             * @brief Saves the render packet of the next rendered scene to a file, to be replayed by the benchmarks.
+             *
+             * The meshes and textures drawn are annotated with the id of the asset they come from, when there is one.
+             *
+             * @param path File the capture is written to, overwritten if it exists.
+             */
+            void captureNextFrame(const std::filesystem::path &path) { m_frameCapturePath = path; }
+
             int initScripting() const;
             int shutdownScripting() const;
 
             // Game state management
             GameState getGameState() const { return m_gameState; }
-            void setGameState(GameState state) { m_gameState = state; }
+            /**
+             * @brief Switches between editor and play mode.
+             *
+             * Entering play mode captures a snapshot of the ECS world, leaving it restores that
+             * snapshot so the scenes are back to their edited state.
+             *
+             * @param state The new game state.
+             */
+            void setGameState(GameState state);
             bool isInPlayMode() const { return m_gameState == GameState::PLAY_MODE; }
             bool isInEditorMode() const { return m_gameState == GameState::EDITOR_MODE; }
 
@@ -278,9 +339,12 @@ namespace nexo {
             bool m_isMinimized = false;
             bool m_displayProfileResult = true;
             std::shared_ptr<renderer::NxWindow> m_window;
+            std::unique_ptr<renderer::NxRenderThread> m_renderThread;
+            std::optional<std::filesystem::path> m_frameCapturePath;
 
             WorldState m_worldState;
             GameState m_gameState = GameState::EDITOR_MODE;
+            std::optional<ecs::WorldSnapshot> m_playModeSnapshot;
 
             int m_eventDebugFlags{};
 
@@ -294,8 +358,11 @@ namespace nexo {
             std::shared_ptr<system::RenderCommandSystem> m_renderCommandSystem;
             std::shared_ptr<system::RenderBillboardSystem> m_renderBillboardSystem;
             std::shared_ptr<system::PhysicsSystem> m_physicsSystem;
+            std::shared_ptr<system::SpatialIndexSystem> m_spatialIndexSystem;
 
             std::vector<ProfileResult> m_profilesResults;
+            memory::AllocationStats m_frameAllocationStart;
+            memory::AllocationStats m_frameAllocationStats;
 
     };
 }
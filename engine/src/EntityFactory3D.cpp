@@ -30,6 +30,9 @@
 #include "components/Uuid.hpp"
 #include "components/StaticMesh.hpp"
 #include "components/MaterialComponent.hpp"
+#include "components/Editor.hpp"
+#include "components/SceneComponents.hpp"
+#include "components/PhysicsBodyComponent.hpp"
 #include "assets/AssetCatalog.hpp"
 #include "Application.hpp"
 #include "math/Matrix.hpp"
@@ -49,6 +52,8 @@ namespace nexo
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getCubeVAO();
+        mesh.localMin = glm::vec3(-0.5f);
+        mesh.localMax = glm::vec3(0.5f);
 
         auto material = std::make_unique<components::Material>();
         material->albedoColor = color;
@@ -84,6 +89,8 @@ namespace nexo
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getCubeVAO();
+        mesh.localMin = glm::vec3(-0.5f);
+        mesh.localMax = glm::vec3(0.5f);
 
         const auto materialRef = assets::AssetCatalog::getInstance().createAsset<assets::Material>(
             assets::AssetLocation("_internal::CubeMat@_internal"),
@@ -493,6 +500,12 @@ namespace nexo
 
             components::StaticMeshComponent staticMesh;
             staticMesh.vao = mesh.vao;
+            staticMesh.localMin = mesh.localMin;
+            staticMesh.localMax = mesh.localMax;
+            staticMesh.lods = mesh.lods;
+            staticMesh.vertexDecode = mesh.vertexDecode;
+            staticMesh.range = mesh.range;
+            staticMesh.allocation = mesh.allocation;
 
             components::RenderComponent renderComponent;
             renderComponent.isRendered = true;
@@ -531,4 +544,57 @@ namespace nexo
 
         return totalChildrenCreated;
     }
+
+    ecs::EntityTemplate EntityFactory3D::createPrefab(const ecs::Entity root)
+    {
+        const auto &coordinator = Application::m_coordinator;
+        std::vector<ecs::Entity> hierarchy = {root};
+        for (size_t i = 0; i < hierarchy.size(); ++i) {
+            if (!coordinator->entityHasComponent<components::TransformComponent>(hierarchy[i]))
+                continue;
+            const auto &transform = coordinator->getComponent<components::TransformComponent>(hierarchy[i]);
+            hierarchy.insert(hierarchy.end(), transform.children.begin(), transform.children.end());
+        }
+
+        ecs::Signature excluded;
+        excluded.set(coordinator->getComponentType<components::SceneTag>());
+        excluded.set(coordinator->getComponentType<components::SelectedTag>());
+        excluded.set(coordinator->getComponentType<components::PhysicsBodyComponent>());
+        return coordinator->createTemplate(hierarchy, excluded);
+    }
+
+    std::vector<ecs::Entity> EntityFactory3D::instantiatePrefab(const ecs::EntityTemplate &prefab,
+                                                               const std::span<const glm::vec3> positions,
+                                                               const unsigned int sceneId)
+    {
+        const auto &coordinator = Application::m_coordinator;
+        std::vector<ecs::Entity> roots;
+        if (prefab.size() == 0 || positions.empty())
+            return roots;
+
+        // The scene tag is stamped on a copy of the template, so it is inserted with the other components
+        auto &scene = Application::getInstance().getSceneManager().getScene(sceneId);
+        ecs::EntityTemplate instanceTemplate = prefab;
+        coordinator->setTemplateComponent(instanceTemplate,
+                                          components::SceneTag{sceneId, scene.isActive(), scene.isRendered()});
+
+        const std::vector<ecs::Entity> entities = coordinator->instantiateTemplate(instanceTemplate, positions.size());
+        scene.addTaggedEntities(entities);
+        roots.reserve(positions.size());
+        for (size_t i = 0; i < positions.size(); ++i) {
+            const ecs::Entity root = entities[i * prefab.size()];
+            if (coordinator->entityHasComponent<components::TransformComponent>(root))
+                coordinator->getComponent<components::TransformComponent>(root).pos = positions[i];
+            roots.push_back(root);
+        }
+
+        // The root keeps the parent of the prefab source, which has to know about its new children
+        const auto parentComponent = coordinator->tryGetComponent<components::ParentComponent>(roots.front());
+        if (parentComponent && parentComponent->get().parent != ecs::INVALID_ENTITY) {
+            const auto parentTransform = coordinator->tryGetComponent<components::TransformComponent>(parentComponent->get().parent);
+            if (parentTransform)
+                parentTransform->get().children.insert(parentTransform->get().children.end(), roots.begin(), roots.end());
+        }
+        return roots;
+    }
 }
@@ -19,8 +19,11 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <span>
+#include <vector>
 
 #include "assets/Assets/Model/Model.hpp"
+#include "ecs/EntityTemplate.hpp"
 #include "components/Components.hpp"
 #include "components/Model.hpp"
 
@@ -201,5 +204,32 @@ namespace nexo
         static ecs::Entity createSphere(glm::vec3 pos, glm::vec3 size, glm::vec3 rotation,
                                         const components::Material& material,
                                         unsigned int nbSubdivision = 2);
+
+        /**
+         * @brief Captures an entity hierarchy into a prefab template.
+         *
+         * The root and all its descendants (following TransformComponent::children) are stored,
+         * the root always being the first entity of the template. Scene membership, editor selection
+         * and physics bodies are not part of the template.
+         *
+         * @param root The root entity of the hierarchy.
+         * @return ecs::EntityTemplate The template holding the components of the hierarchy.
+         */
+        static ecs::EntityTemplate createPrefab(ecs::Entity root);
+
+        /**
+         * @brief Instantiates a prefab once per position, in a single batch.
+         *
+         * Every node receives the SceneTag of the scene along with its other components. When the
+         * prefab root had a parent, each instance root is added to the children of that parent.
+         *
+         * @param prefab The template created with createPrefab.
+         * @param positions The position of each instance root, relative to its parent if it has one.
+         * @param sceneId The scene the instances are added to.
+         * @return std::vector<ecs::Entity> The root entity of each instance.
+         */
+        static std::vector<ecs::Entity> instantiatePrefab(const ecs::EntityTemplate &prefab,
+                                                          std::span<const glm::vec3> positions,
+                                                          unsigned int sceneId);
     };
 }
@@ -50,6 +50,7 @@ namespace nexo::assets {
         FONT,
         SHADER,
         SCRIPT,
+        PREFAB,
         _COUNT
     };
 
@@ -66,7 +67,8 @@ namespace nexo::assets {
         "MUSIC",
         "FONT",
         "SHADER",
-        "SCRIPT"
+        "SCRIPT",
+        "PREFAB"
     };
 
     static_assert(
@@ -0,0 +1,334 @@
+//// MeshOptimizer.cpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the mesh optimization functions
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <unordered_map>
+
+namespace nexo::assets {
+
+    namespace {
+
+        constexpr unsigned int NO_INDEX = UINT32_MAX;
+
+        // Scoring constants of Tom Forsyth's algorithm
+        constexpr float CACHE_DECAY_POWER = 1.5f;
+        constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+        constexpr float VALENCE_BOOST_SCALE = 2.0f;
+        constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+        struct VertexBytesHash {
+            size_t operator()(const renderer::NxVertex *vertex) const noexcept
+            {
+                // FNV-1a over the attributes, NxVertex only holds 4 byte members so it has no padding
+                const auto *bytes = reinterpret_cast<const unsigned char *>(vertex);
+                size_t hash = 14695981039346656037ull;
+                for (size_t i = 0; i < sizeof(renderer::NxVertex); ++i) {
+                    hash ^= bytes[i];
+                    hash *= 1099511628211ull;
+                }
+                return hash;
+            }
+        };
+
+        struct VertexBytesEqual {
+            bool operator()(const renderer::NxVertex *lhs, const renderer::NxVertex *rhs) const noexcept
+            {
+                return std::memcmp(lhs, rhs, sizeof(renderer::NxVertex)) == 0;
+            }
+        };
+
+        float forsythVertexScore(const int cachePosition, const unsigned int remainingTriangles)
+        {
+            if (remainingTriangles == 0)
+                return -1.0f;
+            float score = 0.0f;
+            if (cachePosition >= 0) {
+                // The vertices of the last triangle get a fixed score, so the next triangle does not reuse them all
+                if (cachePosition < 3) {
+                    score = LAST_TRIANGLE_SCORE;
+                } else {
+                    constexpr float scaler = 1.0f / static_cast<float>(VERTEX_CACHE_OPTIMIZE_SIZE - 3);
+                    score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scaler, CACHE_DECAY_POWER);
+                }
+            }
+            return score + VALENCE_BOOST_SCALE * std::pow(static_cast<float>(remainingTriangles), -VALENCE_BOOST_POWER);
+        }
+
+    }
+
+    size_t weldVertices(std::vector<renderer::NxVertex> &vertices, std::vector<unsigned int> &indices)
+    {
+        std::unordered_map<const renderer::NxVertex *, unsigned int, VertexBytesHash, VertexBytesEqual> unique;
+        unique.reserve(vertices.size());
+        std::vector<unsigned int> remap(vertices.size());
+        std::vector<renderer::NxVertex> welded;
+        welded.reserve(vertices.size());
+        for (size_t vertex = 0; vertex < vertices.size(); ++vertex) {
+            const auto [it, inserted] = unique.try_emplace(&vertices[vertex], static_cast<unsigned int>(welded.size()));
+            if (inserted)
+                welded.push_back(vertices[vertex]);
+            remap[vertex] = it->second;
+        }
+        for (unsigned int &index : indices)
+            index = remap[index];
+        vertices = std::move(welded);
+        return vertices.size();
+    }
+
+    void optimizeVertexCache(const std::span<unsigned int> indices, const size_t vertexCount)
+    {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0)
+            return;
+
+        // Live triangles of each vertex, emitted triangles are swapped out of the vertex range
+        std::vector<unsigned int> offsets(vertexCount + 1, 0);
+        for (const unsigned int index : indices)
+            ++offsets[index + 1];
+        std::inclusive_scan(offsets.begin(), offsets.end(), offsets.begin());
+        std::vector<unsigned int> remaining(vertexCount);
+        for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+            remaining[vertex] = offsets[vertex + 1] - offsets[vertex];
+        std::vector<unsigned int> adjacency(indices.size());
+        {
+            std::vector<unsigned int> cursor(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < indices.size(); ++i)
+                adjacency[cursor[indices[i]]++] = static_cast<unsigned int>(i / 3);
+        }
+
+        std::vector<int> cachePosition(vertexCount, -1);
+        std::vector<float> vertexScore(vertexCount);
+        for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+            vertexScore[vertex] = forsythVertexScore(-1, remaining[vertex]);
+        std::vector<float> triangleScore(triangleCount);
+        std::vector<uint8_t> emitted(triangleCount, 0);
+        unsigned int bestTriangle = 0;
+        for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+            triangleScore[triangle] = vertexScore[indices[triangle * 3]] + vertexScore[indices[triangle * 3 + 1]] +
+                                      vertexScore[indices[triangle * 3 + 2]];
+            if (triangleScore[triangle] > triangleScore[bestTriangle])
+                bestTriangle = static_cast<unsigned int>(triangle);
+        }
+
+        std::vector<unsigned int> output;
+        output.reserve(indices.size());
+        std::array<unsigned int, VERTEX_CACHE_OPTIMIZE_SIZE + 3> cache{};
+        std::array<unsigned int, VERTEX_CACHE_OPTIMIZE_SIZE + 3> nextCache{};
+        size_t cacheSize = 0;
+        size_t inputCursor = 0;
+
+        for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount) {
+            if (bestTriangle == NO_INDEX) {
+                // Nothing left around the cache, continue with the next triangle of the input order
+                while (emitted[inputCursor])
+                    ++inputCursor;
+                bestTriangle = static_cast<unsigned int>(inputCursor);
+            }
+            emitted[bestTriangle] = 1;
+            const std::array<unsigned int, 3> corners = {
+                indices[bestTriangle * 3], indices[bestTriangle * 3 + 1], indices[bestTriangle * 3 + 2]
+            };
+            output.insert(output.end(), corners.begin(), corners.end());
+
+            size_t nextCacheSize = 0;
+            for (const unsigned int vertex : corners) {
+                const unsigned int begin = offsets[vertex];
+                for (unsigned int i = begin; i < begin + remaining[vertex]; ++i) {
+                    if (adjacency[i] == bestTriangle) {
+                        std::swap(adjacency[i], adjacency[begin + remaining[vertex] - 1]);
+                        --remaining[vertex];
+                        break;
+                    }
+                }
+                if (std::find(nextCache.begin(), nextCache.begin() + nextCacheSize, vertex) == nextCache.begin() + nextCacheSize)
+                    nextCache[nextCacheSize++] = vertex;
+            }
+            for (size_t i = 0; i < cacheSize; ++i) {
+                if (std::ranges::find(corners, cache[i]) == corners.end())
+                    nextCache[nextCacheSize++] = cache[i];
+            }
+
+            // Rescore the vertices of the cache, including the ones it just evicted, and their live triangles
+            for (size_t i = 0; i < nextCacheSize; ++i) {
+                const unsigned int vertex = nextCache[i];
+                cachePosition[vertex] = i < VERTEX_CACHE_OPTIMIZE_SIZE ? static_cast<int>(i) : -1;
+                vertexScore[vertex] = forsythVertexScore(cachePosition[vertex], remaining[vertex]);
+            }
+            bestTriangle = NO_INDEX;
+            float bestScore = -1.0f;
+            for (size_t i = 0; i < nextCacheSize; ++i) {
+                const unsigned int vertex = nextCache[i];
+                for (unsigned int j = offsets[vertex]; j < offsets[vertex] + remaining[vertex]; ++j) {
+                    const unsigned int triangle = adjacency[j];
+                    const float score = vertexScore[indices[triangle * 3]] + vertexScore[indices[triangle * 3 + 1]] +
+                                        vertexScore[indices[triangle * 3 + 2]];
+                    triangleScore[triangle] = score;
+                    if (score > bestScore) {
+                        bestScore = score;
+                        bestTriangle = triangle;
+                    }
+                }
+            }
+
+            cacheSize = std::min<size_t>(nextCacheSize, VERTEX_CACHE_OPTIMIZE_SIZE);
+            std::copy_n(nextCache.begin(), cacheSize, cache.begin());
+        }
+
+        std::ranges::copy(output, indices.begin());
+    }
+
+    void optimizeOverdraw(const std::span<unsigned int> indices,
+                          const std::span<const renderer::NxVertex> vertices,
+                          const float threshold)
+    {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2)
+            return;
+
+        const float meshAcmr = analyzeVertexCache(indices, vertices.size()).acmr;
+
+        // Each cluster is simulated from a cold cache, as it will be once the clusters are reordered
+        std::vector<unsigned int> clusterStarts;
+        std::vector<unsigned int> cacheTime(vertices.size(), 0);
+        unsigned int time = VERTEX_CACHE_ANALYZE_SIZE + 1;
+        unsigned int clusterStartTime = time;
+        size_t clusterMisses = 0;
+        size_t clusterTriangles = 0;
+        for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+            const unsigned int triangleTime = time;
+            unsigned int misses = 0;
+            for (size_t corner = 0; corner < 3; ++corner) {
+                const unsigned int vertex = indices[triangle * 3 + corner];
+                if (cacheTime[vertex] < clusterStartTime || time - cacheTime[vertex] > VERTEX_CACHE_ANALYZE_SIZE) {
+                    cacheTime[vertex] = time++;
+                    ++misses;
+                }
+            }
+            // A triangle missing every vertex starts a new cluster for free
+            if (clusterTriangles == 0 || misses == 3) {
+                clusterStarts.push_back(static_cast<unsigned int>(triangle));
+                clusterStartTime = triangleTime;
+                clusterMisses = 0;
+                clusterTriangles = 0;
+            }
+            clusterMisses += misses;
+            ++clusterTriangles;
+            // Cheap enough already, cut here and let the next triangle start cold
+            if (static_cast<float>(clusterMisses) <= threshold * meshAcmr * static_cast<float>(clusterTriangles)) {
+                clusterTriangles = 0;
+                clusterStartTime = time;
+            }
+        }
+        clusterStarts.push_back(static_cast<unsigned int>(triangleCount));
+        const size_t clusterCount = clusterStarts.size() - 1;
+
+        // Area weighted centroids and normals, of the mesh and of each cluster
+        std::vector<glm::vec3> clusterCentroids(clusterCount, glm::vec3(0.0f));
+        std::vector<glm::vec3> clusterNormals(clusterCount, glm::vec3(0.0f));
+        glm::vec3 meshCentroid(0.0f);
+        float meshArea = 0.0f;
+        for (size_t cluster = 0; cluster < clusterCount; ++cluster) {
+            float clusterArea = 0.0f;
+            for (size_t triangle = clusterStarts[cluster]; triangle < clusterStarts[cluster + 1]; ++triangle) {
+                const glm::vec3 &a = vertices[indices[triangle * 3]].position;
+                const glm::vec3 &b = vertices[indices[triangle * 3 + 1]].position;
+                const glm::vec3 &c = vertices[indices[triangle * 3 + 2]].position;
+                const glm::vec3 normal = glm::cross(b - a, c - a);
+                const float area = glm::length(normal);
+                clusterCentroids[cluster] += (a + b + c) * (area / 3.0f);
+                clusterNormals[cluster] += normal;
+                clusterArea += area;
+            }
+            meshCentroid += clusterCentroids[cluster];
+            meshArea += clusterArea;
+            if (clusterArea > 0.0f)
+                clusterCentroids[cluster] /= clusterArea;
+        }
+        if (meshArea > 0.0f)
+            meshCentroid /= meshArea;
+
+        std::vector<float> occlusionPotential(clusterCount);
+        for (size_t cluster = 0; cluster < clusterCount; ++cluster) {
+            const float normalLength = glm::length(clusterNormals[cluster]);
+            occlusionPotential[cluster] = normalLength > 0.0f
+                ? glm::dot(clusterCentroids[cluster] - meshCentroid, clusterNormals[cluster] / normalLength)
+                : 0.0f;
+        }
+        std::vector<unsigned int> order(clusterCount);
+        std::iota(order.begin(), order.end(), 0u);
+        std::ranges::stable_sort(order, [&](const unsigned int lhs, const unsigned int rhs) {
+            return occlusionPotential[lhs] > occlusionPotential[rhs];
+        });
+
+        std::vector<unsigned int> output;
+        output.reserve(indices.size());
+        for (const unsigned int cluster : order) {
+            output.insert(output.end(),
+                          indices.begin() + clusterStarts[cluster] * 3,
+                          indices.begin() + clusterStarts[cluster + 1] * 3);
+        }
+        std::ranges::copy(output, indices.begin());
+    }
+
+    size_t optimizeVertexFetch(std::vector<renderer::NxVertex> &vertices, const std::span<unsigned int> indices)
+    {
+        std::vector<unsigned int> remap(vertices.size(), NO_INDEX);
+        unsigned int nextVertex = 0;
+        for (unsigned int &index : indices) {
+            if (remap[index] == NO_INDEX)
+                remap[index] = nextVertex++;
+            index = remap[index];
+        }
+        std::vector<renderer::NxVertex> reordered(nextVertex);
+        for (size_t vertex = 0; vertex < vertices.size(); ++vertex) {
+            if (remap[vertex] != NO_INDEX)
+                reordered[remap[vertex]] = vertices[vertex];
+        }
+        vertices = std::move(reordered);
+        return vertices.size();
+    }
+
+    VertexCacheStats analyzeVertexCache(const std::span<const unsigned int> indices,
+                                        const size_t vertexCount,
+                                        const unsigned int cacheSize)
+    {
+        VertexCacheStats stats;
+        // A vertex is in the cache while fewer than cacheSize vertices were transformed after it
+        std::vector<unsigned int> cacheTime(vertexCount, 0);
+        unsigned int time = cacheSize + 1;
+        for (const unsigned int index : indices) {
+            if (time - cacheTime[index] > cacheSize) {
+                cacheTime[index] = time++;
+                ++stats.transformedCount;
+            }
+        }
+        if (!indices.empty())
+            stats.acmr = static_cast<float>(stats.transformedCount) / static_cast<float>(indices.size() / 3);
+        if (vertexCount > 0)
+            stats.atvr = static_cast<float>(stats.transformedCount) / static_cast<float>(vertexCount);
+        return stats;
+    }
+
+}
@@ -0,0 +1,94 @@
+//// MeshOptimizer.hpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the mesh optimization functions
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "renderer/Renderer3D.hpp"
+
+#include <span>
+#include <vector>
+
+namespace nexo::assets {
+
+    // Size of the FIFO post transform cache simulated by analyzeVertexCache
+    constexpr unsigned int VERTEX_CACHE_ANALYZE_SIZE = 16;
+    // Size of the LRU cache modeled by optimizeVertexCache
+    constexpr unsigned int VERTEX_CACHE_OPTIMIZE_SIZE = 32;
+
+    struct VertexCacheStats {
+        size_t transformedCount = 0;    //< Vertices transformed, i.e. cache misses
+        float acmr = 0.0f;              //< Average cache miss ratio: transformed vertices per triangle, 0.5 at best
+        float atvr = 0.0f;              //< Average transform to vertex ratio: transformed vertices per vertex, 1 at best
+    };
+
+    /**
+     * @brief Merges the vertices whose attributes are bitwise identical.
+     *
+     * The vertices are compacted in first appearance order and the indices rewritten to match.
+     *
+     * @return The number of vertices left.
+     */
+    size_t weldVertices(std::vector<renderer::NxVertex> &vertices, std::vector<unsigned int> &indices);
+
+    /**
+     * @brief Reorders the triangles so consecutive ones reuse the vertices still in the post transform cache.
+     *
+     * Uses Tom Forsyth's linear speed vertex cache optimization: triangles are emitted greedily by a score favouring
+     * vertices recently used and vertices with few triangles left.
+     *
+     * @param indices Triangle list to reorder in place.
+     * @param vertexCount Number of vertices the indices reference.
+     */
+    void optimizeVertexCache(std::span<unsigned int> indices, size_t vertexCount);
+
+    /**
+     * @brief Reorders clusters of triangles to draw the ones likely to occlude the others first.
+     *
+     * The cache optimized order is cut in clusters where it restarts from cold vertices, or wherever the cluster so
+     * far is cheap enough for the cut to keep the cache miss ratio under the threshold. Clusters facing outward from
+     * the mesh centroid are drawn first (Sander et al., Fast Triangle Reordering for Vertex Locality and Reduced
+     * Overdraw).
+     *
+     * @param indices Cache optimized triangle list to reorder in place.
+     * @param vertices Vertices the indices reference.
+     * @param threshold Cache miss ratio allowed, relative to the one of the input order (1.05 allows 5% more).
+     */
+    void optimizeOverdraw(std::span<unsigned int> indices, std::span<const renderer::NxVertex> vertices, float threshold);
+
+    /**
+     * @brief Reorders the vertices in the order the triangles first use them, so vertex fetches are sequential.
+     *
+     * Vertices no triangle references are dropped and the indices are rewritten to match.
+     *
+     * @return The number of vertices left.
+     */
+    size_t optimizeVertexFetch(std::vector<renderer::NxVertex> &vertices, std::span<unsigned int> indices);
+
+    /**
+     * @brief Simulates a FIFO post transform cache over a triangle list.
+     *
+     * @param indices Triangle list to analyze.
+     * @param vertexCount Number of vertices the indices reference.
+     * @param cacheSize Number of entries of the simulated cache.
+     */
+    [[nodiscard]] VertexCacheStats analyzeVertexCache(std::span<const unsigned int> indices,
+                                                      size_t vertexCount,
+                                                      unsigned int cacheSize = VERTEX_CACHE_ANALYZE_SIZE);
+
+}
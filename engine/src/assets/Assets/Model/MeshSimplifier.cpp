@@ -0,0 +1,419 @@
+//// MeshSimplifier.cpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the mesh simplifier
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "MeshSimplifier.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
+namespace nexo::assets {
+
+    namespace {
+
+        enum class VertexKind : uint8_t {
+            MANIFOLD,   //< Interior vertex, collapses onto any neighbour
+            BORDER,     //< On an open edge, only collapses along the border
+            SEAM,       //< Position shared by two attribute sets, only collapses along the seam
+            LOCKED      //< Seam corner or non manifold vertex, never collapsed
+        };
+
+        // Weight of the planes keeping the borders in place, relative to the triangle planes
+        constexpr double BORDER_WEIGHT = 10.0;
+        // Cosine of the largest normal rotation a collapse may cause on the surrounding triangles
+        constexpr float MAX_FLIP_COS = 0.25f;
+        constexpr unsigned int MAX_PASSES = 128;
+
+        struct Quadric {
+            double a00 = 0.0, a11 = 0.0, a22 = 0.0, a01 = 0.0, a02 = 0.0, a12 = 0.0;
+            double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+            double c = 0.0;
+            double weight = 0.0;
+
+            void addPlane(const glm::vec3 &normal, const float distance, const double planeWeight)
+            {
+                const double x = normal.x;
+                const double y = normal.y;
+                const double z = normal.z;
+                const double d = distance;
+                a00 += planeWeight * x * x;
+                a11 += planeWeight * y * y;
+                a22 += planeWeight * z * z;
+                a01 += planeWeight * x * y;
+                a02 += planeWeight * x * z;
+                a12 += planeWeight * y * z;
+                b0 += planeWeight * x * d;
+                b1 += planeWeight * y * d;
+                b2 += planeWeight * z * d;
+                c += planeWeight * d * d;
+                weight += planeWeight;
+            }
+
+            void add(const Quadric &other)
+            {
+                a00 += other.a00;
+                a11 += other.a11;
+                a22 += other.a22;
+                a01 += other.a01;
+                a02 += other.a02;
+                a12 += other.a12;
+                b0 += other.b0;
+                b1 += other.b1;
+                b2 += other.b2;
+                c += other.c;
+                weight += other.weight;
+            }
+
+            // Weighted mean of the squared distances to the planes
+            [[nodiscard]] double error(const glm::vec3 &point) const
+            {
+                if (weight <= 0.0)
+                    return 0.0;
+                const double x = point.x;
+                const double y = point.y;
+                const double z = point.z;
+                const double sum = a00 * x * x + a11 * y * y + a22 * z * z
+                                 + 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z)
+                                 + 2.0 * (b0 * x + b1 * y + b2 * z) + c;
+                return std::max(sum, 0.0) / weight;
+            }
+        };
+
+        struct PositionKey {
+            std::array<uint32_t, 3> bits;
+
+            explicit PositionKey(const glm::vec3 &position)
+            {
+                // Positive and negative zero weld together
+                const glm::vec3 p = position + glm::vec3(0.0f);
+                std::memcpy(&bits[0], &p.x, sizeof(float));
+                std::memcpy(&bits[1], &p.y, sizeof(float));
+                std::memcpy(&bits[2], &p.z, sizeof(float));
+            }
+
+            bool operator==(const PositionKey &) const = default;
+        };
+
+        struct PositionKeyHash {
+            size_t operator()(const PositionKey &key) const noexcept
+            {
+                size_t hash = key.bits[0] * 73856093u;
+                hash ^= key.bits[1] * 19349663u;
+                hash ^= key.bits[2] * 83492791u;
+                return hash;
+            }
+        };
+
+        // Triangles around each position, in a single array
+        struct Adjacency {
+            std::vector<unsigned int> offsets;
+            std::vector<unsigned int> triangles;
+
+            void build(const std::span<const unsigned int> indices, const std::vector<unsigned int> &remap)
+            {
+                offsets.assign(remap.size() + 1, 0);
+                for (const unsigned int index : indices)
+                    ++offsets[remap[index] + 1];
+                for (size_t i = 1; i < offsets.size(); ++i)
+                    offsets[i] += offsets[i - 1];
+                triangles.resize(indices.size());
+                std::vector<unsigned int> cursor(offsets.begin(), offsets.end() - 1);
+                for (size_t i = 0; i < indices.size(); ++i)
+                    triangles[cursor[remap[indices[i]]]++] = static_cast<unsigned int>(i / 3);
+            }
+
+            [[nodiscard]] std::span<const unsigned int> around(const unsigned int position) const
+            {
+                return {triangles.data() + offsets[position], offsets[position + 1] - offsets[position]};
+            }
+        };
+
+        struct Collapse {
+            unsigned int source;
+            unsigned int target;
+            float error;
+        };
+
+        unsigned int countEdgeTriangles(const Adjacency &adjacency, const std::vector<unsigned int> &indices,
+                                        const std::vector<unsigned int> &remap,
+                                        const unsigned int a, const unsigned int b)
+        {
+            unsigned int count = 0;
+            for (const unsigned int triangle : adjacency.around(a)) {
+                for (unsigned int corner = 0; corner < 3; ++corner)
+                    count += remap[indices[triangle * 3 + corner]] == b;
+            }
+            return count;
+        }
+
+        std::vector<VertexKind> classifyVertices(const Adjacency &adjacency, const std::vector<unsigned int> &indices,
+                                                 const std::vector<unsigned int> &remap)
+        {
+            std::vector<VertexKind> kinds(remap.size(), VertexKind::LOCKED);
+            std::vector<unsigned int> attributes;
+            for (unsigned int position = 0; position < remap.size(); ++position) {
+                if (remap[position] != position || adjacency.around(position).empty())
+                    continue;
+                attributes.clear();
+                unsigned int openEdges = 0;
+                bool manifold = true;
+                for (const unsigned int triangle : adjacency.around(position)) {
+                    for (unsigned int corner = 0; corner < 3; ++corner) {
+                        const unsigned int index = indices[triangle * 3 + corner];
+                        if (remap[index] == position) {
+                            if (std::ranges::find(attributes, index) == attributes.end())
+                                attributes.push_back(index);
+                            const unsigned int next = remap[indices[triangle * 3 + (corner + 1) % 3]];
+                            const unsigned int edgeTriangles = countEdgeTriangles(adjacency, indices, remap, position, next);
+                            openEdges += edgeTriangles == 1;
+                            manifold &= edgeTriangles <= 2;
+                            const unsigned int previous = remap[indices[triangle * 3 + (corner + 2) % 3]];
+                            openEdges += countEdgeTriangles(adjacency, indices, remap, position, previous) == 1;
+                        }
+                    }
+                }
+                // An open edge has a single triangle, so it is counted once, interior edges never are
+                if (!manifold)
+                    kinds[position] = VertexKind::LOCKED;
+                else if (attributes.size() == 1)
+                    kinds[position] = openEdges == 0 ? VertexKind::MANIFOLD
+                                    : openEdges == 2 ? VertexKind::BORDER : VertexKind::LOCKED;
+                else if (attributes.size() == 2 && openEdges == 0)
+                    kinds[position] = VertexKind::SEAM;
+            }
+            return kinds;
+        }
+
+        bool flipsTriangle(const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c, const glm::vec3 &moved)
+        {
+            // a moves to moved, b and c stay
+            const glm::vec3 before = glm::cross(b - a, c - a);
+            const glm::vec3 after = glm::cross(b - moved, c - moved);
+            const float lengths = std::sqrt(glm::dot(before, before) * glm::dot(after, after));
+            return lengths == 0.0f || glm::dot(before, after) < MAX_FLIP_COS * lengths;
+        }
+
+    }
+
+    SimplifiedMesh simplifyMesh(const std::span<const glm::vec3> positions,
+                                const std::span<const unsigned int> indices,
+                                const size_t targetIndexCount,
+                                const float maxError)
+    {
+        SimplifiedMesh result;
+        result.indices.assign(indices.begin(), indices.end());
+        if (result.indices.size() <= targetIndexCount || positions.empty())
+            return result;
+
+        const auto vertexCount = static_cast<unsigned int>(positions.size());
+        // Every vertex is remapped to the first vertex at the same position, collapses move whole positions
+        std::vector<unsigned int> remap(vertexCount);
+        {
+            std::unordered_map<PositionKey, unsigned int, PositionKeyHash> firstAtPosition;
+            firstAtPosition.reserve(vertexCount);
+            for (unsigned int vertex = 0; vertex < vertexCount; ++vertex)
+                remap[vertex] = firstAtPosition.try_emplace(PositionKey(positions[vertex]), vertex).first->second;
+        }
+
+        auto &current = result.indices;
+        Adjacency adjacency;
+        adjacency.build(current, remap);
+        const std::vector<VertexKind> kinds = classifyVertices(adjacency, current, remap);
+
+        std::vector<Quadric> quadrics(vertexCount);
+        for (size_t i = 0; i < current.size(); i += 3) {
+            const std::array<unsigned int, 3> corners = {remap[current[i]], remap[current[i + 1]], remap[current[i + 2]]};
+            const glm::vec3 normal = glm::cross(positions[corners[1]] - positions[corners[0]],
+                                                positions[corners[2]] - positions[corners[0]]);
+            const float length = std::sqrt(glm::dot(normal, normal));
+            if (length == 0.0f)
+                continue;
+            const glm::vec3 unitNormal = normal / length;
+            const float distance = -glm::dot(unitNormal, positions[corners[0]]);
+            for (const unsigned int corner : corners)
+                quadrics[corner].addPlane(unitNormal, distance, length * 0.5f);
+
+            // Planes orthogonal to the open edges keep the borders from moving inward
+            for (unsigned int edge = 0; edge < 3; ++edge) {
+                const unsigned int a = corners[edge];
+                const unsigned int b = corners[(edge + 1) % 3];
+                if (countEdgeTriangles(adjacency, current, remap, a, b) != 1)
+                    continue;
+                const glm::vec3 direction = positions[b] - positions[a];
+                const glm::vec3 borderNormal = glm::cross(direction, unitNormal);
+                const float borderLength = std::sqrt(glm::dot(borderNormal, borderNormal));
+                if (borderLength == 0.0f)
+                    continue;
+                const glm::vec3 unitBorderNormal = borderNormal / borderLength;
+                const float borderDistance = -glm::dot(unitBorderNormal, positions[a]);
+                const double borderWeight = glm::dot(direction, direction) * BORDER_WEIGHT;
+                quadrics[a].addPlane(unitBorderNormal, borderDistance, borderWeight);
+                quadrics[b].addPlane(unitBorderNormal, borderDistance, borderWeight);
+            }
+        }
+
+        const double errorLimit = maxError == FLT_MAX ? DBL_MAX : static_cast<double>(maxError) * maxError;
+        double appliedError = 0.0;
+        std::vector<Collapse> candidates;
+        std::vector<unsigned int> collapseTarget(vertexCount);
+        std::vector<uint8_t> touched(vertexCount);
+        const size_t targetTriangleCount = targetIndexCount / 3;
+
+        for (unsigned int pass = 0; pass < MAX_PASSES && current.size() > targetIndexCount; ++pass) {
+            if (pass > 0)
+                adjacency.build(current, remap);
+
+            candidates.clear();
+            for (size_t i = 0; i < current.size(); ++i) {
+                const unsigned int a = remap[current[i]];
+                const unsigned int b = remap[current[i - i % 3 + (i % 3 + 1) % 3]];
+                Collapse best{a, b, FLT_MAX};
+                for (const auto &[source, target] : {std::pair{a, b}, std::pair{b, a}}) {
+                    const VertexKind sourceKind = kinds[source];
+                    const VertexKind targetKind = kinds[target];
+                    if (sourceKind == VertexKind::LOCKED ||
+                        (sourceKind == VertexKind::BORDER && targetKind != VertexKind::BORDER && targetKind != VertexKind::LOCKED) ||
+                        (sourceKind == VertexKind::SEAM && targetKind != VertexKind::SEAM && targetKind != VertexKind::LOCKED))
+                        continue;
+                    Quadric merged = quadrics[source];
+                    merged.add(quadrics[target]);
+                    const auto error = static_cast<float>(merged.error(positions[target]));
+                    if (error < best.error)
+                        best = {source, target, error};
+                }
+                if (best.error != FLT_MAX)
+                    candidates.push_back(best);
+            }
+            std::ranges::sort(candidates, {}, &Collapse::error);
+
+            for (unsigned int vertex = 0; vertex < vertexCount; ++vertex)
+                collapseTarget[vertex] = vertex;
+            std::ranges::fill(touched, 0);
+            size_t triangleCount = current.size() / 3;
+            bool collapsed = false;
+
+            for (const auto &[source, target, error] : candidates) {
+                if (error > errorLimit || triangleCount <= targetTriangleCount)
+                    break;
+                if (touched[source] || touched[target])
+                    continue;
+
+                // Each attribute set of the source moves to the attribute set of the target it shares an edge with
+                std::array<std::pair<unsigned int, unsigned int>, 2> wedges{};
+                unsigned int wedgeCount = 0;
+                unsigned int sharedTriangles = 0;
+                bool valid = true;
+                for (const unsigned int triangle : adjacency.around(source)) {
+                    unsigned int sourceIndex = 0;
+                    unsigned int targetIndex = UINT32_MAX;
+                    for (unsigned int corner = 0; corner < 3; ++corner) {
+                        const unsigned int index = current[triangle * 3 + corner];
+                        valid &= !touched[remap[index]];
+                        if (remap[index] == source)
+                            sourceIndex = index;
+                        else if (remap[index] == target)
+                            targetIndex = index;
+                    }
+                    auto wedge = std::ranges::find(wedges.begin(), wedges.begin() + wedgeCount, sourceIndex,
+                                                    &std::pair<unsigned int, unsigned int>::first);
+                    if (wedge == wedges.begin() + wedgeCount) {
+                        if (wedgeCount == wedges.size()) {
+                            valid = false;
+                            break;
+                        }
+                        *wedge = {sourceIndex, UINT32_MAX};
+                        ++wedgeCount;
+                    }
+                    if (targetIndex == UINT32_MAX)
+                        continue;
+                    ++sharedTriangles;
+                    if (wedge->second != UINT32_MAX && wedge->second != targetIndex)
+                        valid = false;
+                    wedge->second = targetIndex;
+                }
+                for (unsigned int i = 0; i < wedgeCount; ++i)
+                    valid &= wedges[i].second != UINT32_MAX;
+                // A seam collapse has to keep both sides apart, the others must follow an interior or border edge
+                if (kinds[source] == VertexKind::SEAM)
+                    valid &= wedgeCount == 2 && sharedTriangles == 2 && wedges[0].second != wedges[1].second;
+                else if (kinds[source] == VertexKind::BORDER)
+                    valid &= sharedTriangles == 1;
+                else
+                    valid &= sharedTriangles == 2;
+                if (!valid)
+                    continue;
+
+                bool flips = false;
+                for (const unsigned int triangle : adjacency.around(source)) {
+                    std::array<unsigned int, 3> corners{};
+                    unsigned int sourceCorner = 0;
+                    bool hasTarget = false;
+                    for (unsigned int corner = 0; corner < 3; ++corner) {
+                        corners[corner] = remap[current[triangle * 3 + corner]];
+                        sourceCorner = corners[corner] == source ? corner : sourceCorner;
+                        hasTarget |= corners[corner] == target;
+                    }
+                    if (hasTarget)
+                        continue;
+                    if (flipsTriangle(positions[source], positions[corners[(sourceCorner + 1) % 3]],
+                                      positions[corners[(sourceCorner + 2) % 3]], positions[target])) {
+                        flips = true;
+                        break;
+                    }
+                }
+                if (flips)
+                    continue;
+
+                for (unsigned int i = 0; i < wedgeCount; ++i)
+                    collapseTarget[wedges[i].first] = wedges[i].second;
+                quadrics[target].add(quadrics[source]);
+                appliedError = std::max(appliedError, static_cast<double>(error));
+                // The ring of the source changes shape, its collapses are reevaluated in the next pass
+                for (const unsigned int triangle : adjacency.around(source)) {
+                    for (unsigned int corner = 0; corner < 3; ++corner)
+                        touched[remap[current[triangle * 3 + corner]]] = 1;
+                }
+                triangleCount -= sharedTriangles;
+                collapsed = true;
+            }
+            if (!collapsed)
+                break;
+
+            size_t kept = 0;
+            for (size_t i = 0; i < current.size(); i += 3) {
+                const unsigned int a = collapseTarget[current[i]];
+                const unsigned int b = collapseTarget[current[i + 1]];
+                const unsigned int c = collapseTarget[current[i + 2]];
+                if (remap[a] == remap[b] || remap[b] == remap[c] || remap[a] == remap[c])
+                    continue;
+                current[kept++] = a;
+                current[kept++] = b;
+                current[kept++] = c;
+            }
+            current.resize(kept);
+        }
+
+        result.error = static_cast<float>(std::sqrt(appliedError));
+        return result;
+    }
+
+}
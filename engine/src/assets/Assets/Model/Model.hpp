@@ -21,6 +21,9 @@
 #include "VertexArray.hpp"
 #include "assets/Asset.hpp"
 #include "assets/Assets/Material/Material.hpp"
+#include "renderer/MeshLod.hpp"
+#include "renderer/MeshPool.hpp"
+#include "renderer/VertexFormat.hpp"
 
 namespace nexo::assets {
 
@@ -30,6 +33,13 @@ namespace nexo::assets {
         AssetRef<Material> material;
 
         glm::vec3 localCenter = {0.0f, 0.0f, 0.0f};
+        glm::vec3 localMin = {0.0f, 0.0f, 0.0f};
+        glm::vec3 localMax = {0.0f, 0.0f, 0.0f};
+
+        std::vector<renderer::NxMeshLod> lods; //< Simplified levels sharing the vertex buffer of vao, finest first
+        renderer::NxVertexDecode vertexDecode; //< Format of the vertex buffer of vao
+        renderer::NxMeshRange range; //< Part of vao holding the mesh, vao is shared with the meshes of its pool page
+        std::shared_ptr<const renderer::NxMeshAllocation> allocation; //< Place in the mesh pool, null outside of it
     };
 
     struct MeshNode {
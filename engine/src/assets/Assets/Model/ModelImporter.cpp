@@ -18,6 +18,7 @@
 
 #include "ModelImporter.hpp"
 
+#include <algorithm>
 #include <array>
 #include <iomanip>
 
@@ -27,12 +28,16 @@
 
 #include "Buffer.hpp"
 #include "VertexArray.hpp"
+#include "renderer/MeshPool.hpp"
 #include "Path.hpp"
 
 #include "assets/AssetImporterBase.hpp"
 #include "assets/Assets/Model/Model.hpp"
+#include "MeshOptimizer.hpp"
+#include "MeshSimplifier.hpp"
 #include "ModelParameters.hpp"
 #include "renderer/Renderer3D.hpp"
+#include "renderer/VertexFormat.hpp"
 
 #include "core/exceptions/Exceptions.hpp"
 
@@ -361,17 +366,6 @@ namespace nexo::assets {
 
     Mesh ModelImporter::processMesh(const AssetImporterContext& ctx, aiMesh* mesh, [[maybe_unused]] const aiScene* scene) const
     {
-        std::shared_ptr<renderer::NxVertexArray> vao = renderer::createVertexArray();
-        auto vertexBuffer = renderer::createVertexBuffer(mesh->mNumVertices * sizeof(renderer::NxVertex));
-        const renderer::NxBufferLayout cubeVertexBufferLayout = {
-            {renderer::NxShaderDataType::FLOAT3, "aPos"},
-            {renderer::NxShaderDataType::FLOAT2, "aTexCoord"},
-            {renderer::NxShaderDataType::FLOAT3, "aNormal"},
-            {renderer::NxShaderDataType::FLOAT3, "aTangent"},
-            {renderer::NxShaderDataType::FLOAT3, "aBiTangent"},
-            {renderer::NxShaderDataType::INT, "aEntityID"}
-        };
-        vertexBuffer->setLayout(cubeVertexBufferLayout);
         std::vector<renderer::NxVertex> vertices;
         std::vector<unsigned int> indices;
         vertices.reserve(mesh->mNumVertices);
@@ -407,18 +401,29 @@ namespace nexo::assets {
 
         glm::vec3 centerLocal = (minBB + maxBB) * 0.5f;
 
+        // Point and line primitives are kept as is, the optimizations only handle triangle lists
+        bool trianglesOnly = true;
         for (unsigned int i = 0; i < mesh->mNumFaces; i++)
         {
             const aiFace face = mesh->mFaces[i];
             indices.insert(indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
+            trianglesOnly &= face.mNumIndices == 3;
         }
 
-        vertexBuffer->setData(vertices.data(), static_cast<unsigned int>(vertices.size() * sizeof(renderer::NxVertex)));
-        vao->addVertexBuffer(vertexBuffer);
+        const auto params = ctx.getParameters<ModelImportParameters>();
+        if (trianglesOnly)
+            optimizeMesh(mesh->mName.C_Str(), vertices, indices, params);
+
+        const renderer::NxPackedVertices packedVertices = renderer::packVertices(vertices, params.vertexFormat);
+        const auto vertexBufferSize = static_cast<unsigned int>(packedVertices.data.size());
+
+        // Meshes of the same format share the buffers of a pool page, so they can be drawn by one batch
+        std::shared_ptr<const renderer::NxMeshAllocation> allocation =
+            renderer::NxMeshPool::get().allocate(params.vertexFormat, packedVertices.data, indices);
 
-        std::shared_ptr<renderer::NxIndexBuffer> indexBuffer = renderer::createIndexBuffer();
-        indexBuffer->setData(indices.data(), static_cast<unsigned int>(indices.size()));
-        vao->setIndexBuffer(indexBuffer);
+        std::vector<renderer::NxMeshLod> lods;
+        if (params.generateLods && trianglesOnly)
+            lods = generateMeshLods(allocation, vertices, indices, params);
 
         AssetRef<Material> materialComponent = nullptr;
         if (mesh->mMaterialIndex < m_materials.size()) {
@@ -430,8 +435,78 @@ namespace nexo::assets {
             LOG(NEXO_WARN, "ModelImporter: Model {}: Mesh {} has no material.", std::quoted(ctx.location.getFullLocation()), std::quoted(mesh->mName.C_Str()));
         }
 
-        LOG(NEXO_INFO, "Loaded mesh {}", mesh->mName.C_Str());
-        return {mesh->mName.C_Str(), vao, materialComponent, centerLocal};
+        LOG(NEXO_INFO, "Loaded mesh {} with {} levels of detail, {} bytes of vertices ({} in the standard format)",
+            mesh->mName.C_Str(), lods.size(), vertexBufferSize, vertices.size() * sizeof(renderer::NxVertex));
+        return {
+            mesh->mName.C_Str(), allocation->vao, materialComponent, centerLocal, minBB, maxBB, std::move(lods),
+            packedVertices.decode, allocation->range, allocation
+        };
+    }
+
+    void ModelImporter::optimizeMesh(const std::string_view meshName,
+                                     std::vector<renderer::NxVertex>& vertices,
+                                     std::vector<unsigned int>& indices,
+                                     const ModelImportParameters& params)
+    {
+        const VertexCacheStats before = analyzeVertexCache(indices, vertices.size());
+        const size_t importedVertexCount = vertices.size();
+
+        if (params.weldVertices)
+            weldVertices(vertices, indices);
+        if (params.optimizeVertexCache)
+            optimizeVertexCache(indices, vertices.size());
+        if (params.optimizeOverdraw)
+            optimizeOverdraw(indices, vertices, params.overdrawThreshold);
+        if (params.optimizeVertexFetch)
+            optimizeVertexFetch(vertices, indices);
+
+        const VertexCacheStats after = analyzeVertexCache(indices, vertices.size());
+        LOG(NEXO_INFO, "Optimized mesh {}: {} -> {} vertices, ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}",
+            meshName, importedVertexCount, vertices.size(), before.acmr, after.acmr, before.atvr, after.atvr);
+    }
+
+    std::vector<renderer::NxMeshLod> ModelImporter::generateMeshLods(
+        const std::shared_ptr<const renderer::NxMeshAllocation>& allocation,
+        const std::span<const renderer::NxVertex> vertices,
+        const std::span<const unsigned int> indices,
+        const ModelImportParameters& params)
+    {
+        std::vector<renderer::NxMeshLod> lods;
+        if (indices.size() / 3 < MIN_LOD_TRIANGLE_COUNT || params.lodReductionRatio <= 0.0f || params.lodReductionRatio >= 1.0f)
+            return lods;
+
+        std::vector<glm::vec3> positions;
+        positions.reserve(vertices.size());
+        for (const auto& vertex : vertices)
+            positions.push_back(vertex.position);
+
+        // Every level is simplified from the full mesh, so the errors are all measured against it
+        size_t previousCount = indices.size();
+        float previousError = 0.0f;
+        float ratio = 1.0f;
+        for (unsigned int level = 1; level <= params.maxLodCount; ++level) {
+            ratio *= params.lodReductionRatio;
+            const auto targetCount = static_cast<size_t>(static_cast<float>(indices.size()) * ratio) / 3 * 3;
+            if (targetCount / 3 < MIN_LOD_TRIANGLE_COUNT)
+                break;
+            SimplifiedMesh simplified = simplifyMesh(positions, indices, targetCount);
+            // Locked borders and seams can stop the simplification early, a level drawing nearly as much is useless
+            if (simplified.indices.size() > previousCount * 3 / 4)
+                break;
+            if (params.optimizeVertexCache)
+                optimizeVertexCache(simplified.indices, vertices.size());
+
+            auto lodAllocation = renderer::NxMeshPool::get().allocateLod(allocation, simplified.indices);
+            if (!lodAllocation) {
+                LOG(NEXO_WARN, "ModelImporter: no room left in the mesh pool page for level {} of detail", level);
+                break;
+            }
+
+            previousError = std::max(previousError, simplified.error);
+            previousCount = simplified.indices.size();
+            lods.push_back({lodAllocation->vao, previousError, lodAllocation->range, lodAllocation});
+        }
+        return lods;
     }
 
     glm::mat4 ModelImporter::convertAssimpMatrixToGLM(const aiMatrix4x4& matrix)
@@ -23,12 +23,19 @@
 
 #include "assets/AssetImporterBase.hpp"
 #include "assets/Assets/Model/Model.hpp"
+#include "assets/Assets/Model/ModelParameters.hpp"
 #include "assets/AssetRef.hpp"
+#include "renderer/Renderer3D.hpp"
+
+#include <span>
+#include <string_view>
 
 namespace nexo::assets {
 
     constexpr float OPACITY_THRESHOLD = 0.99f;
     constexpr float TRANSPARENCY_EPSILON = 0.01f;
+    // Meshes under this triangle count are cheap enough to always draw at full resolution
+    constexpr size_t MIN_LOD_TRIANGLE_COUNT = 64;
 
     class ModelImporter : public AssetImporterBase {
         public:
@@ -47,6 +54,15 @@ namespace nexo::assets {
 
             MeshNode processNode(AssetImporterContext& ctx, aiNode const *node, const aiScene* scene);
             Mesh processMesh(const AssetImporterContext& ctx, aiMesh* mesh, const aiScene* scene) const;
+            static void optimizeMesh(std::string_view meshName,
+                                     std::vector<renderer::NxVertex>& vertices,
+                                     std::vector<unsigned int>& indices,
+                                     const ModelImportParameters& params);
+            static std::vector<renderer::NxMeshLod> generateMeshLods(
+                const std::shared_ptr<const renderer::NxMeshAllocation>& allocation,
+                std::span<const renderer::NxVertex> vertices,
+                std::span<const unsigned int> indices,
+                const ModelImportParameters& params);
 
             static renderer::NxTextureFormat convertAssimpHintToNxTextureFormat(const char achFormatHint[9]);
             static glm::mat4 convertAssimpMatrixToGLM(const aiMatrix4x4& matrix);
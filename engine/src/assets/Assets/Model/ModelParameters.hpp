@@ -23,6 +23,19 @@
 #include "json.hpp"
 
 #include "../Texture/TextureParameters.hpp"
+#include "renderer/VertexFormat.hpp"
+
+namespace nexo::renderer {
+
+    NLOHMANN_JSON_SERIALIZE_ENUM(NxVertexFormat,
+        {
+            {NxVertexFormat::STANDARD, "STANDARD"},
+            {NxVertexFormat::COMPACT, "COMPACT"},
+            {NxVertexFormat::COMPACT_QUANTIZED, "COMPACT_QUANTIZED"}
+        }
+    );
+
+} // namespace nexo::renderer
 
 namespace nexo::assets {
 
@@ -32,8 +45,34 @@ namespace nexo::assets {
     struct ModelImportParameters {
         std::vector<TextureImportParameters> textureParameters;
 
-        NLOHMANN_DEFINE_TYPE_INTRUSIVE(ModelImportParameters,
-            textureParameters
+        // Mesh optimization options
+        bool weldVertices = true;
+        bool optimizeVertexCache = true;
+        bool optimizeOverdraw = false;
+        float overdrawThreshold = 1.05f;   //< Cache miss ratio the overdraw ordering may reach, relative to the cache optimized one
+        bool optimizeVertexFetch = true;
+
+        // Levels of detail options
+        bool generateLods = true;
+        unsigned int maxLodCount = 4;
+        float lodReductionRatio = 0.5f;    //< Index count of each level relative to the previous one
+
+        // Layout of the vertex buffers, COMPACT_QUANTIZED trades position precision (1/65535 of the mesh
+        // bounds) for 4 more bytes per vertex
+        renderer::NxVertexFormat vertexFormat = renderer::NxVertexFormat::COMPACT;
+
+        // Parameters saved before a field existed keep its default value
+        NLOHMANN_DEFINE_TYPE_INTRUSIVE_WITH_DEFAULT(ModelImportParameters,
+            textureParameters,
+            weldVertices,
+            optimizeVertexCache,
+            optimizeOverdraw,
+            overdrawThreshold,
+            optimizeVertexFetch,
+            generateLods,
+            maxLodCount,
+            lodReductionRatio,
+            vertexFormat
         )
     };
 
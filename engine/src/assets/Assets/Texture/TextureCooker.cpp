@@ -0,0 +1,602 @@
+//// TextureCooker.cpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Implementation file for the offline texture cooker
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "TextureCooker.hpp"
+#include "core/thread/WorkerPool.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <latch>
+#include <limits>
+#include <numbers>
+
+namespace nexo::assets {
+
+    using renderer::NxTextureFormat;
+    using renderer::NxTextureImage;
+
+    namespace {
+
+        constexpr unsigned int MAX_MIP_LEVELS = 32;
+        // Block rows encoded by a single worker job
+        constexpr unsigned int BLOCK_ROWS_PER_JOB = 8;
+
+        using Rgba = std::array<uint8_t, 4>;
+        using Block = std::array<Rgba, 16>;
+
+        thread::WorkerPool &cookingPool()
+        {
+            static thread::WorkerPool pool;
+            return pool;
+        }
+
+        // Converts any uncompressed image to RGBA8, grey images are spread on the three color channels
+        NxTextureImage toRgba(const NxTextureImage &image)
+        {
+            const auto channels = static_cast<size_t>(image.format);
+            const size_t pixelCount = static_cast<size_t>(image.width) * image.height;
+            NxTextureImage rgba{std::vector<uint8_t>(pixelCount * 4), image.width, image.height, NxTextureFormat::RGBA8};
+            for (size_t i = 0; i < pixelCount; ++i) {
+                const uint8_t *src = image.pixels.data() + i * channels;
+                uint8_t *dst = rgba.pixels.data() + i * 4;
+                dst[0] = src[0];
+                dst[1] = channels == 1 ? src[0] : src[1];
+                dst[2] = channels == 1 ? src[0] : channels == 2 ? 0 : src[2];
+                dst[3] = channels == 4 ? src[3] : 255;
+            }
+            return rgba;
+        }
+
+        // Keeps the first channels of an RGBA8 image
+        std::vector<uint8_t> packChannels(const NxTextureImage &rgba, const size_t channels)
+        {
+            const size_t pixelCount = static_cast<size_t>(rgba.width) * rgba.height;
+            std::vector<uint8_t> pixels(pixelCount * channels);
+            for (size_t i = 0; i < pixelCount; ++i)
+                std::copy_n(rgba.pixels.data() + i * 4, channels, pixels.data() + i * channels);
+            return pixels;
+        }
+
+        NxTextureImage boxDownsample(const NxTextureImage &src)
+        {
+            const unsigned int width = std::max(src.width / 2, 1u);
+            const unsigned int height = std::max(src.height / 2, 1u);
+            NxTextureImage dst{std::vector<uint8_t>(static_cast<size_t>(width) * height * 4), width, height,
+                               NxTextureFormat::RGBA8};
+            for (unsigned int y = 0; y < height; ++y) {
+                const unsigned int y0 = std::min(y * 2, src.height - 1);
+                const unsigned int y1 = std::min(y * 2 + 1, src.height - 1);
+                for (unsigned int x = 0; x < width; ++x) {
+                    const unsigned int x0 = std::min(x * 2, src.width - 1);
+                    const unsigned int x1 = std::min(x * 2 + 1, src.width - 1);
+                    for (unsigned int c = 0; c < 4; ++c) {
+                        const auto at = [&](const unsigned int px, const unsigned int py) {
+                            return static_cast<unsigned int>(src.pixels[(static_cast<size_t>(py) * src.width + px) * 4 + c]);
+                        };
+                        dst.pixels[(static_cast<size_t>(y) * width + x) * 4 + c] =
+                            static_cast<uint8_t>((at(x0, y0) + at(x1, y0) + at(x0, y1) + at(x1, y1) + 2) / 4);
+                    }
+                }
+            }
+            return dst;
+        }
+
+        // Modified Bessel function of the first kind of order 0, its series converges quickly for the window range
+        double besselI0(const double x)
+        {
+            double sum = 1.0;
+            double term = 1.0;
+            for (int k = 1; k < 32; ++k) {
+                term *= (x / (2.0 * k)) * (x / (2.0 * k));
+                sum += term;
+            }
+            return sum;
+        }
+
+        // Halving Kaiser windowed sinc: 8 taps, i.e. a support of two destination pixels on each side
+        constexpr int KAISER_TAPS = 8;
+
+        std::array<float, KAISER_TAPS> kaiserWeights()
+        {
+            constexpr double alpha = 4.0;
+            constexpr double radius = 2.0;
+            std::array<float, KAISER_TAPS> weights{};
+            double total = 0.0;
+            for (int i = 0; i < KAISER_TAPS; ++i) {
+                // Distance from the destination pixel center, in destination pixels
+                const double t = (i - KAISER_TAPS / 2 + 0.5) / 2.0;
+                const double sinc = std::sin(std::numbers::pi * t) / (std::numbers::pi * t);
+                const double ratio = t / radius;
+                const double window = besselI0(alpha * std::sqrt(std::max(0.0, 1.0 - ratio * ratio))) / besselI0(alpha);
+                weights[i] = static_cast<float>(sinc * window);
+                total += sinc * window;
+            }
+            for (auto &weight : weights)
+                weight = static_cast<float>(weight / total);
+            return weights;
+        }
+
+        // Halves one dimension of an RGBA image with the Kaiser filter, sampling with clamp to edge
+        NxTextureImage kaiserDownsampleAxis(const NxTextureImage &src, const bool horizontal)
+        {
+            static const auto weights = kaiserWeights();
+            const unsigned int srcLength = horizontal ? src.width : src.height;
+            if (srcLength == 1)
+                return src;
+            const unsigned int width = horizontal ? src.width / 2 : src.width;
+            const unsigned int height = horizontal ? src.height : src.height / 2;
+            NxTextureImage dst{std::vector<uint8_t>(static_cast<size_t>(width) * height * 4), width, height,
+                               NxTextureFormat::RGBA8};
+            for (unsigned int y = 0; y < height; ++y) {
+                for (unsigned int x = 0; x < width; ++x) {
+                    std::array<float, 4> sum{};
+                    const int center = static_cast<int>(horizontal ? x : y) * 2;
+                    for (int tap = 0; tap < KAISER_TAPS; ++tap) {
+                        const int s = std::clamp(center + tap - KAISER_TAPS / 2 + 1, 0, static_cast<int>(srcLength) - 1);
+                        const size_t sx = horizontal ? static_cast<size_t>(s) : x;
+                        const size_t sy = horizontal ? y : static_cast<size_t>(s);
+                        const uint8_t *pixel = src.pixels.data() + (sy * src.width + sx) * 4;
+                        for (int c = 0; c < 4; ++c)
+                            sum[c] += weights[tap] * static_cast<float>(pixel[c]);
+                    }
+                    uint8_t *out = dst.pixels.data() + (static_cast<size_t>(y) * width + x) * 4;
+                    for (int c = 0; c < 4; ++c)
+                        out[c] = static_cast<uint8_t>(std::clamp(std::lround(sum[c]), 0l, 255l));
+                }
+            }
+            return dst;
+        }
+
+        Block fetchBlock(const NxTextureImage &rgba, const unsigned int blockX, const unsigned int blockY)
+        {
+            Block block{};
+            for (unsigned int y = 0; y < 4; ++y) {
+                const unsigned int py = std::min(blockY * 4 + y, rgba.height - 1);
+                for (unsigned int x = 0; x < 4; ++x) {
+                    const unsigned int px = std::min(blockX * 4 + x, rgba.width - 1);
+                    std::copy_n(rgba.pixels.data() + (static_cast<size_t>(py) * rgba.width + px) * 4, 4,
+                                block[y * 4 + x].data());
+                }
+            }
+            return block;
+        }
+
+        template<size_t N>
+        unsigned int nearestIndex(const std::array<Rgba, N> &palette, const Rgba &color, const int channels)
+        {
+            unsigned int best = 0;
+            int bestError = std::numeric_limits<int>::max();
+            for (unsigned int i = 0; i < N; ++i) {
+                int error = 0;
+                for (int c = 0; c < channels; ++c) {
+                    const int d = static_cast<int>(palette[i][c]) - static_cast<int>(color[c]);
+                    error += d * d;
+                }
+                if (error < bestError) {
+                    bestError = error;
+                    best = i;
+                }
+            }
+            return best;
+        }
+
+        uint16_t packRgb565(const Rgba &color)
+        {
+            return static_cast<uint16_t>(((color[0] * 31 + 127) / 255) << 11
+                                         | ((color[1] * 63 + 127) / 255) << 5
+                                         | (color[2] * 31 + 127) / 255);
+        }
+
+        Rgba unpackRgb565(const uint16_t packed)
+        {
+            const unsigned int r = (packed >> 11) & 31;
+            const unsigned int g = (packed >> 5) & 63;
+            const unsigned int b = packed & 31;
+            return {static_cast<uint8_t>(r << 3 | r >> 2), static_cast<uint8_t>(g << 2 | g >> 4),
+                    static_cast<uint8_t>(b << 3 | b >> 2), 255};
+        }
+
+        // BC1 color block: bounding box endpoints, inset to reduce the error at the extremes, 4 color mode
+        void encodeColorBlock(const Block &block, uint8_t *out)
+        {
+            Rgba minColor{255, 255, 255, 255};
+            Rgba maxColor{0, 0, 0, 255};
+            for (const auto &pixel : block) {
+                for (int c = 0; c < 3; ++c) {
+                    minColor[c] = std::min(minColor[c], pixel[c]);
+                    maxColor[c] = std::max(maxColor[c], pixel[c]);
+                }
+            }
+            for (int c = 0; c < 3; ++c) {
+                const int inset = (maxColor[c] - minColor[c]) / 16;
+                minColor[c] = static_cast<uint8_t>(minColor[c] + inset);
+                maxColor[c] = static_cast<uint8_t>(maxColor[c] - inset);
+            }
+
+            const uint16_t color0 = packRgb565(maxColor);
+            const uint16_t color1 = packRgb565(minColor);
+            uint32_t indices = 0;
+            // Equal endpoints would switch the block to the 3 color mode, every pixel uses color0 anyway
+            if (color0 != color1) {
+                const Rgba c0 = unpackRgb565(color0);
+                const Rgba c1 = unpackRgb565(color1);
+                std::array<Rgba, 4> palette{c0, c1, Rgba{}, Rgba{}};
+                for (int c = 0; c < 3; ++c) {
+                    palette[2][c] = static_cast<uint8_t>((2 * c0[c] + c1[c] + 1) / 3);
+                    palette[3][c] = static_cast<uint8_t>((c0[c] + 2 * c1[c] + 1) / 3);
+                }
+                for (unsigned int i = 0; i < 16; ++i)
+                    indices |= nearestIndex(palette, block[i], 3) << (i * 2);
+            }
+            out[0] = static_cast<uint8_t>(color0 & 0xff);
+            out[1] = static_cast<uint8_t>(color0 >> 8);
+            out[2] = static_cast<uint8_t>(color1 & 0xff);
+            out[3] = static_cast<uint8_t>(color1 >> 8);
+            for (int i = 0; i < 4; ++i)
+                out[4 + i] = static_cast<uint8_t>(indices >> (i * 8));
+        }
+
+        // BC4 block of one channel, 8 value mode
+        void encodeChannelBlock(const Block &block, const int channel, uint8_t *out)
+        {
+            uint8_t minValue = 255;
+            uint8_t maxValue = 0;
+            for (const auto &pixel : block) {
+                minValue = std::min(minValue, pixel[channel]);
+                maxValue = std::max(maxValue, pixel[channel]);
+            }
+            out[0] = maxValue;
+            out[1] = minValue;
+            uint64_t indices = 0;
+            if (maxValue != minValue) {
+                std::array<Rgba, 8> palette{};
+                palette[0][0] = maxValue;
+                palette[1][0] = minValue;
+                for (int i = 2; i < 8; ++i)
+                    palette[i][0] = static_cast<uint8_t>(((8 - i) * maxValue + (i - 1) * minValue + 3) / 7);
+                for (unsigned int i = 0; i < 16; ++i)
+                    indices |= static_cast<uint64_t>(nearestIndex(palette, Rgba{block[i][channel]}, 1)) << (i * 3);
+            }
+            for (int i = 0; i < 6; ++i)
+                out[2 + i] = static_cast<uint8_t>(indices >> (i * 8));
+        }
+
+        class BitWriter {
+            public:
+                explicit BitWriter(uint8_t *out) : m_out(out) { std::fill_n(out, 16, 0); }
+
+                void write(const uint32_t value, const unsigned int bits)
+                {
+                    for (unsigned int i = 0; i < bits; ++i, ++m_bit)
+                        m_out[m_bit / 8] |= static_cast<uint8_t>(((value >> i) & 1) << (m_bit % 8));
+                }
+
+            private:
+                uint8_t *m_out;
+                unsigned int m_bit = 0;
+        };
+
+        // BC7 mode 6: a single RGBA subset, 7 bit endpoints with a parity bit and 4 bit indices
+        void encodeBc7Block(const Block &block, uint8_t *out)
+        {
+            static constexpr std::array<int, 16> weights = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+            std::array<Rgba, 2> endpoints{Rgba{255, 255, 255, 255}, Rgba{0, 0, 0, 0}};
+            for (const auto &pixel : block) {
+                for (int c = 0; c < 4; ++c) {
+                    endpoints[0][c] = std::min(endpoints[0][c], pixel[c]);
+                    endpoints[1][c] = std::max(endpoints[1][c], pixel[c]);
+                }
+            }
+
+            // Each endpoint stores 7 bits per channel plus a parity bit shared by its four channels
+            std::array<Rgba, 2> quantized{};
+            std::array<uint32_t, 2> parity{};
+            for (int e = 0; e < 2; ++e) {
+                int bestError = std::numeric_limits<int>::max();
+                for (uint32_t p = 0; p < 2; ++p) {
+                    Rgba candidate{};
+                    int error = 0;
+                    for (int c = 0; c < 4; ++c) {
+                        const int q = std::clamp((endpoints[e][c] - static_cast<int>(p) + 1) / 2, 0, 127);
+                        candidate[c] = static_cast<uint8_t>(q);
+                        const int d = (q << 1 | static_cast<int>(p)) - endpoints[e][c];
+                        error += d * d;
+                    }
+                    if (error < bestError) {
+                        bestError = error;
+                        quantized[e] = candidate;
+                        parity[e] = p;
+                    }
+                }
+            }
+
+            std::array<Rgba, 16> palette{};
+            for (int i = 0; i < 16; ++i) {
+                for (int c = 0; c < 4; ++c) {
+                    const int e0 = quantized[0][c] << 1 | static_cast<int>(parity[0]);
+                    const int e1 = quantized[1][c] << 1 | static_cast<int>(parity[1]);
+                    palette[i][c] = static_cast<uint8_t>(((64 - weights[i]) * e0 + weights[i] * e1 + 32) >> 6);
+                }
+            }
+            std::array<uint32_t, 16> indices{};
+            for (unsigned int i = 0; i < 16; ++i)
+                indices[i] = nearestIndex(palette, block[i], 4);
+            // The most significant bit of the first index is implicit and must be 0
+            if (indices[0] & 8) {
+                std::swap(quantized[0], quantized[1]);
+                std::swap(parity[0], parity[1]);
+                for (auto &index : indices)
+                    index = 15 - index;
+            }
+
+            BitWriter writer(out);
+            writer.write(1u << 6, 7);
+            for (int c = 0; c < 4; ++c) {
+                writer.write(quantized[0][c], 7);
+                writer.write(quantized[1][c], 7);
+            }
+            writer.write(parity[0], 1);
+            writer.write(parity[1], 1);
+            writer.write(indices[0], 3);
+            for (unsigned int i = 1; i < 16; ++i)
+                writer.write(indices[i], 4);
+        }
+
+        void encodeBlock(const NxTextureFormat format, const Block &block, uint8_t *out)
+        {
+            switch (format) {
+                case NxTextureFormat::BC1:
+                    encodeColorBlock(block, out);
+                    break;
+                case NxTextureFormat::BC3:
+                    encodeChannelBlock(block, 3, out);
+                    encodeColorBlock(block, out + 8);
+                    break;
+                case NxTextureFormat::BC5:
+                    encodeChannelBlock(block, 0, out);
+                    encodeChannelBlock(block, 1, out + 8);
+                    break;
+                case NxTextureFormat::BC7:
+                    encodeBc7Block(block, out);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        // Encodes the blocks of a level, spreading the block rows over the cooking pool
+        void encodeLevel(const NxTextureImage &rgba, const NxTextureFormat format, uint8_t *out)
+        {
+            const unsigned int blocksX = (rgba.width + 3) / 4;
+            const unsigned int blocksY = (rgba.height + 3) / 4;
+            const size_t blockSize = format == NxTextureFormat::BC1 ? 8 : 16;
+            const auto encodeRows = [&](const unsigned int firstRow, const unsigned int lastRow) {
+                for (unsigned int by = firstRow; by < lastRow; ++by)
+                    for (unsigned int bx = 0; bx < blocksX; ++bx)
+                        encodeBlock(format, fetchBlock(rgba, bx, by),
+                                    out + (static_cast<size_t>(by) * blocksX + bx) * blockSize);
+            };
+
+            const unsigned int jobCount = (blocksY + BLOCK_ROWS_PER_JOB - 1) / BLOCK_ROWS_PER_JOB;
+            if (jobCount <= 1) {
+                encodeRows(0, blocksY);
+                return;
+            }
+            std::latch done(jobCount);
+            for (unsigned int job = 0; job < jobCount; ++job) {
+                const unsigned int firstRow = job * BLOCK_ROWS_PER_JOB;
+                cookingPool().submit([&, firstRow] {
+                    encodeRows(firstRow, std::min(firstRow + BLOCK_ROWS_PER_JOB, blocksY));
+                    done.count_down();
+                });
+            }
+            done.wait();
+        }
+
+        NxTextureFormat outputFormat(const TextureImportParameters::Format format, const NxTextureFormat source)
+        {
+            switch (format) {
+                case TextureImportParameters::Format::RGB:  return NxTextureFormat::RGB8;
+                case TextureImportParameters::Format::RGBA: return NxTextureFormat::RGBA8;
+                case TextureImportParameters::Format::BC1:  return NxTextureFormat::BC1;
+                case TextureImportParameters::Format::BC3:  return NxTextureFormat::BC3;
+                case TextureImportParameters::Format::BC5:  return NxTextureFormat::BC5;
+                case TextureImportParameters::Format::BC7:  return NxTextureFormat::BC7;
+                default: return source;
+            }
+        }
+
+        template<typename T>
+        void append(std::vector<uint8_t> &bytes, const T value)
+        {
+            const auto *raw = reinterpret_cast<const uint8_t *>(&value);
+            bytes.insert(bytes.end(), raw, raw + sizeof(T));
+        }
+
+        template<typename T>
+        T read(const std::vector<uint8_t> &bytes, size_t &offset, const std::filesystem::path &path)
+        {
+            if (offset + sizeof(T) > bytes.size())
+                THROW_EXCEPTION(InvalidCookedTexture, path, "truncated header");
+            T value;
+            std::memcpy(&value, bytes.data() + offset, sizeof(T));
+            offset += sizeof(T);
+            return value;
+        }
+
+        constexpr size_t LEVEL_ENTRY_SIZE = 2 * sizeof(uint32_t) + 2 * sizeof(uint64_t);
+        constexpr size_t HEADER_SIZE = TextureCooker::MAGIC.size() + 3 * sizeof(uint32_t);
+
+    }
+
+    std::vector<renderer::NxTextureMipLevel> CookedTexture::mipLevels() const
+    {
+        std::vector<renderer::NxTextureMipLevel> mips;
+        mips.reserve(levels.size());
+        for (const auto &level : levels)
+            mips.push_back({data.data() + level.offset, level.size, level.width, level.height});
+        return mips;
+    }
+
+    size_t CookedTexture::pixelSize() const
+    {
+        size_t size = 0;
+        for (const auto &level : levels)
+            size += level.size;
+        return size;
+    }
+
+    std::vector<NxTextureImage> TextureCooker::generateMipChain(const NxTextureImage &image,
+                                                                const TextureImportParameters::MipFilter filter)
+    {
+        std::vector<NxTextureImage> chain;
+        chain.push_back(image.format == NxTextureFormat::RGBA8 ? image : toRgba(image));
+        while (chain.back().width > 1 || chain.back().height > 1) {
+            const auto &previous = chain.back();
+            if (filter == TextureImportParameters::MipFilter::Kaiser)
+                chain.push_back(kaiserDownsampleAxis(kaiserDownsampleAxis(previous, true), false));
+            else
+                chain.push_back(boxDownsample(previous));
+        }
+        return chain;
+    }
+
+    CookedTexture TextureCooker::cook(const NxTextureImage &image) const
+    {
+        if (image.width == 0 || image.height == 0 || image.format == NxTextureFormat::INVALID
+            || renderer::NxTextureFormatIsCompressed(image.format)
+            || image.pixels.size() != renderer::NxTextureFormatImageSize(image.format, image.width, image.height))
+            THROW_EXCEPTION(InvalidCookedTexture, "(image)", "the source image must be a valid uncompressed image");
+
+        auto chain = generateMipChain(image, m_params.mipFilter);
+        // Levels larger than the maximum size are dropped, the next one becomes the top level
+        const auto maxSize = static_cast<unsigned int>(std::max(m_params.maxSize, 1));
+        const auto first = std::ranges::find_if(chain, [maxSize](const NxTextureImage &level) {
+            return level.width <= maxSize && level.height <= maxSize;
+        });
+        chain.erase(chain.begin(), first);
+        if (!m_params.generateMipmaps || chain.size() > MAX_MIP_LEVELS)
+            chain.resize(m_params.generateMipmaps ? MAX_MIP_LEVELS : 1);
+
+        CookedTexture cooked;
+        cooked.format = outputFormat(m_params.format, image.format);
+        size_t offset = 0;
+        for (const auto &level : chain) {
+            const size_t size = renderer::NxTextureFormatImageSize(cooked.format, level.width, level.height);
+            cooked.levels.push_back({level.width, level.height, offset, size});
+            offset += size;
+        }
+        cooked.data.resize(offset);
+
+        for (size_t i = 0; i < chain.size(); ++i) {
+            uint8_t *out = cooked.data.data() + cooked.levels[i].offset;
+            if (renderer::NxTextureFormatIsCompressed(cooked.format))
+                encodeLevel(chain[i], cooked.format, out);
+            else {
+                const auto pixels = packChannels(chain[i], static_cast<size_t>(cooked.format));
+                std::ranges::copy(pixels, out);
+            }
+        }
+        return cooked;
+    }
+
+    CookedTexture TextureCooker::cookFile(const std::filesystem::path &path) const
+    {
+        return cook(renderer::NxDecodeTextureFile(path.string(), m_params.flipVertically));
+    }
+
+    void TextureCooker::save(const CookedTexture &texture, const std::filesystem::path &path)
+    {
+        std::vector<uint8_t> header;
+        header.insert(header.end(), MAGIC.begin(), MAGIC.end());
+        append(header, VERSION);
+        append(header, static_cast<uint32_t>(texture.format));
+        append(header, static_cast<uint32_t>(texture.levels.size()));
+
+        const size_t dataStart = HEADER_SIZE + texture.levels.size() * LEVEL_ENTRY_SIZE;
+        for (const auto &level : texture.levels) {
+            append(header, static_cast<uint32_t>(level.width));
+            append(header, static_cast<uint32_t>(level.height));
+            append(header, static_cast<uint64_t>(dataStart + level.offset));
+            append(header, static_cast<uint64_t>(level.size));
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            THROW_EXCEPTION(InvalidCookedTexture, path, "cannot be opened for writing");
+        file.write(reinterpret_cast<const char *>(header.data()), static_cast<std::streamsize>(header.size()));
+        for (const auto &level : texture.levels)
+            file.write(reinterpret_cast<const char *>(texture.data.data() + level.offset),
+                       static_cast<std::streamsize>(level.size));
+        if (!file)
+            THROW_EXCEPTION(InvalidCookedTexture, path, "write failed");
+    }
+
+    CookedTexture TextureCooker::load(const std::filesystem::path &path)
+    {
+        std::error_code error;
+        const auto fileSize = std::filesystem::file_size(path, error);
+        std::ifstream file(path, std::ios::binary);
+        if (error || !file)
+            THROW_EXCEPTION(InvalidCookedTexture, path, "cannot be opened");
+
+        CookedTexture cooked;
+        cooked.data.resize(fileSize);
+        if (!file.read(reinterpret_cast<char *>(cooked.data.data()), static_cast<std::streamsize>(fileSize)))
+            THROW_EXCEPTION(InvalidCookedTexture, path, "read failed");
+
+        size_t offset = 0;
+        const auto magic = read<std::array<char, 4>>(cooked.data, offset, path);
+        if (magic != MAGIC)
+            THROW_EXCEPTION(InvalidCookedTexture, path, "not a cooked texture");
+        if (read<uint32_t>(cooked.data, offset, path) != VERSION)
+            THROW_EXCEPTION(InvalidCookedTexture, path, "unsupported version");
+        const auto format = read<uint32_t>(cooked.data, offset, path);
+        if (format == 0 || format >= static_cast<uint32_t>(NxTextureFormat::_NB_FORMATS_))
+            THROW_EXCEPTION(InvalidCookedTexture, path, "unknown texture format");
+        cooked.format = static_cast<NxTextureFormat>(format);
+        const auto levelCount = read<uint32_t>(cooked.data, offset, path);
+        if (levelCount == 0 || levelCount > MAX_MIP_LEVELS)
+            THROW_EXCEPTION(InvalidCookedTexture, path, "invalid mip level count");
+
+        cooked.levels.reserve(levelCount);
+        for (uint32_t i = 0; i < levelCount; ++i) {
+            CookedTexture::Level level;
+            level.width = read<uint32_t>(cooked.data, offset, path);
+            level.height = read<uint32_t>(cooked.data, offset, path);
+            level.offset = static_cast<size_t>(read<uint64_t>(cooked.data, offset, path));
+            level.size = static_cast<size_t>(read<uint64_t>(cooked.data, offset, path));
+            if (level.size != renderer::NxTextureFormatImageSize(cooked.format, level.width, level.height)
+                || level.offset > cooked.data.size() || level.size > cooked.data.size() - level.offset)
+                THROW_EXCEPTION(InvalidCookedTexture, path, "mip level out of bounds");
+            cooked.levels.push_back(level);
+        }
+        return cooked;
+    }
+
+    bool TextureCooker::isCookedTexture(const std::filesystem::path &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::array<char, 4> magic{};
+        return file.read(magic.data(), magic.size()) && magic == MAGIC;
+    }
+
+} // namespace nexo::assets
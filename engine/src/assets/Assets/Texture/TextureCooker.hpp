@@ -0,0 +1,129 @@
+//// TextureCooker.hpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the offline texture cooker
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Exception.hpp"
+#include "TextureParameters.hpp"
+#include "renderer/Texture.hpp"
+#include "renderer/TextureUploadQueue.hpp"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <string_view>
+#include <vector>
+
+namespace nexo::assets {
+
+    class InvalidCookedTexture final : public Exception {
+        public:
+            explicit InvalidCookedTexture(
+                const std::filesystem::path &path,
+                std::string_view message,
+                const std::source_location loc = std::source_location::current()
+            ) : Exception(std::format("Invalid cooked texture '{}': {}", path.string(), message), loc) {};
+    };
+
+    /**
+     * @brief Texture ready to be uploaded as is: every mip level, already in its GPU format.
+     */
+    struct CookedTexture {
+        struct Level {
+            unsigned int width = 0;
+            unsigned int height = 0;
+            size_t offset = 0;      //< Offset of the level in data
+            size_t size = 0;        //< Size of the level in bytes
+        };
+
+        renderer::NxTextureFormat format = renderer::NxTextureFormat::INVALID;
+        std::vector<Level> levels;
+        std::vector<uint8_t> data;
+
+        /**
+         * @brief Returns the levels as expected by `NxTexture2D::create`, pointing into data.
+         */
+        [[nodiscard]] std::vector<renderer::NxTextureMipLevel> mipLevels() const;
+
+        /// Size of the pixels of every level, i.e. the memory the texture takes once uploaded
+        [[nodiscard]] size_t pixelSize() const;
+    };
+
+    /**
+     * @class TextureCooker
+     * @brief Offline step turning decoded images into cooked textures.
+     *
+     * Cooking generates the whole mip chain (box or Kaiser filtered) and encodes every level in the output format
+     * chosen in the `TextureImportParameters`, block compressing it on the CPU when asked to (BC1, BC3, BC5 or BC7,
+     * 4x4 blocks encoded in parallel on worker threads).
+     *
+     * Cooked textures are stored in `.nxtex` containers: a small header, the level table and the level data. Loading
+     * one is a single file read and the levels are uploaded without any transcoding, so nothing is decoded at
+     * runtime anymore.
+     *
+     * Container layout (little endian):
+     * - magic "NXTX", uint32 version, uint32 format, uint32 level count
+     * - per level: uint32 width, uint32 height, uint64 offset in the file, uint64 size
+     * - level data
+     */
+    class TextureCooker {
+        public:
+            static constexpr std::array<char, 4> MAGIC = {'N', 'X', 'T', 'X'};
+            static constexpr uint32_t VERSION = 1;
+            static constexpr std::string_view EXTENSION = ".nxtex";
+
+            explicit TextureCooker(const TextureImportParameters &params = {}) : m_params(params) {}
+
+            /**
+             * @brief Cooks a decoded image.
+             *
+             * @throws InvalidCookedTexture If the image is empty or its format is not an uncompressed one.
+             */
+            [[nodiscard]] CookedTexture cook(const renderer::NxTextureImage &image) const;
+
+            /**
+             * @brief Decodes an image file (see `NxDecodeTextureFile`) and cooks it.
+             */
+            [[nodiscard]] CookedTexture cookFile(const std::filesystem::path &path) const;
+
+            /**
+             * @brief Builds the RGBA8 mip chain of an image, from the image itself down to 1x1.
+             */
+            [[nodiscard]] static std::vector<renderer::NxTextureImage> generateMipChain(
+                const renderer::NxTextureImage &image, TextureImportParameters::MipFilter filter);
+
+            static void save(const CookedTexture &texture, const std::filesystem::path &path);
+
+            /**
+             * @brief Loads a cooked texture container with a single read.
+             *
+             * @throws InvalidCookedTexture If the file cannot be read or is not a valid container.
+             */
+            [[nodiscard]] static CookedTexture load(const std::filesystem::path &path);
+
+            /**
+             * @brief Checks whether a file starts with the cooked texture magic.
+             */
+            [[nodiscard]] static bool isCookedTexture(const std::filesystem::path &path);
+
+        private:
+            TextureImportParameters m_params;
+    };
+
+} // namespace nexo::assets
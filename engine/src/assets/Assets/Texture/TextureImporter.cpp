@@ -22,6 +22,9 @@
 #include <stb_image.h>
 #include "assets/AssetImporterBase.hpp"
 #include "assets/Assets/Texture/Texture.hpp"
+#include "assets/Assets/Texture/TextureParameters.hpp"
+#include "assets/Assets/Texture/TextureCooker.hpp"
+#include "renderer/TextureUploadQueue.hpp"
 #include <boost/uuid/random_generator.hpp>
 
 namespace nexo::assets {
@@ -39,9 +42,30 @@ namespace nexo::assets {
     void TextureImporter::importImpl(AssetImporterContext& ctx)
     {
         // TODO: we need to import textures independently from graphics API back end renderer::NxTexture2D::create implementation
+        const auto params = ctx.getParameters<TextureImportParameters>();
         auto asset = std::make_unique<Texture>();
         std::shared_ptr<renderer::NxTexture2D> rendererTexture;
-        if (std::holds_alternative<ImporterFileInput>(ctx.input))
+        if (std::holds_alternative<ImporterFileInput>(ctx.input)
+            && TextureCooker::isCookedTexture(std::get<ImporterFileInput>(ctx.input).filePath)) {
+            // Cooked textures are a single read away from their upload, nothing to offload
+            const auto cooked = TextureCooker::load(std::get<ImporterFileInput>(ctx.input).filePath);
+            rendererTexture = renderer::NxTexture2D::create(cooked.mipLevels(), cooked.format);
+        } else if (params.asyncUpload) {
+            // Decoded on a worker, the asset shows the placeholder until the upload queue reaches it
+            auto &uploadQueue = renderer::NxTextureUploadQueue::get();
+            if (std::holds_alternative<ImporterFileInput>(ctx.input)) {
+                auto path = std::get<ImporterFileInput>(ctx.input).filePath.string();
+                rendererTexture = uploadQueue.enqueue([path, flip = params.flipVertically] {
+                    return renderer::NxDecodeTextureFile(path, flip);
+                }, path);
+            } else {
+                // Flipped like the synchronous loader does, the model samples the same pixels either way
+                rendererTexture = uploadQueue.enqueue([data = std::get<ImporterMemoryInput>(ctx.input).memoryData,
+                                                       flip = params.flipVertically] {
+                    return renderer::NxDecodeTextureMemory(data.data(), data.size(), flip);
+                });
+            }
+        } else if (std::holds_alternative<ImporterFileInput>(ctx.input))
             rendererTexture = renderer::NxTexture2D::create(std::get<ImporterFileInput>(ctx.input).filePath.string());
         else {
             const auto data = std::get<ImporterMemoryInput>(ctx.input).memoryData;
@@ -67,6 +91,8 @@ namespace nexo::assets {
 
     bool TextureImporter::canReadFile(const ImporterFileInput& input)
     {
+        if (TextureCooker::isCookedTexture(input.filePath))
+            return true;
         const int ok = stbi_info(input.filePath.string().c_str(), nullptr, nullptr, nullptr);
         return ok;
     }
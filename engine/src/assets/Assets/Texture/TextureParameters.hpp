@@ -29,6 +29,7 @@ namespace nexo::assets {
         bool generateMipmaps = true;
         bool convertToSRGB = true;
         bool flipVertically = true;
+        bool asyncUpload = true;    // Decode on a worker and upload later, showing a placeholder meanwhile
 
         enum class Format {
             Preserve,    // Keep original format
@@ -36,10 +37,17 @@ namespace nexo::assets {
             RGBA,        // Convert to RGBA with alpha
             BC1,         // Block compression (DXT1)
             BC3,         // Block compression (DXT5)
+            BC5,         // Two channels block compression (normal maps)
             BC7          // High quality block compression
         };
         Format format = Format::Preserve;
 
+        enum class MipFilter {
+            Box,         // Average of each 2x2 square
+            Kaiser       // Kaiser windowed sinc, sharper minification
+        };
+        MipFilter mipFilter = MipFilter::Box;
+
         int maxSize = 4096;         // Max texture dimension
         float compressionQuality = 0.9f;
 
@@ -47,7 +55,9 @@ namespace nexo::assets {
             generateMipmaps,
             convertToSRGB,
             flipVertically,
+            asyncUpload,
             format,
+            mipFilter,
             maxSize,
             compressionQuality
         )
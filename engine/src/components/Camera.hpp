@@ -181,13 +181,17 @@ namespace nexo::components {
      * @brief Encapsulates the overall camera context.
      *
      * Includes the view-projection matrix, camera position, clear color,
-     * and the render target used for rendering.
+     * the render target used for rendering and the camera's render pipeline.
      */
     struct CameraContext {
         glm::mat4 viewProjectionMatrix;                      ///< Combined view and projection matrix.
         glm::vec3 cameraPosition;                            ///< The position of the camera.
         glm::vec4 clearColor;                                ///< Clear color used for rendering.
         std::shared_ptr<renderer::NxFramebuffer> renderTarget; ///< The render target framebuffer.
-        renderer::RenderPipeline pipeline;
+        renderer::RenderPipeline *pipeline;                  ///< Pipeline of the camera component, valid until the render context is reset.
+        glm::mat4 viewMatrix;                                ///< View matrix, used to bin the lights in clusters.
+        glm::mat4 projectionMatrix;                          ///< Projection matrix, used to bin the lights in clusters.
+        float nearPlane;                                     ///< Near clipping plane distance.
+        float farPlane;                                      ///< Far clipping plane distance.
     };
 }
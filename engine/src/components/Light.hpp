@@ -19,13 +19,10 @@
 
 #include <glm/fwd.hpp>
 #include <glm/glm.hpp>
-#include <array>
+#include <vector>
 
 #include "ecs/Definitions.hpp"
 
-constexpr unsigned int MAX_POINT_LIGHTS = 10;
-constexpr unsigned int MAX_SPOT_LIGHTS = 10;
-
 namespace nexo::components {
 
     struct AmbientLightComponent {
@@ -145,10 +142,9 @@ namespace nexo::components {
 
     struct LightContext {
         glm::vec3 ambientLight;
-        std::array<ecs::Entity, MAX_POINT_LIGHTS> pointLights;
-        unsigned int pointLightCount = 0;
-        std::array<ecs::Entity, MAX_SPOT_LIGHTS> spotLights;
-        unsigned int spotLightCount = 0;
+        // Any number of point and spot lights, they are binned per camera in light clusters
+        std::vector<ecs::Entity> pointLights;
+        std::vector<ecs::Entity> spotLights;
         DirectionalLightComponent dirLight;
     };
 }
@@ -34,6 +34,17 @@ namespace nexo::components {
             float cellSize = 0.025f;
         };
         GridParams gridParams;
+        bool frustumCulling = true; //<< Skip the meshes outside the view of a camera, found through the spatial index of the scene
+        bool occlusionCulling = true; //<< Skip the meshes hidden behind OccluderComponent entities, if the scene has any
+        float lodErrorThreshold = 1.0f; //<< Largest error on screen, in pixels, a simplified mesh level may cause. 0 always draws the full meshes
+        bool batchStaticMeshes = true; //<< Draw the opaque pooled meshes sharing a shader with multi draw indirect calls, when supported
+        bool showSelectionBounds = false; //<< Draw the world bounds of the selected meshes with debug lines, in editor scenes
+        struct DebugLine {
+            glm::vec3 start;
+            glm::vec3 end;
+            glm::vec4 color;
+        };
+        std::vector<DebugLine> debugLines; //<< Lines drawn over the scene this frame, added before the render command system runs
         std::vector<CameraContext> cameras;
         LightContext sceneLights{};
 
@@ -61,9 +72,10 @@ namespace nexo::components {
             viewportBounds[0] = glm::vec2{};
             viewportBounds[1] = glm::vec2{};
             cameras.clear();
+            debugLines.clear();
             sceneLights.ambientLight = glm::vec3(0.0f);
-            sceneLights.pointLightCount = 0;
-            sceneLights.spotLightCount = 0;
+            sceneLights.pointLights.clear();
+            sceneLights.spotLights.clear();
             sceneLights.dirLight = DirectionalLightComponent{};
         }
     };
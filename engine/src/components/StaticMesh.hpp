@@ -18,7 +18,12 @@
 #pragma once
 
 #include "renderer/Attributes.hpp"
+#include "renderer/MeshLod.hpp"
+#include "renderer/MeshPool.hpp"
 #include "renderer/VertexArray.hpp"
+#include "renderer/VertexFormat.hpp"
+
+#include <glm/glm.hpp>
 
 namespace nexo::components {
 
@@ -27,18 +32,44 @@ namespace nexo::components {
 
         renderer::RequiredAttributes meshAttributes;
 
+        // Local space bounding box, the default one encloses every primitive
+        glm::vec3 localMin{-1.0f};
+        glm::vec3 localMax{1.0f};
+
+        // Simplified levels of the mesh, from the finest to the coarsest, empty for the primitives
+        std::vector<renderer::NxMeshLod> lods;
+
+        // How the shaders decode the vertices of vao, the primitives use the standard format
+        renderer::NxVertexDecode vertexDecode;
+
+        // Part of vao drawn by the mesh, imported meshes share the vertex array of their mesh pool page
+        renderer::NxMeshRange range;
+        std::shared_ptr<const renderer::NxMeshAllocation> allocation;
+
         struct Memento {
             std::shared_ptr<renderer::NxVertexArray> vao;
+            glm::vec3 localMin;
+            glm::vec3 localMax;
+            std::vector<renderer::NxMeshLod> lods;
+            renderer::NxVertexDecode vertexDecode;
+            renderer::NxMeshRange range;
+            std::shared_ptr<const renderer::NxMeshAllocation> allocation;
         };
 
         void restore(const Memento &memento)
         {
             vao = memento.vao;
+            localMin = memento.localMin;
+            localMax = memento.localMax;
+            lods = memento.lods;
+            vertexDecode = memento.vertexDecode;
+            range = memento.range;
+            allocation = memento.allocation;
         }
 
         [[nodiscard]] Memento save() const
         {
-            return {vao};
+            return {vao, localMin, localMax, lods, vertexDecode, range, allocation};
         }
     };
 
@@ -17,6 +17,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Input.hpp"
 #include "renderer/RendererExceptions.hpp"
+#include "renderer/GraphicsApi.hpp"
+#include "headless/InputHeadless.hpp"
 #ifdef NX_GRAPHICS_API_OPENGL
     #include "opengl/InputOpenGl.hpp"
 #endif
@@ -31,6 +33,10 @@ namespace nexo::event {
         if (_instance)
             return;
 
+        if (renderer::NxGetGraphicsApi() == renderer::NxGraphicsApi::HEADLESS) {
+            _instance = std::make_shared<InputHeadless>(window);
+            return;
+        }
         #ifdef NX_GRAPHICS_API_OPENGL
             _instance = std::make_shared<InputOpenGl>(window);
         #else
@@ -45,18 +45,4 @@ namespace nexo::core {
                                            const std::source_location loc = std::source_location::current())
                 : Exception(message, loc) {}
     };
-
-    class TooManyPointLightsException : public Exception {
-    	public:
-     		explicit TooManyPointLightsException(unsigned int sceneRendered, size_t nbPointLights,
-                                           const std::source_location loc = std::source_location::current())
-                : Exception(std::format("Too many point lights ({} > {}) in scene [{}]", nbPointLights, MAX_POINT_LIGHTS, sceneRendered), loc) {}
-    };
-
-    class TooManySpotLightsException : public Exception {
-    	public:
-     		explicit TooManySpotLightsException(unsigned int sceneRendered, size_t nbSpotLights,
-                                           const std::source_location loc = std::source_location::current())
-       : Exception(std::format("Too many spot lights ({} > {}) in scene [{}]", nbSpotLights, MAX_SPOT_LIGHTS, sceneRendered), loc) {}
-    };
 }
@@ -0,0 +1,168 @@
+//// AllocationCounter.cpp ////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the global heap allocation counter
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "AllocationCounter.hpp"
+
+#ifdef NEXO_TRACK_ALLOCATIONS
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#endif
+
+namespace nexo::memory {
+
+#ifdef NEXO_TRACK_ALLOCATIONS
+    namespace {
+        std::atomic<uint64_t> g_allocations{0};
+        std::atomic<uint64_t> g_deallocations{0};
+        std::atomic<uint64_t> g_allocatedBytes{0};
+
+        void *countedAllocate(size_t size, const size_t alignment)
+        {
+            if (size == 0)
+                size = 1;
+            void *ptr = nullptr;
+            if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                ptr = std::malloc(size);
+            else {
+#ifdef _WIN32
+                ptr = _aligned_malloc(size, alignment);
+#else
+                // aligned_alloc requires the size to be a multiple of the alignment
+                ptr = std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+            }
+            if (ptr) {
+                g_allocations.fetch_add(1, std::memory_order_relaxed);
+                g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+            }
+            return ptr;
+        }
+
+        void countedFree(void *ptr, const size_t alignment) noexcept
+        {
+            if (!ptr)
+                return;
+            g_deallocations.fetch_add(1, std::memory_order_relaxed);
+#ifdef _WIN32
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                _aligned_free(ptr);
+                return;
+            }
+#else
+            (void)alignment;
+#endif
+            std::free(ptr);
+        }
+
+        void *allocateOrThrow(const size_t size, const size_t alignment)
+        {
+            while (true) {
+                if (void *ptr = countedAllocate(size, alignment))
+                    return ptr;
+                const std::new_handler handler = std::get_new_handler();
+                if (!handler)
+                    throw std::bad_alloc();
+                handler();
+            }
+        }
+    }
+
+    AllocationStats getAllocationStats()
+    {
+        return {g_allocations.load(std::memory_order_relaxed), g_deallocations.load(std::memory_order_relaxed),
+                g_allocatedBytes.load(std::memory_order_relaxed)};
+    }
+#else
+    AllocationStats getAllocationStats()
+    {
+        return {};
+    }
+#endif
+
+}
+
+#ifdef NEXO_TRACK_ALLOCATIONS
+using nexo::memory::allocateOrThrow;
+using nexo::memory::countedAllocate;
+using nexo::memory::countedFree;
+
+void *operator new(const size_t size) { return allocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void *operator new[](const size_t size) { return allocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void *operator new(const size_t size, std::align_val_t alignment)
+{
+    return allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+void *operator new[](const size_t size, std::align_val_t alignment)
+{
+    return allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+void *operator new(const size_t size, const std::nothrow_t &) noexcept
+{
+    return countedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void *operator new[](const size_t size, const std::nothrow_t &) noexcept
+{
+    return countedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void *operator new(const size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    return countedAllocate(size, static_cast<size_t>(alignment));
+}
+void *operator new[](const size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    return countedAllocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void *ptr) noexcept { countedFree(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete[](void *ptr) noexcept { countedFree(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete(void *ptr, size_t) noexcept { countedFree(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete[](void *ptr, size_t) noexcept { countedFree(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete(void *ptr, std::align_val_t alignment) noexcept
+{
+    countedFree(ptr, static_cast<size_t>(alignment));
+}
+void operator delete[](void *ptr, std::align_val_t alignment) noexcept
+{
+    countedFree(ptr, static_cast<size_t>(alignment));
+}
+void operator delete(void *ptr, size_t, std::align_val_t alignment) noexcept
+{
+    countedFree(ptr, static_cast<size_t>(alignment));
+}
+void operator delete[](void *ptr, size_t, std::align_val_t alignment) noexcept
+{
+    countedFree(ptr, static_cast<size_t>(alignment));
+}
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+    countedFree(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+    countedFree(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void operator delete(void *ptr, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    countedFree(ptr, static_cast<size_t>(alignment));
+}
+void operator delete[](void *ptr, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    countedFree(ptr, static_cast<size_t>(alignment));
+}
+#endif
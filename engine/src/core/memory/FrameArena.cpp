@@ -0,0 +1,118 @@
+//// FrameArena.cpp ///////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the per-frame linear allocator
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FrameArena.hpp"
+
+#include <algorithm>
+#include <memory>
+
+namespace nexo::memory {
+
+    // Keeps the block data aligned for any fundamental type
+    static constexpr size_t BLOCK_HEADER_SIZE = (sizeof(void *) + sizeof(size_t) + alignof(std::max_align_t) - 1)
+                                                & ~(alignof(std::max_align_t) - 1);
+
+    LinearArena::LinearArena(const size_t capacity, std::pmr::memory_resource *upstream) : m_upstream(upstream)
+    {
+        m_head = allocateBlock(capacity);
+        m_capacity = capacity;
+    }
+
+    LinearArena::~LinearArena()
+    {
+        releaseBlocks(m_head);
+    }
+
+    LinearArena::Block *LinearArena::allocateBlock(const size_t size)
+    {
+        void *memory = m_upstream->allocate(BLOCK_HEADER_SIZE + size, alignof(std::max_align_t));
+        return ::new (memory) Block{nullptr, size};
+    }
+
+    void LinearArena::releaseBlocks(Block *block)
+    {
+        while (block) {
+            Block *next = block->next;
+            m_upstream->deallocate(block, BLOCK_HEADER_SIZE + block->size, alignof(std::max_align_t));
+            block = next;
+        }
+    }
+
+    std::byte *LinearArena::blockData(Block *block)
+    {
+        return reinterpret_cast<std::byte *>(block) + BLOCK_HEADER_SIZE;
+    }
+
+    void *LinearArena::do_allocate(const size_t bytes, const size_t alignment)
+    {
+        void *ptr = blockData(m_head) + m_offset;
+        size_t space = m_head->size - m_offset;
+        if (!std::align(alignment, bytes, ptr, space)) {
+            // Chain a new block, at least as big as the previous one so the number of blocks stays logarithmic
+            Block *block = allocateBlock(std::max(m_head->size, bytes + alignment));
+            block->next = m_head;
+            m_head = block;
+            m_offset = 0;
+            m_capacity += block->size;
+            ++m_overflowCount;
+            ptr = blockData(m_head);
+            space = m_head->size;
+            std::align(alignment, bytes, ptr, space);
+        }
+        const size_t newOffset = static_cast<size_t>(static_cast<std::byte *>(ptr) - blockData(m_head)) + bytes;
+        m_used += newOffset - m_offset;
+        m_offset = newOffset;
+        m_peak = std::max(m_peak, m_used);
+        return ptr;
+    }
+
+    void LinearArena::do_deallocate([[maybe_unused]] void *p, [[maybe_unused]] size_t bytes,
+                                    [[maybe_unused]] size_t alignment)
+    {
+        // Memory is reclaimed in bulk by reset()
+    }
+
+    bool LinearArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+    {
+        return this == &other;
+    }
+
+    void LinearArena::reset()
+    {
+        if (m_head->next) {
+            releaseBlocks(m_head);
+            m_capacity = std::max(m_capacity, m_peak);
+            m_head = allocateBlock(m_capacity);
+        }
+        m_offset = 0;
+        m_used = 0;
+    }
+
+    FrameArena &FrameArena::get()
+    {
+        static FrameArena instance;
+        return instance;
+    }
+
+    void FrameArena::endFrame()
+    {
+        m_index ^= 1;
+        m_arenas[m_index].reset();
+    }
+
+}
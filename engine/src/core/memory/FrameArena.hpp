@@ -0,0 +1,114 @@
+//// FrameArena.hpp ///////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the per-frame linear allocator
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+namespace nexo::memory {
+
+    /**
+     * @brief Bump allocator backing the temporaries of a single frame.
+     *
+     * Allocations only move a cursor forward and deallocations are no-ops: the whole arena is released at once with
+     * `reset()`. When the current block is exhausted a new block is chained from the upstream resource; on the next
+     * reset the chain is coalesced into a single block large enough for the peak usage seen so far, so a workload that
+     * does not grow stops hitting the upstream resource after a couple of frames.
+     *
+     * The arena is not thread safe, it is meant to be used by the thread that owns the frame.
+     */
+    class LinearArena final : public std::pmr::memory_resource {
+        public:
+            static constexpr size_t DEFAULT_CAPACITY = 256 * 1024;
+
+            explicit LinearArena(size_t capacity = DEFAULT_CAPACITY,
+                                 std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+            ~LinearArena() override;
+
+            LinearArena(const LinearArena &) = delete;
+            LinearArena &operator=(const LinearArena &) = delete;
+            LinearArena(LinearArena &&) = delete;
+            LinearArena &operator=(LinearArena &&) = delete;
+
+            /**
+             * @brief Releases every allocation made since the last reset.
+             *
+             * O(1) when the frame fit in the current block. If blocks had to be chained, they are returned upstream
+             * and replaced by a single block sized after the peak usage.
+             */
+            void reset();
+
+            [[nodiscard]] size_t used() const { return m_used; }
+            [[nodiscard]] size_t capacity() const { return m_capacity; }
+            [[nodiscard]] size_t peak() const { return m_peak; }
+            /// Number of blocks chained from the upstream resource since construction
+            [[nodiscard]] size_t overflowCount() const { return m_overflowCount; }
+
+        protected:
+            void *do_allocate(size_t bytes, size_t alignment) override;
+            void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+            [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+        private:
+            struct Block {
+                Block *next;
+                size_t size;
+            };
+
+            Block *allocateBlock(size_t size);
+            void releaseBlocks(Block *block);
+            [[nodiscard]] static std::byte *blockData(Block *block);
+
+            std::pmr::memory_resource *m_upstream;
+            Block *m_head = nullptr;     ///< Block currently bumped into, chained to the previous ones
+            size_t m_offset = 0;         ///< Cursor inside the head block
+            size_t m_capacity = 0;       ///< Usable size of all the chained blocks
+            size_t m_used = 0;           ///< Bytes handed out since the last reset (alignment padding included)
+            size_t m_peak = 0;
+            size_t m_overflowCount = 0;
+    };
+
+    /**
+     * @brief Double-buffered frame arena.
+     *
+     * `resource()` hands out the arena of the frame being built. `endFrame()` flips the two arenas and resets the one
+     * that becomes current, so data allocated during frame N stays valid until the end of frame N + 1 (for instance
+     * for a consumer that lags one frame behind).
+     */
+    class FrameArena {
+        public:
+            static FrameArena &get();
+
+            [[nodiscard]] std::pmr::memory_resource *resource() { return &current(); }
+            [[nodiscard]] LinearArena &current() { return m_arenas[m_index]; }
+            [[nodiscard]] LinearArena &previous() { return m_arenas[m_index ^ 1]; }
+
+            /**
+             * @brief Flips the arenas and releases everything allocated two frames ago.
+             */
+            void endFrame();
+
+        private:
+            FrameArena() = default;
+
+            std::array<LinearArena, 2> m_arenas;
+            unsigned int m_index = 0;
+    };
+
+}
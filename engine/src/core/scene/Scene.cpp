@@ -72,12 +72,27 @@ namespace nexo::scene {
         }
     }
 
+	void Scene::addTaggedEntities(const std::span<const ecs::Entity> entities)
+	{
+		m_entities.insert(entities.begin(), entities.end());
+	}
+
 	void Scene::removeEntity(const ecs::Entity entity)
 	{
 		m_coordinator->removeComponent<components::SceneTag>(entity);
 		m_entities.erase(entity);
 	}
 
+	void Scene::refreshEntities()
+	{
+		m_entities.clear();
+		for (const ecs::Entity entity : m_coordinator->getAllEntitiesWith<components::SceneTag>())
+		{
+			if (m_coordinator->getComponent<components::SceneTag>(entity).id == m_id)
+				m_entities.insert(entity);
+		}
+	}
+
 	void Scene::setActiveStatus(const bool active)
 	{
 		m_active = active;
@@ -20,6 +20,7 @@
 #include "ecs/Coordinator.hpp"
 #include "components/Model.hpp"
 #include <set>
+#include <span>
 
 namespace nexo::scene {
 	inline unsigned int nextSceneId = 0;
@@ -62,6 +63,15 @@ namespace nexo::scene {
 			void addEntity(ecs::Entity entity);
 			void addChildEntityToScene(ecs::Entity entity);
 
+			/**
+			* @brief Adds entities already carrying the SceneTag of the scene.
+			*
+			* Used when the tags are inserted in bulk, e.g. by a prefab instantiation.
+			*
+			* @param entities The entity identifiers to add.
+			*/
+			void addTaggedEntities(std::span<const ecs::Entity> entities);
+
 			/**
              * @brief Removes an entity from the scene.
              *
@@ -71,6 +81,14 @@ namespace nexo::scene {
              */
 			void removeEntity(ecs::Entity entity);
 
+			/**
+             * @brief Rebuilds the scene's entity set from the SceneTag components.
+             *
+             * Used after the ECS world has been restored from a snapshot, which may have brought
+             * back or removed entities behind the scene's back.
+             */
+			void refreshEntities();
+
 			/**
              * @brief Sets the active status for the scene.
              *
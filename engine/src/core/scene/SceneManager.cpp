@@ -20,6 +20,7 @@
 #include "Exception.hpp"
 #include "core/exceptions/Exceptions.hpp"
 #include <cmath>
+#include <ranges>
 
 namespace nexo::scene {
 	SceneManager::SceneManager() = default;
@@ -59,4 +60,10 @@ namespace nexo::scene {
 		return m_scenes.at(id);
 	}
 
+	void SceneManager::refreshSceneEntities()
+	{
+		for (auto &scene : m_scenes | std::views::values)
+			scene.refreshEntities();
+	}
+
 }
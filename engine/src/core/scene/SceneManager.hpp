@@ -91,6 +91,11 @@ namespace nexo::scene {
              */
 			Scene &getScene(unsigned int id);
 
+			/**
+             * @brief Rebuilds the entity set of every scene from the SceneTag components.
+             */
+			void refreshSceneEntities();
+
 		private:
 			std::shared_ptr<ecs::Coordinator> m_coordinator = nullptr;
 			std::unordered_map<unsigned int, Scene> m_scenes;
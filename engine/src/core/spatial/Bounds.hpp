@@ -0,0 +1,191 @@
+//// Bounds.hpp ///////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the bounding volumes used by the spatial queries
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace nexo::spatial {
+
+    /**
+     * @brief Axis aligned bounding box.
+     *
+     * A default constructed box is empty (min above max), expanding it by a point or a box makes it valid.
+     */
+    struct Aabb {
+        glm::vec3 min{std::numeric_limits<float>::max()};
+        glm::vec3 max{std::numeric_limits<float>::lowest()};
+
+        Aabb() = default;
+        Aabb(const glm::vec3 &boxMin, const glm::vec3 &boxMax) : min(boxMin), max(boxMax) {}
+
+        /**
+         * @brief Bounds of a local space box once transformed, tighter than transforming its eight corners.
+         */
+        static Aabb fromTransformed(const glm::vec3 &localMin, const glm::vec3 &localMax, const glm::mat4 &transform)
+        {
+            const glm::vec3 translation(transform[3]);
+            Aabb result(translation, translation);
+            for (int column = 0; column < 3; ++column) {
+                const glm::vec3 axis(transform[column]);
+                const glm::vec3 a = axis * localMin[column];
+                const glm::vec3 b = axis * localMax[column];
+                result.min += glm::min(a, b);
+                result.max += glm::max(a, b);
+            }
+            return result;
+        }
+
+        [[nodiscard]] bool isValid() const { return min.x <= max.x && min.y <= max.y && min.z <= max.z; }
+
+        void expand(const glm::vec3 &point)
+        {
+            min = glm::min(min, point);
+            max = glm::max(max, point);
+        }
+
+        void expand(const Aabb &other)
+        {
+            min = glm::min(min, other.min);
+            max = glm::max(max, other.max);
+        }
+
+        [[nodiscard]] Aabb merged(const Aabb &other) const
+        {
+            return {glm::min(min, other.min), glm::max(max, other.max)};
+        }
+
+        [[nodiscard]] Aabb inflated(const float margin) const
+        {
+            return {min - glm::vec3(margin), max + glm::vec3(margin)};
+        }
+
+        [[nodiscard]] glm::vec3 center() const { return (min + max) * 0.5f; }
+
+        [[nodiscard]] float surfaceArea() const
+        {
+            const glm::vec3 size = max - min;
+            return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+        }
+
+        [[nodiscard]] bool contains(const Aabb &other) const
+        {
+            return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z &&
+                   max.x >= other.max.x && max.y >= other.max.y && max.z >= other.max.z;
+        }
+
+        [[nodiscard]] bool overlaps(const Aabb &other) const
+        {
+            return min.x <= other.max.x && max.x >= other.min.x &&
+                   min.y <= other.max.y && max.y >= other.min.y &&
+                   min.z <= other.max.z && max.z >= other.min.z;
+        }
+
+        /**
+         * @brief Squared distance from a point to the box, 0 if the point is inside.
+         */
+        [[nodiscard]] float distanceSquared(const glm::vec3 &point) const
+        {
+            const glm::vec3 delta = glm::max(glm::max(min - point, point - max), glm::vec3(0.0f));
+            return glm::dot(delta, delta);
+        }
+
+        /**
+         * @brief Slab test of a ray against the box.
+         *
+         * @param origin Origin of the ray.
+         * @param inverseDirection Component-wise inverse of the ray direction.
+         * @param maxDistance Length of the ray, in units of its direction.
+         * @param entry Receives the distance at which the ray enters the box, 0 if it starts inside.
+         * @return true if the ray hits the box before maxDistance.
+         */
+        [[nodiscard]] bool intersectRay(const glm::vec3 &origin, const glm::vec3 &inverseDirection,
+                                        const float maxDistance, float &entry) const
+        {
+            const glm::vec3 t0 = (min - origin) * inverseDirection;
+            const glm::vec3 t1 = (max - origin) * inverseDirection;
+            const glm::vec3 slabEntry = glm::min(t0, t1);
+            const glm::vec3 slabExit = glm::max(t0, t1);
+            const float tNear = std::max({slabEntry.x, slabEntry.y, slabEntry.z, 0.0f});
+            const float tFar = std::min({slabExit.x, slabExit.y, slabExit.z, maxDistance});
+            entry = tNear;
+            return tNear <= tFar;
+        }
+    };
+
+    /**
+     * @brief Six clipping planes of a view, normals pointing inside.
+     */
+    struct Frustum {
+        std::array<glm::vec4, 6> planes{};
+
+        /**
+         * @brief Extracts the planes of a view projection matrix (Gribb-Hartmann), OpenGL clip space conventions.
+         */
+        static Frustum fromMatrix(const glm::mat4 &viewProjection)
+        {
+            Frustum frustum;
+            for (int axis = 0; axis < 3; ++axis) {
+                for (int side = 0; side < 2; ++side) {
+                    glm::vec4 plane;
+                    for (int column = 0; column < 4; ++column) {
+                        const float w = viewProjection[column][3];
+                        const float value = viewProjection[column][axis];
+                        plane[column] = side == 0 ? w + value : w - value;
+                    }
+                    const float length = glm::length(glm::vec3(plane));
+                    frustum.planes[axis * 2 + side] = length > 0.0f ? plane / length : plane;
+                }
+            }
+            return frustum;
+        }
+
+        /**
+         * @brief Conservative overlap test, a few boxes near the frustum corners may pass while being outside.
+         */
+        [[nodiscard]] bool intersects(const Aabb &box) const
+        {
+            for (const auto &plane : planes) {
+                // Corner of the box the farthest along the plane normal
+                const glm::vec3 positive(plane.x >= 0.0f ? box.max.x : box.min.x,
+                                         plane.y >= 0.0f ? box.max.y : box.min.y,
+                                         plane.z >= 0.0f ? box.max.z : box.min.z);
+                if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f)
+                    return false;
+            }
+            return true;
+        }
+
+        [[nodiscard]] bool contains(const Aabb &box) const
+        {
+            for (const auto &plane : planes) {
+                // Corner of the box the farthest against the plane normal
+                const glm::vec3 negative(plane.x >= 0.0f ? box.min.x : box.max.x,
+                                         plane.y >= 0.0f ? box.min.y : box.max.y,
+                                         plane.z >= 0.0f ? box.min.z : box.max.z);
+                if (glm::dot(glm::vec3(plane), negative) + plane.w < 0.0f)
+                    return false;
+            }
+            return true;
+        }
+    };
+
+}
@@ -0,0 +1,531 @@
+//// DynamicBvh.cpp ///////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the dynamic bounding volume hierarchy
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "DynamicBvh.hpp"
+#include "Exception.hpp"
+#include "ecs/ECSExceptions.hpp"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+
+namespace nexo::spatial {
+
+    namespace {
+
+        constexpr unsigned int BIN_COUNT = 16;
+        // Ranges of at most this many leaves are split at the median instead of binned
+        constexpr uint32_t SMALL_RANGE = 4;
+        // The quality of the tree is checked once this share of its leaves changed since the last build...
+        constexpr float REBUILD_CHANGE_RATIO = 0.25f;
+        constexpr size_t REBUILD_MIN_CHANGES = 64;
+        // ...and the tree is rebuilt if its cost per leaf grew by this factor
+        constexpr float REBUILD_COST_RATIO = 1.3f;
+
+        bool operator==(const Aabb &a, const Aabb &b)
+        {
+            return a.min == b.min && a.max == b.max;
+        }
+
+    }
+
+    DynamicBvh::DynamicBvh(const float margin) : m_margin(margin)
+    {
+    }
+
+    int32_t DynamicBvh::allocateNode()
+    {
+        if (m_freeList == NULL_NODE) {
+            m_nodes.emplace_back();
+            return static_cast<int32_t>(m_nodes.size() - 1);
+        }
+        const int32_t node = m_freeList;
+        m_freeList = m_nodes[node].right;
+        m_nodes[node] = Node{};
+        return node;
+    }
+
+    void DynamicBvh::releaseNode(const int32_t node)
+    {
+        m_nodes[node] = Node{};
+        m_nodes[node].right = m_freeList;
+        m_freeList = node;
+    }
+
+    void DynamicBvh::insert(const ecs::Entity entity, const Aabb &bounds)
+    {
+        if (contains(entity)) {
+            update(entity, bounds);
+            return;
+        }
+        const int32_t leaf = allocateNode();
+        m_nodes[leaf].bounds = bounds.inflated(m_margin);
+        m_nodes[leaf].entity = entity;
+
+        if (entity >= m_slots.size())
+            m_slots.resize(std::max<size_t>(entity + 1, m_slots.size() * 2));
+        m_slots[entity] = {leaf, static_cast<uint32_t>(m_entities.size())};
+        m_entities.push_back(entity);
+
+        m_pendingLeaves.push_back(leaf);
+        ++m_changesSinceBuild;
+    }
+
+    bool DynamicBvh::update(const ecs::Entity entity, const Aabb &bounds)
+    {
+        if (!contains(entity)) {
+            insert(entity, bounds);
+            return true;
+        }
+        const int32_t leaf = m_slots[entity].node;
+        if (m_nodes[leaf].bounds.contains(bounds))
+            return false;
+        m_nodes[leaf].bounds = bounds.inflated(m_margin);
+        m_dirtyLeaves.push_back(leaf);
+        ++m_changesSinceBuild;
+        return true;
+    }
+
+    void DynamicBvh::remove(const ecs::Entity entity)
+    {
+        if (!contains(entity))
+            return;
+        const Slot slot = m_slots[entity];
+        if (isLinked(slot.node))
+            removeLeaf(slot.node);
+        else
+            std::erase(m_pendingLeaves, slot.node);
+        releaseNode(slot.node);
+
+        const ecs::Entity last = m_entities.back();
+        m_entities[slot.index] = last;
+        m_slots[last].index = slot.index;
+        m_entities.pop_back();
+        m_slots[entity] = {};
+        ++m_changesSinceBuild;
+    }
+
+    bool DynamicBvh::isLinked(const int32_t leaf) const
+    {
+        return leaf == m_root || m_nodes[leaf].parent != NULL_NODE;
+    }
+
+    bool DynamicBvh::contains(const ecs::Entity entity) const
+    {
+        return entity < m_slots.size() && m_slots[entity].node != NULL_NODE;
+    }
+
+    const Aabb &DynamicBvh::getBounds(const ecs::Entity entity) const
+    {
+        if (!contains(entity))
+            THROW_EXCEPTION(ecs::OutOfRange, entity);
+        return m_nodes[m_slots[entity].node].bounds;
+    }
+
+    void DynamicBvh::clear()
+    {
+        m_nodes.clear();
+        m_root = NULL_NODE;
+        m_freeList = NULL_NODE;
+        m_slots.clear();
+        m_entities.clear();
+        m_pendingLeaves.clear();
+        m_dirtyLeaves.clear();
+        m_changesSinceBuild = 0;
+        m_builtCostPerLeaf = 0.0f;
+    }
+
+    void DynamicBvh::insertLeaf(const int32_t leaf)
+    {
+        if (m_root == NULL_NODE) {
+            m_root = leaf;
+            m_nodes[leaf].parent = NULL_NODE;
+            return;
+        }
+
+        // Walk down towards the sibling whose pairing with the leaf adds the least surface area
+        const Aabb leafBounds = m_nodes[leaf].bounds;
+        int32_t sibling = m_root;
+        while (!m_nodes[sibling].isLeaf()) {
+            const Node &node = m_nodes[sibling];
+            const float area = node.bounds.surfaceArea();
+            const float combinedArea = node.bounds.merged(leafBounds).surfaceArea();
+            // Pairing with this node creates a parent covering both
+            const float cost = 2.0f * combinedArea;
+            // Descending further grows this node anyway
+            const float inheritedCost = 2.0f * (combinedArea - area);
+
+            const auto childCost = [&](const int32_t child) {
+                const Aabb &childBounds = m_nodes[child].bounds;
+                const float mergedArea = childBounds.merged(leafBounds).surfaceArea();
+                return m_nodes[child].isLeaf() ? mergedArea + inheritedCost
+                                               : mergedArea - childBounds.surfaceArea() + inheritedCost;
+            };
+            const float leftCost = childCost(node.left);
+            const float rightCost = childCost(node.right);
+            if (cost < leftCost && cost < rightCost)
+                break;
+            sibling = leftCost < rightCost ? node.left : node.right;
+        }
+
+        const int32_t oldParent = m_nodes[sibling].parent;
+        const int32_t newParent = allocateNode();
+        Node &parent = m_nodes[newParent];
+        parent.parent = oldParent;
+        parent.bounds = m_nodes[sibling].bounds.merged(leafBounds);
+        parent.left = sibling;
+        parent.right = leaf;
+        m_nodes[sibling].parent = newParent;
+        m_nodes[leaf].parent = newParent;
+
+        if (oldParent == NULL_NODE) {
+            m_root = newParent;
+            return;
+        }
+        if (m_nodes[oldParent].left == sibling)
+            m_nodes[oldParent].left = newParent;
+        else
+            m_nodes[oldParent].right = newParent;
+        refitAncestors(oldParent);
+    }
+
+    void DynamicBvh::removeLeaf(const int32_t leaf)
+    {
+        if (leaf == m_root) {
+            m_root = NULL_NODE;
+            return;
+        }
+        const int32_t parent = m_nodes[leaf].parent;
+        const int32_t grandParent = m_nodes[parent].parent;
+        const int32_t sibling = m_nodes[parent].left == leaf ? m_nodes[parent].right : m_nodes[parent].left;
+
+        m_nodes[sibling].parent = grandParent;
+        releaseNode(parent);
+        if (grandParent == NULL_NODE) {
+            m_root = sibling;
+            return;
+        }
+        if (m_nodes[grandParent].left == parent)
+            m_nodes[grandParent].left = sibling;
+        else
+            m_nodes[grandParent].right = sibling;
+        refitAncestors(grandParent);
+    }
+
+    void DynamicBvh::refitAncestors(int32_t node)
+    {
+        while (node != NULL_NODE) {
+            Node &current = m_nodes[node];
+            const Aabb bounds = m_nodes[current.left].bounds.merged(m_nodes[current.right].bounds);
+            // The ancestors already enclose the unchanged bounds
+            if (bounds == current.bounds)
+                return;
+            current.bounds = bounds;
+            node = current.parent;
+        }
+    }
+
+    void DynamicBvh::refit()
+    {
+        for (const int32_t leaf : m_dirtyLeaves) {
+            // The leaf may have been removed since it was updated, released nodes have no parent
+            if (m_nodes[leaf].isLeaf())
+                refitAncestors(m_nodes[leaf].parent);
+        }
+        m_dirtyLeaves.clear();
+
+        const size_t changeThreshold = std::max(REBUILD_MIN_CHANGES,
+            static_cast<size_t>(static_cast<float>(m_entities.size()) * REBUILD_CHANGE_RATIO));
+        // Building from scratch is faster than linking a large batch one leaf at a time
+        if (m_pendingLeaves.size() >= changeThreshold) {
+            rebuild();
+            return;
+        }
+        for (const int32_t leaf : m_pendingLeaves)
+            insertLeaf(leaf);
+        m_pendingLeaves.clear();
+
+        if (m_entities.size() < 2 || m_changesSinceBuild < changeThreshold)
+            return;
+        const float costPerLeaf = cost() / static_cast<float>(m_entities.size());
+        if (m_builtCostPerLeaf == 0.0f || costPerLeaf > m_builtCostPerLeaf * REBUILD_COST_RATIO)
+            rebuild();
+        else
+            m_changesSinceBuild = 0;
+    }
+
+    void DynamicBvh::rebuild()
+    {
+        m_pendingLeaves.clear();
+        m_dirtyLeaves.clear();
+        m_changesSinceBuild = 0;
+        if (m_entities.empty())
+            return;
+
+        // Release the internal nodes, the leaves keep their index
+        m_stack.clear();
+        if (m_root != NULL_NODE)
+            m_stack.push_back(m_root);
+        while (!m_stack.empty()) {
+            const int32_t node = m_stack.back();
+            m_stack.pop_back();
+            if (m_nodes[node].isLeaf())
+                continue;
+            m_stack.push_back(m_nodes[node].left);
+            m_stack.push_back(m_nodes[node].right);
+            releaseNode(node);
+        }
+
+        m_buildItems.clear();
+        m_buildItems.reserve(m_entities.size());
+        for (const ecs::Entity entity : m_entities) {
+            const int32_t leaf = m_slots[entity].node;
+            m_buildItems.push_back({m_nodes[leaf].bounds, m_nodes[leaf].bounds.center(), leaf});
+        }
+        m_root = buildRange(0, static_cast<uint32_t>(m_buildItems.size()));
+        m_nodes[m_root].parent = NULL_NODE;
+        m_builtCostPerLeaf = cost() / static_cast<float>(m_entities.size());
+    }
+
+    int32_t DynamicBvh::buildRange(const uint32_t begin, const uint32_t end)
+    {
+        if (end - begin == 1)
+            return m_buildItems[begin].leaf;
+
+        Aabb centroidBounds;
+        for (uint32_t i = begin; i < end; ++i)
+            centroidBounds.expand(m_buildItems[i].centroid);
+        const glm::vec3 extent = centroidBounds.max - centroidBounds.min;
+        int axis = 0;
+        if (extent.y > extent[axis])
+            axis = 1;
+        if (extent.z > extent[axis])
+            axis = 2;
+
+        uint32_t middle = begin + (end - begin) / 2;
+        if (end - begin <= SMALL_RANGE) {
+            // Too few leaves for the bins to pay off, split at the median
+            std::nth_element(m_buildItems.begin() + begin, m_buildItems.begin() + middle, m_buildItems.begin() + end,
+                             [axis](const BuildItem &a, const BuildItem &b) { return a.centroid[axis] < b.centroid[axis]; });
+        } else if (extent[axis] > 0.0f) {
+            struct Bin {
+                Aabb bounds;
+                uint32_t count = 0;
+            };
+            std::array<Bin, BIN_COUNT> bins{};
+            const float scale = static_cast<float>(BIN_COUNT) / extent[axis];
+            const auto binOf = [&](const BuildItem &item) {
+                const auto bin = static_cast<unsigned int>((item.centroid[axis] - centroidBounds.min[axis]) * scale);
+                return std::min(bin, BIN_COUNT - 1);
+            };
+            for (uint32_t i = begin; i < end; ++i) {
+                Bin &bin = bins[binOf(m_buildItems[i])];
+                bin.bounds.expand(m_buildItems[i].bounds);
+                ++bin.count;
+            }
+
+            // Cost of the splits after each bin: area of each side weighted by its leaf count
+            std::array<float, BIN_COUNT - 1> rightCosts{};
+            Aabb rightBounds;
+            uint32_t rightCount = 0;
+            for (unsigned int split = BIN_COUNT - 1; split > 0; --split) {
+                rightBounds.expand(bins[split].bounds);
+                rightCount += bins[split].count;
+                rightCosts[split - 1] = rightCount ? rightBounds.surfaceArea() * static_cast<float>(rightCount) : 0.0f;
+            }
+            Aabb leftBounds;
+            uint32_t leftCount = 0;
+            float bestCost = std::numeric_limits<float>::max();
+            unsigned int bestSplit = 0;
+            for (unsigned int split = 0; split < BIN_COUNT - 1; ++split) {
+                leftBounds.expand(bins[split].bounds);
+                leftCount += bins[split].count;
+                if (leftCount == 0 || leftCount == end - begin)
+                    continue;
+                const float splitCost = leftBounds.surfaceArea() * static_cast<float>(leftCount) + rightCosts[split];
+                if (splitCost < bestCost) {
+                    bestCost = splitCost;
+                    bestSplit = split;
+                }
+            }
+            if (bestCost < std::numeric_limits<float>::max()) {
+                const auto first = m_buildItems.begin() + begin;
+                const auto last = m_buildItems.begin() + end;
+                middle = static_cast<uint32_t>(
+                    std::partition(first, last, [&](const BuildItem &item) { return binOf(item) <= bestSplit; }) -
+                    m_buildItems.begin());
+            }
+        }
+
+        const int32_t left = buildRange(begin, middle);
+        const int32_t right = buildRange(middle, end);
+        const int32_t node = allocateNode();
+        Node &current = m_nodes[node];
+        current.left = left;
+        current.right = right;
+        current.bounds = m_nodes[left].bounds.merged(m_nodes[right].bounds);
+        m_nodes[left].parent = node;
+        m_nodes[right].parent = node;
+        return node;
+    }
+
+    float DynamicBvh::cost() const
+    {
+        if (m_root == NULL_NODE || m_nodes[m_root].isLeaf())
+            return 0.0f;
+        float area = 0.0f;
+        std::vector<int32_t> stack{m_root};
+        while (!stack.empty()) {
+            const Node &node = m_nodes[stack.back()];
+            stack.pop_back();
+            if (node.isLeaf())
+                continue;
+            area += node.bounds.surfaceArea();
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+        const float rootArea = m_nodes[m_root].bounds.surfaceArea();
+        return rootArea > 0.0f ? area / rootArea : 0.0f;
+    }
+
+    unsigned int DynamicBvh::height() const
+    {
+        if (m_root == NULL_NODE)
+            return 0;
+        unsigned int height = 0;
+        std::vector<std::pair<int32_t, unsigned int>> stack{{m_root, 0}};
+        while (!stack.empty()) {
+            const auto [node, depth] = stack.back();
+            stack.pop_back();
+            height = std::max(height, depth);
+            if (!m_nodes[node].isLeaf()) {
+                stack.emplace_back(m_nodes[node].left, depth + 1);
+                stack.emplace_back(m_nodes[node].right, depth + 1);
+            }
+        }
+        return height;
+    }
+
+    std::span<const ecs::Entity> DynamicBvh::queryAabb(const Aabb &bounds)
+    {
+        m_results.clear();
+        if (m_root == NULL_NODE)
+            return m_results;
+        m_stack.clear();
+        m_stack.push_back(m_root);
+        while (!m_stack.empty()) {
+            const Node &node = m_nodes[m_stack.back()];
+            m_stack.pop_back();
+            if (!node.bounds.overlaps(bounds))
+                continue;
+            if (node.isLeaf()) {
+                m_results.push_back(node.entity);
+                continue;
+            }
+            m_stack.push_back(node.left);
+            m_stack.push_back(node.right);
+        }
+        return m_results;
+    }
+
+    std::span<const ecs::Entity> DynamicBvh::queryFrustum(const Frustum &frustum)
+    {
+        m_results.clear();
+        if (m_root == NULL_NODE)
+            return m_results;
+        // Subtrees entirely inside the frustum are pushed complemented, their descendants skip the plane tests
+        m_stack.clear();
+        m_stack.push_back(m_root);
+        while (!m_stack.empty()) {
+            const int32_t entry = m_stack.back();
+            m_stack.pop_back();
+            bool inside = entry < 0;
+            const Node &node = m_nodes[inside ? ~entry : entry];
+            if (!inside) {
+                if (!frustum.intersects(node.bounds))
+                    continue;
+                inside = frustum.contains(node.bounds);
+            }
+            if (node.isLeaf()) {
+                m_results.push_back(node.entity);
+                continue;
+            }
+            m_stack.push_back(inside ? ~node.left : node.left);
+            m_stack.push_back(inside ? ~node.right : node.right);
+        }
+        return m_results;
+    }
+
+    std::span<const ecs::Entity> DynamicBvh::queryRay(const glm::vec3 &origin, const glm::vec3 &direction,
+                                                      const float maxDistance)
+    {
+        m_results.clear();
+        if (m_root == NULL_NODE)
+            return m_results;
+        const glm::vec3 inverseDirection = 1.0f / direction;
+        m_candidates.clear();
+        m_stack.clear();
+        m_stack.push_back(m_root);
+        while (!m_stack.empty()) {
+            const int32_t index = m_stack.back();
+            m_stack.pop_back();
+            const Node &node = m_nodes[index];
+            float entry = 0.0f;
+            if (!node.bounds.intersectRay(origin, inverseDirection, maxDistance, entry))
+                continue;
+            if (node.isLeaf()) {
+                m_candidates.emplace_back(entry, index);
+                continue;
+            }
+            m_stack.push_back(node.left);
+            m_stack.push_back(node.right);
+        }
+        std::ranges::sort(m_candidates);
+        for (const auto &[entry, leaf] : m_candidates)
+            m_results.push_back(m_nodes[leaf].entity);
+        return m_results;
+    }
+
+    std::span<const ecs::Entity> DynamicBvh::queryNearest(const glm::vec3 &point, const size_t k)
+    {
+        m_results.clear();
+        if (m_root == NULL_NODE || k == 0)
+            return m_results;
+        // Best first: nodes are visited by increasing distance, the leaves come out in order
+        constexpr auto farther = std::greater<>{};
+        m_candidates.clear();
+        m_candidates.emplace_back(m_nodes[m_root].bounds.distanceSquared(point), m_root);
+        while (!m_candidates.empty() && m_results.size() < k) {
+            std::ranges::pop_heap(m_candidates, farther);
+            const int32_t index = m_candidates.back().second;
+            m_candidates.pop_back();
+            const Node &node = m_nodes[index];
+            if (node.isLeaf()) {
+                m_results.push_back(node.entity);
+                continue;
+            }
+            for (const int32_t child : {node.left, node.right}) {
+                m_candidates.emplace_back(m_nodes[child].bounds.distanceSquared(point), child);
+                std::ranges::push_heap(m_candidates, farther);
+            }
+        }
+        return m_results;
+    }
+
+}
@@ -0,0 +1,174 @@
+//// DynamicBvh.hpp ///////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the dynamic bounding volume hierarchy
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Bounds.hpp"
+#include "ecs/Definitions.hpp"
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace nexo::spatial {
+
+    /**
+     * @class DynamicBvh
+     * @brief Bounding volume hierarchy over the world space bounds of entities, kept up to date incrementally.
+     *
+     * Every entity is a leaf holding its bounds inflated by a margin, so small moves do not touch the tree. Changes
+     * are applied to the tree by `refit`, which has to be called before querying:
+     * - `insert` queues a new leaf. `refit` links it under the sibling that grows the tree the least, or rebuilds the
+     *   whole tree when many leaves were queued at once.
+     * - `update` only rewrites a leaf whose bounds escaped its inflated box, `refit` then refits its ancestors.
+     * - `remove` unlinks the leaf right away.
+     *
+     * `refit` also watches the quality of the tree: once enough leaves changed since the last build and the surface
+     * area heuristic (SAH) cost per leaf degraded past a threshold, the tree is rebuilt top-down with a binned SAH.
+     *
+     * Queries return the matching entities in a span that stays valid until the next query or modification.
+     *
+     * @note This class is not thread-safe, queries reuse internal buffers.
+     */
+    class DynamicBvh {
+        public:
+            static constexpr float DEFAULT_MARGIN = 0.1f;
+
+            explicit DynamicBvh(float margin = DEFAULT_MARGIN);
+
+            /**
+             * @brief Adds an entity to the hierarchy, or updates it if it is already part of it.
+             *
+             * The entity is only returned by the queries once the tree has been refit.
+             */
+            void insert(ecs::Entity entity, const Aabb &bounds);
+
+            /**
+             * @brief Updates the bounds of an entity, the ancestors of its leaf are refit by `refit`.
+             *
+             * @return true if the bounds escaped the inflated box of the leaf and the tree has to be refit.
+             */
+            bool update(ecs::Entity entity, const Aabb &bounds);
+
+            void remove(ecs::Entity entity);
+
+            /**
+             * @brief Links the inserted leaves and propagates the updated bounds, rebuilding the tree if it degraded.
+             */
+            void refit();
+
+            /**
+             * @brief Rebuilds the whole tree with a binned surface area heuristic.
+             */
+            void rebuild();
+
+            void clear();
+
+            [[nodiscard]] bool contains(ecs::Entity entity) const;
+            [[nodiscard]] size_t size() const { return m_entities.size(); }
+            [[nodiscard]] bool empty() const { return m_entities.empty(); }
+            [[nodiscard]] std::span<const ecs::Entity> entities() const { return m_entities; }
+
+            /**
+             * @brief Inflated bounds stored in the leaf of an entity.
+             *
+             * @throws ecs::OutOfRange if the entity is not part of the hierarchy
+             */
+            [[nodiscard]] const Aabb &getBounds(ecs::Entity entity) const;
+
+            /**
+             * @brief Surface area heuristic cost of the tree: area of the internal nodes relative to the root.
+             */
+            [[nodiscard]] float cost() const;
+
+            /// Depth of the deepest leaf, 0 for a single leaf
+            [[nodiscard]] unsigned int height() const;
+
+            [[nodiscard]] std::span<const ecs::Entity> queryAabb(const Aabb &bounds);
+            [[nodiscard]] std::span<const ecs::Entity> queryFrustum(const Frustum &frustum);
+
+            /**
+             * @brief Entities whose bounds are hit by a ray, nearest entry point first.
+             *
+             * @param origin Origin of the ray.
+             * @param direction Direction of the ray, does not need to be normalized.
+             * @param maxDistance Length of the ray, in units of the direction.
+             */
+            [[nodiscard]] std::span<const ecs::Entity> queryRay(const glm::vec3 &origin, const glm::vec3 &direction,
+                                                                float maxDistance = std::numeric_limits<float>::max());
+
+            /**
+             * @brief The k entities whose bounds are the closest to a point, nearest first.
+             */
+            [[nodiscard]] std::span<const ecs::Entity> queryNearest(const glm::vec3 &point, size_t k);
+
+        private:
+            static constexpr int32_t NULL_NODE = -1;
+
+            struct Node {
+                Aabb bounds;
+                int32_t parent = NULL_NODE;
+                int32_t left = NULL_NODE;   ///< NULL_NODE for leaves
+                int32_t right = NULL_NODE;  ///< Next free node once released
+                ecs::Entity entity = ecs::INVALID_ENTITY;
+
+                [[nodiscard]] bool isLeaf() const { return left == NULL_NODE; }
+            };
+
+            // Copies the leaf bounds so the build reads them sequentially
+            struct BuildItem {
+                Aabb bounds;
+                glm::vec3 centroid;
+                int32_t leaf;
+            };
+
+            struct Slot {
+                int32_t node = NULL_NODE;
+                uint32_t index = 0; ///< Position of the entity in m_entities
+            };
+
+            int32_t allocateNode();
+            void releaseNode(int32_t node);
+            void insertLeaf(int32_t leaf);
+            void removeLeaf(int32_t leaf);
+            [[nodiscard]] bool isLinked(int32_t leaf) const;
+            void refitAncestors(int32_t node);
+            int32_t buildRange(uint32_t begin, uint32_t end);
+
+            float m_margin;
+            std::vector<Node> m_nodes;
+            int32_t m_root = NULL_NODE;
+            int32_t m_freeList = NULL_NODE;
+
+            std::vector<Slot> m_slots; ///< Indexed by entity
+            std::vector<ecs::Entity> m_entities;
+
+            std::vector<int32_t> m_pendingLeaves;
+            std::vector<int32_t> m_dirtyLeaves;
+            size_t m_changesSinceBuild = 0;
+            float m_builtCostPerLeaf = 0.0f;
+
+            // Scratch buffers of the build and of the queries
+            std::vector<BuildItem> m_buildItems;
+            std::vector<int32_t> m_stack;
+            std::vector<std::pair<float, int32_t>> m_candidates;
+            std::vector<ecs::Entity> m_results;
+    };
+
+}
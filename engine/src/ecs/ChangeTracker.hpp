@@ -0,0 +1,272 @@
+//// ChangeTracker.hpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the per component array change tracker
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Definitions.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace nexo::ecs {
+
+    /**
+     * @brief Kind of change recorded by a ChangeTracker
+     */
+    enum class ChangeKind : std::uint8_t {
+        ADDED,      ///< The component was inserted on the entity
+        MODIFIED,   ///< The component was written through a tracked access path
+        REMOVED     ///< The component was removed from the entity
+    };
+
+    /**
+     * @brief Single entry of the change log
+     */
+    struct ChangeRecord {
+        Entity entity;
+        Tick tick;
+        ChangeKind kind;
+    };
+
+    /**
+     * @class ChangeTracker
+     * @brief Opt-in change log for a single component array.
+     *
+     * Every addition, modification and removal is stamped with the current tick and appended
+     * to a log ordered by tick. Each entity is logged at most once per kind and per tick, so
+     * querying the changes since a given tick costs time proportional to the number of changed
+     * entities rather than to the size of the array.
+     *
+     * The tracker is disabled by default, in which case every hook is a single branch.
+     *
+     * @note This class is not thread-safe.
+     */
+    class ChangeTracker {
+        public:
+            /**
+             * @brief Number of ticks of history kept by default before the log gets trimmed
+             */
+            static constexpr Tick DEFAULT_RETENTION = 120;
+
+            /**
+             * @brief Enables or disables the tracking
+             *
+             * Disabling the tracker drops the whole history.
+             *
+             * @param enabled true to start recording changes
+             */
+            void setEnabled(const bool enabled)
+            {
+                m_enabled = enabled;
+                if (!enabled) {
+                    m_log.clear();
+                    m_log.shrink_to_fit();
+                    m_entityTicks.clear();
+                    m_entityTicks.shrink_to_fit();
+                }
+            }
+
+            [[nodiscard]] bool isEnabled() const { return m_enabled; }
+
+            /**
+             * @brief Sets the tick used to stamp the upcoming changes
+             *
+             * @param tick The new current tick
+             */
+            void setCurrentTick(const Tick tick) { m_currentTick = tick; }
+
+            [[nodiscard]] Tick getCurrentTick() const { return m_currentTick; }
+
+            /**
+             * @brief Records that a component has been added to an entity
+             *
+             * An addition also counts as a modification.
+             *
+             * @param entity The entity that received the component
+             */
+            void onAdded(const Entity entity)
+            {
+                if (!m_enabled)
+                    return;
+                EntityTicks &ticks = ticksOf(entity);
+                ticks.present = true;
+                record(entity, ticks.added, ChangeKind::ADDED);
+                record(entity, ticks.modified, ChangeKind::MODIFIED);
+            }
+
+            /**
+             * @brief Records a component that already existed when the tracking was enabled
+             *
+             * The entity is marked as owning the component and modified at the current tick, so
+             * observers starting from that tick see the existing state and its later writes.
+             *
+             * @param entity The entity owning the component
+             */
+            void onTracked(const Entity entity)
+            {
+                if (!m_enabled)
+                    return;
+                EntityTicks &ticks = ticksOf(entity);
+                ticks.present = true;
+                record(entity, ticks.modified, ChangeKind::MODIFIED);
+            }
+
+            /**
+             * @brief Records that the component of an entity has been written to
+             *
+             * @param entity The modified entity
+             */
+            void onModified(const Entity entity)
+            {
+                if (!m_enabled)
+                    return;
+                record(entity, ticksOf(entity).modified, ChangeKind::MODIFIED);
+            }
+
+            /**
+             * @brief Records that a component has been removed from an entity
+             *
+             * @param entity The entity that lost the component
+             */
+            void onRemoved(const Entity entity)
+            {
+                if (!m_enabled)
+                    return;
+                EntityTicks &ticks = ticksOf(entity);
+                ticks.present = false;
+                record(entity, ticks.removed, ChangeKind::REMOVED);
+            }
+
+            /**
+             * @brief Collects every entity that had a change of the given kind at or after a tick
+             *
+             * Added and modified queries only report entities that still own the component,
+             * removed queries only report entities that do not own it anymore. Each entity is
+             * reported at most once.
+             *
+             * @param kind The kind of change to look for
+             * @param since The oldest tick to consider (inclusive)
+             * @param out Vector the entities are appended to
+             */
+            void collect(const ChangeKind kind, const Tick since, std::vector<Entity> &out) const
+            {
+                if (!m_enabled)
+                    return;
+                const auto first = std::ranges::lower_bound(m_log, since, {}, &ChangeRecord::tick);
+                for (auto it = first; it != m_log.end(); ++it) {
+                    if (it->kind != kind)
+                        continue;
+                    const EntityTicks &ticks = m_entityTicks[it->entity];
+                    switch (kind) {
+                        case ChangeKind::ADDED:
+                            if (ticks.present && ticks.added == it->tick)
+                                out.push_back(it->entity);
+                            break;
+                        case ChangeKind::MODIFIED:
+                            if (ticks.present && ticks.modified == it->tick)
+                                out.push_back(it->entity);
+                            break;
+                        case ChangeKind::REMOVED:
+                            if (!ticks.present && ticks.removed == it->tick)
+                                out.push_back(it->entity);
+                            break;
+                    }
+                }
+            }
+
+            /**
+             * @brief Checks whether an entity had a change of the given kind at or after a tick
+             *
+             * @param entity The entity to check
+             * @param kind The kind of change to look for
+             * @param since The oldest tick to consider (inclusive)
+             * @return true if such a change is still part of the history
+             */
+            [[nodiscard]] bool changedSince(const Entity entity, const ChangeKind kind, const Tick since) const
+            {
+                if (!m_enabled || entity >= m_entityTicks.size())
+                    return false;
+                const EntityTicks &ticks = m_entityTicks[entity];
+                switch (kind) {
+                    case ChangeKind::ADDED: return ticks.present && ticks.added >= since;
+                    case ChangeKind::MODIFIED: return ticks.present && ticks.modified >= since;
+                    case ChangeKind::REMOVED: return !ticks.present && ticks.removed >= since;
+                }
+                return false;
+            }
+
+            /**
+             * @brief Drops every record older than the given tick
+             *
+             * @param before Records with a tick strictly lower than this one are discarded
+             */
+            void trim(const Tick before)
+            {
+                if (before <= m_oldestTick)
+                    return;
+                m_oldestTick = before;
+                const auto first = std::ranges::lower_bound(m_log, before, {}, &ChangeRecord::tick);
+                m_log.erase(m_log.begin(), first);
+            }
+
+            /**
+             * @brief Number of records currently held in the log
+             */
+            [[nodiscard]] size_t logSize() const { return m_log.size(); }
+
+            /**
+             * @brief Get the estimated memory usage of the tracker
+             *
+             * @return Size in bytes of the log and of the per entity ticks
+             */
+            [[nodiscard]] size_t memoryUsage() const
+            {
+                return sizeof(ChangeRecord) * m_log.capacity() + sizeof(EntityTicks) * m_entityTicks.capacity();
+            }
+
+        private:
+            struct EntityTicks {
+                Tick added = NULL_TICK;
+                Tick modified = NULL_TICK;
+                Tick removed = NULL_TICK;
+                bool present = false;
+            };
+
+            EntityTicks &ticksOf(const Entity entity)
+            {
+                if (entity >= m_entityTicks.size())
+                    m_entityTicks.resize(std::max<size_t>(entity + 1, m_entityTicks.size() * 2));
+                return m_entityTicks[entity];
+            }
+
+            void record(const Entity entity, Tick &lastTick, const ChangeKind kind)
+            {
+                if (lastTick == m_currentTick)
+                    return;
+                lastTick = m_currentTick;
+                m_log.push_back({entity, m_currentTick, kind});
+            }
+
+            bool m_enabled = false;
+            Tick m_currentTick = FIRST_TICK;
+            Tick m_oldestTick = NULL_TICK;
+            std::vector<ChangeRecord> m_log;
+            std::vector<EntityTicks> m_entityTicks;
+    };
+
+}
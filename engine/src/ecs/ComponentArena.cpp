@@ -0,0 +1,99 @@
+//// ComponentArena.cpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the pooled allocator backing type-erased component arrays
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ComponentArena.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <new>
+
+namespace nexo::ecs {
+
+    ComponentArena::~ComponentArena()
+    {
+        trim();
+    }
+
+    size_t ComponentArena::sizeClass(const size_t bytes)
+    {
+        const size_t shift = std::bit_width(std::max(bytes, size_t{1} << MIN_BLOCK_SHIFT) - 1);
+        return shift - MIN_BLOCK_SHIFT;
+    }
+
+    std::byte *ComponentArena::allocate(const size_t bytes, size_t &blockSize)
+    {
+        const size_t sizeClassIndex = sizeClass(bytes);
+        if (sizeClassIndex >= SIZE_CLASS_COUNT)
+            throw std::bad_alloc();
+        blockSize = size_t{1} << (sizeClassIndex + MIN_BLOCK_SHIFT);
+
+        auto &freeList = m_freeLists[sizeClassIndex];
+        if (!freeList.empty()) {
+            std::byte *block = freeList.back();
+            freeList.pop_back();
+            m_pooledBytes -= blockSize;
+            return block;
+        }
+
+        auto *block = static_cast<std::byte *>(::operator new(blockSize, std::align_val_t{COMPONENT_STORAGE_ALIGNMENT}));
+        m_reservedBytes += blockSize;
+        return block;
+    }
+
+    void ComponentArena::deallocate(std::byte *block, const size_t blockSize)
+    {
+        if (!block)
+            return;
+        m_freeLists[sizeClass(blockSize)].push_back(block);
+        m_pooledBytes += blockSize;
+    }
+
+    void ComponentArena::trim()
+    {
+        for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i) {
+            const size_t blockSize = size_t{1} << (i + MIN_BLOCK_SHIFT);
+            for (std::byte *block : m_freeLists[i])
+                ::operator delete(block, std::align_val_t{COMPONENT_STORAGE_ALIGNMENT});
+            m_reservedBytes -= blockSize * m_freeLists[i].size();
+            m_freeLists[i].clear();
+            m_freeLists[i].shrink_to_fit();
+        }
+        m_pooledBytes = 0;
+    }
+
+    std::byte *allocateComponentStorage(ComponentArena *arena, const size_t bytes, size_t &blockSize)
+    {
+        if (arena)
+            return arena->allocate(bytes, blockSize);
+        blockSize = bytes;
+        if (bytes == 0)
+            return nullptr;
+        return static_cast<std::byte *>(::operator new(bytes, std::align_val_t{COMPONENT_STORAGE_ALIGNMENT}));
+    }
+
+    void deallocateComponentStorage(ComponentArena *arena, std::byte *block, const size_t blockSize)
+    {
+        if (arena) {
+            arena->deallocate(block, blockSize);
+            return;
+        }
+        if (block)
+            ::operator delete(block, std::align_val_t{COMPONENT_STORAGE_ALIGNMENT});
+    }
+
+}
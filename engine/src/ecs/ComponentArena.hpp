@@ -0,0 +1,108 @@
+//// ComponentArena.hpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the pooled allocator backing type-erased component arrays
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace nexo::ecs {
+
+    /**
+     * @brief Alignment of every component storage block, enough for any SIMD type up to AVX-512.
+     */
+    constexpr size_t COMPONENT_STORAGE_ALIGNMENT = 64;
+
+    /**
+     * @class ComponentArena
+     * @brief Pooled allocator for the component storage of type-erased arrays.
+     *
+     * Blocks are rounded up to a power of two and aligned on COMPONENT_STORAGE_ALIGNMENT. Released
+     * blocks are kept in per-size free lists, so the buffer left behind when one array grows is
+     * reused by the next array reaching that size instead of going back to the system allocator.
+     *
+     * @note Like the rest of the ECS, the arena is not thread safe.
+     */
+    class ComponentArena {
+        public:
+            ComponentArena() = default;
+            ~ComponentArena();
+
+            ComponentArena(const ComponentArena&) = delete;
+            ComponentArena& operator=(const ComponentArena&) = delete;
+
+            /**
+             * @brief Allocates an aligned block of at least the given size.
+             *
+             * @param bytes The minimum size of the block.
+             * @param blockSize Receives the actual size of the block, the caller may use all of it.
+             * @return std::byte* The block, aligned on COMPONENT_STORAGE_ALIGNMENT.
+             */
+            [[nodiscard]] std::byte *allocate(size_t bytes, size_t &blockSize);
+
+            /**
+             * @brief Gives a block back to the pool.
+             *
+             * @param block A block returned by allocate, or nullptr.
+             * @param blockSize The block size returned by allocate.
+             */
+            void deallocate(std::byte *block, size_t blockSize);
+
+            /**
+             * @brief Returns every pooled block to the system allocator.
+             */
+            void trim();
+
+            /**
+             * @brief Gets the bytes currently obtained from the system allocator (used and pooled).
+             */
+            [[nodiscard]] size_t reservedBytes() const { return m_reservedBytes; }
+
+            /**
+             * @brief Gets the bytes sitting in the free lists, ready to be reused.
+             */
+            [[nodiscard]] size_t pooledBytes() const { return m_pooledBytes; }
+
+        private:
+            static constexpr size_t MIN_BLOCK_SHIFT = 8;
+            static constexpr size_t SIZE_CLASS_COUNT = 48;
+
+            [[nodiscard]] static size_t sizeClass(size_t bytes);
+
+            std::array<std::vector<std::byte *>, SIZE_CLASS_COUNT> m_freeLists;
+            size_t m_reservedBytes = 0;
+            size_t m_pooledBytes = 0;
+    };
+
+    /**
+     * @brief Allocates aligned component storage, from the arena if one is given.
+     *
+     * @param arena The arena to allocate from, or nullptr for the system allocator.
+     * @param bytes The minimum size of the block.
+     * @param blockSize Receives the actual size of the block.
+     * @return std::byte* The block, aligned on COMPONENT_STORAGE_ALIGNMENT.
+     */
+    [[nodiscard]] std::byte *allocateComponentStorage(ComponentArena *arena, size_t bytes, size_t &blockSize);
+
+    /**
+     * @brief Releases a block obtained from allocateComponentStorage with the same arena.
+     */
+    void deallocateComponentStorage(ComponentArena *arena, std::byte *block, size_t blockSize);
+
+}
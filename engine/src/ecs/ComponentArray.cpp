@@ -20,7 +20,9 @@
 
 namespace nexo::ecs {
 
-    TypeErasedComponentArray::TypeErasedComponentArray(const size_t componentSize, const size_t initialCapacity): m_componentSize(componentSize), m_capacity(initialCapacity)
+    TypeErasedComponentArray::TypeErasedComponentArray(const size_t componentSize, const size_t initialCapacity,
+                                                       std::shared_ptr<ComponentArena> arena)
+        : m_arena(std::move(arena)), m_componentSize(componentSize), m_capacity(initialCapacity)
     {
         if (componentSize == 0) {
             throw std::invalid_argument("Component size cannot be zero");
@@ -28,7 +30,12 @@ namespace nexo::ecs {
 
         m_sparse.resize(m_capacity, INVALID_ENTITY);
         m_dense.reserve(m_capacity);
-        m_componentData.reserve(m_capacity * m_componentSize);
+        reallocateData(m_capacity);
+    }
+
+    TypeErasedComponentArray::~TypeErasedComponentArray()
+    {
+        deallocateComponentStorage(m_arena.get(), m_componentData, m_dataBytes);
     }
 
     void TypeErasedComponentArray::insert(const Entity entity, const void* componentData)
@@ -48,21 +55,51 @@ namespace nexo::ecs {
             return;
         }
 
+        ensureDataCapacity(m_size + 1);
+
         const size_t newIndex = m_size;
         m_sparse[entity]      = newIndex;
         m_dense.push_back(entity);
 
-        // Resize component data vector if needed
-        const size_t requiredSize = (m_size + 1) * m_componentSize;
-        if (m_componentData.size() < requiredSize) {
-            m_componentData.resize(requiredSize);
-        }
-
         // Copy component data
-        std::memcpy(m_componentData.data() + newIndex * m_componentSize,
-                    componentData, m_componentSize);
+        std::memcpy(m_componentData + newIndex * m_componentSize, componentData, m_componentSize);
 
         ++m_size;
+        m_changeTracker.onAdded(entity);
+        NEXO_ECS_STAT(++m_counters.inserts);
+    }
+
+    void TypeErasedComponentArray::insertRawBatch(const std::span<const Entity> entities, const void *componentData)
+    {
+        if (entities.empty())
+            return;
+
+        for (size_t i = 0; i < entities.size(); ++i) {
+            const Entity entity = entities[i];
+            const bool outOfRange = entity >= MAX_ENTITIES;
+            if (!outOfRange)
+                ensureSparseCapacity(entity);
+            if (outOfRange || hasComponent(entity)) {
+                for (size_t j = 0; j < i; ++j)
+                    m_sparse[entities[j]] = INVALID_ENTITY;
+                if (outOfRange)
+                    THROW_EXCEPTION(OutOfRange, entity);
+                THROW_EXCEPTION(InternalError, std::format("entity {} already has the component", entity));
+            }
+            // Mark the slot so duplicates inside the batch are caught
+            m_sparse[entity] = m_size + i;
+        }
+
+        ensureDataCapacity(m_size + entities.size());
+        std::memcpy(m_componentData + m_size * m_componentSize, componentData, entities.size() * m_componentSize);
+        m_dense.insert(m_dense.end(), entities.begin(), entities.end());
+        m_size += entities.size();
+        NEXO_ECS_STAT(m_counters.inserts += entities.size());
+
+        if (m_changeTracker.isEnabled()) {
+            for (const Entity entity : entities)
+                m_changeTracker.onAdded(entity);
+        }
     }
 
     void TypeErasedComponentArray::remove(const Entity entity)
@@ -80,8 +117,10 @@ namespace nexo::ecs {
                 std::swap(m_dense[indexToRemove], m_dense[groupLastIndex]);
                 m_sparse[m_dense[indexToRemove]]  = indexToRemove;
                 m_sparse[m_dense[groupLastIndex]] = groupLastIndex;
+                NEXO_ECS_STAT(++m_counters.groupSwaps);
             }
             --m_groupSize;
+            NEXO_ECS_STAT(++m_counters.groupMoves);
             indexToRemove = groupLastIndex;
         }
 
@@ -96,6 +135,8 @@ namespace nexo::ecs {
         m_sparse[entity] = INVALID_ENTITY;
         m_dense.pop_back();
         --m_size;
+        m_changeTracker.onRemoved(entity);
+        NEXO_ECS_STAT(++m_counters.removes);
 
         shrinkIfNeeded();
     }
@@ -134,24 +175,24 @@ namespace nexo::ecs {
     {
         if (!hasComponent(entity))
             return nullptr;
-        return m_componentData.data() + m_sparse[entity] * m_componentSize;
+        return m_componentData + m_sparse[entity] * m_componentSize;
     }
 
     const void* TypeErasedComponentArray::getRawComponent(const Entity entity) const
     {
         if (!hasComponent(entity))
             return nullptr;
-        return m_componentData.data() + m_sparse[entity] * m_componentSize;
+        return m_componentData + m_sparse[entity] * m_componentSize;
     }
 
     void* TypeErasedComponentArray::getRawData()
     {
-        return m_componentData.data();
+        return m_componentData;
     }
 
     const void* TypeErasedComponentArray::getRawData() const
     {
-        return m_componentData.data();
+        return m_componentData;
     }
 
     std::span<const Entity> TypeErasedComponentArray::entities() const
@@ -159,6 +200,103 @@ namespace nexo::ecs {
         return {m_dense.data(), m_size};
     }
 
+    void TypeErasedComponentArray::saveSnapshot(ComponentArraySnapshot &snapshot) const
+    {
+        snapshot.typeHash = 0;
+        snapshot.componentSize = m_componentSize;
+        snapshot.groupSize = m_groupSize;
+        snapshot.encoding = SnapshotEncoding::RAW;
+        snapshot.entities.assign(m_dense.begin(), m_dense.begin() + static_cast<std::ptrdiff_t>(m_size));
+        snapshot.data.assign(m_componentData, m_componentData + m_size * m_componentSize);
+        snapshot.objects.reset();
+    }
+
+    void TypeErasedComponentArray::restoreSnapshot(const ComponentArraySnapshot &snapshot)
+    {
+        const size_t count = snapshot.entities.size();
+        if (count && (snapshot.componentSize != m_componentSize || snapshot.encoding != SnapshotEncoding::RAW))
+            THROW_EXCEPTION(InvalidSnapshot, "snapshot does not match the type-erased component layout");
+        if (snapshot.data.size() != count * m_componentSize)
+            THROW_EXCEPTION(InvalidSnapshot, "raw component block has an unexpected size");
+
+        std::vector<Entity> previous;
+        if (m_changeTracker.isEnabled())
+            previous.assign(m_dense.begin(), m_dense.begin() + static_cast<std::ptrdiff_t>(m_size));
+
+        for (size_t i = 0; i < m_size; ++i)
+            m_sparse[m_dense[i]] = INVALID_ENTITY;
+        ensureDataCapacity(count);
+        if (count)
+            std::memcpy(m_componentData, snapshot.data.data(), snapshot.data.size());
+        m_dense.assign(snapshot.entities.begin(), snapshot.entities.end());
+        m_size = count;
+        m_groupSize = std::min(snapshot.groupSize, count);
+        for (size_t i = 0; i < count; ++i) {
+            ensureSparseCapacity(m_dense[i]);
+            m_sparse[m_dense[i]] = i;
+        }
+
+        if (m_changeTracker.isEnabled())
+            recordRestoredChanges(previous);
+    }
+
+    void TypeErasedComponentArray::saveComponents(const std::span<const Entity> entities, ComponentArraySnapshot &block) const
+    {
+        block.typeHash = 0;
+        block.componentSize = m_componentSize;
+        block.groupSize = 0;
+        block.encoding = SnapshotEncoding::RAW;
+        block.objects.reset();
+        block.data.resize(entities.size() * m_componentSize);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            if (!hasComponent(entities[i]))
+                THROW_EXCEPTION(ComponentNotFound, entities[i]);
+            std::memcpy(block.data.data() + i * m_componentSize,
+                        m_componentData + m_sparse[entities[i]] * m_componentSize, m_componentSize);
+        }
+    }
+
+    void TypeErasedComponentArray::instantiate(const ComponentArraySnapshot &block, const std::span<const EntityRemap> instances)
+    {
+        const size_t count = block.entities.size();
+        const size_t total = count * instances.size();
+        if (total == 0)
+            return;
+        if (block.componentSize != m_componentSize || block.encoding != SnapshotEncoding::RAW ||
+            block.data.size() != count * m_componentSize)
+            THROW_EXCEPTION(InvalidSnapshot, "template block does not match the type-erased component layout");
+
+        for (const auto &instance : instances) {
+            for (const Entity index : block.entities) {
+                const Entity entity = instance.at(index);
+                if (entity >= MAX_ENTITIES)
+                    THROW_EXCEPTION(OutOfRange, entity);
+                ensureSparseCapacity(entity);
+                if (hasComponent(entity))
+                    THROW_EXCEPTION(InternalError, std::format("entity {} already has the component", entity));
+            }
+        }
+
+        const size_t first = m_size;
+        ensureDataCapacity(first + total);
+        m_dense.reserve(first + total);
+        for (size_t copy = 0; copy < instances.size(); ++copy) {
+            std::memcpy(m_componentData + (first + copy * count) * m_componentSize, block.data.data(), block.data.size());
+            for (const Entity index : block.entities) {
+                const Entity entity = instances[copy].at(index);
+                m_sparse[entity] = m_dense.size();
+                m_dense.push_back(entity);
+            }
+        }
+        m_size += total;
+        NEXO_ECS_STAT(m_counters.inserts += total);
+
+        if (m_changeTracker.isEnabled()) {
+            for (size_t i = first; i < m_size; ++i)
+                m_changeTracker.onAdded(m_dense[i]);
+        }
+    }
+
     Entity TypeErasedComponentArray::getEntityAtIndex(const size_t index) const
     {
         if (index >= m_size)
@@ -180,8 +318,10 @@ namespace nexo::ecs {
             std::swap(m_dense[index], m_dense[m_groupSize]);
             m_sparse[m_dense[index]]       = index;
             m_sparse[m_dense[m_groupSize]] = m_groupSize;
+            NEXO_ECS_STAT(++m_counters.groupSwaps);
         }
         ++m_groupSize;
+        NEXO_ECS_STAT(++m_counters.groupMoves);
     }
 
     void TypeErasedComponentArray::removeFromGroup(const Entity entity)
@@ -194,11 +334,13 @@ namespace nexo::ecs {
             return;
 
         --m_groupSize;
+        NEXO_ECS_STAT(++m_counters.groupMoves);
         if (index != m_groupSize) {
             swapComponents(index, m_groupSize);
             std::swap(m_dense[index], m_dense[m_groupSize]);
             m_sparse[m_dense[index]]       = index;
             m_sparse[m_dense[m_groupSize]] = m_groupSize;
+            NEXO_ECS_STAT(++m_counters.groupSwaps);
         }
     }
 
@@ -209,9 +351,25 @@ namespace nexo::ecs {
 
     size_t TypeErasedComponentArray::memoryUsage() const
     {
-        return m_componentData.capacity()
+        return m_dataBytes
                + sizeof(size_t) * m_sparse.capacity()
-               + sizeof(Entity) * m_dense.capacity();
+               + sizeof(Entity) * m_dense.capacity()
+               + m_changeTracker.memoryUsage();
+    }
+
+    ComponentArrayStats TypeErasedComponentArray::stats() const
+    {
+        return {
+            .componentSize = m_componentSize,
+            .count = m_size,
+            .groupSize = m_groupSize,
+            .capacity = capacity(),
+            .dataBytes = m_dataBytes,
+            .sparseBytes = sizeof(size_t) * m_sparse.capacity(),
+            .denseBytes = sizeof(Entity) * m_dense.capacity(),
+            .trackerBytes = m_changeTracker.memoryUsage(),
+            .counters = m_counters
+        };
     }
 
     void TypeErasedComponentArray::ensureSparseCapacity(const Entity entity)
@@ -226,32 +384,49 @@ namespace nexo::ecs {
         }
     }
 
+    void TypeErasedComponentArray::ensureDataCapacity(const size_t count)
+    {
+        if (count <= capacity())
+            return;
+        reallocateData(std::max(count, capacity() * 2));
+    }
+
+    void TypeErasedComponentArray::reallocateData(const size_t capacity)
+    {
+        size_t newBytes = 0;
+        std::byte *newData = allocateComponentStorage(m_arena.get(), capacity * m_componentSize, newBytes);
+        if (m_size)
+            std::memcpy(newData, m_componentData, m_size * m_componentSize);
+        deallocateComponentStorage(m_arena.get(), m_componentData, m_dataBytes);
+        m_componentData = newData;
+        m_dataBytes = newBytes;
+    }
+
+    void TypeErasedComponentArray::reserve(const size_t capacity)
+    {
+        if (capacity > this->capacity())
+            reallocateData(capacity);
+    }
+
+    size_t TypeErasedComponentArray::capacity() const
+    {
+        return m_dataBytes / m_componentSize;
+    }
+
     void TypeErasedComponentArray::swapComponents(const size_t index1, const size_t index2)
     {
         if (index1 == index2) return;
 
-        std::byte* data1 = m_componentData.data() + index1 * m_componentSize;
-        std::byte* data2 = m_componentData.data() + index2 * m_componentSize;
-
-        // Use a temporary buffer for swapping
-        std::vector<std::byte> temp(m_componentSize);
-        std::memcpy(temp.data(), data1, m_componentSize);
-        std::memcpy(data1, data2, m_componentSize);
-        std::memcpy(data2, temp.data(), m_componentSize);
+        std::byte* data1 = m_componentData + index1 * m_componentSize;
+        std::byte* data2 = m_componentData + index2 * m_componentSize;
+        std::swap_ranges(data1, data1 + m_componentSize, data2);
     }
 
     void TypeErasedComponentArray::shrinkIfNeeded()
     {
-        if (m_size < m_componentData.capacity() / 4 && m_componentData.capacity() > m_capacity * m_componentSize * 2) {
-            size_t newCapacity = std::max(m_size * 2, m_capacity) * m_componentSize;
-            if (newCapacity < m_capacity * m_componentSize)
-                newCapacity = m_capacity * m_componentSize;
-
-            m_componentData.shrink_to_fit();
+        if (m_size < capacity() / 4 && capacity() > m_capacity * 2) {
+            reallocateData(std::max(m_size * 2, m_capacity));
             m_dense.shrink_to_fit();
-
-            m_componentData.reserve(newCapacity);
-            m_dense.reserve(newCapacity / m_componentSize);
         }
     }
 
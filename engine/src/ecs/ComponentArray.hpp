@@ -18,11 +18,18 @@
 #pragma once
 
 #include "Definitions.hpp"
+#include "ChangeTracker.hpp"
+#include "WorldSnapshot.hpp"
+#include "EntityTemplate.hpp"
+#include "ComponentArena.hpp"
+#include "EcsStats.hpp"
+#include "StridedSpan.hpp"
 #include "ECSExceptions.hpp"
 #include "Exception.hpp"
 #include "Logger.hpp"
 
 #include <vector>
+#include <memory>
 #include <span>
 #include <algorithm>
 #include <cstring>
@@ -107,6 +114,50 @@ namespace nexo::ecs {
          */
         virtual void insertRaw(Entity entity, const void *componentData) = 0;
 
+        /**
+         * @brief Gets a strided view over one field of every component.
+         *
+         * The view follows the dense order of entities(), element i belonging to entities()[i].
+         * It is invalidated by any insertion or removal.
+         *
+         * @tparam T The field type
+         * @param fieldOffset Offset of the field inside the component, in bytes
+         * @throws OutOfRange if the field does not fit inside the component
+         */
+        template<typename T>
+        [[nodiscard]] StridedSpan<T> column(const size_t fieldOffset)
+        {
+            if (fieldOffset + sizeof(T) > getComponentSize())
+                THROW_EXCEPTION(OutOfRange, fieldOffset);
+            return {static_cast<std::byte *>(getRawData()) + fieldOffset, size(), getComponentSize()};
+        }
+
+        template<typename T>
+        [[nodiscard]] StridedSpan<const T> column(const size_t fieldOffset) const
+        {
+            if (fieldOffset + sizeof(T) > getComponentSize())
+                THROW_EXCEPTION(OutOfRange, fieldOffset);
+            return {static_cast<const std::byte *>(getRawData()) + fieldOffset, size(), getComponentSize()};
+        }
+
+        /**
+         * @brief Inserts raw components for several entities at once.
+         *
+         * The default implementation inserts the components one by one, arrays with a raw
+         * storage override it to grow once and copy the whole block.
+         *
+         * @param entities The entities to add the component to
+         * @param componentData Pointer to entities.size() contiguous components
+         *
+         * @pre componentData must point to valid memory of entities.size() * component's size
+         */
+        virtual void insertRawBatch(const std::span<const Entity> entities, const void *componentData)
+        {
+            const auto *data = static_cast<const std::byte *>(componentData);
+            for (size_t i = 0; i < entities.size(); ++i)
+                insertRaw(entities[i], data + i * getComponentSize());
+        }
+
         /**
          * @brief Removes the component for the given entity.
          *
@@ -125,6 +176,159 @@ namespace nexo::ecs {
          * @return Span of entity IDs
          */
         [[nodiscard]] virtual std::span<const Entity> entities() const = 0;
+
+        /**
+         * @brief Captures the content of the array into a snapshot
+         *
+         * The dense block is copied as is, grouped region included.
+         *
+         * @param snapshot The snapshot to fill, its type field is left untouched
+         */
+        virtual void saveSnapshot(ComponentArraySnapshot &snapshot) const = 0;
+
+        /**
+         * @brief Replaces the content of the array with a snapshot
+         *
+         * When change tracking is enabled, the entities that lost the component are recorded
+         * as removed and every restored entity as added.
+         *
+         * @param snapshot The snapshot to restore, an empty snapshot clears the array
+         * @throws InvalidSnapshot if the snapshot holds another component type
+         */
+        virtual void restoreSnapshot(const ComponentArraySnapshot &snapshot) = 0;
+
+        /**
+         * @brief Copies the components of some entities into a template block
+         *
+         * @param entities The entities to copy, they must all own the component
+         * @param block The block to fill, its entities field is left to the caller
+         * @throws ComponentNotFound if an entity does not own the component
+         */
+        virtual void saveComponents(std::span<const Entity> entities, ComponentArraySnapshot &block) const = 0;
+
+        /**
+         * @brief Inserts one copy of a template block per instance, in bulk
+         *
+         * Component i of the block goes to instance.at(block.entities[i]). The instantiate hook,
+         * if any, is then called on every new component.
+         *
+         * @param block The template block
+         * @param instances The entity mapping of each instance
+         * @throws InvalidSnapshot if the block holds another component type
+         */
+        virtual void instantiate(const ComponentArraySnapshot &block, std::span<const EntityRemap> instances) = 0;
+
+        /**
+         * @brief Enables or disables change tracking on this array
+         *
+         * Tracking is opt-in: while disabled, the insertion, removal and write hooks
+         * cost a single branch. Disabling it drops the recorded history. Components the
+         * array already holds when the tracking starts are reported as modified at the
+         * current tick.
+         *
+         * @param enabled true to start recording additions, modifications and removals
+         */
+        void setChangeTracking(const bool enabled)
+        {
+            const bool wasEnabled = m_changeTracker.isEnabled();
+            m_changeTracker.setEnabled(enabled);
+            if (enabled && !wasEnabled) {
+                for (const Entity entity : entities())
+                    m_changeTracker.onTracked(entity);
+            }
+        }
+
+        /**
+         * @brief Checks if change tracking is enabled on this array
+         * @return true if changes are being recorded
+         */
+        [[nodiscard]] bool isChangeTrackingEnabled() const { return m_changeTracker.isEnabled(); }
+
+        /**
+         * @brief Sets the tick used to stamp the upcoming changes
+         * @param tick The current tick of the coordinator
+         */
+        void setChangeTick(const Tick tick) { m_changeTracker.setCurrentTick(tick); }
+
+        /**
+         * @brief Marks the component of an entity as modified during the current tick
+         *
+         * Does nothing if tracking is disabled or if the entity does not own the component.
+         *
+         * @param entity The entity whose component has been written to
+         */
+        void markModified(const Entity entity)
+        {
+            if (!m_changeTracker.isEnabled() || !hasComponent(entity))
+                return;
+            m_changeTracker.onModified(entity);
+        }
+
+        /**
+         * @brief Collects the entities that had a change of the given kind at or after a tick
+         *
+         * @param kind Kind of change to look for
+         * @param since Oldest tick to consider (inclusive)
+         * @return The changed entities, each reported once
+         */
+        [[nodiscard]] std::vector<Entity> getChanges(const ChangeKind kind, const Tick since) const
+        {
+            std::vector<Entity> changes;
+            m_changeTracker.collect(kind, since, changes);
+            return changes;
+        }
+
+        /**
+         * @brief Checks whether an entity had a change of the given kind at or after a tick
+         *
+         * @param entity The entity to check
+         * @param kind Kind of change to look for
+         * @param since Oldest tick to consider (inclusive)
+         * @return true if the entity changed since the tick
+         */
+        [[nodiscard]] bool hasChangedSince(const Entity entity, const ChangeKind kind, const Tick since) const
+        {
+            return m_changeTracker.changedSince(entity, kind, since);
+        }
+
+        /**
+         * @brief Drops the recorded changes older than the given tick
+         * @param before Records with a tick strictly lower than this one are discarded
+         */
+        void trimChanges(const Tick before) { m_changeTracker.trim(before); }
+
+        /**
+         * @brief Gets the memory, occupancy and operation counters of this array
+         *
+         * The counters stay at zero unless the ECS statistics are compiled in (NEXO_ECS_STATS).
+         *
+         * @return The statistics of the array
+         */
+        [[nodiscard]] virtual ComponentArrayStats stats() const = 0;
+
+        /**
+         * @brief Resets the operation counters of this array
+         */
+        void resetCounters() { m_counters = {}; }
+
+    protected:
+        /**
+         * @brief Records the changes caused by a snapshot restore
+         *
+         * @param previous Entities that owned the component before the restore
+         */
+        void recordRestoredChanges(const std::span<const Entity> previous)
+        {
+            for (const Entity entity : previous) {
+                if (!hasComponent(entity))
+                    m_changeTracker.onRemoved(entity);
+            }
+            for (const Entity entity : entities())
+                m_changeTracker.onAdded(entity);
+        }
+
+        ChangeTracker m_changeTracker;
+        ComponentArrayCounters m_counters;
     };
 
 #if defined(_MSC_VER)
@@ -225,6 +429,8 @@ namespace nexo::ecs {
             m_componentArray.push_back(component);
 
             ++m_size;
+            m_changeTracker.onAdded(entity);
+            NEXO_ECS_STAT(++m_counters.inserts);
         }
 
         /**
@@ -259,6 +465,8 @@ namespace nexo::ecs {
             if constexpr (std::is_trivially_copyable_v<T>) {
                 std::memcpy(&m_componentArray[newIndex], componentData, sizeof(T));
                 ++m_size;
+                m_changeTracker.onAdded(entity);
+                NEXO_ECS_STAT(++m_counters.inserts);
             } else {
                 THROW_EXCEPTION(InternalError, "Component type is not trivially copyable, raw insertion is not supported");
             }
@@ -291,8 +499,10 @@ namespace nexo::ecs {
                     std::swap(m_dense[indexToRemove], m_dense[groupLastIndex]);
                     m_sparse[m_dense[indexToRemove]] = indexToRemove;
                     m_sparse[m_dense[groupLastIndex]] = groupLastIndex;
+                    NEXO_ECS_STAT(++m_counters.groupSwaps);
                 }
                 --m_groupSize;
+                NEXO_ECS_STAT(++m_counters.groupMoves);
                 indexToRemove = groupLastIndex;
             }
 
@@ -307,6 +517,8 @@ namespace nexo::ecs {
             m_componentArray.pop_back();
             m_dense.pop_back();
             --m_size;
+            m_changeTracker.onRemoved(entity);
+            NEXO_ECS_STAT(++m_counters.removes);
 
             shrinkIfNeeded();
         }
@@ -454,8 +666,10 @@ namespace nexo::ecs {
                 std::swap(m_dense[index], m_dense[m_groupSize]);
                 m_sparse[m_dense[index]] = index;
                 m_sparse[m_dense[m_groupSize]] = m_groupSize;
+                NEXO_ECS_STAT(++m_counters.groupSwaps);
             }
             ++m_groupSize;
+            NEXO_ECS_STAT(++m_counters.groupMoves);
         }
 
         /**
@@ -478,11 +692,13 @@ namespace nexo::ecs {
             if (index >= m_groupSize)
                 return;
             --m_groupSize;
+            NEXO_ECS_STAT(++m_counters.groupMoves);
             if (index != m_groupSize) {
                 std::swap(m_componentArray[index], m_componentArray[m_groupSize]);
                 std::swap(m_dense[index], m_dense[m_groupSize]);
                 m_sparse[m_dense[index]] = index;
                 m_sparse[m_dense[m_groupSize]] = m_groupSize;
+                NEXO_ECS_STAT(++m_counters.groupSwaps);
             }
         }
 
@@ -565,6 +781,209 @@ namespace nexo::ecs {
             return m_groupSize;
         }
 
+        void saveSnapshot(ComponentArraySnapshot &snapshot) const override
+        {
+            snapshot.typeHash = getSnapshotTypeHash<T>();
+            snapshot.componentSize = sizeof(T);
+            snapshot.groupSize = m_groupSize;
+            snapshot.entities.assign(m_dense.begin(), m_dense.begin() + static_cast<std::ptrdiff_t>(m_size));
+            snapshot.data.clear();
+            snapshot.objects.reset();
+            if (std::is_trivially_copyable_v<T> || m_size == 0) {
+                const auto *bytes = reinterpret_cast<const std::byte *>(m_componentArray.data());
+                snapshot.encoding = SnapshotEncoding::RAW;
+                snapshot.data.assign(bytes, bytes + m_size * sizeof(T));
+            } else if (m_serializer.serialize) {
+                snapshot.encoding = SnapshotEncoding::SERIALIZED;
+                for (size_t i = 0; i < m_size; ++i)
+                    m_serializer.serialize(m_componentArray[i], snapshot.data);
+            } else {
+                snapshot.encoding = SnapshotEncoding::OBJECTS;
+                snapshot.objects = std::make_shared<const std::vector<T>>(m_componentArray.begin(), m_componentArray.begin() + static_cast<std::ptrdiff_t>(m_size));
+            }
+        }
+
+        void restoreSnapshot(const ComponentArraySnapshot &snapshot) override
+        {
+            const size_t count = snapshot.entities.size();
+            if (count && (snapshot.componentSize != sizeof(T) || snapshot.typeHash != getSnapshotTypeHash<T>()))
+                THROW_EXCEPTION(InvalidSnapshot, std::format("snapshot does not hold components of type {}", typeid(T).name()));
+
+            std::vector<Entity> previous;
+            if (m_changeTracker.isEnabled())
+                previous.assign(m_dense.begin(), m_dense.begin() + static_cast<std::ptrdiff_t>(m_size));
+
+            switch (snapshot.encoding) {
+                case SnapshotEncoding::RAW:
+                    if constexpr (std::is_trivially_copyable_v<T>) {
+                        if (snapshot.data.size() != count * sizeof(T))
+                            THROW_EXCEPTION(InvalidSnapshot, "raw component block has an unexpected size");
+                        m_componentArray.resize(count);
+                        if (count)
+                            std::memcpy(m_componentArray.data(), snapshot.data.data(), count * sizeof(T));
+                    } else {
+                        if (count)
+                            THROW_EXCEPTION(InvalidSnapshot, "raw component block for a non trivially copyable type");
+                        m_componentArray.clear();
+                    }
+                    break;
+                case SnapshotEncoding::SERIALIZED: {
+                    if (!m_serializer.deserialize)
+                        THROW_EXCEPTION(InvalidSnapshot, std::format("no serializer registered for {}", typeid(T).name()));
+                    m_componentArray.clear();
+                    m_componentArray.reserve(count);
+                    size_t offset = 0;
+                    for (size_t i = 0; i < count; ++i)
+                        m_componentArray.push_back(m_serializer.deserialize(snapshot.data, offset));
+                    break;
+                }
+                case SnapshotEncoding::OBJECTS: {
+                    const auto *components = static_cast<const std::vector<T> *>(snapshot.objects.get());
+                    if (!components || components->size() != count)
+                        THROW_EXCEPTION(InvalidSnapshot, "deep copied components are missing");
+                    m_componentArray.assign(components->begin(), components->end());
+                    break;
+                }
+            }
+
+            for (size_t i = 0; i < m_size; ++i)
+                m_sparse[m_dense[i]] = INVALID_ENTITY;
+            m_dense.assign(snapshot.entities.begin(), snapshot.entities.end());
+            m_size = count;
+            m_groupSize = std::min(snapshot.groupSize, count);
+            for (size_t i = 0; i < count; ++i) {
+                ensureSparseCapacity(m_dense[i]);
+                m_sparse[m_dense[i]] = i;
+            }
+
+            if (m_changeTracker.isEnabled())
+                recordRestoredChanges(previous);
+        }
+
+        void saveComponents(const std::span<const Entity> entities, ComponentArraySnapshot &block) const override
+        {
+            block.typeHash = getSnapshotTypeHash<T>();
+            block.componentSize = sizeof(T);
+            block.groupSize = 0;
+            block.data.clear();
+            block.objects.reset();
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                block.encoding = SnapshotEncoding::RAW;
+                block.data.resize(entities.size() * sizeof(T));
+                for (size_t i = 0; i < entities.size(); ++i)
+                    std::memcpy(block.data.data() + i * sizeof(T), &get(entities[i]), sizeof(T));
+            } else {
+                auto components = std::make_shared<std::vector<T>>();
+                components->reserve(entities.size());
+                for (const Entity entity : entities)
+                    components->push_back(get(entity));
+                block.encoding = SnapshotEncoding::OBJECTS;
+                block.objects = std::move(components);
+            }
+        }
+
+        void instantiate(const ComponentArraySnapshot &block, const std::span<const EntityRemap> instances) override
+        {
+            const size_t count = block.entities.size();
+            const size_t total = count * instances.size();
+            if (total == 0)
+                return;
+            if (block.componentSize != sizeof(T) || block.typeHash != getSnapshotTypeHash<T>())
+                THROW_EXCEPTION(InvalidSnapshot, std::format("template block does not hold components of type {}", typeid(T).name()));
+
+            [[maybe_unused]] const std::vector<T> *objects = nullptr;
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                if (block.encoding != SnapshotEncoding::RAW || block.data.size() != count * sizeof(T))
+                    THROW_EXCEPTION(InvalidSnapshot, "raw component block has an unexpected size");
+            } else {
+                objects = static_cast<const std::vector<T> *>(block.objects.get());
+                if (block.encoding != SnapshotEncoding::OBJECTS || !objects || objects->size() != count)
+                    THROW_EXCEPTION(InvalidSnapshot, "template components are missing");
+            }
+
+            // Validate every destination before touching the storage
+            for (const auto &instance : instances) {
+                for (const Entity index : block.entities) {
+                    const Entity entity = instance.at(index);
+                    if (entity >= MAX_ENTITIES)
+                        THROW_EXCEPTION(OutOfRange, entity);
+                    ensureSparseCapacity(entity);
+                    if (hasComponent(entity))
+                        THROW_EXCEPTION(InternalError, std::format("entity {} already has component {}", entity, typeid(T).name()));
+                }
+            }
+
+            const size_t first = m_size;
+            m_dense.reserve(first + total);
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                m_componentArray.resize(first + total);
+                for (size_t copy = 0; copy < instances.size(); ++copy)
+                    std::memcpy(&m_componentArray[first + copy * count], block.data.data(), count * sizeof(T));
+            } else {
+                m_componentArray.reserve(first + total);
+                for (size_t copy = 0; copy < instances.size(); ++copy)
+                    m_componentArray.insert(m_componentArray.end(), objects->begin(), objects->end());
+            }
+            for (const auto &instance : instances) {
+                for (const Entity index : block.entities) {
+                    const Entity entity = instance.at(index);
+                    m_sparse[entity] = m_dense.size();
+                    m_dense.push_back(entity);
+                }
+            }
+            m_size += total;
+            NEXO_ECS_STAT(m_counters.inserts += total);
+
+            if (m_instantiateHook) {
+                for (size_t copy = 0; copy < instances.size(); ++copy) {
+                    for (size_t i = 0; i < count; ++i)
+                        m_instantiateHook(m_componentArray[first + copy * count + i], instances[copy]);
+                }
+            }
+            if (m_changeTracker.isEnabled()) {
+                for (size_t i = first; i < m_size; ++i)
+                    m_changeTracker.onAdded(m_dense[i]);
+            }
+        }
+
+        /**
+         * @brief Sets the hook called on every component created by a template instantiation
+         *
+         * @param hook The hook, typically remapping the entity references held by the component
+         */
+        void setInstantiateHook(InstantiateHook<T> hook)
+        {
+            m_instantiateHook = std::move(hook);
+        }
+
+        /**
+         * @brief Sets the serializer used to write non trivially copyable components to snapshots
+         *
+         * Without a serializer, such components are deep copied and the snapshot can only be
+         * kept in memory.
+         *
+         * @param serializer The serializer hook of the component type
+         */
+        void setSerializer(ComponentSerializer<T> serializer)
+        {
+            m_serializer = std::move(serializer);
+        }
+
+        /**
+         * @brief Marks the component stored at a dense index as modified
+         *
+         * Used by access-controlled spans, which only know the dense index of the component
+         * being written to.
+         *
+         * @param index Index in the dense array
+         */
+        void markModifiedAt(const size_t index)
+        {
+            if (!m_changeTracker.isEnabled() || index >= m_size)
+                return;
+            m_changeTracker.onModified(m_dense[index]);
+        }
+
         /**
          * @brief Get the estimated memory usage of this component array
          *
@@ -574,7 +993,23 @@ namespace nexo::ecs {
         {
             return sizeof(T) * m_componentArray.capacity()
                             + sizeof(size_t) * m_sparse.capacity()
-                            + sizeof(Entity) * m_dense.capacity();
+                            + sizeof(Entity) * m_dense.capacity()
+                            + m_changeTracker.memoryUsage();
+        }
+
+        [[nodiscard]] ComponentArrayStats stats() const override
+        {
+            return {
+                .componentSize = sizeof(T),
+                .count = m_size,
+                .groupSize = m_groupSize,
+                .capacity = m_componentArray.capacity(),
+                .dataBytes = sizeof(T) * m_componentArray.capacity(),
+                .sparseBytes = sizeof(size_t) * m_sparse.capacity(),
+                .denseBytes = sizeof(Entity) * m_dense.capacity(),
+                .trackerBytes = m_changeTracker.memoryUsage(),
+                .counters = m_counters
+            };
         }
 
     private:
@@ -588,6 +1023,10 @@ namespace nexo::ecs {
         size_t m_size = 0;
         // The first m_groupSize entries in m_dense/m_componentArray are considered "grouped".
         size_t m_groupSize = 0;
+        // Serializer hook used by world snapshots for non trivially copyable components.
+        ComponentSerializer<T> m_serializer;
+        // Hook called on the components created by template instantiations.
+        InstantiateHook<T> m_instantiateHook;
 
         /**
          * @brief Ensures m_sparse is large enough to index 'entity'
@@ -650,10 +1089,21 @@ namespace nexo::ecs {
     public:
         /**
          * @brief Constructs a new type-erased component array
+         *
+         * The component storage is aligned on COMPONENT_STORAGE_ALIGNMENT and grows geometrically,
+         * without zero-initializing the new slots.
+         *
          * @param componentSize Size of each component in bytes
          * @param initialCapacity Initial capacity for the array
+         * @param arena Optional allocator shared with other type-erased arrays, the system allocator is used when null
          */
-        explicit TypeErasedComponentArray(size_t componentSize, size_t initialCapacity = 1024);
+        explicit TypeErasedComponentArray(size_t componentSize, size_t initialCapacity = 1024,
+                                          std::shared_ptr<ComponentArena> arena = nullptr);
+
+        ~TypeErasedComponentArray() override;
+
+        TypeErasedComponentArray(const TypeErasedComponentArray&) = delete;
+        TypeErasedComponentArray& operator=(const TypeErasedComponentArray&) = delete;
 
         /**
          * @brief Inserts a new component for the given entity
@@ -674,6 +1124,18 @@ namespace nexo::ecs {
          */
         void insertRaw(Entity entity, const void* componentData) override;
 
+        /**
+         * @brief Inserts raw components for several entities, growing the storage once.
+         *
+         * Every entity is validated before anything is inserted.
+         *
+         * @param entities The entities to add the component to
+         * @param componentData Pointer to entities.size() contiguous components
+         * @throws OutOfRange if an entity ID exceeds MAX_ENTITIES
+         * @throws InternalError if an entity already has the component or appears twice
+         */
+        void insertRawBatch(std::span<const Entity> entities, const void *componentData) override;
+
         /**
          * @brief Removes the component for the given entity
          * @param entity The entity to remove the component from
@@ -700,6 +1162,25 @@ namespace nexo::ecs {
 
         [[nodiscard]] std::span<const Entity> entities() const override;
 
+        void saveSnapshot(ComponentArraySnapshot &snapshot) const override;
+
+        void restoreSnapshot(const ComponentArraySnapshot &snapshot) override;
+
+        void saveComponents(std::span<const Entity> entities, ComponentArraySnapshot &block) const override;
+
+        void instantiate(const ComponentArraySnapshot &block, std::span<const EntityRemap> instances) override;
+
+        /**
+         * @brief Ensures the storage can hold the given number of components without reallocating
+         * @param capacity The number of components to make room for
+         */
+        void reserve(size_t capacity);
+
+        /**
+         * @brief Gets the number of components the storage can hold without reallocating
+         */
+        [[nodiscard]] size_t capacity() const;
+
         /**
          * @brief Gets the entity at the given index in the dense array
          * @param index The index to look up
@@ -731,9 +1212,15 @@ namespace nexo::ecs {
          */
         [[nodiscard]] size_t memoryUsage() const;
 
+        [[nodiscard]] ComponentArrayStats stats() const override;
+
     private:
-        // Component data storage
-        std::vector<std::byte> m_componentData;
+        // Optional allocator shared between type-erased arrays
+        std::shared_ptr<ComponentArena> m_arena;
+        // Component data storage, aligned on COMPONENT_STORAGE_ALIGNMENT
+        std::byte *m_componentData = nullptr;
+        // Size in bytes of the block holding the component data
+        size_t m_dataBytes = 0;
         // Sparse mapping: maps entity ID to index in the dense arrays
         std::vector<size_t> m_sparse;
         // Dense storage for entity IDs
@@ -749,6 +1236,10 @@ namespace nexo::ecs {
 
         void ensureSparseCapacity(Entity entity);
 
+        void ensureDataCapacity(size_t count);
+
+        void reallocateData(size_t capacity);
+
         void swapComponents(size_t index1, size_t index2);
 
         void shrinkIfNeeded();
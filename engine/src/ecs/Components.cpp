@@ -32,4 +32,145 @@ namespace nexo::ecs {
         }
     }
 
+    Tick ComponentManager::advanceTick()
+    {
+        ++m_currentTick;
+        const Tick oldestKept = m_currentTick > m_changeRetention ? m_currentTick - m_changeRetention : NULL_TICK;
+        for (const auto& componentArray : m_componentArrays) {
+            if (!componentArray)
+                continue;
+            componentArray->setChangeTick(m_currentTick);
+            if (componentArray->isChangeTrackingEnabled())
+                componentArray->trimChanges(oldestKept);
+        }
+        return m_currentTick;
+    }
+
+    void ComponentManager::saveSnapshot(std::vector<ComponentArraySnapshot> &snapshots) const
+    {
+        snapshots.clear();
+        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+            if (!m_componentArrays[type])
+                continue;
+            auto &snapshot = snapshots.emplace_back();
+            snapshot.type = type;
+            m_componentArrays[type]->saveSnapshot(snapshot);
+        }
+    }
+
+    void ComponentManager::restoreSnapshot(const std::span<const ComponentArraySnapshot> snapshots, const EntitySnapshot &entities)
+    {
+        std::array<const ComponentArraySnapshot *, MAX_COMPONENT_TYPE> byType{};
+        for (const auto &snapshot : snapshots) {
+            if (snapshot.type >= MAX_COMPONENT_TYPE || !m_componentArrays[snapshot.type])
+                THROW_EXCEPTION(InvalidSnapshot, std::format("component type {} is not registered", snapshot.type));
+            if (!snapshot.entities.empty() && snapshot.componentSize != m_componentArrays[snapshot.type]->getComponentSize())
+                THROW_EXCEPTION(InvalidSnapshot, std::format("component type {} does not match the registered one", snapshot.type));
+            byType[snapshot.type] = &snapshot;
+        }
+
+        static const ComponentArraySnapshot emptySnapshot{};
+        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+            if (m_componentArrays[type])
+                m_componentArrays[type]->restoreSnapshot(byType[type] ? *byType[type] : emptySnapshot);
+        }
+
+        // Groups created after the capture start empty, pull their matching entities back in
+        for (const auto &group : m_groupRegistry | std::views::values) {
+            const Signature &groupSignature = group->allSignature();
+            for (size_t i = 0; i < entities.livingEntities.size(); ++i) {
+                if ((entities.signatures[i] & groupSignature) == groupSignature)
+                    group->addToGroup(entities.livingEntities[i]);
+            }
+            group->invalidateCaches();
+        }
+    }
+
+    void ComponentManager::saveTemplate(EntityTemplate &entityTemplate) const
+    {
+        entityTemplate.componentBlocks.clear();
+        std::vector<Entity> sources;
+        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+            if (!m_componentArrays[type])
+                continue;
+            ComponentArraySnapshot block;
+            block.type = type;
+            sources.clear();
+            for (size_t i = 0; i < entityTemplate.size(); ++i) {
+                if (entityTemplate.signatures[i].test(type)) {
+                    block.entities.push_back(static_cast<Entity>(i));
+                    sources.push_back(entityTemplate.sourceEntities[i]);
+                }
+            }
+            if (block.entities.empty())
+                continue;
+            m_componentArrays[type]->saveComponents(sources, block);
+            entityTemplate.componentBlocks.push_back(std::move(block));
+        }
+    }
+
+    void ComponentManager::instantiateTemplate(const EntityTemplate &entityTemplate, const std::span<const EntityRemap> instances)
+    {
+        for (const auto &block : entityTemplate.componentBlocks) {
+            if (block.type >= MAX_COMPONENT_TYPE || !m_componentArrays[block.type])
+                THROW_EXCEPTION(InvalidSnapshot, std::format("component type {} is not registered", block.type));
+            m_componentArrays[block.type]->instantiate(block, instances);
+        }
+
+        std::vector<Entity> grouped;
+        for (const auto &group : m_groupRegistry | std::views::values) {
+            const Signature &groupSignature = group->allSignature();
+            grouped.clear();
+            for (size_t i = 0; i < entityTemplate.size(); ++i) {
+                if ((entityTemplate.signatures[i] & groupSignature) != groupSignature)
+                    continue;
+                for (const auto &instance : instances)
+                    grouped.push_back(instance.at(i));
+            }
+            if (!grouped.empty())
+                group->addBatchToGroup(grouped);
+        }
+    }
+
+    void ComponentManager::addComponents(const std::span<const Entity> entities, const ComponentType componentType,
+                                         const void *componentData, const std::span<const Signature> newSignatures)
+    {
+        getComponentArray(componentType)->insertRawBatch(entities, componentData);
+
+        std::vector<Entity> grouped;
+        for (const auto &group : m_groupRegistry | std::views::values) {
+            // The entities did not have the component before, only groups requiring it can gain members
+            const Signature &groupSignature = group->allSignature();
+            if (!groupSignature.test(componentType))
+                continue;
+            grouped.clear();
+            for (size_t i = 0; i < entities.size(); ++i) {
+                if ((newSignatures[i] & groupSignature) == groupSignature)
+                    grouped.push_back(entities[i]);
+            }
+            if (!grouped.empty())
+                group->addBatchToGroup(grouped);
+        }
+    }
+
+    void ComponentManager::collectStats(EcsStats &stats) const
+    {
+        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+            if (m_componentArrays[type])
+                stats.components.push_back({type, {}, m_componentArrays[type]->stats()});
+        }
+        for (const auto &group : m_groupRegistry | std::views::values)
+            stats.groups.push_back(group->stats());
+    }
+
+    void ComponentManager::resetStatCounters() const
+    {
+        for (const auto &componentArray : m_componentArrays) {
+            if (componentArray)
+                componentArray->resetCounters();
+        }
+        for (const auto &group : m_groupRegistry | std::views::values)
+            group->resetCounters();
+    }
+
 }
@@ -238,6 +238,7 @@ namespace nexo::ecs {
 		        }
 
 		        m_componentArrays[typeID] = std::make_shared<ComponentArray<T>>();
+		        m_componentArrays[typeID]->setChangeTick(m_currentTick);
 		    }
 
 	        ComponentType registerComponent(const size_t componentSize, const size_t initialCapacity = 1024)
@@ -246,10 +247,31 @@ namespace nexo::ecs {
 		        assert(typeID < m_componentArrays.size() && "Component type ID exceeds component array size");
 
 		        assert(m_componentArrays[typeID] == nullptr && "TypeErasedComponent already registered, should really not happen");
-		        m_componentArrays[typeID] = std::make_shared<TypeErasedComponentArray>(componentSize, initialCapacity);
+		        m_componentArrays[typeID] = std::make_shared<TypeErasedComponentArray>(componentSize, initialCapacity, m_typeErasedArena);
+		        m_componentArrays[typeID]->setChangeTick(m_currentTick);
 		        return typeID;
 		    }
 
+		    /**
+		     * @brief Sets the allocator used by type-erased component arrays registered from now on
+		     *
+		     * @param arena The arena to share between the arrays, nullptr to use the system allocator
+		     */
+		    void setTypeErasedArena(std::shared_ptr<ComponentArena> arena)
+		    {
+		        m_typeErasedArena = std::move(arena);
+		    }
+
+		    /**
+		     * @brief Gets the allocator shared by type-erased component arrays
+		     *
+		     * @return The arena, or nullptr if the system allocator is used
+		     */
+		    [[nodiscard]] const std::shared_ptr<ComponentArena> &getTypeErasedArena() const
+		    {
+		        return m_typeErasedArena;
+		    }
+
 		    /**
 		     * @brief Gets the unique identifier for a component type
 		     *
@@ -323,6 +345,22 @@ namespace nexo::ecs {
 		        }
 		    }
 
+		    /**
+		     * @brief Adds the same component type to several entities using type ID
+		     *
+		     * The components are inserted in one batch, then the entities now qualifying for a group
+		     * are added to it in one batch as well.
+		     *
+		     * @param entities The entities to add the component to
+		     * @param componentType The type ID of the component
+		     * @param componentData Pointer to entities.size() contiguous components
+		     * @param newSignatures The signature of each entity after the addition
+		     *
+		     * @pre componentType must be a valid registered component type
+		     */
+		    void addComponents(std::span<const Entity> entities, ComponentType componentType, const void *componentData,
+		                       std::span<const Signature> newSignatures);
+
 	        /**
              * @brief Removes a component from an entity using type ID
              *
@@ -626,6 +664,81 @@ namespace nexo::ecs {
                 return (key1.ownedSignature & key2.ownedSignature).any();
             }
 
+			/**
+			 * @brief Gets the tick currently used to stamp component changes
+			 *
+			 * @return The current change tick
+			 */
+			[[nodiscard]] Tick getCurrentTick() const { return m_currentTick; }
+
+			/**
+			 * @brief Advances the change tick and propagates it to every component array
+			 *
+			 * History older than the retention window is trimmed from the tracked arrays.
+			 *
+			 * @return The new current tick
+			 */
+			Tick advanceTick();
+
+			/**
+			 * @brief Sets how many ticks of change history the tracked arrays keep
+			 *
+			 * @param retention Number of ticks kept, at least one
+			 */
+			void setChangeRetention(const Tick retention) { m_changeRetention = std::max<Tick>(retention, 1); }
+			[[nodiscard]] Tick getChangeRetention() const { return m_changeRetention; }
+
+			/**
+			 * @brief Captures every registered component array
+			 *
+			 * @param snapshots Receives one snapshot per registered array
+			 */
+			void saveSnapshot(std::vector<ComponentArraySnapshot> &snapshots) const;
+
+			/**
+			 * @brief Restores every registered component array from a snapshot
+			 *
+			 * Registered arrays missing from the snapshot are cleared. The groups are then brought
+			 * back in sync with the restored entity signatures.
+			 *
+			 * @param snapshots The component array snapshots
+			 * @param entities The restored entity table
+			 * @throws InvalidSnapshot if a snapshot targets an unregistered or different component type
+			 */
+			void restoreSnapshot(std::span<const ComponentArraySnapshot> snapshots, const EntitySnapshot &entities);
+
+			/**
+			 * @brief Copies the components of the template entities into per-type blocks
+			 *
+			 * The source entities and signatures of the template must already be filled, only the
+			 * component types present in the signatures are copied.
+			 *
+			 * @param entityTemplate The template to fill
+			 */
+			void saveTemplate(EntityTemplate &entityTemplate) const;
+
+			/**
+			 * @brief Inserts the components of every instance of a template and groups them in bulk
+			 *
+			 * @param entityTemplate The template to instantiate
+			 * @param instances The entity mapping of each instance
+			 */
+			void instantiateTemplate(const EntityTemplate &entityTemplate, std::span<const EntityRemap> instances);
+
+			/**
+			 * @brief Appends the statistics of every registered component array and every group
+			 *
+			 * Names are left empty, the coordinator knows the component type names.
+			 *
+			 * @param stats The statistics to fill
+			 */
+			void collectStats(EcsStats &stats) const;
+
+			/**
+			 * @brief Resets the operation counters of every component array and every group
+			 */
+			void resetStatCounters() const;
+
 		private:
 		    /**
 		     * @brief Array of component arrays indexed by component type ID
@@ -641,6 +754,11 @@ namespace nexo::ecs {
 			 */
 			std::unordered_map<GroupKey, std::shared_ptr<IGroup>> m_groupRegistry;
 
+			std::shared_ptr<ComponentArena> m_typeErasedArena = std::make_shared<ComponentArena>(); ///< Storage shared by type-erased arrays
+
+			Tick m_currentTick = FIRST_TICK; ///< Tick stamped on the changes recorded by tracked arrays
+			Tick m_changeRetention = ChangeTracker::DEFAULT_RETENTION; ///< Ticks of history kept by tracked arrays
+
 			/**
 			 * @brief Helper function to get the tuple of non-owned component arrays
 			 *
@@ -18,6 +18,8 @@
 
 #include "Coordinator.hpp"
 
+#include <format>
+
 std::shared_ptr<nexo::ecs::Coordinator> nexo::ecs::System::coord = nullptr;
 
 namespace nexo::ecs {
@@ -142,4 +144,97 @@ namespace nexo::ecs {
         if (it != m_addComponentFunctions.end())
             it->second(entity, component);
     }
+
+    void Coordinator::updateSystemEntities() const
+    {
+        m_systemManager->clearSystemEntities();
+        for (const Entity entity : m_entityManager->getLivingEntities())
+            m_systemManager->entitySignatureChanged(entity, Signature{}, m_entityManager->getSignature(entity));
+    }
+
+    WorldSnapshot Coordinator::captureWorld() const
+    {
+        WorldSnapshot snapshot;
+        m_entityManager->saveSnapshot(snapshot.entities);
+        m_componentManager->saveSnapshot(snapshot.componentArrays);
+        return snapshot;
+    }
+
+    EcsStats Coordinator::collectStats() const
+    {
+        EcsStats stats;
+        stats.livingEntities = m_entityManager->getLivingEntities().size();
+        m_componentManager->collectStats(stats);
+
+        std::array<std::string, MAX_COMPONENT_TYPE> names;
+        for (auto &component : stats.components) {
+            if (const auto description = m_componentDescriptions.find(component.type); description != m_componentDescriptions.end())
+                component.name = description->second->name;
+            else if (const auto typeIndex = m_typeIDtoTypeIndex.find(component.type); typeIndex != m_typeIDtoTypeIndex.end())
+                component.name = readableTypeName(typeIndex->second.name());
+            else
+                component.name = std::format("Component {}", component.type);
+            names[component.type] = component.name;
+        }
+
+        for (auto &group : stats.groups) {
+            std::string owned;
+            std::string nonOwned;
+            for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+                if (!group.allSignature.test(type))
+                    continue;
+                std::string &list = group.ownedSignature.test(type) ? owned : nonOwned;
+                list += list.empty() ? names[type] : ", " + names[type];
+            }
+            group.name = std::format("Owned<{}>, NonOwned<{}>", owned, nonOwned);
+        }
+        return stats;
+    }
+
+    void Coordinator::resetStatCounters() const
+    {
+        m_componentManager->resetStatCounters();
+    }
+
+    void Coordinator::restoreWorld(const WorldSnapshot &snapshot) const
+    {
+        m_entityManager->restoreSnapshot(snapshot.entities);
+        m_componentManager->restoreSnapshot(snapshot.componentArrays, snapshot.entities);
+        updateSystemEntities();
+    }
+
+    EntityTemplate Coordinator::createTemplate(const std::span<const Entity> entities, const Signature excluded) const
+    {
+        EntityTemplate entityTemplate;
+        entityTemplate.sourceEntities.assign(entities.begin(), entities.end());
+        entityTemplate.signatures.reserve(entities.size());
+        entityTemplate.sourceLookup.reserve(entities.size());
+        for (size_t i = 0; i < entities.size(); ++i) {
+            entityTemplate.signatures.push_back(m_entityManager->getSignature(entities[i]) & ~excluded);
+            entityTemplate.sourceLookup.emplace_back(entities[i], static_cast<std::uint32_t>(i));
+        }
+        std::ranges::sort(entityTemplate.sourceLookup);
+        m_componentManager->saveTemplate(entityTemplate);
+        return entityTemplate;
+    }
+
+    std::vector<Entity> Coordinator::instantiateTemplate(const EntityTemplate &entityTemplate, const size_t copies) const
+    {
+        const size_t count = entityTemplate.size();
+        std::vector<Entity> entities;
+        entities.reserve(count * copies);
+        m_entityManager->createEntities(count * copies, entities);
+
+        std::vector<EntityRemap> instances;
+        instances.reserve(copies);
+        for (size_t copy = 0; copy < copies; ++copy)
+            instances.emplace_back(entityTemplate, std::span<const Entity>(entities).subspan(copy * count, count));
+
+        for (size_t i = 0; i < entities.size(); ++i)
+            m_entityManager->setSignature(entities[i], entityTemplate.signatures[i % count]);
+        m_componentManager->instantiateTemplate(entityTemplate, instances);
+        for (size_t i = 0; i < entities.size(); ++i)
+            m_systemManager->entitySignatureChanged(entities[i], Signature{}, entityTemplate.signatures[i % count]);
+        return entities;
+    }
 }
@@ -21,6 +21,8 @@
 
 #include <memory>
 #include <any>
+#include <algorithm>
+#include <cstring>
 
 #include "Components.hpp"
 #include "System.hpp"
@@ -195,6 +197,16 @@ namespace nexo::ecs {
                 return typeID;
             }
 
+            /**
+             * @brief Sets the allocator shared by type-erased component arrays registered from now on.
+             *
+             * @param arena The arena to share, nullptr to use the system allocator.
+             */
+            void setTypeErasedArena(std::shared_ptr<ComponentArena> arena) const
+            {
+                m_componentManager->setTypeErasedArena(std::move(arena));
+            }
+
             /**
              * @brief Registers a new singleton component
              *
@@ -250,6 +262,36 @@ namespace nexo::ecs {
                 m_systemManager->entitySignatureChanged(entity, oldSignature, signature);
             }
 
+            /**
+             * @brief Adds the same component type to several entities in one batch, updates their signatures, and notifies systems.
+             *
+             * The component storage grows once and the whole block is copied at once, which is how
+             * scripts should populate many entities with a type-erased component.
+             *
+             * @param entities The entities to which the component will be added.
+             * @param componentType The type ID of the component to be added.
+             * @param componentData Pointer to entities.size() contiguous components.
+             *
+             * @pre componentType must be a valid registered component type.
+             * @pre componentData must point to valid memory of entities.size() times the component's size.
+             */
+            void addComponents(const std::span<const Entity> entities, const ComponentType componentType, const void *componentData) const
+            {
+                std::vector<Signature> signatures;
+                signatures.reserve(entities.size());
+                for (const Entity entity : entities)
+                    signatures.push_back(m_entityManager->getSignature(entity).set(componentType, true));
+
+                m_componentManager->addComponents(entities, componentType, componentData, signatures);
+
+                for (size_t i = 0; i < entities.size(); ++i) {
+                    Signature oldSignature = signatures[i];
+                    oldSignature.set(componentType, false);
+                    m_entityManager->setSignature(entities[i], signatures[i]);
+                    m_systemManager->entitySignatureChanged(entities[i], oldSignature, signatures[i]);
+                }
+            }
+
             /**
              * @brief Removes a component from an entity using ComponentType, updates its signature, and notifies systems.
              *
@@ -349,6 +391,19 @@ namespace nexo::ecs {
                 return m_componentManager->getComponentArray<T>();
             }
 
+            /**
+             * @brief Get the component array of a component type by its type ID.
+             *
+             * Gives access to the raw storage of type-erased components, e.g. through IComponentArray::column.
+             *
+             * @param componentType The type ID of the component.
+             * @return std::shared_ptr<IComponentArray> Shared pointer to the component array
+             */
+            [[nodiscard]] std::shared_ptr<IComponentArray> getComponentArray(const ComponentType componentType) const
+            {
+                return m_componentManager->getComponentArray(componentType);
+            }
+
             /**
              * @brief Attempts to retrieve a component from an entity.
              *
@@ -580,6 +635,132 @@ namespace nexo::ecs {
                 return signature.test(componentType);
             }
 
+            /**
+             * @brief Enables or disables change tracking for a component type.
+             *
+             * Once enabled, additions, removals and writes going through Write<T> access paths
+             * are recorded and can be queried with getAddedSince(), getModifiedSince() and
+             * getRemovedSince().
+             *
+             * @tparam T The component type.
+             * @param enabled true to start tracking, false to stop and drop the history.
+             */
+            template<typename T>
+            void enableChangeTracking(const bool enabled = true) const
+            {
+                m_componentManager->getComponentArray<T>()->setChangeTracking(enabled);
+            }
+
+            /**
+             * @brief Enables or disables change tracking for a component type by its type ID.
+             *
+             * @param componentType The type ID of the component.
+             * @param enabled true to start tracking, false to stop and drop the history.
+             */
+            void enableChangeTracking(const ComponentType componentType, const bool enabled = true) const
+            {
+                m_componentManager->getComponentArray(componentType)->setChangeTracking(enabled);
+            }
+
+            /**
+             * @brief Gets the tick currently stamped on component changes.
+             *
+             * Observers typically store this value after processing the changes, and pass it
+             * back as the "since" argument of the next query.
+             *
+             * @return Tick The current change tick.
+             */
+            [[nodiscard]] Tick getCurrentTick() const
+            {
+                return m_componentManager->getCurrentTick();
+            }
+
+            /**
+             * @brief Advances the change tick, should be called once per frame.
+             *
+             * @return Tick The new current tick.
+             */
+            Tick advanceTick() const
+            {
+                return m_componentManager->advanceTick();
+            }
+
+            /**
+             * @brief Sets how many ticks of change history are kept by tracked component arrays.
+             *
+             * @param retention Number of ticks kept.
+             */
+            void setChangeRetention(const Tick retention) const
+            {
+                m_componentManager->setChangeRetention(retention);
+            }
+
+            /**
+             * @brief Gets how many ticks of change history are kept by tracked component arrays.
+             *
+             * Changes are only complete for "since" ticks at most this many ticks old, observers
+             * lagging further behind have to rescan the components instead.
+             *
+             * @return Tick Number of ticks kept.
+             */
+            [[nodiscard]] Tick getChangeRetention() const
+            {
+                return m_componentManager->getChangeRetention();
+            }
+
+            /**
+             * @brief Marks the component of an entity as modified during the current tick.
+             *
+             * Only needed for writes that bypass the Write<T> access paths of the systems.
+             *
+             * @tparam T The component type.
+             * @param entity The modified entity.
+             */
+            template<typename T>
+            void markModified(const Entity entity) const
+            {
+                m_componentManager->getComponentArray<T>()->markModified(entity);
+            }
+
+            /**
+             * @brief Retrieves the entities that gained the component at or after a tick.
+             *
+             * @tparam T The component type, must have change tracking enabled.
+             * @param since The oldest tick to consider (inclusive).
+             * @return std::vector<Entity> The entities that still own the component.
+             */
+            template<typename T>
+            [[nodiscard]] std::vector<Entity> getAddedSince(const Tick since) const
+            {
+                return m_componentManager->getComponentArray<T>()->getChanges(ChangeKind::ADDED, since);
+            }
+
+            /**
+             * @brief Retrieves the entities whose component was added or written to at or after a tick.
+             *
+             * @tparam T The component type, must have change tracking enabled.
+             * @param since The oldest tick to consider (inclusive).
+             * @return std::vector<Entity> The entities that still own the component.
+             */
+            template<typename T>
+            [[nodiscard]] std::vector<Entity> getModifiedSince(const Tick since) const
+            {
+                return m_componentManager->getComponentArray<T>()->getChanges(ChangeKind::MODIFIED, since);
+            }
+
+            /**
+             * @brief Retrieves the entities that lost the component at or after a tick.
+             *
+             * @tparam T The component type, must have change tracking enabled.
+             * @param since The oldest tick to consider (inclusive).
+             * @return std::vector<Entity> The entities that do not own the component anymore.
+             */
+            template<typename T>
+            [[nodiscard]] std::vector<Entity> getRemovedSince(const Tick since) const
+            {
+                return m_componentManager->getComponentArray<T>()->getChanges(ChangeKind::REMOVED, since);
+            }
+
             template<typename T>
             void setRestoreComponent() {
                 m_restoreComponentFunctions[typeid(T)] = [](const std::any&) -> std::any {
@@ -622,7 +803,136 @@ namespace nexo::ecs {
                 return result;
             }
 
-        void updateSystemEntities() const;
+            /**
+             * @brief Repopulates every query system from the current entity signatures.
+             */
+            void updateSystemEntities() const;
+
+            /**
+             * @brief Captures the entity table and every registered component array.
+             *
+             * Trivially copyable components are copied as raw blocks, the others go through their
+             * serializer hook or are deep copied if they have none.
+             *
+             * @return WorldSnapshot The snapshot of the world.
+             */
+            [[nodiscard]] WorldSnapshot captureWorld() const;
+
+            /**
+             * @brief Restores the world captured by captureWorld().
+             *
+             * Entities created since the capture disappear, destroyed ones come back with their
+             * components, and the systems and groups are repopulated accordingly.
+             *
+             * @param snapshot The snapshot to restore.
+             * @throws InvalidSnapshot if the snapshot does not match the registered components.
+             */
+            void restoreWorld(const WorldSnapshot &snapshot) const;
+
+            /**
+             * @brief Collects the memory usage and operation counters of the whole ECS.
+             *
+             * Memory figures are computed on the fly. Operation counters accumulate since the
+             * last resetStatCounters() and are only maintained when NEXO_ECS_STATS is defined.
+             *
+             * @return EcsStats Per component type and per group statistics.
+             */
+            [[nodiscard]] EcsStats collectStats() const;
+
+            /**
+             * @brief Resets the operation counters of every component array and group.
+             */
+            void resetStatCounters() const;
+
+            /**
+             * @brief Captures a set of entities into a template that can be instantiated in bulk.
+             *
+             * Entity references held by the components are captured as is and remapped at
+             * instantiation by the instantiate hooks.
+             *
+             * @param entities The entities to capture, e.g. the nodes of a model hierarchy.
+             * @param excluded Component types left out of the template.
+             * @return EntityTemplate The template.
+             */
+            [[nodiscard]] EntityTemplate createTemplate(std::span<const Entity> entities, Signature excluded = {}) const;
+
+            /**
+             * @brief Instantiates a template several times.
+             *
+             * Entities are created in one go, each component block is copied once per instance
+             * and the new entities are added to the groups in one batch per group.
+             *
+             * @param entityTemplate The template to instantiate.
+             * @param copies Number of instances to create.
+             * @return std::vector<Entity> The new entities, instance after instance, each in template order.
+             * @throws TooManyEntities if there are not enough entity IDs left.
+             */
+            std::vector<Entity> instantiateTemplate(const EntityTemplate &entityTemplate, size_t copies = 1) const;
+
+            /**
+             * @brief Gives every entity of a template the same component.
+             *
+             * Used to stamp per-instantiation data, such as the scene of the instances, in the template
+             * itself so the component is inserted with the others instead of in a second pass.
+             *
+             * @tparam T The component type.
+             * @param entityTemplate The template to modify.
+             * @param component The component every entity of the template receives, replacing its own.
+             */
+            template<typename T>
+            void setTemplateComponent(EntityTemplate &entityTemplate, const T &component) const
+            {
+                const ComponentType componentType = getComponentType<T>();
+                ComponentArraySnapshot block;
+                block.type = componentType;
+                block.typeHash = getSnapshotTypeHash<T>();
+                block.componentSize = sizeof(T);
+                block.entities.resize(entityTemplate.size());
+                for (size_t i = 0; i < entityTemplate.size(); ++i) {
+                    block.entities[i] = static_cast<Entity>(i);
+                    entityTemplate.signatures[i].set(componentType, true);
+                }
+                if constexpr (std::is_trivially_copyable_v<T>) {
+                    block.encoding = SnapshotEncoding::RAW;
+                    block.data.resize(entityTemplate.size() * sizeof(T));
+                    for (size_t i = 0; i < entityTemplate.size(); ++i)
+                        std::memcpy(block.data.data() + i * sizeof(T), &component, sizeof(T));
+                } else {
+                    block.encoding = SnapshotEncoding::OBJECTS;
+                    block.objects = std::make_shared<std::vector<T>>(entityTemplate.size(), component);
+                }
+
+                auto &blocks = entityTemplate.componentBlocks;
+                const auto it = std::ranges::find(blocks, componentType, &ComponentArraySnapshot::type);
+                if (it != blocks.end())
+                    *it = std::move(block);
+                else
+                    blocks.push_back(std::move(block));
+            }
+
+            /**
+             * @brief Sets the hook called on every component of type T created by a template instantiation.
+             *
+             * @tparam T The component type.
+             * @param hook The hook, typically remapping the entity references held by the component.
+             */
+            template<typename T>
+            void setInstantiateHook(InstantiateHook<T> hook) const
+            {
+                m_componentManager->getComponentArray<T>()->setInstantiateHook(std::move(hook));
+            }
+
+            /**
+             * @brief Sets the serializer used to write a non trivially copyable component to snapshot files.
+             *
+             * @tparam T The component type.
+             * @param serializer The serializer hook.
+             */
+            template<typename T>
+            void setComponentSerializer(ComponentSerializer<T> serializer) const
+            {
+                m_componentManager->getComponentArray<T>()->setSerializer(std::move(serializer));
+            }
 
         private:
             template<typename Component>
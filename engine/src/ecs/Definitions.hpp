@@ -121,4 +121,27 @@ namespace nexo::ecs {
 	*/
 	using Signature = std::bitset<MAX_COMPONENT_TYPE>;
 
+	// Change tracking definitions
+
+	/**
+	* @brief Change tick type
+	*
+	* Monotonic counter advanced once per frame by the coordinator, used to timestamp
+	* component additions, modifications and removals.
+	*/
+	using Tick = std::uint32_t;
+
+	/**
+	* @brief Tick value meaning "never happened"
+	*
+	* The coordinator starts counting at FIRST_TICK, so a stored tick of NULL_TICK
+	* always compares older than any real change.
+	*/
+	constexpr Tick NULL_TICK = 0;
+
+	/**
+	* @brief First tick handed out by the coordinator
+	*/
+	constexpr Tick FIRST_TICK = 1;
+
 }
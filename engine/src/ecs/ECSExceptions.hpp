@@ -89,4 +89,10 @@ namespace nexo::ecs {
             explicit OutOfRange(size_t index, const std::source_location loc = std::source_location::current())
                 : Exception(std::format("Index {} is out of range", index), loc) {}
     };
+
+    class InvalidSnapshot final : public Exception {
+        public:
+            explicit InvalidSnapshot(const std::string &reason, const std::source_location loc = std::source_location::current())
+                : Exception(std::format("Invalid world snapshot: {}", reason), loc) {}
+    };
 }
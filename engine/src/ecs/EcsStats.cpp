@@ -0,0 +1,123 @@
+//// EcsStats.cpp /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the ECS memory and operation statistics
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "EcsStats.hpp"
+
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <string_view>
+
+#if defined(__GNUG__)
+    #include <cxxabi.h>
+#endif
+
+namespace nexo::ecs {
+
+    static std::string escapeJson(const std::string &value)
+    {
+        std::string escaped;
+        escaped.reserve(value.size());
+        for (const char c : value) {
+            switch (c) {
+                case '"': escaped += "\\\""; break;
+                case '\\': escaped += "\\\\"; break;
+                case '\n': escaped += "\\n"; break;
+                case '\t': escaped += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                        escaped += std::format("\\u{:04x}", static_cast<unsigned>(c));
+                    else
+                        escaped += c;
+            }
+        }
+        return escaped;
+    }
+
+    size_t EcsStats::totalBytes() const
+    {
+        size_t total = 0;
+        for (const auto &component : components)
+            total += component.array.totalBytes();
+        return total;
+    }
+
+    std::string EcsStats::toJson() const
+    {
+        std::string json = std::format("{{\n  \"countersEnabled\": {},\n  \"livingEntities\": {},\n  \"totalBytes\": {},\n  \"components\": [",
+                                       countersEnabled, livingEntities, totalBytes());
+        for (size_t i = 0; i < components.size(); ++i) {
+            const auto &[type, name, array] = components[i];
+            json += std::format(
+                "{}\n    {{\"type\": {}, \"name\": \"{}\", \"componentSize\": {}, \"count\": {}, \"groupSize\": {}, "
+                "\"capacity\": {}, \"dataBytes\": {}, \"sparseBytes\": {}, \"denseBytes\": {}, \"trackerBytes\": {}, "
+                "\"totalBytes\": {}, \"inserts\": {}, \"removes\": {}, \"groupMoves\": {}, \"groupSwaps\": {}}}",
+                i ? "," : "", type, escapeJson(name), array.componentSize, array.count, array.groupSize,
+                array.capacity, array.dataBytes, array.sparseBytes, array.denseBytes, array.trackerBytes,
+                array.totalBytes(), array.counters.inserts, array.counters.removes, array.counters.groupMoves,
+                array.counters.groupSwaps);
+        }
+        json += components.empty() ? "],\n  \"groups\": [" : "\n  ],\n  \"groups\": [";
+        for (size_t i = 0; i < groups.size(); ++i) {
+            const auto &group = groups[i];
+            json += std::format(
+                "{}\n    {{\"name\": \"{}\", \"owned\": \"{}\", \"all\": \"{}\", \"size\": {}, \"partitionViews\": {}, "
+                "\"entitiesAdded\": {}, \"entitiesRemoved\": {}, \"sorts\": {}, \"partitionRebuilds\": {}, "
+                "\"partitionRebuildMs\": {}, \"lastPartitionRebuildMs\": {}}}",
+                i ? "," : "", escapeJson(group.name), group.ownedSignature.to_string(), group.allSignature.to_string(),
+                group.size, group.partitionViews, group.counters.entitiesAdded, group.counters.entitiesRemoved,
+                group.counters.sorts, group.counters.partitionRebuilds, group.counters.partitionRebuildMs,
+                group.counters.lastPartitionRebuildMs);
+        }
+        json += groups.empty() ? "]\n}\n" : "\n  ]\n}\n";
+        return json;
+    }
+
+    bool EcsStats::saveToFile(const std::filesystem::path &path) const
+    {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file)
+            return false;
+        file << toJson();
+        return static_cast<bool>(file);
+    }
+
+    std::string readableTypeName(const char *typeName)
+    {
+#if defined(__GNUG__)
+        int status = 0;
+        const std::unique_ptr<char, void (*)(void *)> demangled(
+            abi::__cxa_demangle(typeName, nullptr, nullptr, &status), std::free);
+        std::string name = status == 0 && demangled ? demangled.get() : typeName;
+#else
+        std::string name = typeName;
+        for (const std::string_view prefix : {"struct ", "class "}) {
+            if (name.starts_with(prefix))
+                name.erase(0, prefix.size());
+        }
+#endif
+        // Namespaces only add noise in the statistics
+        if (const size_t templateStart = name.find('<'); templateStart == std::string::npos) {
+            if (const size_t lastScope = name.rfind("::"); lastScope != std::string::npos)
+                name.erase(0, lastScope + 2);
+        }
+        return name;
+    }
+
+}
@@ -0,0 +1,143 @@
+//// EcsStats.hpp /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the ECS memory and operation statistics
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Definitions.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Runs the statement only when the ECS statistics are compiled in.
+ *
+ * Operation counters are enabled by defining NEXO_ECS_STATS, without it every counter update
+ * disappears at compile time. Memory figures are computed on demand and always available.
+ */
+#ifdef NEXO_ECS_STATS
+    #define NEXO_ECS_STAT(statement) statement
+#else
+    #define NEXO_ECS_STAT(statement) ((void)0)
+#endif
+
+namespace nexo::ecs {
+
+    /**
+     * @brief Whether the operation counters are compiled in.
+     */
+#ifdef NEXO_ECS_STATS
+    constexpr bool ECS_STATS_ENABLED = true;
+#else
+    constexpr bool ECS_STATS_ENABLED = false;
+#endif
+
+    /**
+     * @brief Operation counters of a component array, accumulated until reset.
+     */
+    struct ComponentArrayCounters {
+        uint64_t inserts = 0;    ///< Components added (single, batch or template instantiation)
+        uint64_t removes = 0;    ///< Components removed
+        uint64_t groupMoves = 0; ///< Entities entering or leaving the group region
+        uint64_t groupSwaps = 0; ///< Component swaps performed to keep the group region packed
+    };
+
+    /**
+     * @brief Memory and occupancy of a component array.
+     */
+    struct ComponentArrayStats {
+        size_t componentSize = 0; ///< Size of one component in bytes
+        size_t count = 0;         ///< Live components
+        size_t groupSize = 0;     ///< Components in the group region
+        size_t capacity = 0;      ///< Components the storage holds without reallocating
+        size_t dataBytes = 0;     ///< Bytes reserved for the components
+        size_t sparseBytes = 0;   ///< Bytes of the entity to index mapping
+        size_t denseBytes = 0;    ///< Bytes of the packed entity list
+        size_t trackerBytes = 0;  ///< Bytes of the change history
+        ComponentArrayCounters counters;
+
+        [[nodiscard]] size_t totalBytes() const { return dataBytes + sparseBytes + denseBytes + trackerBytes; }
+    };
+
+    /**
+     * @brief Statistics of one registered component type.
+     */
+    struct ComponentTypeStats {
+        ComponentType type = 0;
+        std::string name;
+        ComponentArrayStats array;
+    };
+
+    /**
+     * @brief Operation counters of a group, accumulated until reset.
+     */
+    struct GroupCounters {
+        uint64_t entitiesAdded = 0;        ///< Entities that joined the group
+        uint64_t entitiesRemoved = 0;      ///< Entities that left the group
+        uint64_t sorts = 0;                ///< Sorts that actually reordered the group
+        uint64_t partitionRebuilds = 0;    ///< Partition views rebuilt
+        double partitionRebuildMs = 0.0;   ///< Total time spent rebuilding partitions
+        double lastPartitionRebuildMs = 0.0;
+    };
+
+    /**
+     * @brief Statistics of one group.
+     */
+    struct GroupStats {
+        std::string name;
+        Signature ownedSignature;
+        Signature allSignature;
+        size_t size = 0;
+        size_t partitionViews = 0;
+        GroupCounters counters;
+    };
+
+    /**
+     * @brief Statistics of a whole ECS world, as returned by Coordinator::collectStats.
+     */
+    struct EcsStats {
+        bool countersEnabled = ECS_STATS_ENABLED;
+        size_t livingEntities = 0;
+        std::vector<ComponentTypeStats> components;
+        std::vector<GroupStats> groups;
+
+        /**
+         * @brief Sums the memory held by every component array.
+         */
+        [[nodiscard]] size_t totalBytes() const;
+
+        /**
+         * @brief Serializes the statistics to a JSON document.
+         */
+        [[nodiscard]] std::string toJson() const;
+
+        /**
+         * @brief Writes the JSON document to a file.
+         *
+         * @return true if the file was written.
+         */
+        [[nodiscard]] bool saveToFile(const std::filesystem::path &path) const;
+    };
+
+    /**
+     * @brief Makes a readable name out of a std::type_info name.
+     */
+    [[nodiscard]] std::string readableTypeName(const char *typeName);
+
+}
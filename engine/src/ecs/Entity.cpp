@@ -38,11 +38,26 @@ namespace nexo::ecs {
 
         const Entity id = m_availableEntities.front();
         m_availableEntities.pop_front();
+        if (m_recycledCount)
+            --m_recycledCount;
         m_livingEntities.push_back(id);
 
         return id;
     }
 
+    void EntityManager::createEntities(const size_t count, std::vector<Entity> &entities)
+    {
+        if (count > m_availableEntities.size())
+            THROW_EXCEPTION(TooManyEntities);
+
+        const auto first = m_availableEntities.begin();
+        const auto last = first + static_cast<std::ptrdiff_t>(count);
+        entities.insert(entities.end(), first, last);
+        m_livingEntities.insert(m_livingEntities.end(), first, last);
+        m_availableEntities.erase(first, last);
+        m_recycledCount -= std::min(m_recycledCount, count);
+    }
+
     void EntityManager::destroyEntity(const Entity entity)
     {
         if (entity >= MAX_ENTITIES)
@@ -56,6 +71,7 @@ namespace nexo::ecs {
         m_signatures[entity].reset();
 
         m_availableEntities.push_front(entity);
+        ++m_recycledCount;
 
     }
 
@@ -85,4 +101,37 @@ namespace nexo::ecs {
         return {m_livingEntities};
     }
 
+    void EntityManager::saveSnapshot(EntitySnapshot &snapshot) const
+    {
+        snapshot.livingEntities.assign(m_livingEntities.begin(), m_livingEntities.end());
+        snapshot.signatures.resize(m_livingEntities.size());
+        for (size_t i = 0; i < m_livingEntities.size(); ++i)
+            snapshot.signatures[i] = m_signatures[m_livingEntities[i]];
+        snapshot.recycledEntities.assign(m_availableEntities.begin(),
+                                         m_availableEntities.begin() + static_cast<std::ptrdiff_t>(m_recycledCount));
+        snapshot.nextFreshEntity = m_recycledCount < m_availableEntities.size() ? m_availableEntities[m_recycledCount] : MAX_ENTITIES;
+    }
+
+    void EntityManager::restoreSnapshot(const EntitySnapshot &snapshot)
+    {
+        if (snapshot.livingEntities.size() != snapshot.signatures.size())
+            THROW_EXCEPTION(InvalidSnapshot, "every living entity needs a signature");
+        if (snapshot.nextFreshEntity > MAX_ENTITIES ||
+            snapshot.livingEntities.size() + snapshot.recycledEntities.size() + (MAX_ENTITIES - snapshot.nextFreshEntity) != MAX_ENTITIES)
+            THROW_EXCEPTION(InvalidSnapshot, "entity table does not account for every entity");
+        if (std::ranges::any_of(snapshot.livingEntities, [](const Entity entity) { return entity >= MAX_ENTITIES; }))
+            THROW_EXCEPTION(InvalidSnapshot, "living entity exceeds MAX_ENTITIES");
+
+        for (const Entity entity : m_livingEntities)
+            m_signatures[entity].reset();
+        m_livingEntities.assign(snapshot.livingEntities.begin(), snapshot.livingEntities.end());
+        for (size_t i = 0; i < m_livingEntities.size(); ++i)
+            m_signatures[m_livingEntities[i]] = snapshot.signatures[i];
+
+        m_availableEntities.assign(snapshot.recycledEntities.begin(), snapshot.recycledEntities.end());
+        for (Entity entity = snapshot.nextFreshEntity; entity < MAX_ENTITIES; ++entity)
+            m_availableEntities.push_back(entity);
+        m_recycledCount = snapshot.recycledEntities.size();
+    }
+
 }
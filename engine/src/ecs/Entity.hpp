@@ -25,6 +25,7 @@
 #include <span>
 
 #include "Definitions.hpp"
+#include "WorldSnapshot.hpp"
 
 namespace nexo::ecs {
 
@@ -53,6 +54,15 @@ namespace nexo::ecs {
             */
             Entity createEntity();
 
+            /**
+            * @brief Creates several entities at once.
+            *
+            * @param count - The number of entities to create.
+            * @param entities - Receives the IDs of the new entities, in creation order.
+            * @throws TooManyEntities if fewer than count IDs are available.
+            */
+            void createEntities(size_t count, std::vector<Entity> &entities);
+
             /**
             * @brief Destroys an entity.
             *
@@ -92,8 +102,25 @@ namespace nexo::ecs {
              */
             [[nodiscard]] std::span<const Entity> getLivingEntities() const;
 
+            /**
+             * @brief Captures the entity table into a snapshot
+             *
+             * @param snapshot The snapshot to fill
+             */
+            void saveSnapshot(EntitySnapshot &snapshot) const;
+
+            /**
+             * @brief Replaces the entity table with a snapshot
+             *
+             * @param snapshot The snapshot to restore
+             * @throws InvalidSnapshot if the snapshot is inconsistent
+             */
+            void restoreSnapshot(const EntitySnapshot &snapshot);
+
         private:
             std::deque<Entity> m_availableEntities{};
+            // Number of recycled IDs at the front of m_availableEntities, the rest were never used
+            size_t m_recycledCount = 0;
             std::vector<Entity> m_livingEntities{};
 
             std::array<Signature, MAX_ENTITIES> m_signatures{};
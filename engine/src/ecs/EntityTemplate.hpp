@@ -0,0 +1,121 @@
+//// EntityTemplate.hpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for entity templates, used to instantiate entity hierarchies in bulk
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Definitions.hpp"
+#include "WorldSnapshot.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace nexo::ecs {
+
+    /**
+     * @class EntityTemplate
+     * @brief Compact copy of a set of entities and of their components.
+     *
+     * Built by Coordinator::createTemplate() and instantiated any number of times by
+     * Coordinator::instantiateTemplate(). Components are stored per type in the same blocks
+     * as world snapshots, except that the entities of each block are indices in the template.
+     */
+    struct EntityTemplate {
+        std::vector<Entity> sourceEntities;                  ///< Entities the template was captured from
+        std::vector<Signature> signatures;                   ///< Signature of each template entity
+        std::vector<ComponentArraySnapshot> componentBlocks; ///< One block per component type, indexed by template index
+        std::vector<std::pair<Entity, std::uint32_t>> sourceLookup; ///< Source entity to template index, sorted
+
+        /**
+         * @brief Gets the number of entities in the template
+         * @return size_t Entity count
+         */
+        [[nodiscard]] size_t size() const { return sourceEntities.size(); }
+
+        /**
+         * @brief Finds the template index of a source entity
+         *
+         * @param source The source entity
+         * @return The template index, or INVALID_ENTITY if the entity is not part of the template
+         */
+        [[nodiscard]] Entity indexOf(const Entity source) const
+        {
+            const auto it = std::ranges::lower_bound(sourceLookup, source, {}, &std::pair<Entity, std::uint32_t>::first);
+            if (it == sourceLookup.end() || it->first != source)
+                return INVALID_ENTITY;
+            return it->second;
+        }
+    };
+
+    /**
+     * @class EntityRemap
+     * @brief Maps the source entities of a template to the entities of one of its instances.
+     *
+     * Handed to the instantiate hooks so components can rewrite the entity references they hold.
+     * References to entities outside of the template are left untouched.
+     */
+    class EntityRemap {
+        public:
+            EntityRemap(const EntityTemplate &entityTemplate, const std::span<const Entity> instance)
+                : m_template(&entityTemplate), m_instance(instance) {}
+
+            /**
+             * @brief Remaps a source entity
+             *
+             * @param source Entity referenced by a template component
+             * @return The matching instance entity, or source if it is not part of the template
+             */
+            [[nodiscard]] Entity operator()(const Entity source) const
+            {
+                const Entity index = m_template->indexOf(source);
+                return index == INVALID_ENTITY ? source : m_instance[index];
+            }
+
+            /**
+             * @brief Gets the instance entity created for a template index
+             *
+             * @param index Index in the template
+             * @return Entity The instance entity
+             */
+            [[nodiscard]] Entity at(const size_t index) const { return m_instance[index]; }
+
+            /**
+             * @brief Gets every entity of the instance, in template order
+             * @return std::span<const Entity> The instance entities
+             */
+            [[nodiscard]] std::span<const Entity> entities() const { return m_instance; }
+
+        private:
+            const EntityTemplate *m_template;
+            std::span<const Entity> m_instance;
+    };
+
+    /**
+     * @brief Hook called on every component created by a template instantiation
+     *
+     * Used to rewrite entity references, or to regenerate per-instance data such as UUIDs.
+     *
+     * @tparam T The component type
+     */
+    template<typename T>
+    using InstantiateHook = std::function<void(T &component, const EntityRemap &remap)>;
+
+}
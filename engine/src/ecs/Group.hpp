@@ -25,12 +25,14 @@
 #include <functional>
 #include <span>
 #include <memory>
+#include <memory_resource>
 #include <unordered_map>
 #include <vector>
 #include <tuple>
 #include <type_traits>
 #include <algorithm>
 #include <string>
+#include <chrono>
 
 namespace nexo::ecs {
 
@@ -62,6 +64,30 @@ namespace nexo::ecs {
 		     * @param e Entity to remove.
 		     */
 		    virtual void removeFromGroup(Entity e) = 0;
+		    /**
+		     * @brief Adds several entities to the group, invalidating the caches once.
+		     *
+		     * @param entities Entities to add.
+		     */
+		    virtual void addBatchToGroup(std::span<const Entity> entities) = 0;
+		    /**
+		     * @brief Invalidates the sorting and partition caches of the group.
+		     *
+		     * Needed when the owned arrays are reordered behind the group's back.
+		     */
+		    virtual void invalidateCaches() = 0;
+		    /**
+		     * @brief Returns the size and operation counters of the group.
+		     *
+		     * The counters stay at zero unless the ECS statistics are compiled in (NEXO_ECS_STATS).
+		     *
+		     * @return GroupStats Statistics of the group, without a name.
+		     */
+		    [[nodiscard]] virtual GroupStats stats() const = 0;
+		    /**
+		     * @brief Resets the operation counters of the group.
+		     */
+		    virtual void resetCounters() = 0;
 	};
 
 	/**
@@ -385,6 +411,21 @@ namespace nexo::ecs {
 				std::apply([e](auto&&... arrays) {
 					((arrays->addToGroup(e)), ...);
 				}, m_ownedArrays);
+				NEXO_ECS_STAT(++m_counters.entitiesAdded);
+
+				m_sortingInvalidated = true;
+				invalidatePartitions();
+		    }
+
+		    void addBatchToGroup(const std::span<const Entity> entities) override
+		    {
+				std::apply([entities](auto&&... arrays) {
+					([&] {
+						for (const Entity e : entities)
+							arrays->addToGroup(e);
+					}(), ...);
+				}, m_ownedArrays);
+				NEXO_ECS_STAT(m_counters.entitiesAdded += entities.size());
 
 				m_sortingInvalidated = true;
 				invalidatePartitions();
@@ -402,6 +443,7 @@ namespace nexo::ecs {
 				std::apply([e](auto&&... arrays) {
 					((arrays->removeFromGroup(e)), ...);
 				}, m_ownedArrays);
+				NEXO_ECS_STAT(++m_counters.entitiesRemoved);
 
 				m_sortingInvalidated = true;
 				invalidatePartitions();
@@ -482,6 +524,28 @@ namespace nexo::ecs {
 				m_sortingInvalidated = true;
 			}
 
+			void invalidateCaches() override
+			{
+				m_sortingInvalidated = true;
+				invalidatePartitions();
+			}
+
+			[[nodiscard]] GroupStats stats() const override
+			{
+				GroupStats groupStats;
+				groupStats.ownedSignature = m_ownedSignature;
+				groupStats.allSignature = m_allSignature;
+				groupStats.size = size();
+				groupStats.partitionViews = m_partitionStorageMap.size();
+				groupStats.counters = m_counters;
+				return groupStats;
+			}
+
+			void resetCounters() override
+			{
+				m_counters = {};
+			}
+
 			/**
 			 * @brief Sorts the group by a specified component field.
 			 *
@@ -540,6 +604,7 @@ namespace nexo::ecs {
 
 			    reorderGroup(entities);
 				m_sortingInvalidated = false;
+				NEXO_ECS_STAT(++m_counters.sorts);
 			}
 
 			// =======================================
@@ -729,6 +794,29 @@ namespace nexo::ecs {
 				virtual void rebuild() = 0;
 			};
 
+			/**
+			 * @brief Records the duration of a partition rebuild in the group counters when destroyed.
+			 */
+			struct RebuildTimer {
+				explicit RebuildTimer(GroupCounters &counters)
+					: m_counters(counters), m_start(std::chrono::steady_clock::now()) {}
+
+				~RebuildTimer()
+				{
+					const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - m_start;
+					++m_counters.partitionRebuilds;
+					m_counters.partitionRebuildMs += elapsed.count();
+					m_counters.lastPartitionRebuildMs = elapsed.count();
+				}
+
+				RebuildTimer(const RebuildTimer&) = delete;
+				RebuildTimer& operator=(const RebuildTimer&) = delete;
+
+				private:
+					GroupCounters &m_counters;
+					std::chrono::steady_clock::time_point m_start;
+			};
+
 			/**
 			 * @brief Concrete partition storage for a specific key type.
 			 *
@@ -759,6 +847,7 @@ namespace nexo::ecs {
 					{
 						if (!m_isDirty)
 							return;
+						NEXO_ECS_STAT(const RebuildTimer timer(m_group->m_counters));
 						auto drivingArray = std::get<0>(m_group->m_ownedArrays);
 						const size_t groupSize = drivingArray->groupSize();
 
@@ -769,7 +858,8 @@ namespace nexo::ecs {
 							return;
 						}
 
-						std::unordered_map<KeyType, std::vector<Entity>> keyToEntities;
+						// Temporaries come from the storage's pool so repeated rebuilds reuse the same memory
+						std::pmr::unordered_map<KeyType, std::pmr::vector<Entity>> keyToEntities(&m_scratch);
 
 						for (size_t i = 0; i < groupSize; i++) {
 							Entity e = drivingArray->getEntityAtIndex(i);
@@ -780,7 +870,7 @@ namespace nexo::ecs {
 						m_partitions.clear();
 						m_partitions.reserve(keyToEntities.size());
 
-						std::vector<Entity> newOrder;
+						std::pmr::vector<Entity> newOrder(&m_scratch);
 						newOrder.reserve(groupSize);
 
 						size_t currentIndex = 0;
@@ -797,7 +887,7 @@ namespace nexo::ecs {
 							currentIndex += entities.size();
 						}
 
-						m_group->reorderGroup(newOrder);
+						m_group->reorderGroup(newOrder, &m_scratch);
 						m_isDirty = false;
 					}
 
@@ -816,17 +906,20 @@ namespace nexo::ecs {
 					EntityKeyExtractor<KeyType> m_keyExtractor; ///< Function to extract a key from an entity.
 					std::vector<Partition<KeyType>> m_partitions; ///< Vector of partitions.
 					bool m_isDirty = true; ///< Flag indicating if partitions need rebuilding.
+					std::pmr::unsynchronized_pool_resource m_scratch; ///< Backs the temporaries of rebuild().
 			};
 
 			/**
 			* @brief Reorders the group entities based on a new order.
 			*
 			* @param newOrder New order of entities.
+			* @param scratch Memory resource used for the temporary component copies.
 			*/
-			void reorderGroup(const std::vector<Entity>& newOrder)
+			void reorderGroup(std::span<const Entity> newOrder,
+			                  std::pmr::memory_resource *scratch = std::pmr::get_default_resource())
 			{
 				std::apply([&](auto&&... arrays) {
-					((reorderArray(arrays, newOrder)), ...);
+					((reorderArray(arrays, newOrder, scratch)), ...);
 				}, m_ownedArrays);
 			}
 
@@ -836,9 +929,10 @@ namespace nexo::ecs {
 			* @tparam ArrayPtr Type of the component array pointer.
 			* @param array Component array pointer.
 			* @param newOrder New order of entities.
+			* @param scratch Memory resource used for the temporary component copies.
 			*/
 			template<typename ArrayPtr>
-			void reorderArray(ArrayPtr array, const std::vector<Entity>& newOrder) const
+			void reorderArray(ArrayPtr array, std::span<const Entity> newOrder, std::pmr::memory_resource *scratch) const
 			{
 				size_t groupSize = array->groupSize();
 				if (newOrder.size() != groupSize)
@@ -849,7 +943,7 @@ namespace nexo::ecs {
 
 				// Create a temporary storage for components
 				using CompType = typename std::decay_t<decltype(*array)>::component_type;
-				std::vector<CompType> tempComponents;
+				std::pmr::vector<CompType> tempComponents(scratch);
 				tempComponents.reserve(groupSize);
 
 				for (Entity e : newOrder)
@@ -951,6 +1045,7 @@ namespace nexo::ecs {
 		    Signature      m_allSignature{};   ///< Combined signature for all components.
 			bool m_sortingInvalidated = true;    ///< Flag indicating if sorting is invalidated.
 			SortingOrder m_sortingOrder = SortingOrder::ASCENDING;
+			GroupCounters m_counters;            ///< Operation counters, only updated with NEXO_ECS_STATS.
    			std::unordered_map<std::string, std::unique_ptr<IPartitionStorage>> m_partitionStorageMap; ///< Map storing partition data by ID.
 
 	};
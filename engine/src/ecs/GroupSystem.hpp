@@ -27,9 +27,53 @@
 #include <memory>
 #include <type_traits>
 #include <span>
+#include <compare>
+#include <iterator>
 
 namespace nexo::ecs {
 
+    /**
+     * @class TrackedComponentArray
+     * @brief Write access to a component array that is not owned by a group
+     *
+     * Used like a pointer to the array: `get` marks the component as modified when its type
+     * is change tracked, the same way the write spans of owned components do.
+     *
+     * @tparam T The component type
+     */
+    template<typename T>
+    class TrackedComponentArray {
+        public:
+            explicit TrackedComponentArray(std::shared_ptr<ComponentArray<T>> array) : m_array(std::move(array)) {}
+
+            const TrackedComponentArray *operator->() const { return this; }
+            explicit operator bool() const { return m_array != nullptr; }
+
+            /**
+             * @brief Gets the component of an entity for writing and marks it as modified
+             *
+             * @param entity The entity owning the component
+             * @return Reference to the component
+             */
+            [[nodiscard]] T &get(const Entity entity) const
+            {
+                m_array->markModified(entity);
+                return m_array->get(entity);
+            }
+
+            [[nodiscard]] bool hasComponent(const Entity entity) const { return m_array->hasComponent(entity); }
+            [[nodiscard]] size_t size() const { return m_array->size(); }
+            [[nodiscard]] std::span<const Entity> entities() const { return m_array->entities(); }
+
+            /**
+             * @brief Gets the underlying array, whose accesses are not tracked
+             */
+            [[nodiscard]] const std::shared_ptr<ComponentArray<T>> &array() const { return m_array; }
+
+        private:
+            std::shared_ptr<ComponentArray<T>> m_array;
+    };
+
     /**
      * @class GroupSystem
      * @brief System that uses component groups for optimized access with enforced permissions
@@ -135,14 +179,69 @@ namespace nexo::ecs {
 			class ComponentSpan {
 				private:
 					std::span<T> m_span;
+					ComponentArray<std::remove_const_t<T>> *m_trackedArray = nullptr;
 
 				public:
+					/**
+					* @brief Random access iterator over a writable span
+					*
+					* Dereferencing it marks the component as modified when its type
+					* is change tracked, like the access operator does, so writes
+					* through a range-for loop are recorded too.
+					*/
+					class TrackingIterator {
+						public:
+							using iterator_category = std::random_access_iterator_tag;
+							using iterator_concept = std::random_access_iterator_tag;
+							using value_type = std::remove_const_t<T>;
+							using difference_type = std::ptrdiff_t;
+							using pointer = T *;
+							using reference = T &;
+
+							TrackingIterator() = default;
+							TrackingIterator(T *data, const size_t index, ComponentArray<std::remove_const_t<T>> *trackedArray)
+								: m_data(data), m_index(index), m_trackedArray(trackedArray) {}
+
+							reference operator*() const
+							{
+								if (m_trackedArray)
+									m_trackedArray->markModifiedAt(m_index);
+								return m_data[m_index];
+							}
+							pointer operator->() const { return &**this; }
+							reference operator[](const difference_type offset) const { return *(*this + offset); }
+
+							TrackingIterator &operator++() { ++m_index; return *this; }
+							TrackingIterator operator++(int) { auto previous = *this; ++m_index; return previous; }
+							TrackingIterator &operator--() { --m_index; return *this; }
+							TrackingIterator operator--(int) { auto previous = *this; --m_index; return previous; }
+							TrackingIterator &operator+=(const difference_type offset) { m_index += offset; return *this; }
+							TrackingIterator &operator-=(const difference_type offset) { m_index -= offset; return *this; }
+
+							friend TrackingIterator operator+(TrackingIterator it, const difference_type offset) { return it += offset; }
+							friend TrackingIterator operator+(const difference_type offset, TrackingIterator it) { return it += offset; }
+							friend TrackingIterator operator-(TrackingIterator it, const difference_type offset) { return it -= offset; }
+							friend difference_type operator-(const TrackingIterator &a, const TrackingIterator &b)
+							{
+								return static_cast<difference_type>(a.m_index) - static_cast<difference_type>(b.m_index);
+							}
+							friend bool operator==(const TrackingIterator &a, const TrackingIterator &b) { return a.m_index == b.m_index; }
+							friend auto operator<=>(const TrackingIterator &a, const TrackingIterator &b) { return a.m_index <=> b.m_index; }
+
+						private:
+							T *m_data = nullptr;
+							size_t m_index = 0;
+							ComponentArray<std::remove_const_t<T>> *m_trackedArray = nullptr;
+					};
+
 					/**
 					* @brief Constructs a ComponentSpan from a raw span
 					*
 					* @param span The underlying component data span
+					* @param trackedArray Array to notify on write access, nullptr if changes are not tracked
 					*/
-					explicit ComponentSpan(std::span<T> span) : m_span(span) {}
+					explicit ComponentSpan(std::span<T> span, ComponentArray<std::remove_const_t<T>> *trackedArray = nullptr)
+						: m_span(span), m_trackedArray(trackedArray) {}
 
 					/**
 					* @brief Returns the number of components in the span
@@ -155,7 +254,8 @@ namespace nexo::ecs {
 					* @brief Access operator with enforced permissions
 					*
 					* Returns a mutable reference if Write access is specified,
-					* otherwise returns a const reference.
+					* otherwise returns a const reference. Write accesses mark the
+					* component as modified when its type is change tracked.
 					*
 					* @param index Element index to access
 					* @return Reference to component with appropriate const qualification
@@ -167,9 +267,11 @@ namespace nexo::ecs {
 																					const std::remove_const_t<U>&
 						>
 					{
-						if constexpr (GetComponentAccess<std::remove_const_t<U>>::accessType == AccessType::Write)
+						if constexpr (GetComponentAccess<std::remove_const_t<U>>::accessType == AccessType::Write) {
+							if (m_trackedArray)
+								m_trackedArray->markModifiedAt(index);
 							return const_cast<std::remove_const_t<U>&>(m_span[index]);
-						else
+						} else
 							return m_span[index];
 					}
 
@@ -189,15 +291,31 @@ namespace nexo::ecs {
 
 					/**
 					* @brief Returns an iterator to the beginning of the span
+					*
+					* Writable spans hand out a TrackingIterator, so the components
+					* written through it are marked as modified.
+					*
 					* @return Iterator to the first element
 					*/
-					auto begin() { return m_span.begin(); }
+					auto begin()
+					{
+						if constexpr (std::is_const_v<T>)
+							return m_span.begin();
+						else
+							return TrackingIterator(m_span.data(), 0, m_trackedArray);
+					}
 
 					/**
 					* @brief Returns an iterator to the end of the span
 					* @return Iterator one past the last element
 					*/
-					auto end() { return m_span.end(); }
+					auto end()
+					{
+						if constexpr (std::is_const_v<T>)
+							return m_span.end();
+						else
+							return TrackingIterator(m_span.data(), m_span.size(), m_trackedArray);
+					}
 
 					/**
 					* @brief Returns a const iterator to the beginning of the span
@@ -259,12 +377,20 @@ namespace nexo::ecs {
 					// Get the span from the group
 					auto baseSpan = m_group->template get<T>();
 
+					// Only hand the array to the span when writes have to be recorded
+					ComponentArray<T> *trackedArray = nullptr;
+					if constexpr (GetComponentAccess<T>::accessType == AccessType::Write) {
+						auto componentArray = coord->getComponentArray<T>();
+						if (componentArray->isChangeTrackingEnabled())
+							trackedArray = componentArray.get();
+					}
+
 					// Wrap it in our access-controlled span
 					return ComponentSpan<std::conditional_t<
 						GetComponentAccess<T>::accessType == AccessType::Read,
 						const T,
 						T
-					>>(baseSpan);
+					>>(baseSpan, trackedArray);
 				} else {
 					// For non-owned components, return the component array itself
 					auto componentArray = m_group->template get<T>();
@@ -273,7 +399,7 @@ namespace nexo::ecs {
 					if constexpr (GetComponentAccess<T>::accessType == AccessType::Read)
 						return std::shared_ptr<const ComponentArray<T>>(m_group->template get<T>());
 					else
-						return componentArray;
+						return TrackedComponentArray<T>(componentArray);
 				}
 			}
 
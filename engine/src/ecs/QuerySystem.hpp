@@ -146,6 +146,9 @@ namespace nexo::ecs {
 	        /**
 	         * @brief Get a component for an entity with access type determined at compile time
 	         *
+	         * Components accessed with Write access are marked as modified when change
+	         * tracking is enabled for their type.
+	         *
 	         * @tparam T The component type
 	         * @param entity The entity to get the component from
 	         * @return Reference to the component with appropriate const-ness
@@ -153,20 +156,27 @@ namespace nexo::ecs {
 			template<typename T>
 			std::conditional_t<hasReadAccess<T>(), const T&, T&> getComponent(Entity entity)
 			{
-				const ComponentType typeIndex = getUniqueComponentTypeID<T>();
-				const auto it = m_componentArrays.find(typeIndex);
-
-				if (it == m_componentArrays.end())
-					THROW_EXCEPTION(InternalError, "Component array not found");
-
-				auto componentArray = std::static_pointer_cast<ComponentArray<T>>(it->second);
-
-				if (!componentArray)
-					THROW_EXCEPTION(InternalError, "Failed to cast component array");
+				ComponentArray<T> &componentArray = findComponentArray<T>(entity);
+				// Write access counts as a modification for change tracking
+				if constexpr (!hasReadAccess<T>())
+					componentArray.markModified(entity);
+				return componentArray.get(entity);
+			}
 
-				if (!componentArray->hasComponent(entity))
-					THROW_EXCEPTION(InternalError, "Entity doesn't have requested component");
-				return componentArray->get(entity);
+	        /**
+	         * @brief Get a component for reading only, whatever its access type
+	         *
+	         * Unlike getComponent, a component with Write access is not marked as modified, so
+	         * systems can check whether they have to write to it first.
+	         *
+	         * @tparam T The component type
+	         * @param entity The entity to get the component from
+	         * @return Const reference to the component
+	         */
+			template<typename T>
+			const T& peekComponent(Entity entity)
+			{
+				return findComponentArray<T>(entity).get(entity);
 			}
 
 			/**
@@ -184,6 +194,30 @@ namespace nexo::ecs {
 			Signature& getSignature() { return m_signature; }
 
 	    protected:
+	        /**
+	         * @brief Gets the cached array of a component the entity owns
+	         *
+	         * @throws InternalError if the array is not cached or the entity lacks the component
+	         */
+			template<typename T>
+			ComponentArray<T> &findComponentArray(Entity entity)
+			{
+				const ComponentType typeIndex = getUniqueComponentTypeID<T>();
+				const auto it = m_componentArrays.find(typeIndex);
+
+				if (it == m_componentArrays.end())
+					THROW_EXCEPTION(InternalError, "Component array not found");
+
+				auto componentArray = std::static_pointer_cast<ComponentArray<T>>(it->second);
+
+				if (!componentArray)
+					THROW_EXCEPTION(InternalError, "Failed to cast component array");
+
+				if (!componentArray->hasComponent(entity))
+					THROW_EXCEPTION(InternalError, "Entity doesn't have requested component");
+				return *componentArray;
+			}
+
 	        /**
 	         * @brief Caches component arrays for faster access (only for regular components)
 	         *
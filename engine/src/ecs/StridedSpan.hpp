@@ -0,0 +1,110 @@
+//// StridedSpan.hpp //////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the strided view over a component field column
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace nexo::ecs {
+
+    /**
+     * @class StridedSpan
+     * @brief Non-owning view over elements laid out with a fixed byte stride.
+     *
+     * Used to walk a single field of densely packed components (a "column") without copying it,
+     * e.g. the float at offset 8 of every component of a type-erased array.
+     *
+     * @tparam T The element type, may be const qualified.
+     */
+    template<typename T>
+    class StridedSpan {
+        using BytePointer = std::conditional_t<std::is_const_v<T>, const std::byte *, std::byte *>;
+
+        public:
+            class Iterator {
+                public:
+                    using iterator_category = std::random_access_iterator_tag;
+                    using value_type = std::remove_cv_t<T>;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = T *;
+                    using reference = T &;
+
+                    Iterator() = default;
+                    Iterator(const BytePointer data, const size_t stride) : m_data(data), m_stride(stride) {}
+
+                    reference operator*() const { return *reinterpret_cast<pointer>(m_data); }
+                    pointer operator->() const { return reinterpret_cast<pointer>(m_data); }
+                    reference operator[](const difference_type n) const { return *(*this + n); }
+
+                    Iterator &operator++() { m_data += m_stride; return *this; }
+                    Iterator operator++(int) { Iterator tmp = *this; ++*this; return tmp; }
+                    Iterator &operator--() { m_data -= m_stride; return *this; }
+                    Iterator operator--(int) { Iterator tmp = *this; --*this; return tmp; }
+                    Iterator &operator+=(const difference_type n) { m_data += n * static_cast<difference_type>(m_stride); return *this; }
+                    Iterator &operator-=(const difference_type n) { return *this += -n; }
+
+                    friend Iterator operator+(Iterator it, const difference_type n) { return it += n; }
+                    friend Iterator operator+(const difference_type n, Iterator it) { return it += n; }
+                    friend Iterator operator-(Iterator it, const difference_type n) { return it -= n; }
+                    friend difference_type operator-(const Iterator &a, const Iterator &b)
+                    {
+                        return (a.m_data - b.m_data) / static_cast<difference_type>(a.m_stride);
+                    }
+
+                    friend bool operator==(const Iterator &a, const Iterator &b) { return a.m_data == b.m_data; }
+                    friend auto operator<=>(const Iterator &a, const Iterator &b) { return a.m_data <=> b.m_data; }
+
+                private:
+                    BytePointer m_data = nullptr;
+                    size_t m_stride = sizeof(T);
+            };
+
+            StridedSpan() = default;
+
+            /**
+             * @brief Creates a view over count elements.
+             *
+             * @param data Address of the first element.
+             * @param count Number of elements.
+             * @param stride Distance in bytes between two consecutive elements.
+             */
+            StridedSpan(const BytePointer data, const size_t count, const size_t stride)
+                : m_data(data), m_count(count), m_stride(stride) {}
+
+            [[nodiscard]] T &operator[](const size_t index) const
+            {
+                return *reinterpret_cast<T *>(m_data + index * m_stride);
+            }
+
+            [[nodiscard]] size_t size() const { return m_count; }
+            [[nodiscard]] bool empty() const { return m_count == 0; }
+            [[nodiscard]] size_t stride() const { return m_stride; }
+            [[nodiscard]] BytePointer data() const { return m_data; }
+
+            [[nodiscard]] Iterator begin() const { return {m_data, m_stride}; }
+            [[nodiscard]] Iterator end() const { return {m_data + m_count * m_stride, m_stride}; }
+
+        private:
+            BytePointer m_data = nullptr;
+            size_t m_count = 0;
+            size_t m_stride = sizeof(T);
+    };
+
+}
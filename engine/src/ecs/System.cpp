@@ -78,4 +78,10 @@ namespace nexo::ecs {
             }
         }
     }
+
+    void SystemManager::clearSystemEntities() const
+    {
+        for (const auto& system : std::ranges::views::values(m_querySystems))
+            system->entities.clear();
+    }
 }
@@ -79,6 +79,11 @@ namespace nexo::ecs {
 	         */
 	        size_t size() const { return dense.size(); }
 
+	        /**
+	         * @brief Remove every entity from the set
+	         */
+	        void clear() { dense.clear(); sparse.clear(); }
+
 	        /**
 	         * @brief Get the dense array of entities
 	         *
@@ -244,6 +249,13 @@ namespace nexo::ecs {
             * @param newSignature - The new signature of the entity.
             */
             void entitySignatureChanged(Entity entity, Signature oldSignature, Signature newSignature);
+
+            /**
+            * @brief Removes every entity from the query systems.
+            *
+            * Used before repopulating the systems from scratch, e.g. after restoring a world snapshot.
+            */
+            void clearSystemEntities() const;
         private:
 	        /**
 	         * @brief Map of system type to component signature
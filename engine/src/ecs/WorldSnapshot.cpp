@@ -0,0 +1,257 @@
+//// WorldSnapshot.cpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the binary snapshot of the ECS world
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "WorldSnapshot.hpp"
+#include "ECSExceptions.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <type_traits>
+
+namespace nexo::ecs {
+
+    namespace {
+        constexpr std::array<char, 8> SNAPSHOT_MAGIC = {'N', 'X', 'S', 'N', 'A', 'P', '\0', '\0'};
+        constexpr std::uint32_t SNAPSHOT_VERSION = 1;
+        constexpr size_t SNAPSHOT_ALIGNMENT = 64;
+
+        static_assert(MAX_COMPONENT_TYPE <= 32, "Signatures are stored on 32 bits in snapshot files");
+
+        struct FileHeader {
+            std::array<char, 8> magic;
+            std::uint32_t version;
+            std::uint32_t arrayCount;
+            std::uint64_t livingCount;
+            std::uint64_t recycledCount;
+            std::uint64_t livingOffset;
+            std::uint64_t signaturesOffset;
+            std::uint64_t recycledOffset;
+            std::uint64_t arrayTableOffset;
+            std::uint32_t nextFreshEntity;
+            std::uint32_t padding;
+        };
+
+        struct ArrayHeader {
+            std::uint64_t typeHash;
+            std::uint64_t componentSize;
+            std::uint64_t count;
+            std::uint64_t groupSize;
+            std::uint64_t entitiesOffset;
+            std::uint64_t dataOffset;
+            std::uint64_t dataSize;
+            std::uint8_t type;
+            std::uint8_t encoding;
+            std::array<std::uint8_t, 6> padding;
+        };
+
+        static_assert(std::is_trivially_copyable_v<FileHeader> && std::is_trivially_copyable_v<ArrayHeader>);
+
+        constexpr size_t alignOffset(const size_t offset)
+        {
+            return (offset + SNAPSHOT_ALIGNMENT - 1) & ~(SNAPSHOT_ALIGNMENT - 1);
+        }
+
+        /**
+         * @brief Reserves an aligned block at the end of the image layout
+         *
+         * @param end Current end of the layout, moved past the new block
+         * @param size Size of the block in bytes
+         * @return std::uint64_t Offset of the block
+         */
+        std::uint64_t reserveBlock(size_t &end, const size_t size)
+        {
+            const size_t offset = alignOffset(end);
+            end = offset + size;
+            return offset;
+        }
+
+        void writeBlock(std::vector<std::byte> &image, const std::uint64_t offset, const void *data, const size_t size)
+        {
+            if (size)
+                std::memcpy(image.data() + offset, data, size);
+        }
+
+        void checkBounds(const std::span<const std::byte> image, const std::uint64_t offset, const std::uint64_t size)
+        {
+            if (offset > image.size() || size > image.size() - offset)
+                THROW_EXCEPTION(InvalidSnapshot, "image is truncated");
+        }
+
+        template<typename T>
+        void readBlock(const std::span<const std::byte> image, const std::uint64_t offset, const std::uint64_t count, std::vector<T> &out)
+        {
+            if (count > image.size() / sizeof(T))
+                THROW_EXCEPTION(InvalidSnapshot, "image is truncated");
+            checkBounds(image, offset, count * sizeof(T));
+            out.resize(count);
+            if (count)
+                std::memcpy(out.data(), image.data() + offset, count * sizeof(T));
+        }
+    }
+
+    bool WorldSnapshot::isPersistable() const
+    {
+        return std::ranges::none_of(componentArrays, [](const ComponentArraySnapshot &array) {
+            return array.encoding == SnapshotEncoding::OBJECTS;
+        });
+    }
+
+    size_t WorldSnapshot::memoryUsage() const
+    {
+        size_t usage = sizeof(Entity) * (entities.livingEntities.capacity() + entities.recycledEntities.capacity())
+                     + sizeof(Signature) * entities.signatures.capacity();
+        for (const auto &array : componentArrays) {
+            usage += sizeof(ComponentArraySnapshot)
+                   + sizeof(Entity) * array.entities.capacity()
+                   + array.data.capacity();
+            if (array.encoding == SnapshotEncoding::OBJECTS)
+                usage += array.componentSize * array.entities.size();
+        }
+        return usage;
+    }
+
+    std::vector<std::byte> WorldSnapshot::toImage() const
+    {
+        if (!isPersistable())
+            THROW_EXCEPTION(InvalidSnapshot, "a component type without serializer cannot be written to a file");
+
+        FileHeader header{};
+        header.magic = SNAPSHOT_MAGIC;
+        header.version = SNAPSHOT_VERSION;
+        header.arrayCount = static_cast<std::uint32_t>(componentArrays.size());
+        header.livingCount = entities.livingEntities.size();
+        header.recycledCount = entities.recycledEntities.size();
+        header.nextFreshEntity = entities.nextFreshEntity;
+
+        // First pass: lay out every block at an aligned offset
+        size_t end = sizeof(FileHeader);
+        header.livingOffset = reserveBlock(end, header.livingCount * sizeof(Entity));
+        header.signaturesOffset = reserveBlock(end, header.livingCount * sizeof(std::uint32_t));
+        header.recycledOffset = reserveBlock(end, header.recycledCount * sizeof(Entity));
+        header.arrayTableOffset = reserveBlock(end, componentArrays.size() * sizeof(ArrayHeader));
+
+        std::vector<ArrayHeader> arrayHeaders(componentArrays.size());
+        for (size_t i = 0; i < componentArrays.size(); ++i) {
+            const auto &array = componentArrays[i];
+            auto &arrayHeader = arrayHeaders[i];
+            arrayHeader.typeHash = array.typeHash;
+            arrayHeader.componentSize = array.componentSize;
+            arrayHeader.count = array.entities.size();
+            arrayHeader.groupSize = array.groupSize;
+            arrayHeader.type = array.type;
+            arrayHeader.encoding = static_cast<std::uint8_t>(array.encoding);
+            arrayHeader.entitiesOffset = reserveBlock(end, array.entities.size() * sizeof(Entity));
+            arrayHeader.dataOffset = reserveBlock(end, array.data.size());
+            arrayHeader.dataSize = array.data.size();
+        }
+
+        // Second pass: copy the blocks
+        std::vector<std::byte> image(alignOffset(end));
+        writeBlock(image, 0, &header, sizeof(FileHeader));
+        writeBlock(image, header.livingOffset, entities.livingEntities.data(), header.livingCount * sizeof(Entity));
+        std::vector<std::uint32_t> signatures(entities.signatures.size());
+        for (size_t i = 0; i < signatures.size(); ++i)
+            signatures[i] = static_cast<std::uint32_t>(entities.signatures[i].to_ulong());
+        writeBlock(image, header.signaturesOffset, signatures.data(), signatures.size() * sizeof(std::uint32_t));
+        writeBlock(image, header.recycledOffset, entities.recycledEntities.data(), header.recycledCount * sizeof(Entity));
+        writeBlock(image, header.arrayTableOffset, arrayHeaders.data(), arrayHeaders.size() * sizeof(ArrayHeader));
+        for (size_t i = 0; i < componentArrays.size(); ++i) {
+            const auto &array = componentArrays[i];
+            writeBlock(image, arrayHeaders[i].entitiesOffset, array.entities.data(), array.entities.size() * sizeof(Entity));
+            writeBlock(image, arrayHeaders[i].dataOffset, array.data.data(), array.data.size());
+        }
+        return image;
+    }
+
+    WorldSnapshot WorldSnapshot::fromImage(const std::span<const std::byte> image)
+    {
+        FileHeader header{};
+        checkBounds(image, 0, sizeof(FileHeader));
+        std::memcpy(&header, image.data(), sizeof(FileHeader));
+        if (header.magic != SNAPSHOT_MAGIC)
+            THROW_EXCEPTION(InvalidSnapshot, "not a snapshot image");
+        if (header.version != SNAPSHOT_VERSION)
+            THROW_EXCEPTION(InvalidSnapshot, std::format("unsupported version {}", header.version));
+        if (header.livingCount > MAX_ENTITIES || header.recycledCount > MAX_ENTITIES || header.nextFreshEntity > MAX_ENTITIES)
+            THROW_EXCEPTION(InvalidSnapshot, "entity table exceeds MAX_ENTITIES");
+        if (header.arrayCount > MAX_COMPONENT_TYPE)
+            THROW_EXCEPTION(InvalidSnapshot, "too many component arrays");
+
+        WorldSnapshot snapshot;
+        readBlock(image, header.livingOffset, header.livingCount, snapshot.entities.livingEntities);
+        std::vector<std::uint32_t> signatures;
+        readBlock(image, header.signaturesOffset, header.livingCount, signatures);
+        snapshot.entities.signatures.reserve(signatures.size());
+        for (const std::uint32_t signature : signatures)
+            snapshot.entities.signatures.emplace_back(signature);
+        readBlock(image, header.recycledOffset, header.recycledCount, snapshot.entities.recycledEntities);
+        snapshot.entities.nextFreshEntity = header.nextFreshEntity;
+
+        std::vector<ArrayHeader> arrayHeaders;
+        readBlock(image, header.arrayTableOffset, header.arrayCount, arrayHeaders);
+        snapshot.componentArrays.resize(arrayHeaders.size());
+        for (size_t i = 0; i < arrayHeaders.size(); ++i) {
+            const auto &arrayHeader = arrayHeaders[i];
+            auto &array = snapshot.componentArrays[i];
+            if (arrayHeader.type >= MAX_COMPONENT_TYPE)
+                THROW_EXCEPTION(InvalidSnapshot, std::format("invalid component type {}", arrayHeader.type));
+            if (arrayHeader.encoding > static_cast<std::uint8_t>(SnapshotEncoding::SERIALIZED))
+                THROW_EXCEPTION(InvalidSnapshot, "invalid component encoding");
+            if (arrayHeader.count > MAX_ENTITIES || arrayHeader.groupSize > arrayHeader.count)
+                THROW_EXCEPTION(InvalidSnapshot, "invalid component count");
+            array.type = arrayHeader.type;
+            array.typeHash = arrayHeader.typeHash;
+            array.componentSize = arrayHeader.componentSize;
+            array.groupSize = arrayHeader.groupSize;
+            array.encoding = static_cast<SnapshotEncoding>(arrayHeader.encoding);
+            if (array.encoding == SnapshotEncoding::RAW && arrayHeader.dataSize != arrayHeader.count * arrayHeader.componentSize)
+                THROW_EXCEPTION(InvalidSnapshot, "raw component block has an unexpected size");
+            readBlock(image, arrayHeader.entitiesOffset, arrayHeader.count, array.entities);
+            readBlock(image, arrayHeader.dataOffset, arrayHeader.dataSize, array.data);
+        }
+        return snapshot;
+    }
+
+    void WorldSnapshot::saveToFile(const std::filesystem::path &path) const
+    {
+        const std::vector<std::byte> image = toImage();
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            THROW_EXCEPTION(InvalidSnapshot, std::format("cannot open {} for writing", path.string()));
+        file.write(reinterpret_cast<const char *>(image.data()), static_cast<std::streamsize>(image.size()));
+        if (!file)
+            THROW_EXCEPTION(InvalidSnapshot, std::format("cannot write {}", path.string()));
+    }
+
+    WorldSnapshot WorldSnapshot::loadFromFile(const std::filesystem::path &path)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+            THROW_EXCEPTION(InvalidSnapshot, std::format("cannot open {}", path.string()));
+        const std::streamsize size = file.tellg();
+        file.seekg(0, std::ios::beg);
+        std::vector<std::byte> image(static_cast<size_t>(size));
+        if (!file.read(reinterpret_cast<char *>(image.data()), size))
+            THROW_EXCEPTION(InvalidSnapshot, std::format("cannot read {}", path.string()));
+        return fromImage(image);
+    }
+
+}
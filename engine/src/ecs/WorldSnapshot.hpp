@@ -0,0 +1,185 @@
+//// WorldSnapshot.hpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the binary snapshot of the ECS world
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Definitions.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <typeinfo>
+#include <vector>
+
+namespace nexo::ecs {
+
+    /**
+     * @brief How the components of an array are stored inside a snapshot
+     */
+    enum class SnapshotEncoding : std::uint8_t {
+        RAW,        ///< Dense block copied byte for byte, used for trivially copyable components
+        SERIALIZED, ///< Byte stream produced by the serializer hook of the component type
+        OBJECTS     ///< Deep copy of the components, only valid for in-memory snapshots
+    };
+
+    /**
+     * @brief Serializer hook for component types that are not trivially copyable
+     *
+     * Without a serializer, such components are deep copied in memory and the snapshot
+     * cannot be written to a file.
+     *
+     * @tparam T The component type
+     */
+    template<typename T>
+    struct ComponentSerializer {
+        /// Appends the binary representation of a component to the stream
+        std::function<void(const T &component, std::vector<std::byte> &stream)> serialize;
+        /// Reads a component from the stream, advancing offset past the consumed bytes
+        std::function<T(std::span<const std::byte> stream, size_t &offset)> deserialize;
+    };
+
+    /**
+     * @brief Hashes a type name with FNV-1a
+     *
+     * Used to check that a snapshot is restored into arrays holding the same component type.
+     *
+     * @param name The name to hash
+     * @return std::uint64_t The hash of the name
+     */
+    constexpr std::uint64_t hashTypeName(const std::string_view name)
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (const char c : name) {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Gets the snapshot type hash of a component type
+     *
+     * @tparam T The component type
+     * @return std::uint64_t Hash of the type name
+     */
+    template<typename T>
+    std::uint64_t getSnapshotTypeHash()
+    {
+        static const std::uint64_t hash = hashTypeName(typeid(T).name());
+        return hash;
+    }
+
+    /**
+     * @brief Captured state of a single component array
+     */
+    struct ComponentArraySnapshot {
+        ComponentType type = 0;                  ///< Component type ID of the array
+        std::uint64_t typeHash = 0;              ///< Hash of the component type name, 0 for type-erased arrays
+        size_t componentSize = 0;                ///< Size in bytes of a single component
+        size_t groupSize = 0;                    ///< Number of grouped entries at the front of the array
+        SnapshotEncoding encoding = SnapshotEncoding::RAW;
+        std::vector<Entity> entities;            ///< Dense entity array, in storage order
+        std::vector<std::byte> data;             ///< RAW or SERIALIZED component data
+        std::shared_ptr<const void> objects;     ///< OBJECTS encoding: std::vector<T> holding the components
+    };
+
+    /**
+     * @brief Captured state of the entity manager
+     *
+     * The queue of available entities is always made of recycled IDs followed by the
+     * untouched range [nextFreshEntity, MAX_ENTITIES), so only the recycled part is stored.
+     */
+    struct EntitySnapshot {
+        std::vector<Entity> livingEntities;      ///< Living entities, in creation order
+        std::vector<Signature> signatures;       ///< Signature of each living entity
+        std::vector<Entity> recycledEntities;    ///< Recycled IDs at the front of the available queue
+        Entity nextFreshEntity = 0;              ///< First never used entity ID
+    };
+
+    /**
+     * @class WorldSnapshot
+     * @brief Binary snapshot of the entity table and of every registered component array.
+     *
+     * A snapshot is captured and restored through the Coordinator. It can be kept in memory,
+     * e.g. to reset the world when leaving play mode, or written to a file. The file image
+     * stores every block at a 64 byte aligned offset so a memory-mapped file can be handed
+     * directly to fromImage().
+     *
+     * Singleton components are not part of the snapshot.
+     */
+    class WorldSnapshot {
+        public:
+            EntitySnapshot entities;
+            std::vector<ComponentArraySnapshot> componentArrays;
+
+            /**
+             * @brief Checks whether the snapshot can be written to a file
+             *
+             * @return true if no component array relies on the in-memory OBJECTS encoding
+             */
+            [[nodiscard]] bool isPersistable() const;
+
+            /**
+             * @brief Gets the estimated memory used by the snapshot
+             *
+             * Deep copied components are counted by their shallow size only.
+             *
+             * @return size_t Size in bytes
+             */
+            [[nodiscard]] size_t memoryUsage() const;
+
+            /**
+             * @brief Builds the file image of the snapshot
+             *
+             * @return std::vector<std::byte> The image, ready to be written as is
+             * @throws InvalidSnapshot if a component array is not persistable
+             */
+            [[nodiscard]] std::vector<std::byte> toImage() const;
+
+            /**
+             * @brief Rebuilds a snapshot from a file image
+             *
+             * @param image The image, either read from a file or memory-mapped
+             * @return WorldSnapshot The decoded snapshot
+             * @throws InvalidSnapshot if the image is truncated or has an unknown format
+             */
+            [[nodiscard]] static WorldSnapshot fromImage(std::span<const std::byte> image);
+
+            /**
+             * @brief Writes the snapshot image to a file
+             *
+             * @param path Destination file, overwritten if it exists
+             * @throws InvalidSnapshot if the snapshot is not persistable or the file cannot be written
+             */
+            void saveToFile(const std::filesystem::path &path) const;
+
+            /**
+             * @brief Reads a snapshot from a file written by saveToFile()
+             *
+             * @param path Source file
+             * @return WorldSnapshot The decoded snapshot
+             * @throws InvalidSnapshot if the file cannot be read or is invalid
+             */
+            [[nodiscard]] static WorldSnapshot loadFromFile(const std::filesystem::path &path);
+    };
+
+}
@@ -25,8 +25,6 @@
 #include "renderer/Renderer3D.hpp"
 #include "Passes.hpp"
 
-#include <glad/glad.h>
-
 namespace nexo::renderer {
     ForwardPass::ForwardPass() : RenderPass(Passes::FORWARD, "Forward Pass")
     {
@@ -37,15 +35,11 @@ namespace nexo::renderer {
     {
         const std::shared_ptr<renderer::NxFramebuffer> renderTarget = pipeline.getRenderTarget();
         renderTarget->bind();
-       	NxRenderCommand::setClearColor(pipeline.getCameraClearColor());
+       	NxRenderCommand::setClearColor(pipeline.getFrame().clearColor);
        	NxRenderCommand::clear();
         renderTarget->clearAttachment<int>(1, -1);
-        NxRenderer3D::get().bindTextures();
-        const std::vector<DrawCommand> &drawCommands = pipeline.getDrawCommands();
-        for (const auto &cmd : drawCommands) {
-            if (cmd.filterMask & F_FORWARD_PASS)
-                cmd.execute();
-        }
+        NxRenderer3D::bindTextures(pipeline.getFrame().textures);
+        pipeline.executeDrawCommands(F_FORWARD_PASS);
         renderTarget->unbind();
     }
 }
@@ -24,8 +24,6 @@
 #include "Masks.hpp"
 #include "Passes.hpp"
 
-#include <glad/glad.h>
-
 namespace nexo::renderer {
     GridPass::GridPass() : RenderPass(Passes::GRID, "Grid pass")
     {
@@ -39,22 +37,15 @@ namespace nexo::renderer {
             return;
 
         renderTarget->bind();
-        constexpr GLenum singleDrawBuffer[] = { GL_COLOR_ATTACHMENT0 };
-        glDrawBuffers(1, singleDrawBuffer);
+        renderer::NxRenderCommand::setDrawBuffers(1);
         renderer::NxRenderCommand::setDepthMask(false);
         renderer::NxRenderCommand::setCulling(false);
-        const auto &drawCommands = pipeline.getDrawCommands();
-        for (const auto &cmd : drawCommands) {
-            if (cmd.filterMask & F_GRID_PASS) {
-                cmd.execute();
-            }
-        }
+        pipeline.executeDrawCommands(F_GRID_PASS);
         renderer::NxRenderCommand::setDepthMask(true);
         renderer::NxRenderCommand::setCulling(true);
         renderer::NxRenderCommand::setCulledFace(CulledFace::BACK);
 
-        constexpr GLenum allBuffers[] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
-        glDrawBuffers(2, allBuffers);
+        renderer::NxRenderCommand::setDrawBuffers(2);
         renderTarget->unbind();
     }
 }
@@ -17,7 +17,6 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "MaskPass.hpp"
-#include <memory>
 #include "DrawCommand.hpp"
 #include "Framebuffer.hpp"
 #include "renderer/RenderPipeline.hpp"
@@ -27,41 +26,31 @@
 #include "Passes.hpp"
 
 namespace nexo::renderer {
-    MaskPass::MaskPass(unsigned int width, unsigned int height) : RenderPass(Passes::MASK, "Mask pass")
+    MaskPass::MaskPass() : RenderPass(Passes::MASK, "Mask pass")
+    {
+
+    }
+
+    void MaskPass::setup(RenderPipeline& pipeline)
     {
         renderer::NxFramebufferSpecs maskFramebufferSpecs;
         maskFramebufferSpecs.attachments = { renderer::NxFrameBufferTextureFormats::RGBA8, renderer::NxFrameBufferTextureFormats::DEPTH24STENCIL8 };
-        maskFramebufferSpecs.width = width;  // Default size, will be resized as needed
-        maskFramebufferSpecs.height = height;
-        m_mask = renderer::NxFramebuffer::create(maskFramebufferSpecs);
+        outputs = { pipeline.createTransientTarget(maskFramebufferSpecs) };
     }
 
     void MaskPass::execute(RenderPipeline& pipeline)
     {
-        m_mask->bind();
+        const auto mask = pipeline.getTransientTarget(outputs.front());
+        if (!mask)
+            return;
+        mask->bind();
         renderer::NxRenderCommand::setClearColor({0.0f, 0.0f, 0.0f, 0.0f});
         renderer::NxRenderCommand::clear();
 
         //IMPORTANT: Bind textures after binding the framebuffer, since binding can trigger a resize and invalidate the
         // current texture slots
-        renderer::NxRenderer3D::get().bindTextures();
-        const std::vector<DrawCommand> &drawCommands = pipeline.getDrawCommands();
-        for (const auto &cmd : drawCommands) {
-            if (cmd.filterMask & F_OUTLINE_MASK)
-                cmd.execute();
-        }
-        m_mask->unbind();
-    }
-
-    void MaskPass::resize(unsigned int width, unsigned int height)
-    {
-        if (!m_mask)
-            return;
-        m_mask->resize(width, height);
-    }
-
-    std::shared_ptr<renderer::NxFramebuffer> MaskPass::getOutput() const
-    {
-        return m_mask;
+        renderer::NxRenderer3D::bindTextures(pipeline.getFrame().textures);
+        pipeline.executeDrawCommands(F_OUTLINE_MASK);
+        mask->unbind();
     }
 }
@@ -24,13 +24,11 @@ namespace nexo::renderer {
 
     class MaskPass : public RenderPass {
         public:
-            MaskPass(unsigned int width, unsigned int height);
+            MaskPass();
             ~MaskPass() override = default;
 
+            // Declares the RGBA8 + depth mask as a transient target of the pipeline, sized like its render target
+            void setup(RenderPipeline& pipeline) override;
             void execute(RenderPipeline& pipeline) override;
-            void resize(unsigned int width, unsigned int height) override;
-            std::shared_ptr<NxFramebuffer> getOutput() const override;
-        private:
-            std::shared_ptr<NxFramebuffer> m_mask;
     };
 }
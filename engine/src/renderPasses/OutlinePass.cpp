@@ -26,8 +26,6 @@
 #include "Masks.hpp"
 #include "Passes.hpp"
 
-#include <glad/glad.h>
-
 namespace nexo::renderer {
     OutlinePass::OutlinePass() : RenderPass(Passes::OUTLINE, "Outline pass")
     {
@@ -40,15 +38,14 @@ namespace nexo::renderer {
         std::shared_ptr<NxFramebuffer> maskPass = nullptr;
         for (auto prereq : prerequisites) {
             auto p = pipeline.getRenderPass(prereq);
-            if (p->getId() == Passes::MASK)
-                maskPass = p->getOutput();
+            if (p->getId() == Passes::MASK && !p->getOutputs().empty())
+                maskPass = pipeline.getTransientTarget(p->getOutputs().front());
         }
         if (!renderTarget || !maskPass)
             return;
 
         renderTarget->bind();
-        constexpr GLenum ourDrawBuffers[] = { GL_COLOR_ATTACHMENT0 };
-        glDrawBuffers(1, ourDrawBuffers);
+        renderer::NxRenderCommand::setDrawBuffers(1);
 
         renderer::NxRenderCommand::setDepthTest(false);
         renderer::NxRenderCommand::setDepthMask(false);
@@ -56,13 +53,8 @@ namespace nexo::renderer {
         renderTarget->bindDepthAsTexture(1);   // bound to unit 1
         maskPass->bindDepthAsTexture(2);       // bound to unit 2
 
-        const auto& drawCommands = pipeline.getDrawCommands();
-        for (auto const& cmd : drawCommands) {
-            if (cmd.filterMask & F_OUTLINE_PASS)
-                cmd.execute();
-        }
-        constexpr GLenum allBuffers[] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
-        glDrawBuffers(2, allBuffers);
+        pipeline.executeDrawCommands(F_OUTLINE_PASS);
+        renderer::NxRenderCommand::setDrawBuffers(2);
         renderTarget->unbind();
         renderer::NxRenderCommand::setDepthMask(true);
         renderer::NxRenderCommand::setDepthTest(true);
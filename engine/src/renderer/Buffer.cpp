@@ -17,6 +17,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Buffer.hpp"
 #include "renderer/RendererExceptions.hpp"
+#include "GraphicsApi.hpp"
+#include "headless/HeadlessBuffer.hpp"
 #ifdef NX_GRAPHICS_API_OPENGL
     #include "opengl/OpenGlBuffer.hpp"
 #endif
@@ -26,6 +28,8 @@ namespace nexo::renderer {
 
     std::shared_ptr<NxVertexBuffer> createVertexBuffer(float *vertices, unsigned int size)
     {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return std::make_shared<NxHeadlessVertexBuffer>(vertices, size);
         #ifdef NX_GRAPHICS_API_OPENGL
             return std::make_shared<NxOpenGlVertexBuffer>(vertices, size);
         #else
@@ -35,6 +39,8 @@ namespace nexo::renderer {
 
     std::shared_ptr<NxVertexBuffer> createVertexBuffer(unsigned int size)
     {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return std::make_shared<NxHeadlessVertexBuffer>(size);
         #ifdef NX_GRAPHICS_API_OPENGL
             return std::make_shared<NxOpenGlVertexBuffer>(size);
         #else
@@ -44,6 +50,8 @@ namespace nexo::renderer {
 
     std::shared_ptr<NxIndexBuffer> createIndexBuffer()
     {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return std::make_shared<NxHeadlessIndexBuffer>();
         #ifdef NX_GRAPHICS_API_OPENGL
             return std::make_shared<NxOpenGlIndexBuffer>();
         #else
@@ -39,6 +39,9 @@ namespace nexo::renderer {
      * - MAT3, MAT4: Represents 3x3 or 4x4 matrices.
      * - INT, INT2, INT3, INT4: Represents one or more integer values.
      * - BOOL: Represents a boolean value.
+     * - HALF2: Two half-precision floats, used for compact texture coordinates.
+     * - SHORT2, USHORT4: Two signed or four unsigned 16-bit integers, read as floats by the
+     *   shader (normalized when the buffer element asks for it).
      */
     enum class NxShaderDataType {
         NONE = 0,
@@ -52,7 +55,10 @@ namespace nexo::renderer {
         INT2,
         INT3,
         INT4,
-        BOOL
+        BOOL,
+        HALF2,
+        SHORT2,
+        USHORT4
     };
 
     /**
@@ -83,6 +89,9 @@ namespace nexo::renderer {
             case NxShaderDataType::INT3:     return 4 * 3;  // 3 ints (12 bytes)
             case NxShaderDataType::INT4:     return 4 * 4;  // 4 ints (16 bytes)
             case NxShaderDataType::BOOL:     return 1;  // 1 byte (1 bool)
+            case NxShaderDataType::HALF2:    return 2 * 2;  // 2 halves (4 bytes)
+            case NxShaderDataType::SHORT2:   return 2 * 2;  // 2 shorts (4 bytes)
+            case NxShaderDataType::USHORT4:  return 2 * 4;  // 4 unsigned shorts (8 bytes)
             case NxShaderDataType::NONE:     return 0;  // No type, return 0
         }
         return 0; // Default case for undefined types
@@ -134,6 +143,9 @@ namespace nexo::renderer {
                 case NxShaderDataType::MAT3:      return 3 * 3;
                 case NxShaderDataType::MAT4:      return 4 * 4;
                 case NxShaderDataType::BOOL:      return 1;
+                case NxShaderDataType::HALF2:     return 2;
+                case NxShaderDataType::SHORT2:    return 2;
+                case NxShaderDataType::USHORT4:   return 4;
                 default: return 0; // Undefined type, return 0
             }
         }
@@ -170,6 +182,11 @@ namespace nexo::renderer {
             {
                 calculateOffsetAndStride();
             };
+            explicit NxBufferLayout(std::vector<NxBufferElements> elements)
+                : _elements(std::move(elements))
+            {
+                calculateOffsetAndStride();
+            };
 
             [[nodiscard]] std::vector<NxBufferElements> getElements() const { return _elements; };
             [[nodiscard]] unsigned int getStride() const { return _stride; };
@@ -279,6 +296,17 @@ namespace nexo::renderer {
              */
             virtual void setData(void *data, size_t size) = 0;
 
+            /**
+             * @brief Uploads data to a part of the vertex buffer, leaving the rest untouched.
+             *
+             * The buffer is not resized: the range must fit in the size it was created with.
+             *
+             * @param data Pointer to the data to upload.
+             * @param size The size (in bytes) of the data.
+             * @param offset Offset (in bytes) of the data in the buffer.
+             */
+            virtual void setSubData(const void *data, size_t size, size_t offset) = 0;
+
             [[nodiscard]] virtual unsigned int getId() const = 0;
     };
 
@@ -339,6 +367,17 @@ namespace nexo::renderer {
              */
             virtual void setData(unsigned int *data, size_t size) = 0;
 
+            /**
+             * @brief Uploads indices to a part of the index buffer, leaving the rest untouched.
+             *
+             * The buffer is not resized: the range must fit in the count given to the last `setData`.
+             *
+             * @param data Pointer to the indices to upload.
+             * @param count The number of indices to upload.
+             * @param offset Index of the first one in the buffer.
+             */
+            virtual void setSubData(const unsigned int *data, size_t count, size_t offset) = 0;
+
             /**
              * @brief Retrieves the number of indices in the index buffer.
              *
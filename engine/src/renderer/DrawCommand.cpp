@@ -18,42 +18,150 @@
 
 #include "DrawCommand.hpp"
 #include "RenderCommand.hpp"
+#include "ShaderStorageBuffer.hpp"
+
+#include <algorithm>
 
 namespace nexo::renderer {
-    void DrawCommand::execute() const
+    static void setUniforms(const NxShader &shader, const UniformMap &uniforms)
     {
-        static unsigned int currentShader = 0;
-        static unsigned int currentVAO    = 0;
+        // The shader API takes std::string names, reuse one buffer instead of converting every pmr key
+        thread_local std::string name;
+        for (auto const& [key, val] : uniforms) {
+            name.assign(key.data(), key.size());
+            std::visit([&](auto&& v){ shader.setUniform(name, v); }, val);
+        }
+    }
 
-        // Bind shader if changed
-        if (shader && currentShader != shader->getProgramId()) {
-            shader->bind();
-            currentShader = shader->getProgramId();
+    // Program and vertex array bound by the last command, shared by the commands and the batches
+    static unsigned int s_currentShader = 0;
+    static unsigned int s_currentVao = 0;
+    static NxDrawCommandStats s_stats;
+
+    const NxDrawCommandStats &getDrawCommandStats()
+    {
+        return s_stats;
+    }
+
+    void resetDrawCommandStats()
+    {
+        s_stats = {};
+    }
+
+    static void bindShader(const NxShader &shader)
+    {
+        if (s_currentShader != shader.getProgramId()) {
+            shader.bind();
+            s_currentShader = shader.getProgramId();
+            ++s_stats.shaderBinds;
         }
+    }
 
-        // Bind VAO for mesh, or use full-screen quad
-        if (type == CommandType::MESH && vao && currentVAO != vao->getId()) {
-            vao->bind();
-            for (const auto &vbo : vao->getVertexBuffers())
+    static void bindVertexArray(const NxVertexArray &vao)
+    {
+        if (s_currentVao != vao.getId()) {
+            vao.bind();
+            for (const auto &vbo : vao.getVertexBuffers())
                 vbo->bind();
-            currentVAO = vao->getId();
+            s_currentVao = vao.getId();
+            ++s_stats.vertexArrayBinds;
+        }
+    }
+
+    void DrawCommand::execute(const UniformMap *frameUniforms, const UniformMap *viewUniforms) const
+    {
+        if (shader)
+            bindShader(*shader);
+
+        // Bind VAO for mesh, or use full-screen quad
+        NxMeshRange streamed;
+        if (type == CommandType::MESH && vao) {
+            bindVertexArray(*vao);
+        } else if (type == CommandType::STREAMED) {
+            const auto &renderer3D = NxRenderer3D::get();
+            const std::shared_ptr<NxVertexArray> streamVao = renderer3D.getStreamVertexArray();
+            streamed = renderer3D.streamGeometry(vertices, indices);
+            // Growing the rings replaces their vertex array, which is bound while it is set up
+            if (renderer3D.getStreamVertexArray() != streamVao)
+                s_currentVao = 0;
+            bindVertexArray(*renderer3D.getStreamVertexArray());
         } else if (type == CommandType::FULL_SCREEN) {
             auto quad = getFullscreenQuad();
             quad->bind();
-            currentVAO = quad->getId();
+            s_currentVao = quad->getId();
+            ++s_stats.vertexArrayBinds;
         }
 
         // Set uniforms
         if (shader) {
-            for (auto const& [name, val] : uniforms) {
-                std::visit([&](auto&& v){ shader->setUniform(name, v); }, val);
-            }
+            if (frameUniforms)
+                setUniforms(*shader, *frameUniforms);
+            if (viewUniforms)
+                setUniforms(*shader, *viewUniforms);
+            setUniforms(*shader, uniforms);
         }
 
         if (type == CommandType::MESH && vao) {
-            NxRenderCommand::drawIndexed(vao, vao->getIndexBuffer()->getCount());
+            const size_t count = range.indexCount ? range.indexCount : vao->getIndexBuffer()->getCount();
+            NxRenderCommand::drawIndexed(vao, count, range.firstIndex, range.baseVertex);
+            ++s_stats.drawCalls;
+        } else if (type == CommandType::STREAMED) {
+            const auto &renderer3D = NxRenderer3D::get();
+            if (streamed.indexCount) {
+                NxRenderCommand::drawIndexed(renderer3D.getStreamVertexArray(), streamed.indexCount,
+                                             streamed.firstIndex, streamed.baseVertex);
+                ++s_stats.drawCalls;
+            }
+            renderer3D.closeStreamedGeometry();
         } else if (type == CommandType::FULL_SCREEN) {
             NxRenderCommand::drawUnIndexed(6);
+            ++s_stats.drawCalls;
+        }
+    }
+
+    void DrawBatch::execute(const UniformMap *frameUniforms, const UniformMap *viewUniforms) const
+    {
+        if (!shader || !vao || draws.empty())
+            return;
+        bindShader(*shader);
+        bindVertexArray(*vao);
+
+        if (frameUniforms)
+            setUniforms(*shader, *frameUniforms);
+        if (viewUniforms)
+            setUniforms(*shader, *viewUniforms);
+        shader->setUniform("uBatched", true);
+        shader->setUniform("uObjectOffset", static_cast<int>(firstObject));
+        shader->setUniform("uBatchAlbedoTex", albedoTexIndex);
+        shader->setUniform("uBatchSpecularTex", specularTexIndex);
+        // Quantized positions are decoded with the bounds of each object, only the format is shared
+        shader->setUniform("uVertexFormat", static_cast<int>(vertexFormat));
+
+        NxRenderCommand::multiDrawIndexedIndirect(vao, draws);
+        ++s_stats.drawCalls;
+    }
+
+    void SharedDrawCommands::bindObjects() const
+    {
+        static std::shared_ptr<NxShaderStorageBuffer> s_objectBuffer;
+        static size_t s_objectBufferCapacity = 0;
+        static uint64_t s_nextUploadId = 0;
+        static uint64_t s_boundUploadId = 0;
+
+        if (objects.empty())
+            return;
+        if (m_objectsUploadId == 0 || m_objectsUploadId != s_boundUploadId) {
+            const size_t size = objects.size() * sizeof(NxObjectData);
+            if (!s_objectBuffer || size > s_objectBufferCapacity) {
+                // Grown geometrically, the number of batched meshes changes with the scene
+                s_objectBufferCapacity = std::max(size, s_objectBufferCapacity * 2);
+                s_objectBuffer = NxShaderStorageBuffer::create(static_cast<unsigned int>(s_objectBufferCapacity));
+            }
+            s_objectBuffer->setData(objects.data(), size);
+            ++s_stats.objectUploads;
+            m_objectsUploadId = ++s_nextUploadId;
+            s_boundUploadId = m_objectsUploadId;
         }
+        s_objectBuffer->bindBase(NX_OBJECT_DATA_BINDING);
     }
 }
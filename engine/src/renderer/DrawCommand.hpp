@@ -17,12 +17,57 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include "Renderer3D.hpp"
+#include "RendererAPI.hpp"
 #include "Shader.hpp"
 #include "UniformCache.hpp"
 #include "VertexArray.hpp"
+#include "VertexFormat.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <glm/glm.hpp>
+#include <memory_resource>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace nexo::renderer {
 
+    /**
+     * @brief Hash allowing uniform maps to be looked up with a `std::string_view` without building a key.
+     */
+    struct UniformNameHash {
+        using is_transparent = void;
+
+        size_t operator()(const std::string_view name) const noexcept
+        {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
+
+    /**
+     * @brief Uniform name to value map used by draw commands.
+     *
+     * Allocator aware so that per-frame commands can be built on the frame arena (see `memory::FrameArena`).
+     */
+    using UniformMap = std::pmr::unordered_map<std::pmr::string, UniformValue, UniformNameHash, std::equal_to<>>;
+
+    /**
+     * @brief Formats an indexed uniform name (e.g. `uPointLights[2].color`) into a caller provided buffer.
+     *
+     * Avoids building a temporary `std::string` per uniform; the name is truncated if the buffer is too small.
+     */
+    template<typename... Args>
+    std::string_view formatUniformName(const std::span<char> buffer, std::format_string<Args...> fmt, Args &&...args)
+    {
+        const auto result = std::format_to_n(buffer.data(), static_cast<std::ptrdiff_t>(buffer.size()), fmt,
+                                             std::forward<Args>(args)...);
+        return {buffer.data(), static_cast<size_t>(std::min<std::ptrdiff_t>(result.size, static_cast<std::ptrdiff_t>(buffer.size())))};
+    }
+
     // Function to get the quad, initializing it on first use
     inline std::shared_ptr<NxVertexArray> getFullscreenQuad()
     {
@@ -50,9 +95,25 @@ namespace nexo::renderer {
         return s_fullscreenQuad;
     }
 
+    /**
+     * @brief Work submitted by the draw commands and batches, whatever the backend.
+     *
+     * Binds skipped because the program or vertex array was already bound are not counted.
+     */
+    struct NxDrawCommandStats {
+        uint64_t drawCalls = 0;         ///< Draws and multi draws issued, a multi draw counts once
+        uint64_t shaderBinds = 0;
+        uint64_t vertexArrayBinds = 0;
+        uint64_t objectUploads = 0;     ///< Uploads of the object buffer of the batches
+    };
+
+    [[nodiscard]] const NxDrawCommandStats &getDrawCommandStats();
+    void resetDrawCommandStats();
+
     enum class CommandType {
         MESH,
         FULL_SCREEN,
+        STREAMED,   //< Draws the geometry of the command through the stream rings of NxRenderer3D
     };
 
     struct DrawCommand {
@@ -60,11 +121,144 @@ namespace nexo::renderer {
 
         std::shared_ptr<NxVertexArray> vao;
         std::shared_ptr<NxShader> shader;
-        std::unordered_map<std::string, UniformValue> uniforms;
+        UniformMap uniforms;
 
+        NxMeshRange range;      //< Part of the vertex array drawn, the whole index buffer by default
+        // Geometry of STREAMED commands, rebuilt every frame, the indices are relative to its first vertex
+        std::pmr::vector<NxVertex> vertices;
+        std::pmr::vector<unsigned int> indices;
         uint32_t filterMask = 0xFFFFFFFF;
+        uint32_t texturePage = 0; //< Page of the frame textures the texture indices refer to
         bool isOpaque = true;
 
-        void execute() const;
+        DrawCommand() = default;
+
+        /**
+         * @brief Creates a command whose uniforms are allocated from the given memory resource.
+         *
+         * @param resource Resource outliving the command, typically the frame arena.
+         */
+        explicit DrawCommand(std::pmr::memory_resource *resource)
+            : uniforms(resource), vertices(resource), indices(resource) {}
+
+        /**
+         * @brief Sets a uniform of the command, reusing the existing entry when there is one.
+         *
+         * Unlike `uniforms[name]`, the name is only copied (into the command's memory resource) when it is inserted.
+         */
+        void setUniform(const std::string_view name, const UniformValue &value)
+        {
+            setUniform(uniforms, name, value);
+        }
+
+        static void setUniform(UniformMap &map, const std::string_view name, const UniformValue &value)
+        {
+            if (const auto it = map.find(name); it != map.end())
+                it->second = value;
+            else
+                map.emplace(std::piecewise_construct, std::forward_as_tuple(name), std::forward_as_tuple(value));
+        }
+
+        /**
+         * @brief Sets the uniforms the mesh shaders decode the vertices of the command's vertex array with.
+         *
+         * Commands drawing with a shader including common/vertex_decode.glsl must always set them, the values of
+         * the previous draw would otherwise stay bound to the program.
+         */
+        void setVertexDecode(const NxVertexDecode &decode)
+        {
+            setUniform("uVertexFormat", static_cast<int>(decode.format));
+            setUniform("uPositionMin", decode.positionMin);
+            setUniform("uPositionExtent", decode.positionExtent);
+        }
+
+        /**
+         * @brief Binds the command state, uploads its uniforms and issues the draw call.
+         *
+         * Uniforms are applied from the broadest scope to the narrowest one: frame-wide uniforms first, then the
+         * view (camera) uniforms, then the command's own uniforms, so a command can still override any of them.
+         *
+         * @param frameUniforms Uniforms shared by every view of the frame (e.g. lights), may be null.
+         * @param viewUniforms Uniforms specific to the view being rendered (e.g. view-projection), may be null.
+         */
+        void execute(const UniformMap *frameUniforms = nullptr, const UniformMap *viewUniforms = nullptr) const;
+    };
+
+    // Storage buffer binding of the object data of the batches, after the light buffers (see LightClusters.hpp)
+    constexpr unsigned int NX_OBJECT_DATA_BINDING = 3;
+
+    /**
+     * @brief Per object data of a batched mesh, read by the mesh shaders at the index given by their draw ID.
+     *
+     * std430 layout, must match resources/shaders/common/object_data.glsl.
+     */
+    struct NxObjectData {
+        glm::mat4 model;
+        glm::vec4 albedoColor;
+        glm::vec4 specularColor;
+        glm::vec4 positionMin;      //< w: roughness
+        glm::vec4 positionExtent;
+        glm::ivec4 info;            //< x: albedo texture index, y: specular texture index (shared by a batch), z: entity id
+    };
+
+    static_assert(sizeof(NxObjectData) == 144);
+
+    /**
+     * @brief Meshes sharing a shader and a vertex array, drawn by a single multi draw indirect call.
+     *
+     * Draw i of the batch reads the object firstObject + i of the list owning the batch, so the per mesh state
+     * (transform, material, entity id) comes from the object buffer instead of uniforms set between draws.
+     * The texture indices are the exception: indexing a sampler array with a value that differs between the draws
+     * of one call is undefined, so the objects of a batch share them and they are set as uniforms.
+     */
+    struct DrawBatch {
+        std::shared_ptr<NxVertexArray> vao;
+        std::shared_ptr<NxShader> shader;
+        NxVertexFormat vertexFormat = NxVertexFormat::STANDARD;
+        uint32_t firstObject = 0;
+        uint32_t filterMask = 0xFFFFFFFF;
+        uint32_t texturePage = 0; //< Page of the frame textures the texture indices refer to
+        int32_t albedoTexIndex = 0; //< Albedo texture of every object of the batch
+        int32_t specularTexIndex = 0; //< Specular texture of every object of the batch
+        std::pmr::vector<NxDrawIndexedIndirectCommand> draws;
+
+        DrawBatch() = default;
+        explicit DrawBatch(std::pmr::memory_resource *resource) : draws(resource) {}
+
+        /**
+         * @brief Binds the batch state, uploads the frame and view uniforms then issues the multi draw call.
+         *
+         * The object buffer of the owning list must be bound, see SharedDrawCommands::bindObjects.
+         */
+        void execute(const UniformMap *frameUniforms = nullptr, const UniformMap *viewUniforms = nullptr) const;
+    };
+
+    /**
+     * @brief Frame-scoped list of draw commands shared by every camera.
+     *
+     * Built once per frame and referenced by each camera's `RenderPipeline` instead of being copied into it, so the
+     * cost of building the commands does not grow with the number of cameras. Only view-independent data goes here;
+     * camera specific uniforms are bound per view by the pipeline (see `RenderPipeline::setViewUniform`).
+     * Both containers allocate from the resource given at construction, the frame arena for the engine's lists.
+     */
+    struct SharedDrawCommands {
+        std::pmr::vector<DrawCommand> commands;
+        std::pmr::vector<DrawBatch> batches;
+        std::pmr::vector<NxObjectData> objects; ///< Objects of every batch of the list
+        UniformMap uniforms; ///< Uniforms applied to every command of the list
+
+        SharedDrawCommands() = default;
+        explicit SharedDrawCommands(std::pmr::memory_resource *resource)
+            : commands(resource), batches(resource), objects(resource), uniforms(resource) {}
+
+        /**
+         * @brief Binds the object buffer of the batches, uploading the objects if another list was bound since.
+         *
+         * Every list shares one buffer, the objects are uploaded once however many cameras draw the batches.
+         */
+        void bindObjects() const;
+
+        private:
+            mutable uint64_t m_objectsUploadId = 0;
     };
 }
@@ -0,0 +1,811 @@
+//// FrameCapture /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the capture and replay of the frames submitted to the render pipelines
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "FrameCapture.hpp"
+#include "Exception.hpp"
+#include "RenderCommand.hpp"
+#include "Renderer3D.hpp"
+#include "RendererExceptions.hpp"
+#include "ShaderLibrary.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <type_traits>
+#include <unordered_map>
+
+namespace nexo::renderer {
+
+    namespace {
+
+        constexpr std::array<char, 4> MAGIC = {'N', 'X', 'F', 'C'};
+
+        // Program drawing the commands whose shader is not known on the replaying side
+        constexpr auto STAND_IN_VERTEX_SOURCE = R"(#version 450 core
+layout(location = 0) in vec3 aPosition;
+void main()
+{
+    gl_Position = vec4(aPosition, 1.0);
+})";
+        constexpr auto STAND_IN_FRAGMENT_SOURCE = R"(#version 450 core
+layout(location = 0) out vec4 FragColor;
+void main()
+{
+    FragColor = vec4(1.0);
+})";
+
+        class Writer {
+            public:
+                template<typename T> requires std::is_trivially_copyable_v<T>
+                void write(const T &value)
+                {
+                    const auto *bytes = reinterpret_cast<const std::byte *>(&value);
+                    m_bytes.insert(m_bytes.end(), bytes, bytes + sizeof(T));
+                }
+
+                void write(const bool value) { write(static_cast<uint8_t>(value)); }
+
+                void write(const std::string &value)
+                {
+                    write(static_cast<uint32_t>(value.size()));
+                    const auto *bytes = reinterpret_cast<const std::byte *>(value.data());
+                    m_bytes.insert(m_bytes.end(), bytes, bytes + value.size());
+                }
+
+                template<typename T> requires std::is_trivially_copyable_v<T>
+                void writeArray(const std::vector<T> &values)
+                {
+                    write(static_cast<uint32_t>(values.size()));
+                    const auto *bytes = reinterpret_cast<const std::byte *>(values.data());
+                    m_bytes.insert(m_bytes.end(), bytes, bytes + values.size() * sizeof(T));
+                }
+
+                void writeCount(const size_t count) { write(static_cast<uint32_t>(count)); }
+
+                std::vector<std::byte> take() { return std::move(m_bytes); }
+
+            private:
+                std::vector<std::byte> m_bytes;
+        };
+
+        class Reader {
+            public:
+                explicit Reader(const std::span<const std::byte> bytes) : m_bytes(bytes) {}
+
+                template<typename T> requires std::is_trivially_copyable_v<T> && (!std::is_same_v<T, bool>)
+                T read()
+                {
+                    require(sizeof(T));
+                    T value;
+                    std::memcpy(&value, m_bytes.data() + m_offset, sizeof(T));
+                    m_offset += sizeof(T);
+                    return value;
+                }
+
+                bool readBool() { return read<uint8_t>() != 0; }
+
+                std::string readString()
+                {
+                    const auto size = read<uint32_t>();
+                    require(size);
+                    std::string value(reinterpret_cast<const char *>(m_bytes.data() + m_offset), size);
+                    m_offset += size;
+                    return value;
+                }
+
+                template<typename T> requires std::is_trivially_copyable_v<T>
+                std::vector<T> readArray()
+                {
+                    const auto count = read<uint32_t>();
+                    require(static_cast<size_t>(count) * sizeof(T));
+                    std::vector<T> values(count);
+                    if (count)
+                        std::memcpy(values.data(), m_bytes.data() + m_offset, count * sizeof(T));
+                    m_offset += count * sizeof(T);
+                    return values;
+                }
+
+                // Every element takes at least a byte, a count past the end of the data can only be garbage
+                uint32_t readCount()
+                {
+                    const auto count = read<uint32_t>();
+                    require(count);
+                    return count;
+                }
+
+                [[nodiscard]] bool atEnd() const { return m_offset == m_bytes.size(); }
+
+            private:
+                void require(const size_t size) const
+                {
+                    if (size > m_bytes.size() - m_offset)
+                        THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Truncated frame capture");
+                }
+
+                std::span<const std::byte> m_bytes;
+                size_t m_offset = 0;
+        };
+
+        void checkIndex(const int32_t index, const size_t size, const char *table)
+        {
+            if (index < -1 || index >= static_cast<int64_t>(size))
+                THROW_EXCEPTION(NxInvalidValue, "RENDERER",
+                                std::format("Frame capture references {} {} out of {}", table, index, size));
+        }
+
+        template<typename Enum>
+        Enum readEnum(Reader &reader, const Enum last)
+        {
+            const auto value = reader.read<uint8_t>();
+            if (value > static_cast<uint8_t>(last))
+                THROW_EXCEPTION(NxInvalidValue, "RENDERER", std::format("Invalid enum value {} in frame capture", value));
+            return static_cast<Enum>(value);
+        }
+
+        void writeUniforms(Writer &writer, const std::vector<NxFrameCapture::Uniform> &uniforms)
+        {
+            writer.writeCount(uniforms.size());
+            for (const auto &[name, value] : uniforms) {
+                writer.write(name);
+                writer.write(static_cast<uint8_t>(value.index()));
+                std::visit([&](const auto &v) { writer.write(v); }, value);
+            }
+        }
+
+        std::vector<NxFrameCapture::Uniform> readUniforms(Reader &reader)
+        {
+            std::vector<NxFrameCapture::Uniform> uniforms(reader.readCount());
+            for (auto &[name, value] : uniforms) {
+                name = reader.readString();
+                switch (reader.read<uint8_t>()) {
+                    case 0: value = reader.read<float>(); break;
+                    case 1: value = reader.read<glm::vec2>(); break;
+                    case 2: value = reader.read<glm::vec3>(); break;
+                    case 3: value = reader.read<glm::vec4>(); break;
+                    case 4: value = reader.read<int>(); break;
+                    case 5: value = reader.readBool(); break;
+                    case 6: value = reader.read<glm::mat4>(); break;
+                    default: THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Invalid uniform type in frame capture");
+                }
+            }
+            return uniforms;
+        }
+
+        void writeRange(Writer &writer, const NxMeshRange &range)
+        {
+            writer.write(range.indexCount);
+            writer.write(range.firstIndex);
+            writer.write(range.baseVertex);
+        }
+
+        NxMeshRange readRange(Reader &reader)
+        {
+            NxMeshRange range;
+            range.indexCount = reader.read<uint32_t>();
+            range.firstIndex = reader.read<uint32_t>();
+            range.baseVertex = reader.read<int32_t>();
+            return range;
+        }
+
+        void writeCommands(Writer &writer, const std::vector<NxFrameCapture::Command> &commands)
+        {
+            writer.writeCount(commands.size());
+            for (const auto &command : commands) {
+                writer.write(static_cast<uint8_t>(command.type));
+                writer.write(command.mesh);
+                writer.write(command.shader);
+                writeRange(writer, command.range);
+                writer.write(command.filterMask);
+                writer.write(command.isOpaque);
+                writer.write(command.texturePage);
+                writeUniforms(writer, command.uniforms);
+                writer.writeArray(command.vertices);
+                writer.writeArray(command.indices);
+            }
+        }
+
+        std::vector<NxFrameCapture::Command> readCommands(Reader &reader)
+        {
+            std::vector<NxFrameCapture::Command> commands(reader.readCount());
+            for (auto &command : commands) {
+                command.type = readEnum(reader, CommandType::STREAMED);
+                command.mesh = reader.read<int32_t>();
+                command.shader = reader.read<int32_t>();
+                command.range = readRange(reader);
+                command.filterMask = reader.read<uint32_t>();
+                command.isOpaque = reader.readBool();
+                command.texturePage = reader.read<uint32_t>();
+                command.uniforms = readUniforms(reader);
+                command.vertices = reader.readArray<NxVertex>();
+                command.indices = reader.readArray<unsigned int>();
+            }
+            return commands;
+        }
+
+        // Builds the capture tables while walking the packet, each resource is recorded once
+        class Recorder {
+            public:
+                explicit Recorder(NxFrameCapture &capture) : m_capture(capture) {}
+
+                int32_t shader(const std::shared_ptr<NxShader> &shader)
+                {
+                    if (!shader)
+                        return -1;
+                    const auto [it, inserted] = m_shaders.try_emplace(shader.get(),
+                                                                      static_cast<int32_t>(m_capture.shaders.size()));
+                    if (inserted)
+                        m_capture.shaders.push_back(shader->getName());
+                    return it->second;
+                }
+
+                int32_t mesh(const std::shared_ptr<NxVertexArray> &vao)
+                {
+                    if (!vao)
+                        return -1;
+                    const auto [it, inserted] = m_meshes.try_emplace(vao->getId(),
+                                                                     static_cast<int32_t>(m_capture.meshes.size()));
+                    if (inserted) {
+                        NxFrameCapture::Mesh &mesh = m_capture.meshes.emplace_back();
+                        mesh.id = vao->getId();
+                        for (const auto &vertexBuffer : vao->getVertexBuffers())
+                            mesh.layouts.push_back(vertexBuffer->getLayout().getElements());
+                        if (const auto &indexBuffer = vao->getIndexBuffer())
+                            mesh.indexCount = static_cast<uint32_t>(indexBuffer->getCount());
+                    }
+                    return it->second;
+                }
+
+                int32_t texture(const std::shared_ptr<NxTexture2D> &texture)
+                {
+                    if (!texture)
+                        return -1;
+                    const auto [it, inserted] = m_textures.try_emplace(texture->getId(),
+                                                                       static_cast<int32_t>(m_capture.textures.size()));
+                    if (inserted)
+                        m_capture.textures.push_back({texture->getId(), texture->getWidth(), texture->getHeight(), {}});
+                    return it->second;
+                }
+
+                int32_t sharedList(const std::shared_ptr<const SharedDrawCommands> &list)
+                {
+                    if (!list)
+                        return -1;
+                    const auto [it, inserted] = m_sharedLists.try_emplace(list.get(),
+                                                                          static_cast<int32_t>(m_capture.sharedLists.size()));
+                    if (!inserted)
+                        return it->second;
+                    NxFrameCapture::SharedList captured;
+                    for (const auto &command : list->commands)
+                        captured.commands.push_back(this->command(command));
+                    for (const auto &batch : list->batches) {
+                        captured.batches.push_back({mesh(batch.vao), shader(batch.shader), batch.vertexFormat,
+                                                    batch.firstObject, batch.filterMask, batch.texturePage,
+                                                    batch.albedoTexIndex, batch.specularTexIndex,
+                                                    {batch.draws.begin(), batch.draws.end()}});
+                    }
+                    captured.objects.assign(list->objects.begin(), list->objects.end());
+                    captured.uniforms = uniforms(list->uniforms);
+                    m_capture.sharedLists.push_back(std::move(captured));
+                    return it->second;
+                }
+
+                NxFrameCapture::Command command(const DrawCommand &command)
+                {
+                    return {command.type, mesh(command.vao), shader(command.shader), command.range,
+                            command.filterMask, command.isOpaque, command.texturePage, uniforms(command.uniforms),
+                            {command.vertices.begin(), command.vertices.end()},
+                            {command.indices.begin(), command.indices.end()}};
+                }
+
+                // Sorted by name, the map order would make two captures of the same frame differ
+                static std::vector<NxFrameCapture::Uniform> uniforms(const UniformMap &map)
+                {
+                    std::vector<NxFrameCapture::Uniform> uniforms;
+                    uniforms.reserve(map.size());
+                    for (const auto &[name, value] : map)
+                        uniforms.push_back({std::string(name), value});
+                    std::ranges::sort(uniforms, {}, &NxFrameCapture::Uniform::name);
+                    return uniforms;
+                }
+
+            private:
+                NxFrameCapture &m_capture;
+                std::unordered_map<const NxShader *, int32_t> m_shaders;
+                std::unordered_map<unsigned int, int32_t> m_meshes;
+                std::unordered_map<unsigned int, int32_t> m_textures;
+                std::unordered_map<const SharedDrawCommands *, int32_t> m_sharedLists;
+        };
+
+        // Stands in for the captured passes the replay does not know how to build
+        class ReplayPass final : public RenderPass {
+            public:
+                ReplayPass(const PassId id, std::string name) : RenderPass(id, std::move(name)) {}
+
+                void execute(RenderPipeline &pipeline) override
+                {
+                    const auto renderTarget = pipeline.getRenderTarget();
+                    renderTarget->bind();
+                    NxRenderCommand::setClearColor(pipeline.getFrame().clearColor);
+                    NxRenderCommand::clear();
+                    NxRenderer3D::bindTextures(pipeline.getFrame().textures);
+                    pipeline.executeDrawCommands(0xFFFFFFFF);
+                    renderTarget->unbind();
+                }
+        };
+
+        void replayUniforms(UniformMap &map, const std::vector<NxFrameCapture::Uniform> &uniforms)
+        {
+            for (const auto &[name, value] : uniforms)
+                DrawCommand::setUniform(map, name, value);
+        }
+
+        NxDrawCommandStats operator-(const NxDrawCommandStats &lhs, const NxDrawCommandStats &rhs)
+        {
+            return {lhs.drawCalls - rhs.drawCalls, lhs.shaderBinds - rhs.shaderBinds,
+                    lhs.vertexArrayBinds - rhs.vertexArrayBinds, lhs.objectUploads - rhs.objectUploads};
+        }
+
+    }
+
+    NxFrameCapture NxFrameCapture::record(const NxRenderPacket &packet)
+    {
+        NxFrameCapture capture;
+        Recorder recorder(capture);
+
+        for (const auto &texture : packet.textures)
+            capture.textureSlots.push_back(recorder.texture(texture));
+
+        for (const auto &[pipeline, frame] : packet.views) {
+            View &view = capture.views.emplace_back();
+            for (const auto &[id, pass] : pipeline->getRenderPasses())
+                view.passes.push_back({id, pass->getName(), pass->getPrerequisites(), pass->getEffects()});
+            std::ranges::sort(view.passes, {}, &Pass::id);
+            view.finalOutputPass = static_cast<int32_t>(pipeline->getFinalOutputPass());
+            if (const auto renderTarget = pipeline->getRenderTarget())
+                view.renderTarget = renderTarget->getSpecs();
+            view.clearColor = frame.clearColor;
+            view.viewUniforms = Recorder::uniforms(frame.viewUniforms);
+            for (const auto &command : frame.drawCommands)
+                view.drawCommands.push_back(recorder.command(command));
+            view.sharedList = recorder.sharedList(frame.sharedDrawCommands);
+            if (const NxLightClusterGrid *grid = frame.lightClusters) {
+                view.pointLights = grid->getPointLights();
+                view.spotLights = grid->getSpotLights();
+                view.clusters = grid->getClusters();
+                view.lightIndices = grid->getLightIndices();
+                view.depthParams = grid->getDepthParams();
+            }
+        }
+        return capture;
+    }
+
+    void NxFrameCapture::annotateMesh(const unsigned int vaoId, const NxMeshRange &range, const std::string &assetId)
+    {
+        const auto it = std::ranges::find(meshes, vaoId, &Mesh::id);
+        if (it == meshes.end())
+            return;
+        meshAssets.push_back({static_cast<uint32_t>(it - meshes.begin()), range, assetId});
+    }
+
+    void NxFrameCapture::annotateTexture(const unsigned int textureId, const std::string &assetId)
+    {
+        if (const auto it = std::ranges::find(textures, textureId, &Texture::id); it != textures.end())
+            it->assetId = assetId;
+    }
+
+    std::vector<std::byte> NxFrameCapture::toBytes() const
+    {
+        Writer writer;
+        writer.write(MAGIC);
+        writer.write(VERSION);
+
+        writer.writeCount(shaders.size());
+        for (const auto &shader : shaders)
+            writer.write(shader);
+
+        writer.writeCount(meshes.size());
+        for (const auto &mesh : meshes) {
+            writer.write(mesh.id);
+            writer.writeCount(mesh.layouts.size());
+            for (const auto &layout : mesh.layouts) {
+                writer.writeCount(layout.size());
+                for (const auto &element : layout) {
+                    writer.write(element.name);
+                    writer.write(static_cast<uint8_t>(element.type));
+                    writer.write(element.normalized);
+                }
+            }
+            writer.write(mesh.indexCount);
+        }
+
+        writer.writeCount(meshAssets.size());
+        for (const auto &asset : meshAssets) {
+            writer.write(asset.mesh);
+            writeRange(writer, asset.range);
+            writer.write(asset.assetId);
+        }
+
+        writer.writeCount(textures.size());
+        for (const auto &texture : textures) {
+            writer.write(texture.id);
+            writer.write(texture.width);
+            writer.write(texture.height);
+            writer.write(texture.assetId);
+        }
+        writer.writeArray(textureSlots);
+
+        writer.writeCount(sharedLists.size());
+        for (const auto &list : sharedLists) {
+            writeCommands(writer, list.commands);
+            writer.writeCount(list.batches.size());
+            for (const auto &batch : list.batches) {
+                writer.write(batch.mesh);
+                writer.write(batch.shader);
+                writer.write(static_cast<uint8_t>(batch.vertexFormat));
+                writer.write(batch.firstObject);
+                writer.write(batch.filterMask);
+                writer.write(batch.texturePage);
+                writer.write(batch.albedoTexIndex);
+                writer.write(batch.specularTexIndex);
+                writer.writeArray(batch.draws);
+            }
+            writer.writeArray(list.objects);
+            writeUniforms(writer, list.uniforms);
+        }
+
+        writer.writeCount(views.size());
+        for (const auto &view : views) {
+            writer.writeCount(view.passes.size());
+            for (const auto &pass : view.passes) {
+                writer.write(pass.id);
+                writer.write(pass.name);
+                writer.writeArray(pass.prerequisites);
+                writer.writeArray(pass.effects);
+            }
+            writer.write(view.finalOutputPass);
+            writer.write(view.renderTarget.width);
+            writer.write(view.renderTarget.height);
+            writer.writeCount(view.renderTarget.attachments.attachments.size());
+            for (const auto &attachment : view.renderTarget.attachments.attachments)
+                writer.write(static_cast<uint8_t>(attachment.textureFormat));
+            writer.write(view.renderTarget.samples);
+            writer.write(view.clearColor);
+            writeUniforms(writer, view.viewUniforms);
+            writeCommands(writer, view.drawCommands);
+            writer.write(view.sharedList);
+            writer.writeArray(view.pointLights);
+            writer.writeArray(view.spotLights);
+            writer.writeArray(view.clusters);
+            writer.writeArray(view.lightIndices);
+            writer.write(view.depthParams);
+        }
+        return writer.take();
+    }
+
+    NxFrameCapture NxFrameCapture::fromBytes(const std::span<const std::byte> bytes)
+    {
+        Reader reader(bytes);
+        if (reader.read<std::array<char, 4>>() != MAGIC)
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Not a frame capture");
+        if (const auto version = reader.read<uint32_t>(); version != VERSION)
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", std::format("Unsupported frame capture version {}", version));
+
+        NxFrameCapture capture;
+        capture.shaders.resize(reader.readCount());
+        for (auto &shader : capture.shaders)
+            shader = reader.readString();
+
+        capture.meshes.resize(reader.readCount());
+        for (auto &mesh : capture.meshes) {
+            mesh.id = reader.read<unsigned int>();
+            mesh.layouts.resize(reader.readCount());
+            for (auto &layout : mesh.layouts) {
+                layout.resize(reader.readCount());
+                for (auto &element : layout) {
+                    const std::string name = reader.readString();
+                    const auto type = readEnum(reader, NxShaderDataType::USHORT4);
+                    element = NxBufferElements(type, name, reader.readBool());
+                }
+            }
+            mesh.indexCount = reader.read<uint32_t>();
+        }
+
+        capture.meshAssets.resize(reader.readCount());
+        for (auto &asset : capture.meshAssets) {
+            asset.mesh = reader.read<uint32_t>();
+            checkIndex(static_cast<int32_t>(asset.mesh), capture.meshes.size(), "mesh");
+            asset.range = readRange(reader);
+            asset.assetId = reader.readString();
+        }
+
+        capture.textures.resize(reader.readCount());
+        for (auto &texture : capture.textures) {
+            texture.id = reader.read<unsigned int>();
+            texture.width = reader.read<unsigned int>();
+            texture.height = reader.read<unsigned int>();
+            texture.assetId = reader.readString();
+        }
+        capture.textureSlots = reader.readArray<int32_t>();
+        for (const int32_t slot : capture.textureSlots)
+            checkIndex(slot, capture.textures.size(), "texture");
+
+        const auto checkCommands = [&](const std::vector<Command> &commands) {
+            for (const auto &command : commands) {
+                checkIndex(command.mesh, capture.meshes.size(), "mesh");
+                checkIndex(command.shader, capture.shaders.size(), "shader");
+                if (std::ranges::any_of(command.indices, [&](const unsigned int index) {
+                        return index >= command.vertices.size();
+                    }))
+                    THROW_EXCEPTION(NxInvalidValue, "RENDERER",
+                                    std::format("Frame capture streams indices out of {} vertices",
+                                                command.vertices.size()));
+            }
+        };
+
+        capture.sharedLists.resize(reader.readCount());
+        for (auto &list : capture.sharedLists) {
+            list.commands = readCommands(reader);
+            checkCommands(list.commands);
+            list.batches.resize(reader.readCount());
+            for (auto &batch : list.batches) {
+                batch.mesh = reader.read<int32_t>();
+                checkIndex(batch.mesh, capture.meshes.size(), "mesh");
+                batch.shader = reader.read<int32_t>();
+                checkIndex(batch.shader, capture.shaders.size(), "shader");
+                batch.vertexFormat = readEnum(reader, NxVertexFormat::COMPACT_QUANTIZED);
+                batch.firstObject = reader.read<uint32_t>();
+                batch.filterMask = reader.read<uint32_t>();
+                batch.texturePage = reader.read<uint32_t>();
+                batch.albedoTexIndex = reader.read<int32_t>();
+                batch.specularTexIndex = reader.read<int32_t>();
+                batch.draws = reader.readArray<NxDrawIndexedIndirectCommand>();
+            }
+            list.objects = reader.readArray<NxObjectData>();
+            list.uniforms = readUniforms(reader);
+        }
+
+        capture.views.resize(reader.readCount());
+        for (auto &view : capture.views) {
+            view.passes.resize(reader.readCount());
+            for (auto &pass : view.passes) {
+                pass.id = reader.read<PassId>();
+                pass.name = reader.readString();
+                pass.prerequisites = reader.readArray<PassId>();
+                pass.effects = reader.readArray<PassId>();
+            }
+            view.finalOutputPass = reader.read<int32_t>();
+            view.renderTarget.width = reader.read<unsigned int>();
+            view.renderTarget.height = reader.read<unsigned int>();
+            view.renderTarget.attachments.attachments.resize(reader.readCount());
+            for (auto &attachment : view.renderTarget.attachments.attachments) {
+                attachment.textureFormat = readEnum(reader, NxFrameBufferTextureFormats::DEPTH24STENCIL8);
+            }
+            view.renderTarget.samples = reader.read<unsigned int>();
+            view.clearColor = reader.read<glm::vec4>();
+            view.viewUniforms = readUniforms(reader);
+            view.drawCommands = readCommands(reader);
+            checkCommands(view.drawCommands);
+            view.sharedList = reader.read<int32_t>();
+            checkIndex(view.sharedList, capture.sharedLists.size(), "shared list");
+            view.pointLights = reader.readArray<NxPointLightData>();
+            view.spotLights = reader.readArray<NxSpotLightData>();
+            view.clusters = reader.readArray<NxLightCluster>();
+            view.lightIndices = reader.readArray<uint32_t>();
+            view.depthParams = reader.read<glm::vec2>();
+        }
+
+        if (!reader.atEnd())
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Trailing data after frame capture");
+        return capture;
+    }
+
+    void NxFrameCapture::save(const std::filesystem::path &path) const
+    {
+        const std::vector<std::byte> bytes = toBytes();
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", std::format("Could not write frame capture {}", path.string()));
+    }
+
+    NxFrameCapture NxFrameCapture::load(const std::filesystem::path &path)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+        if (!file)
+            THROW_EXCEPTION(NxFileNotFoundException, path.string());
+        std::vector<std::byte> bytes(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char *>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", std::format("Could not read frame capture {}", path.string()));
+        return fromBytes(bytes);
+    }
+
+    NxFrameReplay::NxFrameReplay(NxFrameCapture capture, const PassFactory &passFactory,
+                                 const ShaderResolver &shaderResolver)
+        : m_capture(std::move(capture))
+    {
+        for (const auto &name : m_capture.shaders) {
+            auto shader = shaderResolver ? shaderResolver(name) : ShaderLibrary::getInstance().get(name);
+            if (!shader)
+                shader = NxShader::create(name, STAND_IN_VERTEX_SOURCE, STAND_IN_FRAGMENT_SOURCE);
+            m_shaders.push_back(std::move(shader));
+        }
+
+        // The stand-in indices are all zero, a draw only fetches the vertex at its base vertex
+        std::vector<int64_t> vertexCounts(m_capture.meshes.size(), 1);
+        const auto reserveVertex = [&](const int32_t mesh, const int32_t baseVertex) {
+            if (mesh >= 0)
+                vertexCounts[mesh] = std::max<int64_t>(vertexCounts[mesh], static_cast<int64_t>(baseVertex) + 1);
+        };
+        const auto reserveCommands = [&](const std::vector<NxFrameCapture::Command> &commands) {
+            for (const auto &command : commands)
+                reserveVertex(command.mesh, command.range.baseVertex);
+        };
+        for (const auto &list : m_capture.sharedLists) {
+            reserveCommands(list.commands);
+            for (const auto &batch : list.batches) {
+                for (const auto &draw : batch.draws)
+                    reserveVertex(batch.mesh, draw.baseVertex);
+            }
+        }
+        for (const auto &view : m_capture.views)
+            reserveCommands(view.drawCommands);
+
+        for (size_t i = 0; i < m_capture.meshes.size(); ++i) {
+            const auto &mesh = m_capture.meshes[i];
+            auto vao = createVertexArray();
+            for (const auto &elements : mesh.layouts) {
+                if (elements.empty())
+                    continue;
+                NxBufferLayout layout(elements);
+                const auto size = static_cast<unsigned int>(layout.getStride() * vertexCounts[i]);
+                std::vector<std::byte> zeros(size);
+                auto vertexBuffer = createVertexBuffer(size);
+                vertexBuffer->setData(zeros.data(), zeros.size());
+                vertexBuffer->setLayout(layout);
+                vao->addVertexBuffer(vertexBuffer);
+            }
+            if (mesh.indexCount) {
+                std::vector<unsigned int> zeros(mesh.indexCount);
+                auto indexBuffer = createIndexBuffer();
+                indexBuffer->setData(zeros.data(), zeros.size());
+                vao->setIndexBuffer(indexBuffer);
+            }
+            m_meshes.push_back(std::move(vao));
+        }
+
+        std::vector<std::shared_ptr<NxTexture2D>> textures;
+        for (const auto &texture : m_capture.textures)
+            textures.push_back(NxTexture2D::create(std::max(texture.width, 1u), std::max(texture.height, 1u)));
+        for (const int32_t slot : m_capture.textureSlots)
+            m_textureSlots.push_back(slot >= 0 ? textures[slot] : NxTexture2D::create(1, 1));
+
+        const auto toDrawCommand = [&](const NxFrameCapture::Command &captured) {
+            DrawCommand command;
+            command.type = captured.type;
+            command.vao = captured.mesh >= 0 ? m_meshes[captured.mesh] : nullptr;
+            command.shader = captured.shader >= 0 ? m_shaders[captured.shader] : nullptr;
+            command.range = captured.range;
+            command.filterMask = captured.filterMask;
+            command.isOpaque = captured.isOpaque;
+            command.texturePage = captured.texturePage;
+            replayUniforms(command.uniforms, captured.uniforms);
+            command.vertices.assign(captured.vertices.begin(), captured.vertices.end());
+            command.indices.assign(captured.indices.begin(), captured.indices.end());
+            return command;
+        };
+
+        for (const auto &captured : m_capture.sharedLists) {
+            auto list = std::make_shared<SharedDrawCommands>();
+            for (const auto &command : captured.commands)
+                list->commands.push_back(toDrawCommand(command));
+            for (const auto &capturedBatch : captured.batches) {
+                DrawBatch &batch = list->batches.emplace_back();
+                batch.vao = capturedBatch.mesh >= 0 ? m_meshes[capturedBatch.mesh] : nullptr;
+                batch.shader = capturedBatch.shader >= 0 ? m_shaders[capturedBatch.shader] : nullptr;
+                batch.vertexFormat = capturedBatch.vertexFormat;
+                batch.firstObject = capturedBatch.firstObject;
+                batch.filterMask = capturedBatch.filterMask;
+                batch.texturePage = capturedBatch.texturePage;
+                batch.albedoTexIndex = capturedBatch.albedoTexIndex;
+                batch.specularTexIndex = capturedBatch.specularTexIndex;
+                batch.draws.assign(capturedBatch.draws.begin(), capturedBatch.draws.end());
+            }
+            list->objects.assign(captured.objects.begin(), captured.objects.end());
+            replayUniforms(list->uniforms, captured.uniforms);
+            m_sharedLists.push_back(std::move(list));
+        }
+
+        for (const auto &view : m_capture.views) {
+            auto &pipeline = m_pipelines.emplace_back(std::make_unique<RenderPipeline>());
+            for (const auto &pass : view.passes) {
+                auto renderPass = passFactory ? passFactory(pass) : nullptr;
+                if (!renderPass)
+                    renderPass = std::make_shared<ReplayPass>(pass.id, pass.name);
+                pipeline->addRenderPass(std::move(renderPass));
+            }
+            for (const auto &pass : view.passes) {
+                for (const PassId prerequisite : pass.prerequisites)
+                    pipeline->addPrerequisite(pass.id, prerequisite);
+                for (const PassId effect : pass.effects)
+                    pipeline->addEffect(pass.id, effect);
+            }
+            if (view.finalOutputPass >= 0)
+                pipeline->setFinalOutputPass(static_cast<PassId>(view.finalOutputPass));
+
+            NxFramebufferSpecs specs = view.renderTarget;
+            specs.width = std::max(specs.width, 1u);
+            specs.height = std::max(specs.height, 1u);
+            if (specs.attachments.attachments.empty())
+                specs.attachments = {NxFrameBufferTextureFormats::RGBA8};
+            specs.swapChainTarget = false;
+            pipeline->setRenderTarget(NxFramebuffer::create(specs));
+
+            auto &lightClusters = m_lightClusters.emplace_back(std::make_unique<NxLightClusterGrid>());
+            NxPipelineFrame &frame = m_frames.emplace_back();
+            for (const auto &command : view.drawCommands)
+                frame.drawCommands.push_back(toDrawCommand(command));
+            frame.sharedDrawCommands = view.sharedList >= 0 ? m_sharedLists[view.sharedList] : nullptr;
+            replayUniforms(frame.viewUniforms, view.viewUniforms);
+            frame.clearColor = view.clearColor;
+            frame.lightClusters = lightClusters.get();
+            frame.textures = m_textureSlots;
+        }
+    }
+
+    void NxFrameReplay::restoreLights()
+    {
+        for (size_t i = 0; i < m_capture.views.size(); ++i) {
+            const auto &view = m_capture.views[i];
+            m_lightClusters[i]->restore(view.pointLights, view.spotLights, view.clusters, view.lightIndices,
+                                        view.depthParams);
+        }
+    }
+
+    NxFrameReplayStats::Clock::duration NxFrameReplay::execute()
+    {
+        // The engine rebuilds the clusters every frame, they are uploaded again like they would be
+        restoreLights();
+
+        const auto start = NxFrameReplayStats::Clock::now();
+        for (size_t i = 0; i < m_pipelines.size(); ++i)
+            m_pipelines[i]->execute(m_frames[i]);
+        NxRenderer3D::unbindTextures(m_textureSlots);
+        return NxFrameReplayStats::Clock::now() - start;
+    }
+
+    NxFrameReplayStats NxFrameReplay::run(const unsigned int iterations, const std::function<void()> &endFrame)
+    {
+        NxFrameReplayStats stats;
+        const NxDrawCommandStats drawStatsBefore = getDrawCommandStats();
+        for (unsigned int i = 0; i < iterations; ++i) {
+            const auto time = execute();
+            if (endFrame)
+                endFrame();
+            stats.minTime = stats.iterations ? std::min(stats.minTime, time) : time;
+            stats.maxTime = std::max(stats.maxTime, time);
+            stats.totalTime += time;
+            ++stats.iterations;
+        }
+        stats.drawStats = getDrawCommandStats() - drawStatsBefore;
+        return stats;
+    }
+
+}
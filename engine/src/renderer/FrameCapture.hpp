@@ -0,0 +1,247 @@
+//// FrameCapture /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the capture and replay of the frames submitted to the render pipelines
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "Buffer.hpp"
+#include "DrawCommand.hpp"
+#include "Framebuffer.hpp"
+#include "LightClusters.hpp"
+#include "RenderThread.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @brief Everything a render packet submitted to the render pipelines, in a form that can be saved and replayed.
+     *
+     * GPU resources are recorded by shape only: vertex arrays keep their layouts and index counts, textures their
+     * size, shaders their name. Draw commands and batches reference them by index in the capture tables, so a frame
+     * can be replayed without the scene or its assets (see `NxFrameReplay`). The asset the meshes and textures were
+     * imported from can be attached to them, to find out which asset a slow frame comes from.
+     *
+     * The binary format is written in host byte order and starts with a magic and a version, `fromBytes` rejects
+     * anything it cannot read back.
+     */
+    struct NxFrameCapture {
+        static constexpr uint32_t VERSION = 4;
+
+        struct Uniform {
+            std::string name;
+            UniformValue value;
+        };
+
+        struct Mesh {
+            unsigned int id = 0;                                    //< Renderer id of the captured vertex array
+            std::vector<std::vector<NxBufferElements>> layouts;     //< Layout of each vertex buffer
+            uint32_t indexCount = 0;
+        };
+
+        // Range of a captured vertex array holding an asset's mesh, vertex arrays of the mesh pool hold many
+        struct MeshAsset {
+            uint32_t mesh = 0;
+            NxMeshRange range;
+            std::string assetId;
+        };
+
+        struct Texture {
+            unsigned int id = 0;    //< Renderer id of the captured texture
+            unsigned int width = 0;
+            unsigned int height = 0;
+            std::string assetId;
+        };
+
+        struct Command {
+            CommandType type = CommandType::MESH;
+            int32_t mesh = -1;      //< Index in meshes, -1 when the command has no vertex array
+            int32_t shader = -1;    //< Index in shaders, -1 when the command has no shader
+            NxMeshRange range;
+            uint32_t filterMask = 0xFFFFFFFF;
+            bool isOpaque = true;
+            uint32_t texturePage = 0;
+            std::vector<Uniform> uniforms;
+            std::vector<NxVertex> vertices;     //< Geometry of STREAMED commands
+            std::vector<unsigned int> indices;
+        };
+
+        struct Batch {
+            int32_t mesh = -1;
+            int32_t shader = -1;
+            NxVertexFormat vertexFormat = NxVertexFormat::STANDARD;
+            uint32_t firstObject = 0;
+            uint32_t filterMask = 0xFFFFFFFF;
+            uint32_t texturePage = 0;
+            int32_t albedoTexIndex = 0;
+            int32_t specularTexIndex = 0;
+            std::vector<NxDrawIndexedIndirectCommand> draws;
+        };
+
+        // Draw commands shared by the views, recorded once however many views reference them
+        struct SharedList {
+            std::vector<Command> commands;
+            std::vector<Batch> batches;
+            std::vector<NxObjectData> objects;
+            std::vector<Uniform> uniforms;
+        };
+
+        struct Pass {
+            PassId id = 0;
+            std::string name;
+            std::vector<PassId> prerequisites;
+            std::vector<PassId> effects;
+        };
+
+        struct View {
+            std::vector<Pass> passes;
+            int32_t finalOutputPass = -1;
+            NxFramebufferSpecs renderTarget;
+            glm::vec4 clearColor{0.0f};
+            std::vector<Uniform> viewUniforms;
+            std::vector<Command> drawCommands;
+            int32_t sharedList = -1;    //< Index in sharedLists, -1 when the view has none
+
+            std::vector<NxPointLightData> pointLights;
+            std::vector<NxSpotLightData> spotLights;
+            std::vector<NxLightCluster> clusters;
+            std::vector<uint32_t> lightIndices;
+            glm::vec2 depthParams{0.0f};
+        };
+
+        std::vector<std::string> shaders;
+        std::vector<Mesh> meshes;
+        std::vector<MeshAsset> meshAssets;
+        std::vector<Texture> textures;
+        std::vector<int32_t> textureSlots;  //< Index in textures of each slot, -1 for an empty slot
+        std::vector<SharedList> sharedLists;
+        std::vector<View> views;
+
+        /**
+         * @brief Records the views of a packet, must be called before the packet is executed.
+         *
+         * The pipelines the views reference must still hold the pass graph and render target the frame was built
+         * with, which is the case until the packet is submitted.
+         */
+        [[nodiscard]] static NxFrameCapture record(const NxRenderPacket &packet);
+
+        /**
+         * @brief Attaches an asset to a range of a captured vertex array, ignored if the frame never drew it.
+         */
+        void annotateMesh(unsigned int vaoId, const NxMeshRange &range, const std::string &assetId);
+
+        /**
+         * @brief Attaches an asset to a captured texture, ignored if the frame never bound it.
+         */
+        void annotateTexture(unsigned int textureId, const std::string &assetId);
+
+        [[nodiscard]] std::vector<std::byte> toBytes() const;
+
+        /**
+         * @brief Reads back a capture written by `toBytes`.
+         *
+         * @throws NxInvalidValue If the data is not a capture of this version, or is truncated or inconsistent.
+         */
+        [[nodiscard]] static NxFrameCapture fromBytes(std::span<const std::byte> bytes);
+
+        void save(const std::filesystem::path &path) const;
+
+        /**
+         * @throws NxFileNotFoundException If the file cannot be opened.
+         * @throws NxInvalidValue If the file is not a valid capture.
+         */
+        [[nodiscard]] static NxFrameCapture load(const std::filesystem::path &path);
+    };
+
+    /**
+     * @brief Time spent submitting the replayed frames, measured on the CPU.
+     */
+    struct NxFrameReplayStats {
+        using Clock = std::chrono::steady_clock;
+
+        unsigned int iterations = 0;
+        Clock::duration totalTime{};
+        Clock::duration minTime{};
+        Clock::duration maxTime{};
+        NxDrawCommandStats drawStats;   //< Summed over every iteration
+    };
+
+    /**
+     * @class NxFrameReplay
+     * @brief Rebuilds a captured frame on the current backend and submits it again, as many times as asked.
+     *
+     * The vertex arrays and textures are stand-ins shaped like the captured ones (same layouts, index counts and
+     * sizes) but filled with zeros: the CPU cost of the submission and the calls reaching the backend are the same
+     * as in the captured frame, what ends up on screen is not. Shaders are looked up by name.
+     *
+     * Passes are rebuilt by a factory from their captured name and id. Passes the factory does not know, or every
+     * pass without a factory, are replaced by a generic pass clearing the render target and drawing every command.
+     */
+    class NxFrameReplay {
+        public:
+            using PassFactory = std::function<std::shared_ptr<RenderPass>(const NxFrameCapture::Pass &pass)>;
+            // Returns null when the shader is unknown, a stand-in program is then created
+            using ShaderResolver = std::function<std::shared_ptr<NxShader>(const std::string &name)>;
+
+            /**
+             * @param capture Frame to replay, copied into the replay.
+             * @param passFactory Builds the captured passes, may be null.
+             * @param shaderResolver Finds the captured shaders, the shader library when null.
+             */
+            explicit NxFrameReplay(NxFrameCapture capture, const PassFactory &passFactory = nullptr,
+                                   const ShaderResolver &shaderResolver = nullptr);
+
+            /**
+             * @brief Submits the captured frame once.
+             *
+             * @return The time the submission took on the CPU.
+             */
+            NxFrameReplayStats::Clock::duration execute();
+
+            /**
+             * @brief Submits the captured frame the given number of times.
+             *
+             * @param iterations Number of submissions.
+             * @param endFrame Called after each submission, outside of the measured time (e.g. to swap buffers).
+             */
+            NxFrameReplayStats run(unsigned int iterations, const std::function<void()> &endFrame = nullptr);
+
+            [[nodiscard]] const NxFrameCapture &getCapture() const { return m_capture; }
+
+        private:
+            void restoreLights();
+
+            NxFrameCapture m_capture;
+            std::vector<std::shared_ptr<NxShader>> m_shaders;
+            std::vector<std::shared_ptr<NxVertexArray>> m_meshes;
+            std::vector<std::shared_ptr<NxTexture2D>> m_textureSlots;
+            std::vector<std::shared_ptr<const SharedDrawCommands>> m_sharedLists;
+            std::vector<std::unique_ptr<RenderPipeline>> m_pipelines;
+            std::vector<std::unique_ptr<NxLightClusterGrid>> m_lightClusters;
+            std::vector<NxPipelineFrame> m_frames;
+    };
+
+}
@@ -17,6 +17,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Framebuffer.hpp"
 #include "renderer/RendererExceptions.hpp"
+#include "GraphicsApi.hpp"
+#include "headless/HeadlessFramebuffer.hpp"
 #ifdef NX_GRAPHICS_API_OPENGL
     #include "opengl/OpenGlFramebuffer.hpp"
 #endif
@@ -25,6 +27,8 @@ namespace nexo::renderer {
 
     std::shared_ptr<NxFramebuffer> NxFramebuffer::create(const NxFramebufferSpecs &specs)
     {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return std::make_shared<NxHeadlessFramebuffer>(specs);
         #ifdef NX_GRAPHICS_API_OPENGL
             return std::make_shared<NxOpenGlFramebuffer>(specs);
         #else
@@ -17,6 +17,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <vector>
 #include <glm/glm.hpp>
@@ -118,6 +119,23 @@ namespace nexo::renderer {
         bool swapChainTarget = false;
     };
 
+    /**
+     * @brief Integer pixels of an attachment region, read back asynchronously.
+     *
+     * Pixels are stored row by row starting from the bottom left corner of the region, like OpenGL reads them.
+     */
+    struct NxPixelReadback {
+        int x = 0;
+        int y = 0;
+        unsigned int width = 0;
+        unsigned int height = 0;
+        std::vector<int> pixels;
+
+        [[nodiscard]] int at(const unsigned int px, const unsigned int py) const { return pixels[py * width + px]; }
+    };
+
+    using NxPixelReadCallback = std::function<void(const NxPixelReadback &)>;
+
     /**
      * @class NxFramebuffer
      * @brief Abstract class representing a framebuffer in the rendering pipeline.
@@ -227,6 +245,48 @@ namespace nexo::renderer {
                  return result;
             }
 
+            /**
+             * @brief Queues the read of an integer attachment region without waiting for the GPU.
+             *
+             * `getPixel` stalls until the GPU has finished every queued command. Here the copy is queued behind the
+             * frame instead and `callback` runs from `pollPixelReads` once the pixels reached the CPU, usually one or
+             * two frames later. The region is clipped to the framebuffer.
+             *
+             * @param attachmentIndex The index of an integer color attachment.
+             * @param x X-coordinate of the bottom left corner of the region.
+             * @param y Y-coordinate of the bottom left corner of the region.
+             * @param width Width of the region in pixels.
+             * @param height Height of the region in pixels.
+             * @param callback Receives the pixels of the region.
+             *
+             * Throws:
+             * - NxFramebufferInvalidIndex if the attachment does not exist.
+             * - NxFramebufferUnsupportedColorFormat if the attachment does not store integers.
+             */
+            virtual void readPixelsAsync(unsigned int attachmentIndex, int x, int y, unsigned int width,
+                                         unsigned int height, NxPixelReadCallback callback) = 0;
+
+            /**
+             * @brief Single pixel version of readPixelsAsync, reporting -1 for a pixel outside of the framebuffer.
+             */
+            void readPixelAsync(const unsigned int attachmentIndex, const int x, const int y,
+                                std::function<void(int)> callback)
+            {
+                readPixelsAsync(attachmentIndex, x, y, 1, 1,
+                                [callback = std::move(callback)](const NxPixelReadback &readback) {
+                                    callback(readback.pixels.empty() ? -1 : readback.pixels.front());
+                                });
+            }
+
+            /**
+             * @brief Runs the callbacks of the asynchronous reads whose pixels are available, in submission order.
+             *
+             * @param wait Blocks until every queued read is available.
+             */
+            virtual void pollPixelReads(bool wait = false) = 0;
+
+            [[nodiscard]] virtual size_t getPendingPixelReads() const = 0;
+
             virtual void clearAttachmentWrapper(unsigned int attachmentIndex, const void *value, const std::type_info &ti) const = 0;
 
 
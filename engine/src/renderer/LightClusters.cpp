@@ -0,0 +1,282 @@
+//// LightClusters.cpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the clustered light assignment
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "LightClusters.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace nexo::renderer {
+
+    static constexpr unsigned int CLUSTERS_PER_SLICE = NX_CLUSTER_TILES_X * NX_CLUSTER_TILES_Y;
+    static constexpr float MIN_NEAR_PLANE = 0.001f;
+
+    static int sliceFromDepth(const float depth, const glm::vec2 &depthParams)
+    {
+        const int slice = static_cast<int>(std::floor(std::log(depth) * depthParams.x + depthParams.y));
+        return std::clamp(slice, 0, static_cast<int>(NX_CLUSTER_SLICES) - 1);
+    }
+
+    void NxLightClusterGrid::computeClusterBounds(const glm::mat4 &projection, float nearPlane, const float farPlane)
+    {
+        nearPlane = std::max(nearPlane, MIN_NEAR_PLANE);
+        m_projection = projection;
+        m_nearPlane = nearPlane;
+        m_farPlane = farPlane;
+        m_inverseProjection = glm::inverse(projection);
+        const float logRatio = std::log(farPlane / nearPlane);
+        m_depthParams = {
+            static_cast<float>(NX_CLUSTER_SLICES) / logRatio,
+            -static_cast<float>(NX_CLUSTER_SLICES) * std::log(nearPlane) / logRatio
+        };
+
+        // Line of sight through every tile corner, as its points on the near and far planes
+        constexpr unsigned int cornersX = NX_CLUSTER_TILES_X + 1;
+        constexpr unsigned int cornersY = NX_CLUSTER_TILES_Y + 1;
+        std::vector<glm::vec3> nearPoints(cornersX * cornersY);
+        std::vector<glm::vec3> farPoints(cornersX * cornersY);
+        const auto unproject = [this](const float x, const float y, const float z) {
+            const glm::vec4 point = m_inverseProjection * glm::vec4(x, y, z, 1.0f);
+            return glm::vec3(point) / point.w;
+        };
+        for (unsigned int y = 0; y < cornersY; ++y) {
+            for (unsigned int x = 0; x < cornersX; ++x) {
+                const float ndcX = -1.0f + 2.0f * static_cast<float>(x) / NX_CLUSTER_TILES_X;
+                const float ndcY = -1.0f + 2.0f * static_cast<float>(y) / NX_CLUSTER_TILES_Y;
+                nearPoints[y * cornersX + x] = unproject(ndcX, ndcY, -1.0f);
+                farPoints[y * cornersX + x] = unproject(ndcX, ndcY, 1.0f);
+            }
+        }
+        const auto pointAtDepth = [&](const unsigned int corner, const float depth) {
+            const glm::vec3 &a = nearPoints[corner];
+            const glm::vec3 &b = farPoints[corner];
+            const float t = b.z != a.z ? (-depth - a.z) / (b.z - a.z) : 0.0f;
+            return a + t * (b - a);
+        };
+
+        for (auto *bounds : {&m_minX, &m_minY, &m_minZ, &m_maxX, &m_maxY, &m_maxZ,
+                             &m_centerX, &m_centerY, &m_centerZ, &m_radius})
+            bounds->resize(NX_CLUSTER_COUNT);
+
+        for (unsigned int slice = 0; slice < NX_CLUSTER_SLICES; ++slice) {
+            const float sliceNear = nearPlane * std::pow(farPlane / nearPlane, static_cast<float>(slice) / NX_CLUSTER_SLICES);
+            const float sliceFar = nearPlane * std::pow(farPlane / nearPlane, static_cast<float>(slice + 1) / NX_CLUSTER_SLICES);
+            for (unsigned int y = 0; y < NX_CLUSTER_TILES_Y; ++y) {
+                for (unsigned int x = 0; x < NX_CLUSTER_TILES_X; ++x) {
+                    glm::vec3 minBound(std::numeric_limits<float>::max());
+                    glm::vec3 maxBound(std::numeric_limits<float>::lowest());
+                    for (const unsigned int corner : {y * cornersX + x, y * cornersX + x + 1,
+                                                      (y + 1) * cornersX + x, (y + 1) * cornersX + x + 1}) {
+                        for (const float depth : {sliceNear, sliceFar}) {
+                            const glm::vec3 point = pointAtDepth(corner, depth);
+                            minBound = glm::min(minBound, point);
+                            maxBound = glm::max(maxBound, point);
+                        }
+                    }
+                    const unsigned int index = slice * CLUSTERS_PER_SLICE + y * NX_CLUSTER_TILES_X + x;
+                    const glm::vec3 center = (minBound + maxBound) * 0.5f;
+                    m_minX[index] = minBound.x;
+                    m_minY[index] = minBound.y;
+                    m_minZ[index] = minBound.z;
+                    m_maxX[index] = maxBound.x;
+                    m_maxY[index] = maxBound.y;
+                    m_maxZ[index] = maxBound.z;
+                    m_centerX[index] = center.x;
+                    m_centerY[index] = center.y;
+                    m_centerZ[index] = center.z;
+                    m_radius[index] = glm::length(maxBound - center);
+                }
+            }
+        }
+    }
+
+    void NxLightClusterGrid::binLight(const glm::vec3 &center, const float radius, const uint32_t light,
+                                      const bool isSpot, const glm::vec3 &direction, const float cosAngle,
+                                      const float sinAngle)
+    {
+        const float depth = -center.z;
+        if (depth + radius < m_nearPlane || depth - radius > m_farPlane)
+            return;
+        // The clusters of a slice are contiguous, so the slices the light range spans form a single range
+        const auto firstSlice = static_cast<unsigned int>(sliceFromDepth(std::max(depth - radius, m_nearPlane), m_depthParams));
+        const auto lastSlice = static_cast<unsigned int>(sliceFromDepth(std::min(depth + radius, m_farPlane), m_depthParams));
+        const unsigned int begin = firstSlice * CLUSTERS_PER_SLICE;
+        const unsigned int end = (lastSlice + 1) * CLUSTERS_PER_SLICE;
+        m_hitMask.resize(end - begin);
+
+        // Sphere vs AABB, branchless over arrays of bounds so the compiler can vectorize it
+        const float radiusSq = radius * radius;
+        for (unsigned int i = begin; i < end; ++i) {
+            const float dx = std::max(std::max(m_minX[i] - center.x, 0.0f), center.x - m_maxX[i]);
+            const float dy = std::max(std::max(m_minY[i] - center.y, 0.0f), center.y - m_maxY[i]);
+            const float dz = std::max(std::max(m_minZ[i] - center.z, 0.0f), center.z - m_maxZ[i]);
+            m_hitMask[i - begin] = dx * dx + dy * dy + dz * dz <= radiusSq;
+        }
+
+        // Cone vs bounding sphere of the cluster, skipped for cones wider than a half space
+        if (isSpot && cosAngle > 0.0f) {
+            for (unsigned int i = begin; i < end; ++i) {
+                const float vx = m_centerX[i] - center.x;
+                const float vy = m_centerY[i] - center.y;
+                const float vz = m_centerZ[i] - center.z;
+                const float lengthSq = vx * vx + vy * vy + vz * vz;
+                const float alongAxis = vx * direction.x + vy * direction.y + vz * direction.z;
+                const float closest = cosAngle * std::sqrt(std::max(lengthSq - alongAxis * alongAxis, 0.0f))
+                                      - alongAxis * sinAngle;
+                const bool inCone = closest <= m_radius[i] && alongAxis >= -m_radius[i];
+                m_hitMask[i - begin] = m_hitMask[i - begin] && inCone;
+            }
+        }
+
+        for (unsigned int i = begin; i < end; ++i)
+            if (m_hitMask[i - begin])
+                m_hits.push_back({i, light, isSpot});
+    }
+
+    void NxLightClusterGrid::build(const glm::mat4 &view, const glm::mat4 &projection, const float nearPlane,
+                                   const float farPlane, const std::span<const NxPointLightData> pointLights,
+                                   const std::span<const NxSpotLightData> spotLights)
+    {
+        if (projection != m_projection || std::max(nearPlane, MIN_NEAR_PLANE) != m_nearPlane || farPlane != m_farPlane)
+            computeClusterBounds(projection, nearPlane, farPlane);
+
+        m_hits.clear();
+        m_pointLights.clear();
+        m_spotLights.clear();
+
+        for (const auto &light : pointLights) {
+            const size_t hits = m_hits.size();
+            const glm::vec3 center = glm::vec3(view * glm::vec4(glm::vec3(light.position), 1.0f));
+            binLight(center, light.position.w, static_cast<uint32_t>(m_pointLights.size()), false);
+            if (m_hits.size() != hits)
+                m_pointLights.push_back(light);
+        }
+        for (const auto &light : spotLights) {
+            const size_t hits = m_hits.size();
+            const glm::vec3 center = glm::vec3(view * glm::vec4(glm::vec3(light.position), 1.0f));
+            const glm::vec3 direction = glm::normalize(glm::mat3(view) * glm::vec3(light.direction));
+            const float cosAngle = std::clamp(light.attenuation.w, -1.0f, 1.0f);
+            binLight(center, light.position.w, static_cast<uint32_t>(m_spotLights.size()), true,
+                     direction, cosAngle, std::sqrt(1.0f - cosAngle * cosAngle));
+            if (m_hits.size() != hits)
+                m_spotLights.push_back(light);
+        }
+
+        // Counting sort of the hits by cluster, point lights first within each cluster
+        m_clusters.assign(NX_CLUSTER_COUNT, {});
+        for (const auto &hit : m_hits) {
+            if (hit.isSpot)
+                ++m_clusters[hit.cluster].spotCount;
+            else
+                ++m_clusters[hit.cluster].pointCount;
+        }
+        m_pointCursors.resize(NX_CLUSTER_COUNT);
+        m_spotCursors.resize(NX_CLUSTER_COUNT);
+        uint32_t offset = 0;
+        for (unsigned int i = 0; i < NX_CLUSTER_COUNT; ++i) {
+            auto &cluster = m_clusters[i];
+            cluster.offset = offset;
+            m_pointCursors[i] = offset;
+            m_spotCursors[i] = offset + cluster.pointCount;
+            offset += cluster.pointCount + cluster.spotCount;
+        }
+        m_lightIndices.resize(offset);
+        for (const auto &hit : m_hits) {
+            auto &cursor = hit.isSpot ? m_spotCursors[hit.cluster] : m_pointCursors[hit.cluster];
+            m_lightIndices[cursor++] = hit.light;
+        }
+        m_dirty = true;
+    }
+
+    int NxLightClusterGrid::getClusterIndex(const glm::vec3 &viewPosition) const
+    {
+        const float depth = -viewPosition.z;
+        if (m_clusters.empty() || depth < m_nearPlane || depth > m_farPlane)
+            return -1;
+        const glm::vec4 clip = m_projection * glm::vec4(viewPosition, 1.0f);
+        const glm::vec2 ndc = glm::vec2(clip) / clip.w;
+        if (ndc.x < -1.0f || ndc.x > 1.0f || ndc.y < -1.0f || ndc.y > 1.0f)
+            return -1;
+        const auto tileX = std::min(static_cast<unsigned int>((ndc.x * 0.5f + 0.5f) * NX_CLUSTER_TILES_X), NX_CLUSTER_TILES_X - 1);
+        const auto tileY = std::min(static_cast<unsigned int>((ndc.y * 0.5f + 0.5f) * NX_CLUSTER_TILES_Y), NX_CLUSTER_TILES_Y - 1);
+        const auto slice = static_cast<unsigned int>(sliceFromDepth(depth, m_depthParams));
+        return static_cast<int>(slice * CLUSTERS_PER_SLICE + tileY * NX_CLUSTER_TILES_X + tileX);
+    }
+
+    static void reserveBuffer(std::shared_ptr<NxShaderStorageBuffer> &buffer, size_t &capacity, const size_t size)
+    {
+        if (buffer && size <= capacity)
+            return;
+        // Grown geometrically, the number of visible lights changes every frame
+        capacity = std::max({size, capacity * 2, static_cast<size_t>(256)});
+        buffer = NxShaderStorageBuffer::create(static_cast<unsigned int>(capacity));
+    }
+
+    void NxLightClusterGrid::restore(const std::span<const NxPointLightData> pointLights,
+                                     const std::span<const NxSpotLightData> spotLights,
+                                     const std::span<const NxLightCluster> clusters,
+                                     const std::span<const uint32_t> lightIndices, const glm::vec2 &depthParams)
+    {
+        m_pointLights.assign(pointLights.begin(), pointLights.end());
+        m_spotLights.assign(spotLights.begin(), spotLights.end());
+        m_clusters.assign(clusters.begin(), clusters.end());
+        m_lightIndices.assign(lightIndices.begin(), lightIndices.end());
+        m_depthParams = depthParams;
+        m_dirty = true;
+    }
+
+    void NxLightClusterGrid::upload()
+    {
+        if (!m_dirty)
+            return;
+        m_dirty = false;
+
+        // Storage buffers cannot be empty, an unused light array keeps its previous size
+        const size_t pointLightsSize = m_pointLights.size() * sizeof(NxPointLightData);
+        reserveBuffer(m_pointLightBuffer, m_pointLightCapacity, std::max(pointLightsSize, sizeof(NxPointLightData)));
+        if (pointLightsSize)
+            m_pointLightBuffer->setData(m_pointLights.data(), pointLightsSize);
+
+        const size_t spotLightsSize = m_spotLights.size() * sizeof(NxSpotLightData);
+        reserveBuffer(m_spotLightBuffer, m_spotLightCapacity, std::max(spotLightsSize, sizeof(NxSpotLightData)));
+        if (spotLightsSize)
+            m_spotLightBuffer->setData(m_spotLights.data(), spotLightsSize);
+
+        // The clusters and their index lists share a buffer: the fixed size cluster array comes first
+        const size_t clustersSize = m_clusters.size() * sizeof(NxLightCluster);
+        const size_t indicesSize = m_lightIndices.size() * sizeof(uint32_t);
+        m_uploadData.resize(clustersSize + indicesSize);
+        std::memcpy(m_uploadData.data(), m_clusters.data(), clustersSize);
+        if (indicesSize)
+            std::memcpy(m_uploadData.data() + clustersSize, m_lightIndices.data(), indicesSize);
+        reserveBuffer(m_clusterBuffer, m_clusterCapacity, m_uploadData.size());
+        m_clusterBuffer->setData(m_uploadData.data(), m_uploadData.size());
+    }
+
+    void NxLightClusterGrid::bind() const
+    {
+        if (!m_clusterBuffer)
+            return;
+        m_pointLightBuffer->bindBase(NX_POINT_LIGHTS_BINDING);
+        m_spotLightBuffer->bindBase(NX_SPOT_LIGHTS_BINDING);
+        m_clusterBuffer->bindBase(NX_LIGHT_CLUSTERS_BINDING);
+    }
+
+}
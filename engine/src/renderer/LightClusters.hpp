@@ -0,0 +1,186 @@
+//// LightClusters.hpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the clustered light assignment
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ShaderStorageBuffer.hpp"
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace nexo::renderer {
+
+    // Froxel grid dimensions, must match the defines of the shaders reading the clusters
+    constexpr unsigned int NX_CLUSTER_TILES_X = 16;
+    constexpr unsigned int NX_CLUSTER_TILES_Y = 9;
+    constexpr unsigned int NX_CLUSTER_SLICES = 24;
+    constexpr unsigned int NX_CLUSTER_COUNT = NX_CLUSTER_TILES_X * NX_CLUSTER_TILES_Y * NX_CLUSTER_SLICES;
+
+    // Storage buffer binding points of the clustered lighting data
+    constexpr unsigned int NX_POINT_LIGHTS_BINDING = 0;
+    constexpr unsigned int NX_SPOT_LIGHTS_BINDING = 1;
+    constexpr unsigned int NX_LIGHT_CLUSTERS_BINDING = 2;
+
+    /**
+     * @brief Point light as laid out in the point light storage buffer (std430).
+     */
+    struct NxPointLightData {
+        glm::vec4 position;     ///< World space position, w is the range of the light
+        glm::vec4 color;
+        glm::vec4 attenuation;  ///< Constant, linear and quadratic terms
+    };
+
+    /**
+     * @brief Spot light as laid out in the spot light storage buffer (std430).
+     */
+    struct NxSpotLightData {
+        glm::vec4 position;     ///< World space position, w is the range of the light
+        glm::vec4 direction;    ///< World space direction, w is the cosine of the inner cut off angle
+        glm::vec4 color;
+        glm::vec4 attenuation;  ///< Constant, linear and quadratic terms, w is the cosine of the outer cut off angle
+    };
+
+    /**
+     * @brief Range of the light index list affecting one cluster.
+     *
+     * The `pointCount` point light indices come first, followed by the `spotCount` spot light indices.
+     */
+    struct NxLightCluster {
+        uint32_t offset = 0;
+        uint32_t pointCount = 0;
+        uint32_t spotCount = 0;
+        uint32_t padding = 0;
+    };
+
+    /**
+     * @class NxLightClusterGrid
+     * @brief Assigns the lights of a view to the cells (froxels) of a grid dividing its frustum.
+     *
+     * The frustum is split in NX_CLUSTER_TILES_X x NX_CLUSTER_TILES_Y screen tiles and NX_CLUSTER_SLICES depth
+     * slices, spaced exponentially between the near and far planes. Every light is tested against the view space
+     * bounds of the clusters its range overlaps, and each cluster records the compact list of lights reaching it.
+     * A fragment then only shades the lights of its own cluster instead of every light of the scene.
+     *
+     * Lights reaching no cluster are dropped: the light arrays uploaded for the view only hold visible lights.
+     *
+     * Building the grid only touches CPU memory, `upload` writes the light arrays and the clusters in three storage
+     * buffers that `bind` attaches to the NX_*_BINDING points. Copies start empty, the buffers belong to one view.
+     */
+    class NxLightClusterGrid {
+        public:
+            NxLightClusterGrid() = default;
+            NxLightClusterGrid(const NxLightClusterGrid &) {}
+            NxLightClusterGrid &operator=(const NxLightClusterGrid &) { return *this; }
+
+            /**
+             * @brief Bins the lights into the clusters of the view.
+             *
+             * The cluster bounds are only recomputed when the projection changes.
+             *
+             * @param view View matrix of the camera.
+             * @param projection Projection matrix of the camera, perspective or orthographic.
+             * @param nearPlane Distance of the near plane.
+             * @param farPlane Distance of the far plane.
+             * @param pointLights World space point lights of the scene.
+             * @param spotLights World space spot lights of the scene.
+             */
+            void build(const glm::mat4 &view, const glm::mat4 &projection, float nearPlane, float farPlane,
+                       std::span<const NxPointLightData> pointLights, std::span<const NxSpotLightData> spotLights);
+
+            /**
+             * @brief Replaces the grid content with the result of a previous build, e.g. one read from a frame capture.
+             *
+             * The next upload writes it to the storage buffers. The cluster bounds are left as they are, so
+             * `getClusterIndex` keeps answering for the last built projection.
+             */
+            void restore(std::span<const NxPointLightData> pointLights, std::span<const NxSpotLightData> spotLights,
+                         std::span<const NxLightCluster> clusters, std::span<const uint32_t> lightIndices,
+                         const glm::vec2 &depthParams);
+
+            /**
+             * @brief Writes the result of the last build to the storage buffers, growing them when needed.
+             *
+             * Does nothing if nothing was built since the last upload.
+             */
+            void upload();
+
+            /**
+             * @brief Binds the storage buffers to their binding points, if they have been uploaded.
+             */
+            void bind() const;
+
+            /**
+             * @brief Scale and bias turning the logarithm of a view depth into a slice index.
+             */
+            [[nodiscard]] glm::vec2 getDepthParams() const { return m_depthParams; }
+
+            /**
+             * @brief Returns the cluster containing a view space point, or -1 if it lies outside of the frustum.
+             */
+            [[nodiscard]] int getClusterIndex(const glm::vec3 &viewPosition) const;
+
+            [[nodiscard]] const std::vector<NxLightCluster> &getClusters() const { return m_clusters; }
+            [[nodiscard]] const std::vector<uint32_t> &getLightIndices() const { return m_lightIndices; }
+            [[nodiscard]] const std::vector<NxPointLightData> &getPointLights() const { return m_pointLights; }
+            [[nodiscard]] const std::vector<NxSpotLightData> &getSpotLights() const { return m_spotLights; }
+
+        private:
+            void computeClusterBounds(const glm::mat4 &projection, float nearPlane, float farPlane);
+            void binLight(const glm::vec3 &center, float radius, uint32_t light, bool isSpot,
+                          const glm::vec3 &direction = {}, float cosAngle = 0.0f, float sinAngle = 0.0f);
+
+            glm::mat4 m_projection{0.0f};
+            float m_nearPlane = 0.0f;
+            float m_farPlane = 0.0f;
+            glm::vec2 m_depthParams{0.0f};
+            glm::mat4 m_inverseProjection{1.0f};
+
+            // View space bounds of every cluster, one array per coordinate so the light tests vectorize
+            std::vector<float> m_minX, m_minY, m_minZ, m_maxX, m_maxY, m_maxZ;
+            // Bounding spheres of the clusters, for the spot light cone tests
+            std::vector<float> m_centerX, m_centerY, m_centerZ, m_radius;
+
+            struct Hit {
+                uint32_t cluster;
+                uint32_t light;
+                bool isSpot;
+            };
+            std::vector<Hit> m_hits;
+            std::vector<uint8_t> m_hitMask;
+            std::vector<uint32_t> m_pointCursors;
+            std::vector<uint32_t> m_spotCursors;
+            std::vector<uint8_t> m_uploadData;
+
+            std::vector<NxPointLightData> m_pointLights;
+            std::vector<NxSpotLightData> m_spotLights;
+            std::vector<NxLightCluster> m_clusters;
+            std::vector<uint32_t> m_lightIndices;
+            bool m_dirty = false;
+
+            std::shared_ptr<NxShaderStorageBuffer> m_pointLightBuffer;
+            std::shared_ptr<NxShaderStorageBuffer> m_spotLightBuffer;
+            std::shared_ptr<NxShaderStorageBuffer> m_clusterBuffer;
+            size_t m_pointLightCapacity = 0;
+            size_t m_spotLightCapacity = 0;
+            size_t m_clusterCapacity = 0;
+    };
+
+}
@@ -0,0 +1,79 @@
+//// MeshLod.cpp //////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the mesh levels of detail
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "MeshLod.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace nexo::renderer {
+
+    float computeLodPixelScale(const glm::mat4 &modelMatrix,
+                               const glm::vec3 &localMin,
+                               const glm::vec3 &localMax,
+                               const glm::mat4 &viewMatrix,
+                               const glm::mat4 &projectionMatrix,
+                               const float viewportHeight)
+    {
+        const float objectScale = std::max({
+            glm::length(glm::vec3(modelMatrix[0])),
+            glm::length(glm::vec3(modelMatrix[1])),
+            glm::length(glm::vec3(modelMatrix[2]))
+        });
+        const glm::vec4 worldCenter = modelMatrix * glm::vec4((localMin + localMax) * 0.5f, 1.0f);
+        const float radius = glm::length(localMax - localMin) * 0.5f * objectScale;
+
+        // Clip space w of the center: the depth for a perspective projection, 1 for an orthographic one
+        const float viewZ = (viewMatrix * worldCenter).z;
+        const float w = projectionMatrix[2][3] * viewZ + projectionMatrix[3][3];
+        const float closestW = w - std::abs(projectionMatrix[2][3]) * radius;
+        if (closestW <= std::numeric_limits<float>::epsilon())
+            return std::numeric_limits<float>::infinity();
+        return 0.5f * viewportHeight * projectionMatrix[1][1] / closestW * objectScale;
+    }
+
+    unsigned int selectMeshLod(const std::span<const NxMeshLod> lods,
+                               const float pixelScale,
+                               const float threshold,
+                               const unsigned int previousLod)
+    {
+        if (lods.empty() || threshold <= 0.0f || std::isinf(pixelScale))
+            return 0;
+
+        const auto levelCount = static_cast<unsigned int>(lods.size());
+        const unsigned int current = std::min(previousLod, levelCount);
+        auto projectedError = [&](const unsigned int level) {
+            return level == 0 ? 0.0f : lods[level - 1].error * pixelScale;
+        };
+
+        // Errors grow with the levels, walk up while they stay under the limit
+        auto coarsestUnder = [&](const unsigned int from, const float limit) {
+            unsigned int level = from;
+            while (level < levelCount && projectedError(level + 1) <= limit)
+                ++level;
+            return level;
+        };
+
+        if (projectedError(current) > threshold)
+            return coarsestUnder(0, threshold);
+        return coarsestUnder(current, threshold * (1.0f - NX_MESH_LOD_HYSTERESIS));
+    }
+
+}
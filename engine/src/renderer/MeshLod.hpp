@@ -0,0 +1,87 @@
+//// MeshLod.hpp //////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the mesh levels of detail
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "VertexArray.hpp"
+
+#include <glm/glm.hpp>
+#include <memory>
+#include <span>
+
+namespace nexo::renderer {
+
+    class NxMeshAllocation;
+
+    // A coarser level is only picked once its projected error is this fraction under the threshold, so meshes
+    // standing at a switching distance do not pop between two levels every frame
+    constexpr float NX_MESH_LOD_HYSTERESIS = 0.2f;
+
+    /**
+     * @brief Simplified version of a mesh, drawn in place of the full resolution one when it is far enough.
+     *
+     * The level shares the vertices of the full resolution mesh, only its indices are fewer. Levels of meshes
+     * allocated in the mesh pool draw a range of the pool vertex array, the others have their own index buffer.
+     */
+    struct NxMeshLod {
+        std::shared_ptr<NxVertexArray> vao;
+        float error = 0.0f;     //< Object space deviation from the full resolution mesh
+        NxMeshRange range;
+        std::shared_ptr<const NxMeshAllocation> allocation;    //< Place in the mesh pool, null outside of it
+    };
+
+    /**
+     * @brief Computes how many pixels one object space unit of a mesh covers on screen.
+     *
+     * The scale is taken at the point of the bounding sphere of the mesh closest to the camera, so it never
+     * underestimates the size of the mesh.
+     *
+     * @param modelMatrix World matrix of the mesh.
+     * @param localMin Minimum corner of the object space bounding box.
+     * @param localMax Maximum corner of the object space bounding box.
+     * @param viewMatrix View matrix of the camera.
+     * @param projectionMatrix Projection matrix of the camera, perspective or orthographic.
+     * @param viewportHeight Height of the render target in pixels.
+     * @return The pixels per object unit, infinite when the camera is inside the bounding sphere.
+     */
+    [[nodiscard]] float computeLodPixelScale(const glm::mat4 &modelMatrix,
+                                             const glm::vec3 &localMin,
+                                             const glm::vec3 &localMax,
+                                             const glm::mat4 &viewMatrix,
+                                             const glm::mat4 &projectionMatrix,
+                                             float viewportHeight);
+
+    /**
+     * @brief Picks the coarsest level of detail whose projected error stays under a threshold.
+     *
+     * Refining happens as soon as the current level goes over the threshold, coarsening waits for the next level to
+     * be NX_MESH_LOD_HYSTERESIS under it.
+     *
+     * @param lods Simplified levels of the mesh, from the finest to the coarsest.
+     * @param pixelScale Pixels per object unit, see computeLodPixelScale.
+     * @param threshold Largest error allowed on screen, in pixels. 0 always picks the full resolution mesh.
+     * @param previousLod Level picked for the mesh on the previous frame.
+     * @return 0 for the full resolution mesh, i to draw lods[i - 1].
+     */
+    [[nodiscard]] unsigned int selectMeshLod(std::span<const NxMeshLod> lods,
+                                             float pixelScale,
+                                             float threshold,
+                                             unsigned int previousLod);
+
+}
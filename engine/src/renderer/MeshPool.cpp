@@ -0,0 +1,244 @@
+//// MeshPool.cpp /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the pool sharing vertex and index buffers between static meshes
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "MeshPool.hpp"
+#include "RendererExceptions.hpp"
+
+#include <algorithm>
+#include <ranges>
+
+namespace nexo::renderer {
+
+    NxRangeAllocator::NxRangeAllocator(const size_t capacity) : m_capacity(capacity)
+    {
+        if (capacity > 0)
+            m_freeRanges.emplace(0, capacity);
+    }
+
+    std::optional<size_t> NxRangeAllocator::allocate(const size_t size)
+    {
+        if (size == 0)
+            return std::nullopt;
+        for (auto it = m_freeRanges.begin(); it != m_freeRanges.end(); ++it) {
+            auto [offset, freeSize] = *it;
+            if (freeSize < size)
+                continue;
+            m_freeRanges.erase(it);
+            if (freeSize > size)
+                m_freeRanges.emplace(offset + size, freeSize - size);
+            m_used += size;
+            return offset;
+        }
+        return std::nullopt;
+    }
+
+    void NxRangeAllocator::free(size_t offset, size_t size)
+    {
+        if (size == 0)
+            return;
+        m_used -= size;
+
+        // Merges with the free range right after, then with the one right before
+        if (const auto next = m_freeRanges.find(offset + size); next != m_freeRanges.end()) {
+            size += next->second;
+            m_freeRanges.erase(next);
+        }
+        if (auto it = m_freeRanges.lower_bound(offset); it != m_freeRanges.begin()) {
+            auto previous = std::prev(it);
+            if (previous->first + previous->second == offset) {
+                previous->second += size;
+                return;
+            }
+        }
+        m_freeRanges.emplace(offset, size);
+    }
+
+    size_t NxRangeAllocator::getLargestFreeRange() const
+    {
+        size_t largest = 0;
+        for (const auto &size: m_freeRanges | std::views::values)
+            largest = std::max(largest, size);
+        return largest;
+    }
+
+    NxMeshAllocation::~NxMeshAllocation()
+    {
+        NxMeshPool::get().release(*this);
+    }
+
+    NxMeshPool &NxMeshPool::get()
+    {
+        // Never destroyed, allocations owned by other static objects release their ranges during exit
+        static auto *pool = new NxMeshPool();
+        return *pool;
+    }
+
+    size_t NxMeshPool::createPage(const NxVertexFormat format, const size_t vertexCapacity,
+                                  const size_t indexCapacity, const bool dedicated)
+    {
+        const unsigned int stride = vertexFormatStride(format);
+        auto vertexBuffer = createVertexBuffer(static_cast<unsigned int>(vertexCapacity * stride));
+        vertexBuffer->setLayout(vertexFormatLayout(format));
+        // The index buffer is sized right after its creation, while it is still the bound element buffer
+        auto indexBuffer = createIndexBuffer();
+        indexBuffer->setData(nullptr, indexCapacity);
+
+        auto vao = createVertexArray();
+        vao->addVertexBuffer(vertexBuffer);
+        vao->setIndexBuffer(indexBuffer);
+
+        Page page{
+            format, std::move(vao), std::move(vertexBuffer), std::move(indexBuffer),
+            NxRangeAllocator(vertexCapacity), NxRangeAllocator(indexCapacity), 0, dedicated
+        };
+        // Slots of destroyed pages are reused, the index of a page never changes while it is alive
+        const auto freeSlot = std::ranges::find_if(m_pages, [](const auto &slot) { return !slot.has_value(); });
+        if (freeSlot != m_pages.end()) {
+            freeSlot->emplace(std::move(page));
+            return static_cast<size_t>(freeSlot - m_pages.begin());
+        }
+        m_pages.emplace_back(std::move(page));
+        return m_pages.size() - 1;
+    }
+
+    std::shared_ptr<NxMeshAllocation> NxMeshPool::allocate(const NxVertexFormat format,
+                                                           const std::span<const std::byte> vertices,
+                                                           const std::span<const unsigned int> indices)
+    {
+        const unsigned int stride = vertexFormatStride(format);
+        if (vertices.empty() || vertices.size() % stride != 0)
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Mesh vertices do not match the stride of their format");
+        if (indices.empty())
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Cannot add a mesh without indices to the pool");
+        const size_t vertexCount = vertices.size() / stride;
+
+        std::optional<size_t> pageIndex;
+        for (size_t i = 0; i < m_pages.size(); ++i) {
+            const auto &page = m_pages[i];
+            if (!page || page->dedicated || page->format != format)
+                continue;
+            if (page->vertices.getLargestFreeRange() >= vertexCount &&
+                page->indices.getLargestFreeRange() >= indices.size()) {
+                pageIndex = i;
+                break;
+            }
+        }
+        if (!pageIndex) {
+            // Dedicated pages leave as many indices free for the levels of detail of the mesh
+            if (vertexCount > PAGE_VERTEX_CAPACITY || indices.size() > PAGE_INDEX_CAPACITY)
+                pageIndex = createPage(format, vertexCount, indices.size() * 2, true);
+            else
+                pageIndex = createPage(format, PAGE_VERTEX_CAPACITY, PAGE_INDEX_CAPACITY, false);
+        }
+
+        Page &page = *m_pages[*pageIndex];
+        const size_t vertexOffset = *page.vertices.allocate(vertexCount);
+        const size_t indexOffset = *page.indices.allocate(indices.size());
+        page.vertexBuffer->setSubData(vertices.data(), vertices.size(), vertexOffset * stride);
+        page.indexBuffer->setSubData(indices.data(), indices.size(), indexOffset);
+        ++page.allocationCount;
+
+        std::shared_ptr<NxMeshAllocation> allocation(new NxMeshAllocation());
+        allocation->vao = page.vao;
+        allocation->format = format;
+        allocation->range = {
+            static_cast<uint32_t>(indices.size()),
+            static_cast<uint32_t>(indexOffset),
+            static_cast<int32_t>(vertexOffset)
+        };
+        allocation->m_page = *pageIndex;
+        allocation->m_generation = m_generation;
+        allocation->m_vertexCount = vertexCount;
+        allocation->m_indexOffset = indexOffset;
+        allocation->m_indexCount = indices.size();
+        return allocation;
+    }
+
+    std::shared_ptr<NxMeshAllocation> NxMeshPool::allocateLod(const std::shared_ptr<const NxMeshAllocation> &base,
+                                                              const std::span<const unsigned int> indices)
+    {
+        if (!base || base->m_generation != m_generation || !m_pages[base->m_page])
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Level of detail of a mesh that is not in the pool");
+        if (indices.empty())
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Cannot add a mesh without indices to the pool");
+
+        Page &page = *m_pages[base->m_page];
+        const std::optional<size_t> indexOffset = page.indices.allocate(indices.size());
+        if (!indexOffset)
+            return nullptr;
+        page.indexBuffer->setSubData(indices.data(), indices.size(), *indexOffset);
+        ++page.allocationCount;
+
+        std::shared_ptr<NxMeshAllocation> allocation(new NxMeshAllocation());
+        allocation->vao = page.vao;
+        allocation->format = base->format;
+        allocation->range = {
+            static_cast<uint32_t>(indices.size()),
+            static_cast<uint32_t>(*indexOffset),
+            base->range.baseVertex
+        };
+        allocation->m_page = base->m_page;
+        allocation->m_generation = m_generation;
+        allocation->m_indexOffset = *indexOffset;
+        allocation->m_indexCount = indices.size();
+        allocation->m_base = base;
+        return allocation;
+    }
+
+    void NxMeshPool::release(const NxMeshAllocation &allocation)
+    {
+        if (allocation.m_generation != m_generation || allocation.m_page >= m_pages.size())
+            return;
+        auto &slot = m_pages[allocation.m_page];
+        if (!slot)
+            return;
+        if (allocation.m_vertexCount > 0)
+            slot->vertices.free(static_cast<size_t>(allocation.range.baseVertex), allocation.m_vertexCount);
+        slot->indices.free(allocation.m_indexOffset, allocation.m_indexCount);
+        if (--slot->allocationCount == 0 && slot->dedicated)
+            slot.reset();
+    }
+
+    NxMeshPoolStats NxMeshPool::getStats() const
+    {
+        NxMeshPoolStats stats;
+        for (const auto &page: m_pages) {
+            if (!page)
+                continue;
+            ++stats.pageCount;
+            stats.allocationCount += page->allocationCount;
+            stats.usedVertices += page->vertices.getUsed();
+            stats.vertexCapacity += page->vertices.getCapacity();
+            stats.usedIndices += page->indices.getUsed();
+            stats.indexCapacity += page->indices.getCapacity();
+        }
+        return stats;
+    }
+
+    size_t NxMeshPool::getPageCount() const
+    {
+        return static_cast<size_t>(std::ranges::count_if(m_pages, [](const auto &page) { return page.has_value(); }));
+    }
+
+    void NxMeshPool::clear()
+    {
+        m_pages.clear();
+        ++m_generation;
+    }
+
+}
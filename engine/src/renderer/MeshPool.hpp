@@ -0,0 +1,174 @@
+//// MeshPool.hpp /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the pool sharing vertex and index buffers between static meshes
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "VertexArray.hpp"
+#include "VertexFormat.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @class NxRangeAllocator
+     * @brief First fit allocator of ranges in a fixed capacity, used to place meshes in shared buffers.
+     *
+     * Freed ranges are merged with their free neighbours so the space can be reused by larger meshes.
+     */
+    class NxRangeAllocator {
+        public:
+            explicit NxRangeAllocator(size_t capacity);
+
+            /**
+             * @brief Reserves a range of the given size.
+             *
+             * @return The offset of the range, or nullopt when no free range is large enough.
+             */
+            [[nodiscard]] std::optional<size_t> allocate(size_t size);
+
+            /**
+             * @brief Gives back a range returned by `allocate`.
+             */
+            void free(size_t offset, size_t size);
+
+            [[nodiscard]] size_t getCapacity() const { return m_capacity; }
+            [[nodiscard]] size_t getUsed() const { return m_used; }
+            [[nodiscard]] size_t getLargestFreeRange() const;
+
+        private:
+            size_t m_capacity;
+            size_t m_used = 0;
+            std::map<size_t, size_t> m_freeRanges;  //< Offset to size, sorted by offset
+    };
+
+    /**
+     * @brief Place of a mesh in the shared buffers of the pool.
+     *
+     * The ranges are given back to the pool when the allocation is destroyed. Levels of detail only own their
+     * indices and keep the allocation of the full resolution mesh alive, since they reference its vertices.
+     */
+    class NxMeshAllocation {
+        public:
+            ~NxMeshAllocation();
+
+            NxMeshAllocation(const NxMeshAllocation &) = delete;
+            NxMeshAllocation &operator=(const NxMeshAllocation &) = delete;
+
+            std::shared_ptr<NxVertexArray> vao;     //< Vertex array of the page, shared by every mesh in it
+            NxMeshRange range;
+            NxVertexFormat format = NxVertexFormat::STANDARD;
+
+        private:
+            friend class NxMeshPool;
+            NxMeshAllocation() = default;
+
+            size_t m_page = 0;
+            uint64_t m_generation = 0;
+            size_t m_vertexCount = 0;               //< 0 for levels of detail, whose vertices belong to m_base
+            size_t m_indexOffset = 0;
+            size_t m_indexCount = 0;
+            std::shared_ptr<const NxMeshAllocation> m_base;
+    };
+
+    struct NxMeshPoolStats {
+        size_t pageCount = 0;
+        size_t allocationCount = 0;
+        size_t usedVertices = 0;
+        size_t vertexCapacity = 0;
+        size_t usedIndices = 0;
+        size_t indexCapacity = 0;
+    };
+
+    /**
+     * @class NxMeshPool
+     * @brief Packs static meshes of the same vertex format into large shared vertex and index buffers.
+     *
+     * Meshes sharing a page also share its vertex array, so consecutive draws of them need no rebinding and can
+     * be merged into a single multi draw indirect call, each one selecting its range through its first index and
+     * base vertex. A page is created when the existing ones of the format are full, meshes too large for a page
+     * get a dedicated one.
+     *
+     * @note The pool uploads to GPU buffers, it must only be used on the rendering thread.
+     */
+    class NxMeshPool {
+        public:
+            static constexpr size_t PAGE_VERTEX_CAPACITY = 1 << 18;
+            static constexpr size_t PAGE_INDEX_CAPACITY = 1 << 20;
+
+            static NxMeshPool &get();
+
+            /**
+             * @brief Uploads a mesh to the pool.
+             *
+             * @param format Format of the vertices.
+             * @param vertices Packed vertices, their size must be a multiple of the stride of the format.
+             * @param indices Indices of the mesh, relative to its first vertex.
+             * @return The allocation, whose range draws the mesh with the page vertex array.
+             */
+            std::shared_ptr<NxMeshAllocation> allocate(NxVertexFormat format,
+                                                       std::span<const std::byte> vertices,
+                                                       std::span<const unsigned int> indices);
+
+            /**
+             * @brief Uploads the indices of a level of detail reusing the vertices of an allocated mesh.
+             *
+             * @param base Allocation of the full resolution mesh.
+             * @param indices Indices of the level, relative to the first vertex of the mesh.
+             * @return The allocation, or nullptr when the page of the mesh has no room left for the indices.
+             */
+            std::shared_ptr<NxMeshAllocation> allocateLod(const std::shared_ptr<const NxMeshAllocation> &base,
+                                                          std::span<const unsigned int> indices);
+
+            [[nodiscard]] NxMeshPoolStats getStats() const;
+            [[nodiscard]] size_t getPageCount() const;
+
+            /**
+             * @brief Destroys every page, allocations still alive keep their vertex array but are not tracked anymore.
+             */
+            void clear();
+
+        private:
+            NxMeshPool() = default;
+            friend class NxMeshAllocation;
+
+            struct Page {
+                NxVertexFormat format;
+                std::shared_ptr<NxVertexArray> vao;
+                std::shared_ptr<NxVertexBuffer> vertexBuffer;
+                std::shared_ptr<NxIndexBuffer> indexBuffer;
+                NxRangeAllocator vertices;
+                NxRangeAllocator indices;
+                size_t allocationCount = 0;
+                bool dedicated = false;     //< Created for a mesh larger than a page, destroyed with it
+            };
+
+            void release(const NxMeshAllocation &allocation);
+            size_t createPage(NxVertexFormat format, size_t vertexCapacity, size_t indexCapacity, bool dedicated);
+
+            std::vector<std::optional<Page>> m_pages;
+            uint64_t m_generation = 0;  //< Bumped by clear, so allocations from destroyed pages release nothing
+    };
+
+}
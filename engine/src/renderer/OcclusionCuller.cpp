@@ -0,0 +1,280 @@
+//// OcclusionCuller.cpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the CPU occlusion culler
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "OcclusionCuller.hpp"
+#include "core/thread/WorkerPool.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <latch>
+#include <limits>
+
+namespace nexo::renderer {
+
+    namespace {
+
+        // Rows of the depth buffer rasterized by a single worker job
+        constexpr unsigned int ROWS_PER_JOB = 16;
+        // Below this many triangles, dispatching the jobs costs more than rasterizing on the calling thread
+        constexpr size_t MIN_PARALLEL_TRIANGLES = 64;
+        // Clip space w under which a vertex is considered on or behind the near plane
+        constexpr float MIN_CLIP_W = 1e-5f;
+        // Hierarchy texels read by a single box test, along each axis
+        constexpr unsigned int MAX_TEST_TEXELS = 4;
+
+        thread::WorkerPool &occlusionPool()
+        {
+            static thread::WorkerPool pool;
+            return pool;
+        }
+
+        glm::vec3 toScreen(const glm::vec4 &clip, const float width, const float height)
+        {
+            const glm::vec3 ndc = glm::vec3(clip) / clip.w;
+            return {
+                (ndc.x * 0.5f + 0.5f) * width,
+                (ndc.y * 0.5f + 0.5f) * height,
+                ndc.z * 0.5f + 0.5f
+            };
+        }
+
+        float edge(const glm::vec3 &a, const glm::vec3 &b, const float px, const float py)
+        {
+            return (b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x);
+        }
+
+    }
+
+    NxOcclusionCuller::NxOcclusionCuller(const unsigned int width, const unsigned int height)
+        : m_width(std::max(width, 1u)), m_height(std::max(height, 1u))
+    {
+        glm::uvec2 size{m_width, m_height};
+        while (true) {
+            m_levelSizes.push_back(size);
+            m_levels.emplace_back(static_cast<size_t>(size.x) * size.y, 1.0f);
+            if (size.x == 1 && size.y == 1)
+                break;
+            size = {(size.x + 1) / 2, (size.y + 1) / 2};
+        }
+    }
+
+    void NxOcclusionCuller::begin(const glm::mat4 &viewProjection)
+    {
+        m_viewProjection = viewProjection;
+        m_triangles.clear();
+        m_stats = {};
+        for (auto &level : m_levels)
+            std::ranges::fill(level, 1.0f);
+    }
+
+    void NxOcclusionCuller::addOccluder(const std::span<const glm::vec3> vertices,
+                                        const std::span<const uint32_t> indices, const glm::mat4 &model)
+    {
+        const glm::mat4 modelViewProjection = m_viewProjection * model;
+        m_clipVertices.resize(vertices.size());
+        for (size_t i = 0; i < vertices.size(); ++i)
+            m_clipVertices[i] = modelViewProjection * glm::vec4(vertices[i], 1.0f);
+
+        const auto width = static_cast<float>(m_width);
+        const auto height = static_cast<float>(m_height);
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            if (indices[i] >= vertices.size() || indices[i + 1] >= vertices.size() || indices[i + 2] >= vertices.size())
+                continue;
+            const glm::vec4 &c0 = m_clipVertices[indices[i]];
+            const glm::vec4 &c1 = m_clipVertices[indices[i + 1]];
+            const glm::vec4 &c2 = m_clipVertices[indices[i + 2]];
+            // Dropping the triangle only makes the occlusion less aggressive, no need to clip it
+            if (c0.w < MIN_CLIP_W || c1.w < MIN_CLIP_W || c2.w < MIN_CLIP_W)
+                continue;
+
+            ScreenTriangle triangle{toScreen(c0, width, height), toScreen(c1, width, height), toScreen(c2, width, height)};
+            const float area = edge(triangle.v0, triangle.v1, triangle.v2.x, triangle.v2.y);
+            if (area == 0.0f)
+                continue;
+            // Occluders are rasterized double sided, keep one winding so the edge functions are positive inside
+            if (area < 0.0f)
+                std::swap(triangle.v1, triangle.v2);
+
+            const float minX = std::min({triangle.v0.x, triangle.v1.x, triangle.v2.x});
+            const float maxX = std::max({triangle.v0.x, triangle.v1.x, triangle.v2.x});
+            const float minY = std::min({triangle.v0.y, triangle.v1.y, triangle.v2.y});
+            const float maxY = std::max({triangle.v0.y, triangle.v1.y, triangle.v2.y});
+            const float minZ = std::min({triangle.v0.z, triangle.v1.z, triangle.v2.z});
+            if (maxX < 0.0f || maxY < 0.0f || minX > width || minY > height || minZ > 1.0f)
+                continue;
+            m_triangles.push_back(triangle);
+        }
+        m_stats.occluderTriangles = static_cast<unsigned int>(m_triangles.size());
+    }
+
+    void NxOcclusionCuller::rasterize()
+    {
+        if (m_triangles.empty())
+            return;
+
+        const unsigned int jobCount = (m_height + ROWS_PER_JOB - 1) / ROWS_PER_JOB;
+        if (jobCount <= 1 || m_triangles.size() < MIN_PARALLEL_TRIANGLES) {
+            rasterizeRows(0, m_height);
+        } else {
+            // Each job owns a band of rows, no two jobs write the same texel
+            std::latch done(jobCount);
+            for (unsigned int job = 0; job < jobCount; ++job) {
+                const unsigned int firstRow = job * ROWS_PER_JOB;
+                occlusionPool().submit([this, &done, firstRow] {
+                    rasterizeRows(firstRow, std::min(firstRow + ROWS_PER_JOB, m_height));
+                    done.count_down();
+                });
+            }
+            done.wait();
+        }
+        buildHierarchy();
+    }
+
+    void NxOcclusionCuller::rasterizeRows(const unsigned int firstRow, const unsigned int lastRow)
+    {
+        auto &depth = m_levels.front();
+        for (const auto &[v0, v1, v2] : m_triangles) {
+            const float minY = std::min({v0.y, v1.y, v2.y});
+            const float maxY = std::max({v0.y, v1.y, v2.y});
+            // Pixels are sampled at their center
+            const auto rowBegin = static_cast<unsigned int>(std::clamp(std::ceil(minY - 0.5f), static_cast<float>(firstRow), static_cast<float>(lastRow)));
+            const auto rowEnd = static_cast<unsigned int>(std::clamp(std::floor(maxY - 0.5f) + 1.0f, static_cast<float>(firstRow), static_cast<float>(lastRow)));
+            if (rowBegin >= rowEnd)
+                continue;
+
+            const float minX = std::min({v0.x, v1.x, v2.x});
+            const float maxX = std::max({v0.x, v1.x, v2.x});
+            const auto colBegin = static_cast<unsigned int>(std::clamp(std::ceil(minX - 0.5f), 0.0f, static_cast<float>(m_width)));
+            const auto colEnd = static_cast<unsigned int>(std::clamp(std::floor(maxX - 0.5f) + 1.0f, 0.0f, static_cast<float>(m_width)));
+            if (colBegin >= colEnd)
+                continue;
+
+            // The depth is interpolated linearly in screen space from the barycentric weights
+            const float inverseArea = 1.0f / edge(v0, v1, v2.x, v2.y);
+            const float depth10 = (v1.z - v0.z) * inverseArea;
+            const float depth20 = (v2.z - v0.z) * inverseArea;
+            // Edge function increments along a row
+            const float step0 = v1.y - v2.y;
+            const float step1 = v2.y - v0.y;
+            const float step2 = v0.y - v1.y;
+
+            for (unsigned int y = rowBegin; y < rowEnd; ++y) {
+                const float px = static_cast<float>(colBegin) + 0.5f;
+                const float py = static_cast<float>(y) + 0.5f;
+                float w0 = edge(v1, v2, px, py);
+                float w1 = edge(v2, v0, px, py);
+                float w2 = edge(v0, v1, px, py);
+                float *row = depth.data() + static_cast<size_t>(y) * m_width;
+                // Branchless so the compiler can vectorize the span
+                for (unsigned int x = colBegin; x < colEnd; ++x) {
+                    const bool inside = (w0 >= 0.0f) & (w1 >= 0.0f) & (w2 >= 0.0f);
+                    const float z = v0.z + w1 * depth10 + w2 * depth20;
+                    row[x] = inside ? std::min(row[x], z) : row[x];
+                    w0 += step0;
+                    w1 += step1;
+                    w2 += step2;
+                }
+            }
+        }
+    }
+
+    void NxOcclusionCuller::buildHierarchy()
+    {
+        for (size_t level = 1; level < m_levels.size(); ++level) {
+            const std::vector<float> &source = m_levels[level - 1];
+            const glm::uvec2 sourceSize = m_levelSizes[level - 1];
+            std::vector<float> &target = m_levels[level];
+            const glm::uvec2 targetSize = m_levelSizes[level];
+            for (unsigned int y = 0; y < targetSize.y; ++y) {
+                const unsigned int y0 = y * 2;
+                const unsigned int y1 = std::min(y0 + 1, sourceSize.y - 1);
+                for (unsigned int x = 0; x < targetSize.x; ++x) {
+                    const unsigned int x0 = x * 2;
+                    const unsigned int x1 = std::min(x0 + 1, sourceSize.x - 1);
+                    target[static_cast<size_t>(y) * targetSize.x + x] = std::max({
+                        source[static_cast<size_t>(y0) * sourceSize.x + x0],
+                        source[static_cast<size_t>(y0) * sourceSize.x + x1],
+                        source[static_cast<size_t>(y1) * sourceSize.x + x0],
+                        source[static_cast<size_t>(y1) * sourceSize.x + x1]
+                    });
+                }
+            }
+        }
+    }
+
+    bool NxOcclusionCuller::isOccluded(const glm::vec3 &localMin, const glm::vec3 &localMax, const glm::mat4 &model)
+    {
+        ++m_stats.testedCount;
+        if (m_triangles.empty())
+            return false;
+
+        const glm::mat4 modelViewProjection = m_viewProjection * model;
+        const auto width = static_cast<float>(m_width);
+        const auto height = static_cast<float>(m_height);
+        glm::vec3 screenMin(std::numeric_limits<float>::max());
+        glm::vec3 screenMax(std::numeric_limits<float>::lowest());
+        for (unsigned int corner = 0; corner < 8; ++corner) {
+            const glm::vec3 position{
+                corner & 1 ? localMax.x : localMin.x,
+                corner & 2 ? localMax.y : localMin.y,
+                corner & 4 ? localMax.z : localMin.z
+            };
+            const glm::vec4 clip = modelViewProjection * glm::vec4(position, 1.0f);
+            if (clip.w < MIN_CLIP_W)
+                return false;
+            const glm::vec3 screen = toScreen(clip, width, height);
+            screenMin = glm::min(screenMin, screen);
+            screenMax = glm::max(screenMax, screen);
+        }
+        // Outside of the screen or of the depth range, leave it to the frustum
+        if (screenMax.x < 0.0f || screenMax.y < 0.0f || screenMin.x > width || screenMin.y > height ||
+            screenMin.z < 0.0f || screenMin.z > 1.0f)
+            return false;
+
+        const auto x0 = static_cast<unsigned int>(std::clamp(screenMin.x, 0.0f, width - 1.0f));
+        const auto x1 = static_cast<unsigned int>(std::clamp(screenMax.x, 0.0f, width - 1.0f));
+        const auto y0 = static_cast<unsigned int>(std::clamp(screenMin.y, 0.0f, height - 1.0f));
+        const auto y1 = static_cast<unsigned int>(std::clamp(screenMax.y, 0.0f, height - 1.0f));
+
+        // Coarsest level where the rectangle still covers a handful of texels
+        size_t level = 0;
+        while (level + 1 < m_levels.size() &&
+               ((x1 >> level) - (x0 >> level) >= MAX_TEST_TEXELS || (y1 >> level) - (y0 >> level) >= MAX_TEST_TEXELS))
+            ++level;
+
+        const std::vector<float> &depth = m_levels[level];
+        const unsigned int levelWidth = m_levelSizes[level].x;
+        float farthest = 0.0f;
+        for (unsigned int y = y0 >> level; y <= y1 >> level; ++y)
+            for (unsigned int x = x0 >> level; x <= x1 >> level; ++x)
+                farthest = std::max(farthest, depth[static_cast<size_t>(y) * levelWidth + x]);
+
+        if (screenMin.z <= farthest)
+            return false;
+        ++m_stats.occludedCount;
+        return true;
+    }
+
+    float NxOcclusionCuller::getDepth(const unsigned int x, const unsigned int y, const size_t level) const
+    {
+        const glm::uvec2 size = m_levelSizes[level];
+        return m_levels[level][static_cast<size_t>(std::min(y, size.y - 1)) * size.x + std::min(x, size.x - 1)];
+    }
+
+}
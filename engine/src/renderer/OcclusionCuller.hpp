@@ -0,0 +1,128 @@
+//// OcclusionCuller.hpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the CPU occlusion culler
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace nexo::renderer {
+
+    // Resolution of the software depth buffer the occluders are rasterized in
+    constexpr unsigned int NX_OCCLUSION_BUFFER_WIDTH = 256;
+    constexpr unsigned int NX_OCCLUSION_BUFFER_HEIGHT = 128;
+
+    struct NxOcclusionStats {
+        unsigned int occluderTriangles = 0; ///< Occluder triangles kept after clipping
+        unsigned int testedCount = 0;       ///< Bounds tested since the last begin
+        unsigned int occludedCount = 0;     ///< Bounds found hidden behind the occluders
+    };
+
+    /**
+     * @class NxOcclusionCuller
+     * @brief Software occlusion culling of bounding boxes against a set of occluder meshes.
+     *
+     * A frame goes through three steps:
+     * - `begin` clears the depth buffer for a view projection,
+     * - `addOccluder` projects the triangles of the designated occluders, then `rasterize` writes them in a small
+     *   depth buffer and builds its hierarchical-Z: each level stores the farthest depth of 2x2 texels of the level
+     *   below,
+     * - `isOccluded` projects a bounding box and compares its nearest depth with the farthest depth of the few
+     *   hierarchy texels covering its screen rectangle.
+     *
+     * The test is conservative: boxes crossing the near plane or leaving the depth range are always visible, and
+     * occluder triangles crossing the near plane are dropped instead of clipped.
+     *
+     * Everything runs on the CPU, rows of the depth buffer are rasterized in parallel on a worker pool when there
+     * are enough occluder triangles.
+     */
+    class NxOcclusionCuller {
+        public:
+            explicit NxOcclusionCuller(unsigned int width = NX_OCCLUSION_BUFFER_WIDTH,
+                                       unsigned int height = NX_OCCLUSION_BUFFER_HEIGHT);
+
+            /**
+             * @brief Clears the occluders, the depth buffer and the statistics for a new view.
+             *
+             * @param viewProjection View projection matrix of the camera, OpenGL clip space conventions.
+             */
+            void begin(const glm::mat4 &viewProjection);
+
+            /**
+             * @brief Projects the triangles of an occluder, they are written to the depth buffer by `rasterize`.
+             *
+             * @param vertices Local space positions of the occluder.
+             * @param indices Triangle list indexing the vertices.
+             * @param model Local to world matrix of the occluder.
+             */
+            void addOccluder(std::span<const glm::vec3> vertices, std::span<const uint32_t> indices,
+                             const glm::mat4 &model);
+
+            /**
+             * @brief Rasterizes the occluders added since `begin` and builds the depth hierarchy.
+             */
+            void rasterize();
+
+            /**
+             * @brief Tests whether a bounding box is entirely hidden by the rasterized occluders.
+             *
+             * @param localMin Minimum corner of the local space bounding box.
+             * @param localMax Maximum corner of the local space bounding box.
+             * @param model Local to world matrix of the box.
+             * @return true if no part of the box can be visible.
+             */
+            [[nodiscard]] bool isOccluded(const glm::vec3 &localMin, const glm::vec3 &localMax, const glm::mat4 &model);
+
+            [[nodiscard]] bool hasOccluders() const { return !m_triangles.empty(); }
+            [[nodiscard]] unsigned int getWidth() const { return m_width; }
+            [[nodiscard]] unsigned int getHeight() const { return m_height; }
+            [[nodiscard]] size_t getLevelCount() const { return m_levels.size(); }
+            [[nodiscard]] glm::uvec2 getLevelSize(const size_t level) const { return m_levelSizes[level]; }
+
+            /**
+             * @brief Returns the depth stored in a texel of a hierarchy level, between 0 (near) and 1 (far).
+             */
+            [[nodiscard]] float getDepth(unsigned int x, unsigned int y, size_t level = 0) const;
+
+            [[nodiscard]] const NxOcclusionStats &getStats() const { return m_stats; }
+
+        private:
+            // Screen space triangle: x and y in pixels, z the depth, counter clockwise
+            struct ScreenTriangle {
+                glm::vec3 v0, v1, v2;
+            };
+
+            void rasterizeRows(unsigned int firstRow, unsigned int lastRow);
+            void buildHierarchy();
+
+            unsigned int m_width;
+            unsigned int m_height;
+            glm::mat4 m_viewProjection{1.0f};
+
+            std::vector<glm::vec4> m_clipVertices;
+            std::vector<ScreenTriangle> m_triangles;
+            // Level 0 is the depth buffer, each next level halves the resolution
+            std::vector<std::vector<float>> m_levels;
+            std::vector<glm::uvec2> m_levelSizes;
+
+            NxOcclusionStats m_stats;
+    };
+
+}
@@ -17,6 +17,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "RenderCommand.hpp"
 #include "renderer/RendererExceptions.hpp"
+#include "GraphicsApi.hpp"
+#include "headless/HeadlessRendererApi.hpp"
 #ifdef NX_GRAPHICS_API_OPENGL
     #include "opengl/OpenGlRendererAPI.hpp"
 #endif
@@ -24,11 +26,24 @@
 namespace nexo::renderer {
 
     #ifdef NX_GRAPHICS_API_OPENGL
-        NxRendererApi *NxRenderCommand::_rendererApi = new NxOpenGlRendererApi;
+        static NxRendererApi *const s_openGlApi = new NxOpenGlRendererApi;
+        NxRendererApi *NxRenderCommand::_rendererApi = s_openGlApi;
+    #else
+        NxRendererApi *NxRenderCommand::_rendererApi = nullptr;
     #endif
 
     void NxRenderCommand::init()
     {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS) {
+            static NxHeadlessRendererApi headlessApi;
+            _rendererApi = &headlessApi;
+        }
+        #ifdef NX_GRAPHICS_API_OPENGL
+            // A previous init may have selected the headless backend (e.g. the headless tests)
+            else if (NxGetGraphicsApi() == NxGraphicsApi::OPENGL) {
+                _rendererApi = s_openGlApi;
+            }
+        #endif
         if (!_rendererApi)
             THROW_EXCEPTION(NxUnknownGraphicsApi, "UNKNOWN");
         _rendererApi->init();
@@ -45,7 +45,8 @@ namespace nexo::renderer {
      *
      * Notes:
      * - The specific implementation of `RendererApi` (e.g., `NxOpenGlRendererApi`) is
-     *   determined by the preprocessor directive `NX_GRAPHICS_API_OPENGL` or similar.
+     *   determined by the preprocessor directive `NX_GRAPHICS_API_OPENGL` or similar, unless the
+     *   headless backend is selected at runtime (see `NxSetGraphicsApi`).
      */
     class NxRenderCommand {
         public:
@@ -119,15 +120,31 @@ namespace nexo::renderer {
              * @param vertexArray A shared pointer to the vertex array containing the geometry data.
              * @param indexCount The number of indices to draw. If set to 0, the method will use
              *                   the total index count from the bound index buffer.
+             * @param firstIndex Index of the first index to draw in the index buffer.
+             * @param baseVertex Value added to every index before fetching the vertex.
              *
              * Usage:
              * - Use this method to draw meshes or primitives with indexed geometry.
              */
-            static void drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, const size_t indexCount = 0)
+            static void drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, const size_t indexCount = 0,
+                                    const size_t firstIndex = 0, const int baseVertex = 0)
             {
-                _rendererApi->drawIndexed(vertexArray, indexCount);
+                _rendererApi->drawIndexed(vertexArray, indexCount, firstIndex, baseVertex);
             }
 
+            /**
+             * @brief Issues every draw of the span with a single call on the given vertex array.
+             *
+             * @see NxRendererApi::multiDrawIndexedIndirect
+             */
+            static void multiDrawIndexedIndirect(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                                 const std::span<const NxDrawIndexedIndirectCommand> commands)
+            {
+                _rendererApi->multiDrawIndexedIndirect(vertexArray, commands);
+            }
+
+            [[nodiscard]] static bool supportsMultiDrawIndirect() { return _rendererApi->supportsMultiDrawIndirect(); }
+
             static void drawUnIndexed(const size_t verticesCount)
             {
                 _rendererApi->drawUnIndexed(verticesCount);
@@ -231,6 +248,11 @@ namespace nexo::renderer {
                 _rendererApi->setWindingOrder(order);
             }
 
+            static void setDrawBuffers(const unsigned int count)
+            {
+                _rendererApi->setDrawBuffers(count);
+            }
+
         private:
             /**
             * @brief Static pointer to the active `NxRendererApi` implementation.
@@ -238,6 +260,7 @@ namespace nexo::renderer {
             * This member holds a pointer to the concrete `NxRendererApi` instance (e.g.,
             * `NxOpenGlRendererApi`). It is initialized based on the active graphics API,
             * as determined by preprocessor directives (e.g., `NX_GRAPHICS_API_OPENGL`).
+            * `init()` swaps it for the `NxHeadlessRendererApi` when the headless backend is selected.
             *
             * Notes:
             * - The `_rendererApi` instance is statically allocated and shared across all
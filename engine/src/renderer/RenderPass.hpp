@@ -25,6 +25,8 @@
 
 namespace nexo::renderer {
     using PassId = uint32_t;
+    // Transient render target declared in a RenderPipeline
+    using ResourceId = uint32_t;
 
     class RenderPipeline;
 
@@ -33,6 +35,8 @@ namespace nexo::renderer {
             explicit RenderPass(const PassId id, std::string  debugName = "") : id(id), name(std::move(debugName)) {}
             virtual ~RenderPass() = default;
 
+            // Declare the transient targets the pass reads and writes, called once added to a pipeline
+            virtual void setup([[maybe_unused]] RenderPipeline& pipeline) {};
             // The actual rendering work
             virtual void execute(RenderPipeline& pipeline) = 0;
             virtual void resize([[maybe_unused]] unsigned int width, [[maybe_unused]] unsigned int height) {};
@@ -45,6 +49,10 @@ namespace nexo::renderer {
             [[nodiscard]] const std::vector<PassId> &getPrerequisites() const { return prerequisites; }
             std::vector<PassId> &getEffects() { return effects; }
             [[nodiscard]] const std::vector<PassId> &getEffects() const { return effects; }
+            std::vector<ResourceId> &getInputs() { return inputs; }
+            [[nodiscard]] const std::vector<ResourceId> &getInputs() const { return inputs; }
+            std::vector<ResourceId> &getOutputs() { return outputs; }
+            [[nodiscard]] const std::vector<ResourceId> &getOutputs() const { return outputs; }
 
             virtual std::shared_ptr<NxFramebuffer> getOutput() const { return nullptr; };
         protected:
@@ -56,5 +64,9 @@ namespace nexo::renderer {
             std::vector<PassId> prerequisites;
             // Effects - which passes this one enables
             std::vector<PassId> effects;
+            // Transient targets read by this pass, the outputs of its prerequisites are read implicitly
+            std::vector<ResourceId> inputs;
+            // Transient targets written by this pass
+            std::vector<ResourceId> outputs;
     };
 }
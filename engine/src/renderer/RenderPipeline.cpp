@@ -31,6 +31,7 @@ namespace nexo::renderer {
         // If this is the first pass, set it as the final output
         const PassId id = pass->getId();
         passes[id] = std::move(pass);
+        passes[id]->setup(*this);
         if (passes.size() == 1)
             setFinalOutputPass(id);
         m_isDirty = true;
@@ -147,6 +148,20 @@ namespace nexo::renderer {
         return m_renderTarget;
     }
 
+    ResourceId RenderPipeline::createTransientTarget(const NxFramebufferSpecs &specs)
+    {
+        m_transientTargets.push_back({specs});
+        m_isDirty = true;
+        return static_cast<ResourceId>(m_transientTargets.size() - 1);
+    }
+
+    std::shared_ptr<NxFramebuffer> RenderPipeline::getTransientTarget(const ResourceId id) const
+    {
+        if (id >= m_transientTargets.size())
+            return nullptr;
+        return m_transientTargets[id].framebuffer;
+    }
+
     void RenderPipeline::setFinalOutputPass(const PassId id)
     {
         if (passes.contains(id)) {
@@ -222,19 +237,104 @@ namespace nexo::renderer {
         return result;
     }
 
+    void RenderPipeline::computeTransientLifetimes()
+    {
+        for (auto &target : m_transientTargets) {
+            target.firstUse = -1;
+            target.lastUse = -1;
+        }
+        const auto use = [this](const ResourceId id, const int index) {
+            if (id >= m_transientTargets.size())
+                return;
+            auto &target = m_transientTargets[id];
+            if (target.firstUse == -1)
+                target.firstUse = index;
+            target.lastUse = index;
+        };
+
+        for (int index = 0; index < static_cast<int>(m_plan.size()); ++index) {
+            const auto it = passes.find(m_plan[index]);
+            if (it == passes.end())
+                continue;
+            const auto &pass = it->second;
+            for (const ResourceId output : pass->getOutputs())
+                use(output, index);
+            for (const ResourceId input : pass->getInputs())
+                use(input, index);
+            for (const PassId prereq : pass->getPrerequisites()) {
+                if (const auto prereqIt = passes.find(prereq); prereqIt != passes.end())
+                    for (const ResourceId output : prereqIt->second->getOutputs())
+                        use(output, index);
+            }
+        }
+    }
+
     void RenderPipeline::execute()
     {
-        if (m_isDirty)
+        const NxPipelineFrame frame = takeFrame();
+        execute(frame);
+    }
+
+    NxPipelineFrame RenderPipeline::takeFrame()
+    {
+        NxPipelineFrame frame;
+        frame.drawCommands = std::move(m_drawCommands);
+        frame.sharedDrawCommands = std::move(m_sharedDrawCommands);
+        // View uniforms are kept across frames
+        frame.viewUniforms = m_viewUniforms;
+        frame.clearColor = m_cameraClearColor;
+        frame.lightClusters = &m_lightClusters[m_lightClusterIndex];
+        m_lightClusterIndex ^= 1;
+        m_drawCommands.clear();
+        m_sharedDrawCommands.reset();
+        return frame;
+    }
+
+    const NxPipelineFrame &RenderPipeline::getFrame() const
+    {
+        return *m_frame;
+    }
+
+    void RenderPipeline::execute(const NxPipelineFrame &frame)
+    {
+        if (m_isDirty) {
             m_plan = createExecutionPlan();
+            computeTransientLifetimes();
+        }
 
         if (!m_renderTarget)
             THROW_EXCEPTION(NxPipelineRenderTargetNotSetException);
 
-        for (PassId id : m_plan) {
-            if (passes.contains(id))
-                passes[id]->execute(*this);
+        m_frame = &frame;
+        frame.lightClusters->upload();
+        frame.lightClusters->bind();
+
+        auto &pool = NxRenderTargetPool::get();
+        for (int index = 0; index < static_cast<int>(m_plan.size()); ++index) {
+            // Transient targets are only held from their first to their last use, so the ones whose lifetimes do
+            // not overlap (here or in another camera pipeline) can share the same framebuffer
+            for (auto &target : m_transientTargets) {
+                if (target.firstUse != index)
+                    continue;
+                NxFramebufferSpecs specs = target.specs;
+                if (!specs.width)
+                    specs.width = m_renderTarget->getSpecs().width;
+                if (!specs.height)
+                    specs.height = m_renderTarget->getSpecs().height;
+                target.framebuffer = pool.acquire(specs);
+            }
+
+            if (const auto it = passes.find(m_plan[index]); it != passes.end())
+                it->second->execute(*this);
+
+            for (auto &target : m_transientTargets) {
+                if (target.lastUse != index || !target.framebuffer)
+                    continue;
+                pool.release(target.framebuffer);
+                target.framebuffer.reset();
+            }
         }
-        m_drawCommands.clear();
+        m_frame = nullptr;
     }
 
     void RenderPipeline::addDrawCommands(const std::vector<DrawCommand>& drawCommands)
@@ -248,11 +348,72 @@ namespace nexo::renderer {
         m_drawCommands.push_back(drawCommand);
     }
 
+    void RenderPipeline::addDrawCommand(DrawCommand&& drawCommand)
+    {
+        m_drawCommands.push_back(std::move(drawCommand));
+    }
+
     const std::vector<DrawCommand>& RenderPipeline::getDrawCommands() const
     {
         return m_drawCommands;
     }
 
+    void RenderPipeline::setSharedDrawCommands(std::shared_ptr<const SharedDrawCommands> drawCommands)
+    {
+        m_sharedDrawCommands = std::move(drawCommands);
+    }
+
+    const std::shared_ptr<const SharedDrawCommands>& RenderPipeline::getSharedDrawCommands() const
+    {
+        return m_sharedDrawCommands;
+    }
+
+    void RenderPipeline::setViewUniform(const std::string_view name, const UniformValue& value)
+    {
+        DrawCommand::setUniform(m_viewUniforms, name, value);
+    }
+
+    const UniformMap& RenderPipeline::getViewUniforms() const
+    {
+        return m_viewUniforms;
+    }
+
+    void RenderPipeline::executeDrawCommands(const uint32_t filterMask) const
+    {
+        const NxPipelineFrame &frame = getFrame();
+        // The passes bind the first texture page, the frame only has more when it uses more textures than slots
+        uint32_t boundPage = 0;
+        const auto bindTexturePage = [&frame, &boundPage](const uint32_t page) {
+            if (page == boundPage)
+                return;
+            NxRenderer3D::bindTextures(frame.textures, page);
+            boundPage = page;
+        };
+
+        if (frame.sharedDrawCommands) {
+            for (const auto &cmd : frame.sharedDrawCommands->commands) {
+                if (!(cmd.filterMask & filterMask))
+                    continue;
+                bindTexturePage(cmd.texturePage);
+                cmd.execute(&frame.sharedDrawCommands->uniforms, &frame.viewUniforms);
+            }
+            for (const auto &batch : frame.sharedDrawCommands->batches) {
+                if (!(batch.filterMask & filterMask))
+                    continue;
+                bindTexturePage(batch.texturePage);
+                frame.sharedDrawCommands->bindObjects();
+                batch.execute(&frame.sharedDrawCommands->uniforms, &frame.viewUniforms);
+            }
+        }
+        for (const auto &cmd : frame.drawCommands) {
+            if (!(cmd.filterMask & filterMask))
+                continue;
+            bindTexturePage(cmd.texturePage);
+            cmd.execute(nullptr, &frame.viewUniforms);
+        }
+        bindTexturePage(0);
+    }
+
     void RenderPipeline::setCameraClearColor(const glm::vec4& clearColor)
     {
         m_cameraClearColor = clearColor;
@@ -268,6 +429,7 @@ namespace nexo::renderer {
         if (!m_renderTarget)
             return;
         m_renderTarget->resize(width, height);
+        // Transient targets are not resized here, they follow the render target size when next acquired
         for (const auto& [_, pass] : passes)
             pass->resize(width, height);
     }
@@ -19,12 +19,32 @@
 #include "Framebuffer.hpp"
 #include "RenderPass.hpp"
 #include "DrawCommand.hpp"
+#include "LightClusters.hpp"
+#include "OcclusionCuller.hpp"
+#include "RenderTargetPool.hpp"
+#include <array>
+#include <span>
 #include <vector>
 #include <unordered_map>
 #include <memory>
 
 namespace nexo::renderer {
 
+    /**
+     * @brief Frame state of a pipeline, moved out of it once the frame is built.
+     *
+     * The passes read the frame through `RenderPipeline::getFrame` while it executes, so the next frame can be built
+     * in the pipeline at the same time (see `NxRenderPacket`).
+     */
+    struct NxPipelineFrame {
+        std::vector<DrawCommand> drawCommands;
+        std::shared_ptr<const SharedDrawCommands> sharedDrawCommands = nullptr;
+        UniformMap viewUniforms;
+        glm::vec4 clearColor{};
+        NxLightClusterGrid *lightClusters = nullptr;
+        std::span<const std::shared_ptr<NxTexture2D>> textures; //< Texture slots the draw commands index
+    };
+
     class RenderPipeline {
         public:
             // Add a render pass to the pipeline
@@ -48,9 +68,17 @@ namespace nexo::renderer {
             // Get a render pass by ID
             std::shared_ptr<RenderPass> getRenderPass(PassId id);
 
+            // Every pass of the pipeline, keyed by ID
+            const std::unordered_map<PassId, std::shared_ptr<RenderPass>> &getRenderPasses() const { return passes; }
+
             void setRenderTarget(std::shared_ptr<NxFramebuffer> finalRenderTarget);
             std::shared_ptr<NxFramebuffer> getRenderTarget() const;
 
+            // Declare a transient target, a width or height of 0 follows the size of the render target
+            ResourceId createTransientTarget(const NxFramebufferSpecs &specs);
+            // Framebuffer backing a transient target, only set while the passes using it execute
+            std::shared_ptr<NxFramebuffer> getTransientTarget(ResourceId id) const;
+
             // Set the final output pass
             void setFinalOutputPass(PassId id);
 
@@ -60,9 +88,18 @@ namespace nexo::renderer {
             // Calculate execution plan using DFS
             std::vector<PassId> createExecutionPlan();
 
-            // Execute the pipeline
+            // Execute the pipeline on the frame built so far
             void execute();
 
+            // Move the frame built so far out of the pipeline, which starts building the next one
+            NxPipelineFrame takeFrame();
+
+            // Execute the pipeline on a frame taken from it, the frame must outlive the call
+            void execute(const NxPipelineFrame &frame);
+
+            // Frame being executed, only valid inside the passes
+            const NxPipelineFrame &getFrame() const;
+
             // Find terminal passes (passes with no effects)
             std::vector<PassId> findTerminalPasses() const;
 
@@ -74,15 +111,53 @@ namespace nexo::renderer {
 
             void addDrawCommands(const std::vector<DrawCommand> &drawCommands);
             void addDrawCommand(const DrawCommand &drawCommand);
+            void addDrawCommand(DrawCommand &&drawCommand);
             const std::vector<DrawCommand> &getDrawCommands() const;
 
+            // Reference the frame's shared draw commands (not copied, released after execute)
+            void setSharedDrawCommands(std::shared_ptr<const SharedDrawCommands> drawCommands);
+            const std::shared_ptr<const SharedDrawCommands> &getSharedDrawCommands() const;
+
+            // Set a uniform bound to every command of this view (camera), kept across frames
+            void setViewUniform(std::string_view name, const UniformValue &value);
+            const UniformMap &getViewUniforms() const;
+
+            // Execute the shared then the pipeline-owned draw commands of the executing frame matching the filter mask
+            void executeDrawCommands(uint32_t filterMask) const;
+
+            // Lights of the view binned in clusters, uploaded and bound when the frame executes. Double-buffered so
+            // the frame being built does not overwrite the one executing
+            NxLightClusterGrid &getLightClusters() { return m_lightClusters[m_lightClusterIndex]; }
+            const NxLightClusterGrid &getLightClusters() const { return m_lightClusters[m_lightClusterIndex]; }
+
+            // Software depth buffer of the view, filled with the occluders while building the draw commands
+            NxOcclusionCuller &getOcclusionCuller() { return m_occlusionCuller; }
+            const NxOcclusionCuller &getOcclusionCuller() const { return m_occlusionCuller; }
+
             void setCameraClearColor(const glm::vec4 &clearColor);
             const glm::vec4 &getCameraClearColor() const;
 
             void resize(unsigned int width, unsigned int height) const;
 
         private:
+            // Compute the range of the plan each transient target must stay allocated for
+            void computeTransientLifetimes();
+
+            struct TransientTarget {
+                NxFramebufferSpecs specs;
+                std::shared_ptr<NxFramebuffer> framebuffer = nullptr;
+                int firstUse = -1;
+                int lastUse = -1;
+            };
+            std::vector<TransientTarget> m_transientTargets;
+
             std::vector<DrawCommand> m_drawCommands;
+            std::shared_ptr<const SharedDrawCommands> m_sharedDrawCommands = nullptr;
+            UniformMap m_viewUniforms;
+            std::array<NxLightClusterGrid, 2> m_lightClusters;
+            unsigned int m_lightClusterIndex = 0;
+            const NxPipelineFrame *m_frame = nullptr;
+            NxOcclusionCuller m_occlusionCuller;
             glm::vec4 m_cameraClearColor{};
             std::vector<PassId> m_plan{};
             bool m_isDirty = true;
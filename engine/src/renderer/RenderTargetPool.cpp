@@ -0,0 +1,102 @@
+//// RenderTargetPool.cpp /////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the shared pool of transient render targets
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "RenderTargetPool.hpp"
+
+#include <algorithm>
+
+namespace nexo::renderer {
+
+    static bool sameAttachments(const NxFramebufferSpecs &a, const NxFramebufferSpecs &b)
+    {
+        if (a.samples != b.samples || a.attachments.attachments.size() != b.attachments.attachments.size())
+            return false;
+        return std::ranges::equal(a.attachments.attachments, b.attachments.attachments,
+                                  [](const auto &lhs, const auto &rhs) { return lhs.textureFormat == rhs.textureFormat; });
+    }
+
+    NxRenderTargetPool &NxRenderTargetPool::get()
+    {
+        static NxRenderTargetPool instance;
+        return instance;
+    }
+
+    std::shared_ptr<NxFramebuffer> NxRenderTargetPool::acquire(const NxFramebufferSpecs &specs)
+    {
+        PooledTarget *resizable = nullptr;
+        for (auto &target : m_targets) {
+            if (target.inUse)
+                continue;
+            const auto &targetSpecs = target.framebuffer->getSpecs();
+            if (!sameAttachments(targetSpecs, specs))
+                continue;
+            if (targetSpecs.width == specs.width && targetSpecs.height == specs.height) {
+                target.inUse = true;
+                target.lastUsedFrame = m_frame;
+                return target.framebuffer;
+            }
+            // Only framebuffers idle since the previous frame are resized, those used this frame are likely to be
+            // requested again with their current size by another view
+            if (target.lastUsedFrame < m_frame && (!resizable || target.lastUsedFrame < resizable->lastUsedFrame))
+                resizable = &target;
+        }
+
+        if (resizable) {
+            resizable->framebuffer->resize(specs.width, specs.height);
+            resizable->inUse = true;
+            resizable->lastUsedFrame = m_frame;
+            return resizable->framebuffer;
+        }
+
+        auto &target = m_targets.emplace_back();
+        target.framebuffer = NxFramebuffer::create(specs);
+        target.inUse = true;
+        target.lastUsedFrame = m_frame;
+        return target.framebuffer;
+    }
+
+    void NxRenderTargetPool::release(const std::shared_ptr<NxFramebuffer> &framebuffer)
+    {
+        const auto it = std::ranges::find_if(m_targets, [&framebuffer](const PooledTarget &target) {
+            return target.framebuffer == framebuffer;
+        });
+        if (it != m_targets.end())
+            it->inUse = false;
+    }
+
+    void NxRenderTargetPool::endFrame(const unsigned int maxIdleFrames)
+    {
+        ++m_frame;
+        std::erase_if(m_targets, [this, maxIdleFrames](const PooledTarget &target) {
+            return !target.inUse && m_frame - target.lastUsedFrame > maxIdleFrames;
+        });
+    }
+
+    void NxRenderTargetPool::clear()
+    {
+        std::erase_if(m_targets, [](const PooledTarget &target) { return !target.inUse; });
+    }
+
+    size_t NxRenderTargetPool::getTargetsInUse() const
+    {
+        return static_cast<size_t>(std::ranges::count_if(m_targets, [](const PooledTarget &target) {
+            return target.inUse;
+        }));
+    }
+
+}
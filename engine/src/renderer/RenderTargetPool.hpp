@@ -0,0 +1,85 @@
+//// RenderTargetPool.hpp /////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the shared pool of transient render targets
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Framebuffer.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @class NxRenderTargetPool
+     * @brief Shared pool of the framebuffers render passes only need while a pipeline executes.
+     *
+     * Render pipelines declare their intermediate targets (e.g. the outline mask) as transient resources and
+     * acquire a physical framebuffer from this pool right before the first pass using it, then release it after
+     * the last one. A framebuffer matching the attachments, size and samples of the request is reused, so targets
+     * whose lifetimes do not overlap alias the same memory, within a pipeline and across every camera.
+     *
+     * Size changes are handled lazily: a request with a new size resizes an idle framebuffer with the same
+     * attachments instead of creating one, and `endFrame` destroys the framebuffers left unused for a few frames.
+     *
+     * @note Framebuffers are created on the rendering thread, the pool is not thread safe.
+     */
+    class NxRenderTargetPool {
+        public:
+            static NxRenderTargetPool &get();
+
+            /**
+             * @brief Returns a free framebuffer matching the specifications, creating one if none can be reused.
+             *
+             * The framebuffer stays reserved until it is given back with `release`.
+             */
+            std::shared_ptr<NxFramebuffer> acquire(const NxFramebufferSpecs &specs);
+
+            /**
+             * @brief Gives a framebuffer back to the pool, its content may be overwritten by the next user.
+             */
+            void release(const std::shared_ptr<NxFramebuffer> &framebuffer);
+
+            /**
+             * @brief Advances the frame counter and destroys the free framebuffers unused for `maxIdleFrames` frames.
+             */
+            void endFrame(unsigned int maxIdleFrames = 3);
+
+            /**
+             * @brief Destroys every free framebuffer.
+             */
+            void clear();
+
+            [[nodiscard]] size_t getTargetCount() const { return m_targets.size(); }
+            [[nodiscard]] size_t getTargetsInUse() const;
+
+        private:
+            NxRenderTargetPool() = default;
+
+            struct PooledTarget {
+                std::shared_ptr<NxFramebuffer> framebuffer;
+                bool inUse = false;
+                uint64_t lastUsedFrame = 0;
+            };
+
+            std::vector<PooledTarget> m_targets;
+            uint64_t m_frame = 0;
+    };
+
+}
@@ -0,0 +1,168 @@
+//// RenderThread /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the render thread and its render packets
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "RenderThread.hpp"
+#include "Renderer3D.hpp"
+
+#include <utility>
+
+namespace nexo::renderer {
+
+    void NxRenderPacket::addView(RenderPipeline &pipeline)
+    {
+        views.push_back({&pipeline, pipeline.takeFrame()});
+    }
+
+    void NxRenderPacket::execute()
+    {
+        for (auto &[pipeline, frame] : views) {
+            frame.textures = textures;
+            pipeline->execute(frame);
+        }
+        // We have to unbind after every pipeline since multiple passes can use the same textures
+        NxRenderer3D::unbindTextures(textures);
+        if (presentWindow)
+            presentWindow->swapBuffers();
+    }
+
+    NxRenderThread::NxRenderThread(std::shared_ptr<NxWindow> window) : m_window(std::move(window))
+    {
+    }
+
+    NxRenderThread::~NxRenderThread()
+    {
+        if (!isRunning())
+            return;
+        try {
+            stop();
+        } catch (...) {
+            // The error of the last packet has nobody left to be reported to
+        }
+    }
+
+    void NxRenderThread::start()
+    {
+        if (isRunning())
+            return;
+        m_callerOwnsContext = true;
+        m_thread = std::thread(&NxRenderThread::threadLoop, this);
+    }
+
+    void NxRenderThread::stop()
+    {
+        if (!isRunning())
+            return;
+        {
+            std::unique_lock lock(m_mutex);
+            waitIdle(lock);
+            m_stopping = true;
+        }
+        m_condition.notify_all();
+        m_thread.join();
+        m_stopping = false;
+        sync();
+    }
+
+    NxRenderThread::Clock::duration NxRenderThread::waitIdle(std::unique_lock<std::mutex> &lock)
+    {
+        if (!m_busy)
+            return {};
+        const auto start = Clock::now();
+        m_condition.wait(lock, [this] { return !m_busy; });
+        return Clock::now() - start;
+    }
+
+    void NxRenderThread::submit(NxRenderPacket &&packet)
+    {
+        if (!isRunning()) {
+            const auto start = Clock::now();
+            packet.execute();
+            std::scoped_lock lock(m_mutex);
+            m_stats.executionTime = Clock::now() - start;
+            ++m_stats.packetCount;
+            return;
+        }
+
+        {
+            std::unique_lock lock(m_mutex);
+            m_stats.submitWaitTime = waitIdle(lock);
+            if (m_error)
+                std::rethrow_exception(std::exchange(m_error, nullptr));
+            if (m_callerOwnsContext) {
+                m_window->makeContextCurrent(false);
+                m_callerOwnsContext = false;
+            }
+            m_pendingPacket.emplace(std::move(packet));
+            m_busy = true;
+        }
+        m_condition.notify_all();
+    }
+
+    void NxRenderThread::sync()
+    {
+        std::unique_lock lock(m_mutex);
+        m_stats.syncWaitTime = waitIdle(lock);
+        if (!m_callerOwnsContext) {
+            m_window->makeContextCurrent(true);
+            m_callerOwnsContext = true;
+        }
+        if (m_error)
+            std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+
+    NxRenderThread::Stats NxRenderThread::getStats() const
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_stats;
+    }
+
+    void NxRenderThread::threadLoop()
+    {
+        std::unique_lock lock(m_mutex);
+        while (true) {
+            m_condition.wait(lock, [this] { return m_pendingPacket.has_value() || m_stopping; });
+            if (!m_pendingPacket)
+                return;
+            NxRenderPacket packet = std::move(*m_pendingPacket);
+            m_pendingPacket.reset();
+            lock.unlock();
+
+            m_window->makeContextCurrent(true);
+            const auto start = Clock::now();
+            std::exception_ptr error = nullptr;
+            try {
+                packet.execute();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            const auto executionTime = Clock::now() - start;
+            // Release the frame while the context is current, it may hold the last reference to graphics resources
+            packet = NxRenderPacket{};
+            m_window->makeContextCurrent(false);
+
+            lock.lock();
+            m_error = error;
+            m_stats.executionTime = executionTime;
+            ++m_stats.packetCount;
+            m_busy = false;
+            m_condition.notify_all();
+        }
+    }
+
+}
@@ -0,0 +1,150 @@
+//// RenderThread /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the render thread and its render packets
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "RenderPipeline.hpp"
+#include "Texture.hpp"
+#include "Window.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @brief Everything needed to submit a frame, built by the main thread and executed as is by the render thread.
+     *
+     * The pipelines are referenced, not copied: their frame state is moved into the views (see
+     * `RenderPipeline::takeFrame`), so the main thread can build the next frame in them while this one executes. They
+     * must stay alive until the packet has been executed, which `NxRenderThread::sync` waits for.
+     */
+    struct NxRenderPacket {
+        struct View {
+            RenderPipeline *pipeline = nullptr;
+            NxPipelineFrame frame;
+        };
+
+        std::vector<View> views;
+        std::vector<std::shared_ptr<NxTexture2D>> textures; ///< Texture slots indexed by the draw commands
+        std::shared_ptr<NxWindow> presentWindow = nullptr;  ///< Window presented once every view is executed
+
+        /**
+         * @brief Moves the frame built in a pipeline into a new view of the packet.
+         */
+        void addView(RenderPipeline &pipeline);
+
+        /**
+         * @brief Executes every view in order, then presents the window if there is one.
+         *
+         * Must be called from the thread the graphics context is current on.
+         */
+        void execute();
+    };
+
+    /**
+     * @class NxRenderThread
+     * @brief Thread submitting the render packets built by the main thread.
+     *
+     * Packets are double-buffered: the render thread executes frame N while the main thread simulates and builds
+     * frame N + 1, `submit` only waits when frame N is still executing once N + 1 is ready.
+     *
+     * The graphics context goes with the packet: `submit` releases it from the main thread and the render thread
+     * makes it current while it executes. The main thread must call `sync` before issuing any graphics call of its
+     * own (resource creation, UI rendering, read backs...), which waits for the packet in flight and takes the
+     * context back.
+     *
+     * When the thread is not started, `submit` executes the packet right away on the calling thread.
+     */
+    class NxRenderThread {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            explicit NxRenderThread(std::shared_ptr<NxWindow> window);
+            ~NxRenderThread();
+
+            NxRenderThread(const NxRenderThread &) = delete;
+            NxRenderThread &operator=(const NxRenderThread &) = delete;
+            NxRenderThread(NxRenderThread &&) = delete;
+            NxRenderThread &operator=(NxRenderThread &&) = delete;
+
+            /**
+             * @brief Starts the render thread, the calling thread must be the one the context is current on.
+             */
+            void start();
+
+            /**
+             * @brief Waits for the packet in flight and joins the thread, the context is current on the caller after.
+             */
+            void stop();
+
+            [[nodiscard]] bool isRunning() const { return m_thread.joinable(); }
+
+            /**
+             * @brief Hands a packet over to the render thread.
+             *
+             * Waits for the previous packet first, then releases the context from the calling thread.
+             *
+             * @param packet Packet of the frame built by the caller.
+             */
+            void submit(NxRenderPacket &&packet);
+
+            /**
+             * @brief Waits for the packet in flight and makes the context current on the calling thread again.
+             *
+             * Rethrows the exception the last packet failed with, if any. Cheap when nothing is in flight.
+             */
+            void sync();
+
+            struct Stats {
+                Clock::duration executionTime{};  ///< Time the last packet took to execute
+                Clock::duration submitWaitTime{}; ///< Time the last submit waited for the previous packet
+                Clock::duration syncWaitTime{};   ///< Time the last sync waited for the packet in flight
+                size_t packetCount = 0;
+            };
+
+            /**
+             * @brief Returns the timings of the last packet, only consistent after a sync.
+             */
+            [[nodiscard]] Stats getStats() const;
+
+        private:
+            void threadLoop();
+            // Waits for the packet in flight, returns the time spent waiting
+            Clock::duration waitIdle(std::unique_lock<std::mutex> &lock);
+
+            std::shared_ptr<NxWindow> m_window;
+            std::thread m_thread;
+            bool m_callerOwnsContext = true;
+
+            mutable std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::optional<NxRenderPacket> m_pendingPacket;
+            bool m_busy = false;
+            bool m_stopping = false;
+            std::exception_ptr m_error = nullptr;
+            Stats m_stats;
+    };
+
+}
@@ -19,12 +19,18 @@
 #include "ShaderLibrary.hpp"
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/string_cast.hpp>
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <cstring>
 
 #include "Renderer3D.hpp"
 #include "RenderCommand.hpp"
+#include "TextureRegistry.hpp"
+#include "TextureUploadQueue.hpp"
 #include "Logger.hpp"
 #include "Shader.hpp"
+#include "VertexFormat.hpp"
 #include "renderer/RendererExceptions.hpp"
 #include <glad/glad.h>
 #include "Path.hpp"
@@ -35,11 +41,52 @@ namespace nexo::renderer {
     {
         m_storage = std::make_shared<NxRenderer3DStorage>();
 
-        m_storage->vertexArray = createVertexArray();
-        m_storage->vertexBuffer = createVertexBuffer(m_storage->maxVertices * sizeof(NxVertex));
+        m_storage->vertexRing.setBuffer(
+            createStreamBuffer(NxRenderer3DStorage::initialStreamVertices * sizeof(NxVertex)));
+        m_storage->indexRing.setBuffer(
+            createStreamBuffer(NxRenderer3DStorage::initialStreamIndices * sizeof(unsigned int)));
+        createStreamVertexArray();
+
+        // Texture
+        m_storage->whiteTexture = NxTexture2D::create(1, 1);
+        unsigned int whiteTextureData = 0xffffffff;
+        m_storage->whiteTexture->setData(&whiteTextureData, sizeof(unsigned int));
+        NxTextureUploadQueue::get().setPlaceholder(m_storage->whiteTexture);
+
+        // Shader
+        static constexpr std::array<const char *, 3> texturedShaders = {
+            "Phong", "Outline pulse transparent flat", "Albedo unshaded transparent"
+        };
+        const auto setupSamplers = [](const std::shared_ptr<NxShader> &shader) {
+            std::array<int, NxRenderer3DStorage::maxTextureSlots> samplers{};
+            for (int i = 0; i < static_cast<int>(NxRenderer3DStorage::maxTextureSlots); ++i)
+                samplers[i] = i;
+            shader->bind();
+            shader->setUniformIntArray(NxShaderUniforms::TEXTURE_SAMPLER, samplers.data(), NxRenderer3DStorage::maxTextureSlots);
+            shader->unbind();
+        };
+        for (const char *name : texturedShaders)
+            setupSamplers(ShaderLibrary::getInstance().get(name));
+
+        // Hot reloaded programs start with every uniform reset
+        static bool reloadListenerRegistered = false;
+        if (!reloadListenerRegistered) {
+            ShaderLibrary::getInstance().addReloadListener(
+                [setupSamplers](const std::string &name, const std::shared_ptr<NxShader> &shader) {
+                    if (std::ranges::find(texturedShaders, name) != texturedShaders.end())
+                        setupSamplers(shader);
+                });
+            reloadListenerRegistered = true;
+        }
 
-        // Layout
-        const NxBufferLayout cubeVertexBufferLayout = {
+        m_storage->textureSlots.push_back(m_storage->whiteTexture);
+
+        LOG(NEXO_DEV, "NxRenderer3D initialized");
+    }
+
+    void NxRenderer3D::createStreamVertexArray() const
+    {
+        const NxBufferLayout vertexLayout = {
             {NxShaderDataType::FLOAT3, "aPos"},
             {NxShaderDataType::FLOAT2, "aTexCoord"},
             {NxShaderDataType::FLOAT3, "aNormal"},
@@ -47,38 +94,11 @@ namespace nexo::renderer {
             {NxShaderDataType::FLOAT3, "aBiTangent"},
             {NxShaderDataType::INT, "aEntityID"}
         };
-        m_storage->vertexBuffer->setLayout(cubeVertexBufferLayout);
+        m_storage->vertexArray = createVertexArray();
+        m_storage->vertexBuffer = createStreamVertexBuffer(m_storage->vertexRing.getBuffer(), vertexLayout);
         m_storage->vertexArray->addVertexBuffer(m_storage->vertexBuffer);
-
-        m_storage->indexBuffer = createIndexBuffer();
+        m_storage->indexBuffer = createStreamIndexBuffer(m_storage->indexRing.getBuffer());
         m_storage->vertexArray->setIndexBuffer(m_storage->indexBuffer);
-
-        // Texture
-        m_storage->whiteTexture = NxTexture2D::create(1, 1);
-        unsigned int whiteTextureData = 0xffffffff;
-        m_storage->whiteTexture->setData(&whiteTextureData, sizeof(unsigned int));
-
-        // Shader
-        std::array<int, NxRenderer3DStorage::maxTextureSlots> samplers{};
-        for (int i = 0; i < static_cast<int>(NxRenderer3DStorage::maxTextureSlots); ++i)
-            samplers[i] = i;
-
-        const auto phong = ShaderLibrary::getInstance().get("Phong");
-        const auto outlinePulseTransparentFlat = ShaderLibrary::getInstance().get("Outline pulse transparent flat");
-        const auto albedoUnshadedTransparent = ShaderLibrary::getInstance().get("Albedo unshaded transparent");
-        phong->bind();
-        phong->setUniformIntArray(NxShaderUniforms::TEXTURE_SAMPLER, samplers.data(), NxRenderer3DStorage::maxTextureSlots);
-        phong->unbind();
-        outlinePulseTransparentFlat->bind();
-        outlinePulseTransparentFlat->setUniformIntArray(NxShaderUniforms::TEXTURE_SAMPLER, samplers.data(), NxRenderer3DStorage::maxTextureSlots);
-        outlinePulseTransparentFlat->unbind();
-        albedoUnshadedTransparent->bind();
-        albedoUnshadedTransparent->setUniformIntArray(NxShaderUniforms::TEXTURE_SAMPLER, samplers.data(), NxRenderer3DStorage::maxTextureSlots);
-        albedoUnshadedTransparent->unbind();
-
-        m_storage->textureSlots[0] = m_storage->whiteTexture;
-
-        LOG(NEXO_DEV, "NxRenderer3D initialized");
     }
 
     void NxRenderer3D::shutdown()
@@ -88,21 +108,50 @@ namespace nexo::renderer {
         m_storage.reset();
     }
 
+    /**
+     * @brief Textures of a page of slots, empty when there is no such page.
+     */
+    static std::span<const std::shared_ptr<NxTexture2D>> texturePage(
+        const std::span<const std::shared_ptr<NxTexture2D>> textures, const unsigned int page)
+    {
+        const size_t first = static_cast<size_t>(page) * NxRenderer3DStorage::maxTextureSlots;
+        if (first >= textures.size())
+            return {};
+        return textures.subspan(first, std::min<size_t>(NxRenderer3DStorage::maxTextureSlots, textures.size() - first));
+    }
+
     void NxRenderer3D::bindTextures() const
     {
-        for (unsigned int i = 0; i < m_storage->textureSlotIndex; ++i)
-        {
-            m_storage->textureSlots[i]->bind(i);
-        }
+        bindTextures(m_storage->textureSlots, m_storage->texturePage);
     }
 
     void NxRenderer3D::unbindTextures() const
     {
-        for (unsigned int i = 0; i < m_storage->textureSlotIndex; ++i)
-        {
-            m_storage->textureSlots[i]->unbind(i);
-        }
-        m_storage->textureSlotIndex = 1;
+        unbindTextures(m_storage->textureSlots, m_storage->texturePage);
+        resetTextureSlots();
+    }
+
+    void NxRenderer3D::bindTextures(const std::span<const std::shared_ptr<NxTexture2D>> textures, const unsigned int page)
+    {
+        const auto pageTextures = texturePage(textures, page);
+        for (unsigned int i = 0; i < pageTextures.size(); ++i)
+            pageTextures[i]->bind(i);
+    }
+
+    void NxRenderer3D::unbindTextures(const std::span<const std::shared_ptr<NxTexture2D>> textures, const unsigned int page)
+    {
+        const auto pageTextures = texturePage(textures, page);
+        for (unsigned int i = 0; i < pageTextures.size(); ++i)
+            pageTextures[i]->unbind(i);
+    }
+
+    std::vector<std::shared_ptr<NxTexture2D>> NxRenderer3D::takeTextureSlots() const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+        std::vector<std::shared_ptr<NxTexture2D>> textures = m_storage->textureSlots;
+        resetTextureSlots();
+        return textures;
     }
 
     void NxRenderer3D::beginScene(const glm::mat4 &viewProjection, const glm::vec3 &cameraPos, const std::string &shader)
@@ -119,10 +168,13 @@ namespace nexo::renderer {
         m_storage->currentSceneShader->setUniformMatrix("uViewProjection", viewProjection);
         m_storage->cameraPosition = cameraPos;
         m_storage->currentSceneShader->setUniformFloat3("uCamPos", cameraPos);
+        // The batch holds standard vertices, whatever format the last mesh drawn with this shader had
+        m_storage->currentSceneShader->setUniformInt("uVertexFormat", static_cast<int>(NxVertexFormat::STANDARD));
+        // Geometry left over by a scene that was not ended is dropped
         m_storage->indexCount = 0;
-        m_storage->vertexBufferPtr = m_storage->vertexBufferBase.data();
-        m_storage->indexBufferPtr = m_storage->indexBufferBase.data();
-        m_storage->textureSlotIndex = 1;
+        m_storage->vertexRing.close();
+        m_storage->indexRing.close();
+        resetTextureSlots();
         m_renderingScene = true;
     }
 
@@ -133,70 +185,186 @@ namespace nexo::renderer {
         if (!m_renderingScene)
             THROW_EXCEPTION(NxRendererSceneLifeCycleFailure, NxRendererType::RENDERER_3D,
                         "Renderer not rendering a scene, make sure to call beginScene first");
-        const auto vertexDataSize = static_cast<unsigned int>(
-            reinterpret_cast<std::byte*>(m_storage->vertexBufferPtr) -
-            reinterpret_cast<std::byte*>(m_storage->vertexBufferBase.data())
-        );
+        flushAndReset();
+    }
 
+    void NxRenderer3D::drawGeometry(const std::span<const NxVertex> vertices,
+                                    const std::span<const unsigned int> indices) const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+        if (!m_renderingScene)
+            THROW_EXCEPTION(NxRendererSceneLifeCycleFailure, NxRendererType::RENDERER_3D,
+                        "Renderer not rendering a scene, make sure to call beginScene first");
+        if (vertices.empty() || indices.empty())
+            return;
+        appendGeometry(vertices, indices);
+        m_storage->indexCount += static_cast<unsigned int>(indices.size());
+    }
 
-        m_storage->vertexBuffer->setData(m_storage->vertexBufferBase.data(), vertexDataSize);
+    NxMeshRange NxRenderer3D::streamGeometry(const std::span<const NxVertex> vertices,
+                                             const std::span<const unsigned int> indices) const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+        if (m_renderingScene)
+            THROW_EXCEPTION(NxRendererSceneLifeCycleFailure, NxRendererType::RENDERER_3D,
+                        "Geometry cannot be streamed while rendering a scene, draw it with drawGeometry instead");
+        if (vertices.empty() || indices.empty())
+            return {};
+        appendGeometry(vertices, indices);
+        return {static_cast<uint32_t>(indices.size()), static_cast<uint32_t>(m_storage->indexRing.getRegionStart()),
+                static_cast<int32_t>(m_storage->vertexRing.getRegionStart())};
+    }
 
-        m_storage->indexBuffer->setData(m_storage->indexBufferBase.data(), m_storage->indexCount);
+    void NxRenderer3D::closeStreamedGeometry() const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+        m_storage->vertexRing.close();
+        m_storage->indexRing.close();
+    }
 
-        flushAndReset();
+    const std::shared_ptr<NxVertexArray> &NxRenderer3D::getStreamVertexArray() const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+        return m_storage->vertexArray;
+    }
+
+    void NxRenderer3D::appendGeometry(const std::span<const NxVertex> vertices,
+                                      const std::span<const unsigned int> indices) const
+    {
+        auto &storage = *m_storage;
+        const size_t stalls = storage.vertexRing.getStallCount() + storage.indexRing.getStallCount();
+        reserveGeometry(vertices.size(), indices.size());
+        const size_t firstVertex = storage.vertexRing.append(vertices.size());
+        const size_t firstIndex = storage.indexRing.append(indices.size());
+        storage.stats.dynamicStreamStalls += static_cast<unsigned int>(
+            storage.vertexRing.getStallCount() + storage.indexRing.getStallCount() - stalls);
+
+        std::memcpy(storage.vertexRing.getElement(firstVertex), vertices.data(), vertices.size_bytes());
+        // The batch is drawn with its first vertex as base vertex, indices are made relative to it
+        const auto batchOffset = static_cast<unsigned int>(firstVertex - storage.vertexRing.getRegionStart());
+        auto *batchIndices = reinterpret_cast<unsigned int *>(storage.indexRing.getElement(firstIndex));
+        for (size_t i = 0; i < indices.size(); ++i)
+            batchIndices[i] = indices[i] + batchOffset;
+
+        storage.stats.dynamicVertexCount += static_cast<unsigned int>(vertices.size());
+    }
+
+    void NxRenderer3D::reserveGeometry(const size_t vertexCount, const size_t indexCount) const
+    {
+        auto &storage = *m_storage;
+        if (storage.vertexRing.canAppend(vertexCount) && storage.indexRing.canAppend(indexCount))
+            return;
+        // The batch must stay contiguous: it is drawn before the rings wrap or grow. Texture slots are kept, the
+        // caller may already have been given its slots for the geometry
+        flush();
+        storage.indexCount = 0;
+
+        const auto grow = [](NxStreamRing &ring, const size_t count, const size_t elementSize,
+                             const size_t maxCapacity) {
+            const size_t capacity = ring.getCapacity();
+            if (ring.canAppend(count) || (count <= capacity && capacity >= maxCapacity))
+                return false;
+            // The GPU keeps reading the previous buffer, the driver releases it once it is done
+            const size_t newCapacity = std::max(std::bit_ceil(count), capacity * 2);
+            ring.setBuffer(createStreamBuffer(newCapacity * elementSize));
+            LOG(NEXO_DEV, "Dynamic geometry stream ring grown to {} elements", newCapacity);
+            return true;
+        };
+        const bool verticesGrown = grow(storage.vertexRing, vertexCount, sizeof(NxVertex),
+                                        NxRenderer3DStorage::maxStreamVertices);
+        const bool indicesGrown = grow(storage.indexRing, indexCount, sizeof(unsigned int),
+                                       NxRenderer3DStorage::maxStreamIndices);
+        if (verticesGrown || indicesGrown)
+            createStreamVertexArray();
     }
 
     void NxRenderer3D::flush() const
     {
+        if (m_storage->indexCount == 0)
+            return;
         m_storage->currentSceneShader->bind();
-        for (unsigned int i = 0; i < m_storage->textureSlotIndex; ++i)
-        {
-            m_storage->textureSlots[i]->bind(i);
-        }
-        NxRenderCommand::drawIndexed(m_storage->vertexArray, m_storage->indexCount);
+        bindTextures();
+        m_storage->vertexArray->bind();
+        NxRenderCommand::drawIndexed(m_storage->vertexArray, m_storage->indexCount,
+                                     m_storage->indexRing.getRegionStart(),
+                                     static_cast<int>(m_storage->vertexRing.getRegionStart()));
+        // Fenced once the draw is issued, the rings do not hand the batch out again before the GPU is done with it
+        m_storage->vertexRing.close();
+        m_storage->indexRing.close();
         m_storage->stats.drawCalls++;
         m_storage->vertexArray->unbind();
         m_storage->vertexBuffer->unbind();
         m_storage->currentSceneShader->unbind();
-        for (unsigned int i = 0; i < m_storage->textureSlotIndex; ++i)
-        {
-            m_storage->textureSlots[i]->unbind(i);
-        }
+        unbindTextures(m_storage->textureSlots, m_storage->texturePage);
     }
 
     void NxRenderer3D::flushAndReset() const
     {
         flush();
         m_storage->indexCount = 0;
-        m_storage->vertexBufferPtr = m_storage->vertexBufferBase.data();
-        m_storage->indexBufferPtr = m_storage->indexBufferBase.data();
-        m_storage->textureSlotIndex = 1;
+        resetTextureSlots();
     }
 
-    int NxRenderer3D::getTextureIndex(const std::shared_ptr<NxTexture2D> &texture) const
+    void NxRenderer3D::resetTextureSlots() const
     {
-        int textureIndex = 0;
-
-        if (!texture)
-            return textureIndex;
+        m_storage->textureSlots.resize(1);
+        m_storage->texturePage = 0;
+        m_storage->textureSlotIndex = 1;
+        // Invalidates every binding at once instead of clearing the table
+        ++m_storage->textureBindingStamp;
+    }
 
-        for (unsigned int i = 0; i < m_storage->textureSlotIndex; ++i)
-        {
-            if (*m_storage->textureSlots[i].get() == *texture)
-            {
-                textureIndex = static_cast<int>(i);
-                break;
-            }
+    void NxRenderer3D::startTexturePage() const
+    {
+        // The batch samples the current page, it is drawn before the slots are reused
+        if (m_renderingScene) {
+            flushAndReset();
+            return;
         }
+        auto &storage = *m_storage;
+        // Recorded commands bind their page by index, the pages before the last one are full
+        storage.textureSlots.resize(static_cast<size_t>(storage.texturePage + 1) * NxRenderer3DStorage::maxTextureSlots,
+                                    storage.whiteTexture);
+        storage.textureSlots.push_back(storage.whiteTexture);
+        ++storage.texturePage;
+        storage.textureSlotIndex = 1;
+        ++storage.textureBindingStamp;
+    }
 
-        if (textureIndex == 0)
-        {
-            textureIndex = static_cast<int>(m_storage->textureSlotIndex);
-            m_storage->textureSlots[m_storage->textureSlotIndex] = texture;
-            m_storage->textureSlotIndex++;
-        }
+    unsigned int NxRenderer3D::reserveTextureSlots(const unsigned int count) const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+        if (m_storage->textureSlotIndex + count > NxRenderer3DStorage::maxTextureSlots)
+            startTexturePage();
+        return m_storage->texturePage;
+    }
 
-        return textureIndex;
+    int NxRenderer3D::getTextureIndex(const std::shared_ptr<NxTexture2D> &texture) const
+    {
+        if (!texture || texture == m_storage->whiteTexture)
+            return 0;
+
+        NxTextureHandle handle = texture->getHandle();
+        if (handle == NX_INVALID_TEXTURE_HANDLE)
+            handle = NxTextureRegistry::get().add(texture);
+        if (handle >= m_storage->textureBindings.size())
+            m_storage->textureBindings.resize(std::max<size_t>(handle + 1, NxTextureRegistry::get().capacity()));
+
+        auto &binding = m_storage->textureBindings[handle];
+        if (binding.stamp == m_storage->textureBindingStamp)
+            return static_cast<int>(binding.slot);
+
+        if (m_storage->textureSlotIndex >= NxRenderer3DStorage::maxTextureSlots)
+            startTexturePage();
+        binding.stamp = m_storage->textureBindingStamp;
+        binding.slot = m_storage->textureSlotIndex;
+        m_storage->textureSlots.push_back(texture);
+        return static_cast<int>(m_storage->textureSlotIndex++);
     }
 
     void NxRenderer3D::setMaterialUniforms(const NxIndexedMaterial& material) const
@@ -224,6 +392,14 @@ namespace nexo::renderer {
             THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
         m_storage->stats.drawCalls = 0;
         m_storage->stats.cubeCount = 0;
+        m_storage->stats.occlusionTestedCount = 0;
+        m_storage->stats.occludedCount = 0;
+        m_storage->stats.simplifiedMeshCount = 0;
+        m_storage->stats.batchCount = 0;
+        m_storage->stats.batchedMeshCount = 0;
+        m_storage->stats.indirectBuildTimeMs = 0.0f;
+        m_storage->stats.dynamicVertexCount = 0;
+        m_storage->stats.dynamicStreamStalls = 0;
     }
 
     NxRenderer3DStats NxRenderer3D::getStats() const
@@ -233,4 +409,29 @@ namespace nexo::renderer {
         return m_storage->stats;
     }
 
+    void NxRenderer3D::setOcclusionStats(const unsigned int testedCount, const unsigned int occludedCount) const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+        m_storage->stats.occlusionTestedCount = testedCount;
+        m_storage->stats.occludedCount = occludedCount;
+    }
+
+    void NxRenderer3D::setLodStats(const unsigned int simplifiedCount) const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+        m_storage->stats.simplifiedMeshCount = simplifiedCount;
+    }
+
+    void NxRenderer3D::setBatchStats(const unsigned int batchCount, const unsigned int batchedMeshCount,
+                                     const float indirectBuildTimeMs) const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+        m_storage->stats.batchCount = batchCount;
+        m_storage->stats.batchedMeshCount = batchedMeshCount;
+        m_storage->stats.indirectBuildTimeMs = indirectBuildTimeMs;
+    }
+
 }
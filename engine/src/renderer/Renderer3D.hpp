@@ -20,8 +20,11 @@
 #include "Shader.hpp"
 #include "VertexArray.hpp"
 #include "Texture.hpp"
+#include "StreamBuffer.hpp"
 
 #include <array>
+#include <span>
+#include <vector>
 #include <glm/glm.hpp>
 
 namespace nexo::renderer
@@ -77,6 +80,18 @@ namespace nexo::renderer
     {
         unsigned int drawCalls = 0;
         unsigned int cubeCount = 0;
+        // Meshes tested against the occluders and meshes skipped by the occlusion culling, over every camera
+        unsigned int occlusionTestedCount = 0;
+        unsigned int occludedCount = 0;
+        // Meshes drawn with a simplified level of detail, over every camera
+        unsigned int simplifiedMeshCount = 0;
+        // Multi draw indirect batches of the frame, the meshes they draw and the CPU time spent building them
+        unsigned int batchCount = 0;
+        unsigned int batchedMeshCount = 0;
+        float indirectBuildTimeMs = 0.0f;
+        // Vertices of the dynamic geometry batch and waits for the GPU to release a part of its buffers
+        unsigned int dynamicVertexCount = 0;
+        unsigned int dynamicStreamStalls = 0;
 
         [[nodiscard]] unsigned int getTotalVertexCount() const { return cubeCount * 8; }
         [[nodiscard]] unsigned int getTotalIndexCount() const { return cubeCount * 36; }
@@ -87,40 +102,50 @@ namespace nexo::renderer
      * @brief Holds internal data and resources used by NxRenderer3D.
      *
      * Members:
-     * - `maxCubes`, `maxVertices`, `maxIndices`: Limits for cubes, vertices, and indices.
-     * - `vertexArray`, `vertexBuffer`, `indexBuffer`: Buffers for storing cube data.
+     * - `vertexRing`, `indexRing`: Stream buffers the dynamic geometry batch is written to, see `NxStreamRing`.
+     * - `vertexArray`, `vertexBuffer`, `indexBuffer`: Vertex array reading from the rings, rebuilt when they grow.
      * - `whiteTexture`: Default texture used for untextured objects.
      * - `textureShader`: Shader used for rendering.
-     * - `textureSlots`: Array of texture slots for batching textures.
-     * - `vertexBufferBase`, `indexBufferBase`: Base pointers for vertex and index data.
-     * - `vertexBufferPtr`, `indexBufferPtr`: Current pointers for batching vertices and indices.
+     * - `textureSlots`: Texture of each slot, in pages of `maxTextureSlots` starting with the white texture.
+     * - `texturePage`, `textureSlotIndex`: Page being filled and its next free slot.
+     * - `textureBindings`: Slot of each texture in the current page, indexed by texture registry handle.
+     * - `indexCount`: Number of indices in the batch, the open regions of the rings.
      * - `stats`: Rendering statistics.
      */
     struct NxRenderer3DStorage
     {
-        const unsigned int maxCubes = 10000;
-        const unsigned int maxVertices = maxCubes * 8;
-        const unsigned int maxIndices = maxCubes * 36;
         static constexpr unsigned int maxTextureSlots = 32;
         static constexpr unsigned int maxTransforms = 1024;
+        // The rings start small and double when the batch would otherwise wait for the GPU, up to the max sizes
+        static constexpr size_t initialStreamVertices = 4096;
+        static constexpr size_t initialStreamIndices = initialStreamVertices * 3;
+        static constexpr size_t maxStreamVertices = 1 << 18;
+        static constexpr size_t maxStreamIndices = 1 << 20;
 
         glm::vec3 cameraPosition;
 
         std::shared_ptr<NxShader> currentSceneShader = nullptr;
+        NxStreamRing vertexRing{sizeof(NxVertex)};
+        NxStreamRing indexRing{sizeof(unsigned int)};
         std::shared_ptr<NxVertexArray> vertexArray;
         std::shared_ptr<NxVertexBuffer> vertexBuffer;
         std::shared_ptr<NxIndexBuffer> indexBuffer;
         std::shared_ptr<NxTexture2D> whiteTexture;
 
         unsigned int indexCount = 0;
-        std::array<NxVertex, 80000> vertexBufferBase;
-        std::array<unsigned int, 360000> indexBufferBase;
-        NxVertex* vertexBufferPtr = nullptr;
-        unsigned int* indexBufferPtr = nullptr;
 
-        std::array<std::shared_ptr<NxTexture2D>, maxTextureSlots> textureSlots;
+        std::vector<std::shared_ptr<NxTexture2D>> textureSlots;
+        unsigned int texturePage = 0;
         unsigned int textureSlotIndex = 1;
 
+        /// Slot of a texture in the current batch, indexed by registry handle and valid while `stamp` matches
+        struct TextureBinding {
+            uint32_t stamp = 0;
+            unsigned int slot = 0;
+        };
+        std::vector<TextureBinding> textureBindings;
+        uint32_t textureBindingStamp = 1;
+
         NxRenderer3DStats stats;
     };
 
@@ -165,8 +190,8 @@ namespace nexo::renderer
          * Prepares the default white texture and initializes the texture shader.
          *
          * Responsibilities:
-         * - Creates and configures vertex and index buffers.
-         * - Allocates memory for vertex and index data.
+         * - Creates the stream rings of the dynamic geometry batch, at their initial size.
+         * - Creates and configures the vertex array reading from them.
          * - Sets up default white texture for rendering objects without textures.
          * - Configures the texture shader and binds texture samplers.
          *
@@ -191,11 +216,20 @@ namespace nexo::renderer
         void bindTextures() const;
         void unbindTextures() const;
 
+        /**
+         * @brief Binds the textures of a page to the slots matching their position in the page.
+         *
+         * @param textures Texture of each slot, as returned by takeTextureSlots.
+         * @param page Page to bind, nothing is bound when the span has no such page.
+         */
+        static void bindTextures(std::span<const std::shared_ptr<NxTexture2D>> textures, unsigned int page = 0);
+        static void unbindTextures(std::span<const std::shared_ptr<NxTexture2D>> textures, unsigned int page = 0);
+
         /**
          * @brief Begins a new 3D rendering scene.
          *
          * Sets up the view-projection matrix and camera position for rendering.
-         * Resets internal storage pointers for batching vertices and indices.
+         * Resets the dynamic geometry batch.
          *
          * @param viewProjection The combined view and projection matrix.
          * @param cameraPos The position of the camera in the scene.
@@ -209,8 +243,7 @@ namespace nexo::renderer
         /**
          * @brief Ends the current 3D rendering scene.
          *
-         * Uploads vertex and index data to the GPU, flushes the rendering pipeline,
-         * and resets buffers for the next frame.
+         * Flushes the dynamic geometry batch and resets it for the next scene.
          *
          * Throws:
          * - NxRendererNotInitialized if the renderer is not initialized.
@@ -218,6 +251,49 @@ namespace nexo::renderer
          */
         void endScene() const;
 
+        /**
+         * @brief Appends geometry to the dynamic batch of the scene, drawn with the scene shader.
+         *
+         * Meant for geometry rebuilt every frame, like debug lines, gizmos and billboards. The vertices and indices
+         * are written straight to persistently mapped stream buffers, the batch is flushed when they have no room
+         * left for it and at `endScene`.
+         *
+         * @param vertices Vertices of the geometry.
+         * @param indices Indices of the geometry, relative to its first vertex.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         * - NxRendererSceneLifeCycleFailure if no scene was started with `beginScene()`.
+         */
+        void drawGeometry(std::span<const NxVertex> vertices, std::span<const unsigned int> indices) const;
+
+        /**
+         * @brief Writes geometry to the dynamic geometry stream rings, for the caller to draw it on its own.
+         *
+         * This is how the draw commands carrying their geometry (`CommandType::STREAMED`) are executed, with their
+         * own shader and uniforms. The returned range must be drawn from `getStreamVertexArray` before anything else
+         * is streamed, then fenced with `closeStreamedGeometry`.
+         *
+         * @param vertices Vertices of the geometry.
+         * @param indices Indices of the geometry, relative to its first vertex.
+         * @return Part of the stream vertex array holding the geometry.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         * - NxRendererSceneLifeCycleFailure if a scene is being rendered, its batch is the open part of the rings.
+         */
+        NxMeshRange streamGeometry(std::span<const NxVertex> vertices, std::span<const unsigned int> indices) const;
+
+        /**
+         * @brief Fences the geometry written by `streamGeometry`, to call once its draw is issued.
+         */
+        void closeStreamedGeometry() const;
+
+        /**
+         * @brief Vertex array reading from the stream rings, replaced when they grow.
+         */
+        [[nodiscard]] const std::shared_ptr<NxVertexArray> &getStreamVertexArray() const;
+
         static std::shared_ptr<NxVertexArray> getCubeVAO();
         static std::shared_ptr<NxVertexArray> getBillboardVAO();
         static std::shared_ptr<NxVertexArray> getTetrahedronVAO();
@@ -228,7 +304,7 @@ namespace nexo::renderer
         /**
          * @brief Resets rendering statistics.
          *
-         * Clears the draw call and cube counters in `NxRenderer3DStats`.
+         * Clears the draw call, cube and occlusion counters in `NxRenderer3DStats`.
          *
          * Throws:
          * - NxRendererNotInitialized if the renderer is not initialized.
@@ -245,6 +321,39 @@ namespace nexo::renderer
          */
         [[nodiscard]] NxRenderer3DStats getStats() const;
 
+        /**
+         * @brief Reports the result of the occlusion culling of the frame.
+         *
+         * @param testedCount Number of meshes tested against the occluders, summed over the cameras.
+         * @param occludedCount Number of those tests that skipped the mesh.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         */
+        void setOcclusionStats(unsigned int testedCount, unsigned int occludedCount) const;
+
+        /**
+         * @brief Records the level of detail results of the frame in the rendering statistics.
+         *
+         * @param simplifiedCount Number of meshes drawn with a simplified level of detail.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         */
+        void setLodStats(unsigned int simplifiedCount) const;
+
+        /**
+         * @brief Records the static mesh batching results of the frame in the rendering statistics.
+         *
+         * @param batchCount Number of multi draw indirect batches built.
+         * @param batchedMeshCount Number of meshes drawn by those batches instead of their own draw command.
+         * @param indirectBuildTimeMs CPU time spent sorting the meshes and building the indirect commands.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         */
+        void setBatchStats(unsigned int batchCount, unsigned int batchedMeshCount, float indirectBuildTimeMs) const;
+
         [[nodiscard]] std::shared_ptr<NxShader>& getShader() const { return m_storage->currentSceneShader; };
 
         [[nodiscard]] std::shared_ptr<NxRenderer3DStorage> getInternalStorage() const { return m_storage; };
@@ -252,12 +361,38 @@ namespace nexo::renderer
         /**
          * @brief Returns the texture index for a given texture.
          *
-         * Searches the texture slots for an existing binding. If not found, assigns a new slot.
+         * Looks up the slot bound to the texture's registry handle (see `NxTextureRegistry`) in constant time.
+         * If the texture is not bound yet, assigns it the next free slot of the current page. Once every slot of
+         * the page is taken, a new page is started, see reserveTextureSlots.
          *
          * @param texture The texture to look up.
-         * @return float The texture index.
+         * @return int The texture index, in the current page.
          */
         [[nodiscard]] int getTextureIndex(const std::shared_ptr<NxTexture2D>& texture) const;
+
+        /**
+         * @brief Makes sure the next textures looked up all get a slot of the same page.
+         *
+         * A draw sampling several textures calls it before looking them up, and is executed with the returned page
+         * bound. When the current page has less than `count` free slots, a new page is started: while rendering a
+         * scene, the batch is flushed and its slots reused, otherwise the previous pages are kept for the draw
+         * commands already recorded.
+         *
+         * @param count Number of textures the draw samples.
+         * @return unsigned int The page the textures will be looked up in.
+         */
+        unsigned int reserveTextureSlots(unsigned int count) const;
+
+        /**
+         * @brief Hands the texture slots assigned by getTextureIndex over to the caller and releases them.
+         *
+         * The render packet of the frame keeps them (see `NxRenderPacket`), so the next frame can assign its own
+         * slots while the draw commands of this one are executed.
+         *
+         * @return The texture of each slot used since the last reset, page after page, every page but the last
+         * holding `maxTextureSlots` textures with the white texture first.
+         */
+        [[nodiscard]] std::vector<std::shared_ptr<NxTexture2D>> takeTextureSlots() const;
     private:
         std::shared_ptr<NxRenderer3DStorage> m_storage;
         bool m_renderingScene = false;
@@ -265,7 +400,8 @@ namespace nexo::renderer
         /**
          * @brief Flushes the current batched data to the GPU and issues the draw call.
          *
-         * Binds all active textures, draws indexed geometry, updates statistics, and unbinds resources.
+         * Binds all active textures, draws the batch from the open regions of the stream rings and fences them,
+         * updates statistics, and unbinds resources. Does nothing when the batch is empty.
          */
         void flush() const;
 
@@ -274,6 +410,34 @@ namespace nexo::renderer
          */
         void flushAndReset() const;
 
+        /**
+         * @brief Releases every texture slot but the white texture one of the first page.
+         */
+        void resetTextureSlots() const;
+
+        /**
+         * @brief Starts a new texture page, see reserveTextureSlots.
+         */
+        void startTexturePage() const;
+
+        /**
+         * @brief Makes room in the stream rings for geometry of the given size.
+         *
+         * Flushes the batch when the rings cannot take it without waiting for the GPU, then grows the rings that
+         * still cannot. Past their max size, the rings are left to wait instead.
+         */
+        void reserveGeometry(size_t vertexCount, size_t indexCount) const;
+
+        /**
+         * @brief Appends geometry to the open regions of the stream rings, its indices made relative to them.
+         */
+        void appendGeometry(std::span<const NxVertex> vertices, std::span<const unsigned int> indices) const;
+
+        /**
+         * @brief Creates the vertex array reading from the current buffers of the stream rings.
+         */
+        void createStreamVertexArray() const;
+
 
 
         /**
@@ -19,6 +19,7 @@
 
 #include <glm/glm.hpp>
 #include <memory>
+#include <span>
 
 #include "VertexArray.hpp"
 
@@ -35,6 +36,17 @@ namespace nexo::renderer {
         CCW
     };
 
+    /**
+     * @brief Draw of a multi draw indirect call, laid out as the graphics APIs read it from the indirect buffer.
+     */
+    struct NxDrawIndexedIndirectCommand {
+        uint32_t indexCount = 0;
+        uint32_t instanceCount = 1;
+        uint32_t firstIndex = 0;
+        int32_t baseVertex = 0;
+        uint32_t baseInstance = 0;
+    };
+
     /**
     * @class NxRendererApi
     * @brief Abstract interface for low-level rendering API implementations.
@@ -141,7 +153,18 @@ namespace nexo::renderer {
             *
             * Must be implemented by subclasses.
             */
-            virtual void drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, size_t count = 0) = 0;
+            virtual void drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, size_t count = 0,
+                                     size_t firstIndex = 0, int baseVertex = 0) = 0;
+
+            /**
+             * @brief Issues every draw of the span with a single call, all of them reading the same vertex array.
+             *
+             * The shaders tell the draws apart with their draw ID (`gl_DrawIDARB`), only available when
+             * `supportsMultiDrawIndirect` returns true.
+             */
+            virtual void multiDrawIndexedIndirect(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                                  std::span<const NxDrawIndexedIndirectCommand> commands) = 0;
+            [[nodiscard]] virtual bool supportsMultiDrawIndirect() const = 0;
 
             virtual void drawUnIndexed(size_t verticesCount) = 0;
 
@@ -154,5 +177,12 @@ namespace nexo::renderer {
             virtual void setCulledFace(CulledFace face) = 0;
             virtual void setWindingOrder(WindingOrder order) = 0;
 
+            /**
+            * @brief Selects how many color attachments of the bound framebuffer are written to.
+            *
+            * Attachments `0` to `count - 1` receive the fragment outputs, the others are left untouched.
+            */
+            virtual void setDrawBuffers(unsigned int count) = 0;
+
     };
 }
@@ -20,16 +20,22 @@
 #include "renderer/RendererExceptions.hpp"
 #include "Logger.hpp"
 #include <variant>
+#include "GraphicsApi.hpp"
+#include "headless/HeadlessShader.hpp"
 #ifdef NX_GRAPHICS_API_OPENGL
     #include "opengl/OpenGlShader.hpp"
 #endif
 
+#include <filesystem>
 #include <fstream>
+#include <unordered_set>
 
 namespace nexo::renderer {
 
     std::shared_ptr<NxShader> NxShader::create(const std::string &path)
     {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return std::make_shared<NxHeadlessShader>(path);
         #ifdef NX_GRAPHICS_API_OPENGL
             return std::make_shared<NxOpenGlShader>(path);
         #else
@@ -39,6 +45,8 @@ namespace nexo::renderer {
 
     std::shared_ptr<NxShader> NxShader::create(const std::string& name, const std::string &vertexSource, const std::string &fragmentSource)
     {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return std::make_shared<NxHeadlessShader>(name, vertexSource, fragmentSource);
         #ifdef NX_GRAPHICS_API_OPENGL
             return std::make_shared<NxOpenGlShader>(name, vertexSource, fragmentSource);
         #else
@@ -61,6 +69,65 @@ namespace nexo::renderer {
         THROW_EXCEPTION(NxFileNotFoundException, filepath);
     }
 
+    namespace {
+
+        void expandIncludes(const std::filesystem::path &path, std::string &out,
+                            std::unordered_set<std::string> &included, std::vector<std::string> *dependencies,
+                            const std::string &source)
+        {
+            constexpr std::string_view includeToken = "#include";
+            size_t lineStart = 0;
+            size_t lineNumber = 1;
+            while (lineStart < source.size()) {
+                size_t lineEnd = source.find('\n', lineStart);
+                if (lineEnd == std::string::npos)
+                    lineEnd = source.size();
+                const std::string_view line(source.data() + lineStart, lineEnd - lineStart);
+                const size_t first = line.find_first_not_of(" \t");
+
+                if (first == std::string_view::npos || !line.substr(first).starts_with(includeToken)) {
+                    out.append(line);
+                    out.push_back('\n');
+                } else {
+                    const size_t open = line.find_first_of("\"<", first + includeToken.size());
+                    const size_t close = open == std::string_view::npos
+                                             ? std::string_view::npos
+                                             : line.find(line[open] == '"' ? '"' : '>', open + 1);
+                    if (close == std::string_view::npos || close == open + 1)
+                        THROW_EXCEPTION(NxShaderCreationFailed, "SHADER",
+                                        "Malformed include at line: " + std::to_string(lineNumber),
+                                        path.string());
+
+                    const std::filesystem::path includePath =
+                        (path.parent_path() / line.substr(open + 1, close - open - 1)).lexically_normal();
+                    if (included.insert(includePath.string()).second) {
+                        if (dependencies)
+                            dependencies->push_back(includePath.string());
+                        const std::string includeSource = NxShader::readFile(includePath.string());
+                        expandIncludes(includePath, out, included, dependencies, includeSource);
+                    }
+                }
+                lineStart = lineEnd + 1;
+                ++lineNumber;
+            }
+        }
+
+    }
+
+    std::string NxShader::loadSource(const std::string &path, std::vector<std::string> *dependencies)
+    {
+        const std::string source = readFile(path);
+        const std::filesystem::path normalized = std::filesystem::path(path).lexically_normal();
+        std::unordered_set<std::string> included{normalized.string()};
+        if (dependencies)
+            dependencies->push_back(normalized.string());
+
+        std::string expanded;
+        expanded.reserve(source.size());
+        expandIncludes(normalized, expanded, included, dependencies, source);
+        return expanded;
+    }
+
     void NxShader::addStorageBuffer(const std::shared_ptr<NxShaderStorageBuffer> &buffer)
     {
         m_storageBuffers.push_back(buffer);
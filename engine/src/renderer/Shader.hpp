@@ -136,6 +136,22 @@ namespace nexo::renderer
         static std::shared_ptr<NxShader> create(const std::string& name, const std::string& vertexSource,
                                                 const std::string& fragmentSource);
 
+        /**
+        * @brief Reads a shader file and expands its `#include "file"` directives.
+        *
+        * Included paths are relative to the file including them, and every file is included at most once per
+        * program, which also breaks include cycles.
+        *
+        * @param path The file path to the shader source code.
+        * @param dependencies If not null, receives the path of every file the source was built from, `path` first.
+        * @return The source with every include expanded.
+        *
+        * Throws:
+        * - `NxFileNotFoundException` if the file or one of its includes cannot be found.
+        * - `NxShaderCreationFailed` if an include directive is malformed.
+        */
+        static std::string loadSource(const std::string& path, std::vector<std::string>* dependencies = nullptr);
+
         /**
         * @brief Binds the shader program for use in the rendering pipeline.
         *
@@ -188,8 +204,9 @@ namespace nexo::renderer
         [[nodiscard]] virtual const std::string& getName() const = 0;
         virtual unsigned int getProgramId() const = 0;
 
-    protected:
         static std::string readFile(const std::string& filepath);
+
+    protected:
         std::vector<std::shared_ptr<NxShaderStorageBuffer>> m_storageBuffers;
         RequiredAttributes m_requiredAttributes;
         std::unordered_map<std::string, UniformInfo> m_uniformInfos;
@@ -0,0 +1,323 @@
+//// ShaderCache.cpp //////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the persistent shader program binary cache
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "ShaderCache.hpp"
+#include "Logger.hpp"
+#include "Path.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <ranges>
+#include <sstream>
+
+namespace nexo::renderer {
+
+    namespace {
+
+        class EntryWriter {
+            public:
+                template<typename T>
+                void write(const T &value)
+                {
+                    const auto *bytes = reinterpret_cast<const uint8_t *>(&value);
+                    m_buffer.insert(m_buffer.end(), bytes, bytes + sizeof(T));
+                }
+
+                void writeBytes(const void *data, const size_t size)
+                {
+                    const auto *bytes = static_cast<const uint8_t *>(data);
+                    m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+                }
+
+                void writeString(const std::string &str)
+                {
+                    write(static_cast<uint32_t>(str.size()));
+                    writeBytes(str.data(), str.size());
+                }
+
+                [[nodiscard]] const std::vector<uint8_t> &buffer() const { return m_buffer; }
+
+            private:
+                std::vector<uint8_t> m_buffer;
+        };
+
+        class EntryReader {
+            public:
+                explicit EntryReader(const std::vector<uint8_t> &buffer) : m_buffer(buffer) {}
+
+                template<typename T>
+                bool read(T &value)
+                {
+                    return readBytes(&value, sizeof(T));
+                }
+
+                bool readBytes(void *dst, const size_t size)
+                {
+                    if (size > m_buffer.size() - m_offset)
+                        return false;
+                    std::memcpy(dst, m_buffer.data() + m_offset, size);
+                    m_offset += size;
+                    return true;
+                }
+
+                bool readString(std::string &str)
+                {
+                    uint32_t size = 0;
+                    if (!read(size) || size > m_buffer.size() - m_offset)
+                        return false;
+                    str.assign(reinterpret_cast<const char *>(m_buffer.data() + m_offset), size);
+                    m_offset += size;
+                    return true;
+                }
+
+                [[nodiscard]] bool atEnd() const { return m_offset == m_buffer.size(); }
+
+            private:
+                const std::vector<uint8_t> &m_buffer;
+                size_t m_offset = 0;
+        };
+
+        template<typename Info>
+        void writeReflection(EntryWriter &writer, const Info &info)
+        {
+            writer.writeString(info.name);
+            writer.write(static_cast<int32_t>(info.location));
+            writer.write(static_cast<uint32_t>(info.type));
+            writer.write(static_cast<int32_t>(info.size));
+        }
+
+        template<typename Info>
+        bool readReflection(EntryReader &reader, Info &info)
+        {
+            int32_t location = 0;
+            uint32_t type = 0;
+            int32_t size = 0;
+            if (!reader.readString(info.name) || !reader.read(location) || !reader.read(type) || !reader.read(size))
+                return false;
+            info.location = location;
+            info.type = type;
+            info.size = size;
+            return true;
+        }
+
+    }
+
+    NxShaderBinaryCache &NxShaderBinaryCache::get()
+    {
+        static NxShaderBinaryCache instance;
+        return instance;
+    }
+
+    uint64_t NxShaderBinaryCache::makeKey(const std::string_view driverIdentity, const std::string_view source)
+    {
+        // FNV-1a, the separator keeps ("ab", "c") and ("a", "bc") apart
+        uint64_t hash = 14695981039346656037ull;
+        const auto mix = [&hash](const std::string_view str) {
+            for (const char c : str) {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 1099511628211ull;
+            }
+        };
+        mix(driverIdentity);
+        mix(std::string_view("\0", 1));
+        mix(source);
+        return hash;
+    }
+
+    void NxShaderBinaryCache::setDirectory(std::filesystem::path directory)
+    {
+        m_directory = std::move(directory);
+    }
+
+    const std::filesystem::path &NxShaderBinaryCache::getDirectory()
+    {
+        if (m_directory.empty())
+            m_directory = Path::resolvePathRelativeToExe("cache/shaders");
+        return m_directory;
+    }
+
+    std::filesystem::path NxShaderBinaryCache::entryPath(const uint64_t key)
+    {
+        std::ostringstream name;
+        name << std::hex << key << EXTENSION;
+        return getDirectory() / name.str();
+    }
+
+    std::optional<NxShaderBinary> NxShaderBinaryCache::readEntry(const std::filesystem::path &path, const uint64_t key)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+        if (!file)
+            return std::nullopt;
+        const auto fileSize = static_cast<size_t>(file.tellg());
+        std::vector<uint8_t> buffer(fileSize);
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(fileSize)))
+            return std::nullopt;
+
+        EntryReader reader(buffer);
+        std::array<char, 4> magic{};
+        uint32_t version = 0;
+        uint64_t storedKey = 0;
+        NxShaderBinary binary;
+        uint64_t binarySize = 0;
+        if (!reader.read(magic) || magic != MAGIC || !reader.read(version) || version != VERSION ||
+            !reader.read(storedKey) || storedKey != key || !reader.read(binary.format) || !reader.read(binarySize) ||
+            binarySize > fileSize)
+            return std::nullopt;
+        binary.data.resize(binarySize);
+        if (!reader.readBytes(binary.data.data(), binary.data.size()))
+            return std::nullopt;
+
+        uint32_t uniformCount = 0;
+        if (!reader.read(uniformCount))
+            return std::nullopt;
+        for (uint32_t i = 0; i < uniformCount; ++i) {
+            UniformInfo uniform{};
+            if (!readReflection(reader, uniform))
+                return std::nullopt;
+            binary.uniforms[uniform.name] = std::move(uniform);
+        }
+        uint32_t attributeCount = 0;
+        if (!reader.read(attributeCount))
+            return std::nullopt;
+        for (uint32_t i = 0; i < attributeCount; ++i) {
+            AttributeInfo attribute{};
+            if (!readReflection(reader, attribute))
+                return std::nullopt;
+            binary.attributes[attribute.location] = std::move(attribute);
+        }
+        if (!reader.atEnd())
+            return std::nullopt;
+        return binary;
+    }
+
+    std::optional<NxShaderBinary> NxShaderBinaryCache::load(const uint64_t key)
+    {
+        if (!isEnabled())
+            return std::nullopt;
+        {
+            std::scoped_lock lock(m_prefetchMutex);
+            if (const auto it = m_prefetched.find(key); it != m_prefetched.end()) {
+                NxShaderBinary binary = std::move(it->second);
+                m_prefetched.erase(it);
+                return binary;
+            }
+        }
+
+        const std::filesystem::path path = entryPath(key);
+        std::error_code ec;
+        if (!std::filesystem::exists(path, ec))
+            return std::nullopt;
+        auto binary = readEntry(path, key);
+        if (!binary) {
+            LOG(NEXO_WARN, "Discarding corrupted shader cache entry {}", path.string());
+            std::filesystem::remove(path, ec);
+        }
+        return binary;
+    }
+
+    void NxShaderBinaryCache::store(const uint64_t key, const NxShaderBinary &binary)
+    {
+        if (!isEnabled() || binary.data.empty())
+            return;
+
+        EntryWriter writer;
+        writer.write(MAGIC);
+        writer.write(VERSION);
+        writer.write(key);
+        writer.write(binary.format);
+        writer.write(static_cast<uint64_t>(binary.data.size()));
+        writer.writeBytes(binary.data.data(), binary.data.size());
+        writer.write(static_cast<uint32_t>(binary.uniforms.size()));
+        for (const auto &uniform : binary.uniforms | std::views::values)
+            writeReflection(writer, uniform);
+        writer.write(static_cast<uint32_t>(binary.attributes.size()));
+        for (const auto &attribute : binary.attributes | std::views::values)
+            writeReflection(writer, attribute);
+
+        std::error_code ec;
+        std::filesystem::create_directories(getDirectory(), ec);
+        const std::filesystem::path path = entryPath(key);
+        // Written aside then renamed, so a crash never leaves a truncated entry behind
+        std::filesystem::path tmpPath = path;
+        tmpPath += ".tmp";
+        {
+            std::ofstream file(tmpPath, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!file) {
+                LOG(NEXO_WARN, "Could not write shader cache entry {}", path.string());
+                return;
+            }
+            file.write(reinterpret_cast<const char *>(writer.buffer().data()),
+                       static_cast<std::streamsize>(writer.buffer().size()));
+        }
+        std::filesystem::rename(tmpPath, path, ec);
+        if (ec) {
+            LOG(NEXO_WARN, "Could not write shader cache entry {}: {}", path.string(), ec.message());
+            std::filesystem::remove(tmpPath, ec);
+        }
+    }
+
+    void NxShaderBinaryCache::reject(const uint64_t key)
+    {
+        recordRejection();
+        {
+            std::scoped_lock lock(m_prefetchMutex);
+            m_prefetched.erase(key);
+        }
+        std::error_code ec;
+        std::filesystem::remove(entryPath(key), ec);
+    }
+
+    void NxShaderBinaryCache::prefetch(const std::vector<std::string> &sourcePaths)
+    {
+        if (!isEnabled())
+            return;
+        // Resolved here so the workers never race on the lazily initialized directory
+        const std::filesystem::path directory = getDirectory();
+        for (const auto &sourcePath : sourcePaths) {
+            m_workers.submit([this, sourcePath, directory] {
+                std::string source;
+                try {
+                    source = NxShader::loadSource(sourcePath);
+                } catch (const std::exception &) {
+                    // Reported when the shader itself gets created
+                    return;
+                }
+                const uint64_t key = makeKey(m_driverIdentity, source);
+                std::ostringstream name;
+                name << std::hex << key << EXTENSION;
+                auto binary = readEntry(directory / name.str(), key);
+                if (!binary)
+                    return;
+                std::scoped_lock lock(m_prefetchMutex);
+                m_prefetched.try_emplace(key, std::move(*binary));
+            });
+        }
+    }
+
+    void NxShaderBinaryCache::recordBuild(const bool fromCache, const std::chrono::nanoseconds duration)
+    {
+        if (fromCache) {
+            ++m_stats.warmBuilds;
+            m_stats.warmBuildTime += duration;
+        } else {
+            ++m_stats.coldBuilds;
+            m_stats.coldBuildTime += duration;
+        }
+    }
+
+}
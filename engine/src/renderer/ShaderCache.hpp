@@ -0,0 +1,147 @@
+//// ShaderCache.hpp //////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the persistent shader program binary cache
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Shader.hpp"
+#include "core/thread/WorkerPool.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @brief Linked shader program as returned by the driver, with the reflection results gathered after linking.
+     */
+    struct NxShaderBinary {
+        uint32_t format = 0;                                    ///< Driver specific binary format
+        std::vector<uint8_t> data;
+        std::unordered_map<std::string, UniformInfo> uniforms;
+        std::unordered_map<int, AttributeInfo> attributes;
+    };
+
+    struct NxShaderCacheStats {
+        unsigned int coldBuilds = 0;        ///< Programs compiled and linked from source
+        unsigned int warmBuilds = 0;        ///< Programs restored from a cached binary
+        unsigned int rejectedBinaries = 0;  ///< Cached binaries the driver refused, rebuilt from source
+        std::chrono::nanoseconds coldBuildTime{0};
+        std::chrono::nanoseconds warmBuildTime{0};
+    };
+
+    /**
+     * @class NxShaderBinaryCache
+     * @brief Persistent on-disk cache of linked shader programs.
+     *
+     * Entries are keyed by a hash of the shader source and of the driver identity (vendor, renderer and version
+     * strings), so updating either a shader or the driver simply misses the old entries. Along with the program
+     * binary, an entry holds the uniform and attribute reflection of the program, which spares the reflection queries
+     * on a warm start.
+     *
+     * A driver is free to reject a binary it produced earlier: the backend then rebuilds the program from source and
+     * calls `reject`, which drops the stale entry.
+     *
+     * `prefetch` reads the sources and cache entries of a set of shader files on worker threads, so the rendering
+     * thread only has to hand the binaries to the driver.
+     */
+    class NxShaderBinaryCache {
+        public:
+            static constexpr std::array<char, 4> MAGIC = {'N', 'X', 'S', 'H'};
+            static constexpr uint32_t VERSION = 1;
+            static constexpr std::string_view EXTENSION = ".nxshader";
+
+            static NxShaderBinaryCache &get();
+
+            /**
+             * @brief Hashes a shader source together with the driver identity.
+             */
+            [[nodiscard]] static uint64_t makeKey(std::string_view driverIdentity, std::string_view source);
+
+            /**
+             * @brief Sets the identity of the driver producing the binaries, the cache stays unused until it is set.
+             */
+            void setDriverIdentity(std::string identity) { m_driverIdentity = std::move(identity); }
+            [[nodiscard]] const std::string &getDriverIdentity() const { return m_driverIdentity; }
+
+            void setEnabled(const bool enabled) { m_enabled = enabled; }
+            [[nodiscard]] bool isEnabled() const { return m_enabled && !m_driverIdentity.empty(); }
+
+            /**
+             * @brief Sets the directory holding the cache entries, "cache/shaders" next to the executable by default.
+             */
+            void setDirectory(std::filesystem::path directory);
+            [[nodiscard]] const std::filesystem::path &getDirectory();
+
+            /**
+             * @brief Returns the entry stored under the key, prefetched entries are served from memory.
+             *
+             * Unreadable or corrupted entries are deleted and reported as misses.
+             */
+            [[nodiscard]] std::optional<NxShaderBinary> load(uint64_t key);
+
+            void store(uint64_t key, const NxShaderBinary &binary);
+
+            /**
+             * @brief Drops an entry whose binary has been rejected by the driver.
+             */
+            void reject(uint64_t key);
+
+            /**
+             * @brief Reads the sources of the given shader files and their cache entries on worker threads.
+             *
+             * Keys are computed from the include-expanded sources, the way the backends key shaders created from a file.
+             */
+            void prefetch(const std::vector<std::string> &sourcePaths);
+
+            /**
+             * @brief Blocks until every prefetch is done.
+             */
+            void waitForPrefetch() { m_workers.waitIdle(); }
+
+            void recordBuild(bool fromCache, std::chrono::nanoseconds duration);
+            void recordRejection() { ++m_stats.rejectedBinaries; }
+            [[nodiscard]] const NxShaderCacheStats &getStats() const { return m_stats; }
+            void resetStats() { m_stats = {}; }
+
+        private:
+            NxShaderBinaryCache() = default;
+
+            [[nodiscard]] std::filesystem::path entryPath(uint64_t key);
+            [[nodiscard]] static std::optional<NxShaderBinary> readEntry(const std::filesystem::path &path,
+                                                                         uint64_t key);
+
+            std::string m_driverIdentity;
+            bool m_enabled = true;
+            std::filesystem::path m_directory;
+            NxShaderCacheStats m_stats;
+
+            std::mutex m_prefetchMutex;
+            std::unordered_map<uint64_t, NxShaderBinary> m_prefetched;
+
+            // Declared last so the workers are joined before the state they fill is destroyed
+            thread::WorkerPool m_workers{2};
+    };
+
+}
@@ -0,0 +1,202 @@
+//// ShaderHotReload.cpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the shader hot reloader
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "ShaderHotReload.hpp"
+#include "ShaderLibrary.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <ranges>
+
+namespace nexo::renderer {
+
+    NxShaderHotReloader &NxShaderHotReloader::get()
+    {
+        static NxShaderHotReloader instance;
+        return instance;
+    }
+
+    NxShaderHotReloader::~NxShaderHotReloader()
+    {
+        stop();
+    }
+
+    void NxShaderHotReloader::watch(const std::chrono::milliseconds interval)
+    {
+        stop();
+        m_interval = interval;
+        m_watcher = std::jthread([this](const std::stop_token &stopToken) { watcherLoop(stopToken); });
+        LOG(NEXO_INFO, "Watching shader sources for changes");
+    }
+
+    void NxShaderHotReloader::stop()
+    {
+        if (!m_watcher.joinable())
+            return;
+        m_watcher.request_stop();
+        m_wakeUp.notify_all();
+        m_watcher.join();
+        m_watcher = {};
+    }
+
+    void NxShaderHotReloader::watcherLoop(const std::stop_token &stopToken)
+    {
+        while (!stopToken.stop_requested()) {
+            poll();
+            std::unique_lock lock(m_mutex);
+            m_wakeUp.wait_for(lock, stopToken, m_interval, [] { return false; });
+        }
+    }
+
+    std::filesystem::file_time_type NxShaderHotReloader::lastWriteTime(const std::string &file)
+    {
+        std::error_code ec;
+        const auto time = std::filesystem::last_write_time(file, ec);
+        return ec ? std::filesystem::file_time_type::min() : time;
+    }
+
+    void NxShaderHotReloader::setDependencies(const std::string &name, std::vector<std::string> dependencies)
+    {
+        auto &shader = m_shaders[name];
+        for (const auto &file : dependencies) {
+            m_dependents[file].insert(name);
+            m_timestamps.try_emplace(file, lastWriteTime(file));
+        }
+        for (const auto &file : shader.dependencies) {
+            if (std::ranges::find(dependencies, file) != dependencies.end())
+                continue;
+            if (const auto it = m_dependents.find(file); it != m_dependents.end()) {
+                it->second.erase(name);
+                if (it->second.empty()) {
+                    m_timestamps.erase(file);
+                    m_dependents.erase(it);
+                }
+            }
+        }
+        shader.dependencies = std::move(dependencies);
+    }
+
+    void NxShaderHotReloader::track(const std::string &name, const std::string &path)
+    {
+        std::vector<std::string> dependencies;
+        try {
+            NxShader::loadSource(path, &dependencies);
+        } catch (const std::exception &e) {
+            LOG(NEXO_WARN, "Shader '{}' will not be hot reloaded: {}", name, e.what());
+            return;
+        }
+        std::scoped_lock lock(m_mutex);
+        m_shaders[name].path = path;
+        setDependencies(name, std::move(dependencies));
+    }
+
+    void NxShaderHotReloader::poll()
+    {
+        std::vector<std::string> files;
+        {
+            std::scoped_lock lock(m_mutex);
+            files.reserve(m_timestamps.size());
+            for (const auto &file : m_timestamps | std::views::keys)
+                files.push_back(file);
+        }
+
+        std::vector<std::string> modified;
+        for (const auto &file : files) {
+            const auto time = lastWriteTime(file);
+            std::scoped_lock lock(m_mutex);
+            if (const auto it = m_timestamps.find(file); it != m_timestamps.end() && it->second != time) {
+                it->second = time;
+                modified.push_back(file);
+            }
+        }
+        if (modified.empty())
+            return;
+
+        std::unordered_map<std::string, std::string> affected;
+        {
+            std::scoped_lock lock(m_mutex);
+            for (const auto &file : modified) {
+                LOG(NEXO_DEV, "Shader source modified: {}", file);
+                if (const auto it = m_dependents.find(file); it != m_dependents.end())
+                    for (const auto &name : it->second)
+                        affected.try_emplace(name, m_shaders.at(name).path);
+            }
+        }
+
+        // Expanding the includes here catches broken includes before anything reaches the graphics thread
+        for (const auto &[name, path] : affected) {
+            std::vector<std::string> dependencies;
+            try {
+                NxShader::loadSource(path, &dependencies);
+            } catch (const std::exception &e) {
+                LOG(NEXO_ERROR, "Failed to reload shader '{}': {}", name, e.what());
+                continue;
+            }
+            std::scoped_lock lock(m_mutex);
+            const auto pending = std::ranges::find(m_pending, name, &PendingReload::name);
+            if (pending != m_pending.end())
+                pending->dependencies = std::move(dependencies);
+            else
+                m_pending.push_back({name, path, std::move(dependencies)});
+        }
+    }
+
+    unsigned int NxShaderHotReloader::processReloads()
+    {
+        std::vector<PendingReload> pending;
+        {
+            std::scoped_lock lock(m_mutex);
+            if (m_pending.empty())
+                return 0;
+            pending.swap(m_pending);
+        }
+
+        unsigned int reloaded = 0;
+        for (auto &[name, path, dependencies] : pending) {
+            try {
+                const auto shader = NxShader::create(path);
+                ShaderLibrary::getInstance().replace(name, shader);
+                ++reloaded;
+                LOG(NEXO_INFO, "Shader '{}' reloaded", name);
+            } catch (const std::exception &e) {
+                LOG(NEXO_ERROR, "Failed to reload shader '{}', keeping the previous program: {}", name, e.what());
+            }
+            // New includes are watched even when the build failed, so fixing them triggers another reload
+            std::scoped_lock lock(m_mutex);
+            setDependencies(name, std::move(dependencies));
+        }
+        return reloaded;
+    }
+
+    size_t NxShaderHotReloader::pendingCount() const
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_pending.size();
+    }
+
+    std::vector<std::string> NxShaderHotReloader::getDependents(const std::string &file) const
+    {
+        std::scoped_lock lock(m_mutex);
+        const auto it = m_dependents.find(std::filesystem::path(file).lexically_normal().string());
+        if (it == m_dependents.end())
+            return {};
+        std::vector<std::string> names(it->second.begin(), it->second.end());
+        std::ranges::sort(names);
+        return names;
+    }
+
+}
@@ -0,0 +1,120 @@
+//// ShaderHotReload.hpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the shader hot reloader
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @class NxShaderHotReloader
+     * @brief Rebuilds the shaders of the `ShaderLibrary` whose source files changed on disk.
+     *
+     * Every shader loaded from a file is tracked along with the files it includes, forming a dependency graph from
+     * each file to the programs built from it. Editing a shared include therefore rebuilds every program using it, and
+     * only those.
+     *
+     * Change detection and include expansion run on a watcher thread. Programs can only be linked on the thread owning
+     * the graphics context, so `processReloads` creates the new programs once per frame and swaps them into the
+     * library. A program that fails to build is reported and the previous one stays in use.
+     */
+    class NxShaderHotReloader {
+        public:
+            static constexpr std::chrono::milliseconds DEFAULT_POLL_INTERVAL{250};
+
+            static NxShaderHotReloader &get();
+
+            ~NxShaderHotReloader();
+            NxShaderHotReloader(const NxShaderHotReloader &) = delete;
+            NxShaderHotReloader &operator=(const NxShaderHotReloader &) = delete;
+
+            /**
+             * @brief Starts polling the tracked files on a background thread.
+             */
+            void watch(std::chrono::milliseconds interval = DEFAULT_POLL_INTERVAL);
+            void stop();
+            [[nodiscard]] bool isWatching() const { return m_watcher.joinable(); }
+
+            /**
+             * @brief Tracks the source file of a library shader and every file it includes.
+             */
+            void track(const std::string &name, const std::string &path);
+
+            /**
+             * @brief Checks the tracked files once and queues the programs depending on the modified ones.
+             *
+             * Called by the watcher thread on every interval.
+             */
+            void poll();
+
+            /**
+             * @brief Builds the queued programs and swaps them into the `ShaderLibrary`.
+             *
+             * Must be called from the thread owning the graphics context, once per frame.
+             *
+             * @return The number of programs replaced.
+             */
+            unsigned int processReloads();
+
+            [[nodiscard]] size_t pendingCount() const;
+
+            /**
+             * @brief Returns the names of the shaders built from the given file.
+             */
+            [[nodiscard]] std::vector<std::string> getDependents(const std::string &file) const;
+
+        private:
+            NxShaderHotReloader() = default;
+
+            struct TrackedShader {
+                std::string path;
+                std::vector<std::string> dependencies;
+            };
+
+            struct PendingReload {
+                std::string name;
+                std::string path;
+                std::vector<std::string> dependencies;
+            };
+
+            void setDependencies(const std::string &name, std::vector<std::string> dependencies);
+            void watcherLoop(const std::stop_token &stopToken);
+
+            static std::filesystem::file_time_type lastWriteTime(const std::string &file);
+
+            mutable std::mutex m_mutex;
+            std::unordered_map<std::string, TrackedShader> m_shaders;
+            std::unordered_map<std::string, std::unordered_set<std::string>> m_dependents;
+            std::unordered_map<std::string, std::filesystem::file_time_type> m_timestamps;
+            std::vector<PendingReload> m_pending;
+
+            std::chrono::milliseconds m_interval = DEFAULT_POLL_INTERVAL;
+            std::condition_variable_any m_wakeUp;
+            // Declared last so the watcher is joined before the state it reads is destroyed
+            std::jthread m_watcher;
+    };
+
+}
@@ -17,9 +17,15 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "ShaderLibrary.hpp"
+#include "ShaderCache.hpp"
+#include "ShaderHotReload.hpp"
 #include "Logger.hpp"
 #include "Path.hpp"
 
+#include <array>
+#include <chrono>
+#include <ranges>
+
 namespace nexo::renderer {
 
     ShaderLibrary::ShaderLibrary()
@@ -49,13 +55,30 @@ namespace nexo::renderer {
             }
         };
 
+        static constexpr std::array<std::pair<const char *, const char *>, 6> builtinShaders = {{
+            {"Phong", "../resources/shaders/phong.glsl"},
+            {"Outline pulse flat", "../resources/shaders/outline_pulse_flat.glsl"},
+            {"Outline pulse transparent flat", "../resources/shaders/outline_pulse_transparent_flat.glsl"},
+            {"Albedo unshaded transparent", "../resources/shaders/albedo_unshaded_transparent.glsl"},
+            {"Grid shader", "../resources/shaders/grid_shader.glsl"},
+            {"Flat color", "../resources/shaders/flat_color.glsl"},
+        }};
+
+        // Read the cached binaries in the background while the first shaders are being created
+        auto &cache = NxShaderBinaryCache::get();
+        std::vector<std::string> paths;
+        for (const auto &path : builtinShaders | std::views::values)
+            paths.push_back(Path::resolvePathRelativeToExe(path).string());
+        cache.prefetch(paths);
+
         // Load all required shaders with error handling
-        safeLoadShader("Phong", "../resources/shaders/phong.glsl");
-        safeLoadShader("Outline pulse flat", "../resources/shaders/outline_pulse_flat.glsl");
-        safeLoadShader("Outline pulse transparent flat", "../resources/shaders/outline_pulse_transparent_flat.glsl");
-        safeLoadShader("Albedo unshaded transparent", "../resources/shaders/albedo_unshaded_transparent.glsl");
-        safeLoadShader("Grid shader", "../resources/shaders/grid_shader.glsl");
-        safeLoadShader("Flat color", "../resources/shaders/flat_color.glsl");
+        for (const auto &[name, path] : builtinShaders)
+            safeLoadShader(name, path);
+
+        const auto &stats = cache.getStats();
+        LOG(NEXO_INFO, "Shaders ready: {} compiled from source in {} ms, {} loaded from the binary cache in {} ms",
+            stats.coldBuilds, std::chrono::duration_cast<std::chrono::milliseconds>(stats.coldBuildTime).count(),
+            stats.warmBuilds, std::chrono::duration_cast<std::chrono::milliseconds>(stats.warmBuildTime).count());
     }
 
     void ShaderLibrary::add(const std::shared_ptr<NxShader> &shader)
@@ -73,6 +96,7 @@ namespace nexo::renderer {
     {
         auto shader = NxShader::create(path);
         add(name, shader);
+        NxShaderHotReloader::get().track(name, path);
         return shader;
     }
 
@@ -80,6 +104,7 @@ namespace nexo::renderer {
     {
         auto shader = NxShader::create(path);
         add(shader);
+        NxShaderHotReloader::get().track(shader->getName(), path);
         return shader;
     }
 
@@ -90,6 +115,18 @@ namespace nexo::renderer {
         return shader;
     }
 
+    void ShaderLibrary::replace(const std::string &name, const std::shared_ptr<NxShader> &shader)
+    {
+        m_shaders[name] = shader;
+        for (const auto &listener : m_reloadListeners)
+            listener(name, shader);
+    }
+
+    void ShaderLibrary::addReloadListener(ReloadListener listener)
+    {
+        m_reloadListeners.push_back(std::move(listener));
+    }
+
     std::shared_ptr<NxShader> ShaderLibrary::get(const std::string &name) const
     {
         if (!m_shaders.contains(name))
@@ -17,7 +17,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <functional>
 #include <unordered_map>
+#include <vector>
 #include "Shader.hpp"
 
 namespace nexo::renderer {
@@ -46,6 +48,20 @@ namespace nexo::renderer {
             std::shared_ptr<NxShader> load(const std::string &name, const std::string &vertexSource, const std::string &fragmentSource);
             std::shared_ptr<NxShader> get(const std::string &name) const;
 
+            using ReloadListener = std::function<void(const std::string &name, const std::shared_ptr<NxShader> &shader)>;
+
+            /**
+             * @brief Swaps the program registered under a name and notifies the reload listeners.
+             *
+             * Callers fetching the shader by name pick up the new program from their next lookup.
+             */
+            void replace(const std::string &name, const std::shared_ptr<NxShader> &shader);
+
+            /**
+             * @brief Registers a callback run after a program got replaced, to restore the state set up once on it.
+             */
+            void addReloadListener(ReloadListener listener);
+
             static ShaderLibrary& getInstance()
             {
                 static ShaderLibrary instance;
@@ -61,5 +77,6 @@ namespace nexo::renderer {
                 TransparentStringHasher,
                 std::equal_to<>
             > m_shaders;
+            std::vector<ReloadListener> m_reloadListeners;
     };
 }
@@ -19,6 +19,8 @@
 #include "ShaderStorageBuffer.hpp"
 #include "renderer/RendererExceptions.hpp"
 #include <memory>
+#include "GraphicsApi.hpp"
+#include "headless/HeadlessShaderStorageBuffer.hpp"
 #ifdef NX_GRAPHICS_API_OPENGL
     #include "opengl/OpenGlShaderStorageBuffer.hpp"
 #endif
@@ -27,6 +29,8 @@ namespace nexo::renderer {
 
 	std::shared_ptr<NxShaderStorageBuffer> NxShaderStorageBuffer::create(unsigned int size)
 	{
+	if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+		return std::make_shared<NxHeadlessShaderStorageBuffer>(size);
   		#ifdef NX_GRAPHICS_API_OPENGL
             return std::make_shared<NxOpenGlShaderStorageBuffer>(size);
 	    #else
@@ -0,0 +1,181 @@
+//// StreamBuffer.cpp /////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the persistently mapped buffers streaming dynamic geometry
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "StreamBuffer.hpp"
+#include "GraphicsApi.hpp"
+#include "RendererExceptions.hpp"
+#include "headless/HeadlessStreamBuffer.hpp"
+#ifdef NX_GRAPHICS_API_OPENGL
+    #include "opengl/OpenGlStreamBuffer.hpp"
+#endif
+
+#include <cstring>
+#include <format>
+
+namespace nexo::renderer {
+
+    namespace {
+
+        class StreamVertexBuffer final : public NxVertexBuffer {
+            public:
+                StreamVertexBuffer(std::shared_ptr<NxStreamBuffer> buffer, NxBufferLayout layout)
+                    : m_buffer(std::move(buffer)), m_layout(std::move(layout)) {}
+
+                void bind() const override { m_buffer->bind(NxStreamBufferTarget::VERTEX); }
+                void unbind() const override { m_buffer->unbind(NxStreamBufferTarget::VERTEX); }
+
+                void setLayout(const NxBufferLayout &layout) override { m_layout = layout; }
+                [[nodiscard]] NxBufferLayout getLayout() const override { return m_layout; }
+
+                void setData(void *data, const size_t size) override { setSubData(data, size, 0); }
+
+                void setSubData(const void *data, const size_t size, const size_t offset) override
+                {
+                    if (offset + size > m_buffer->getSize())
+                        THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Vertex buffer range exceeds its size");
+                    if (size)
+                        std::memcpy(m_buffer->getMapping() + offset, data, size);
+                }
+
+                [[nodiscard]] unsigned int getId() const override { return m_buffer->getId(); }
+
+            private:
+                std::shared_ptr<NxStreamBuffer> m_buffer;
+                NxBufferLayout m_layout;
+        };
+
+        class StreamIndexBuffer final : public NxIndexBuffer {
+            public:
+                explicit StreamIndexBuffer(std::shared_ptr<NxStreamBuffer> buffer) : m_buffer(std::move(buffer)) {}
+
+                void bind() const override { m_buffer->bind(NxStreamBufferTarget::INDEX); }
+                void unbind() const override { m_buffer->unbind(NxStreamBufferTarget::INDEX); }
+
+                void setData(unsigned int *indices, const size_t count) override { setSubData(indices, count, 0); }
+
+                void setSubData(const unsigned int *indices, const size_t count, const size_t offset) override
+                {
+                    if (offset + count > getCount())
+                        THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Index buffer range exceeds its count");
+                    if (count)
+                        std::memcpy(m_buffer->getMapping() + offset * sizeof(unsigned int), indices,
+                                    count * sizeof(unsigned int));
+                }
+
+                [[nodiscard]] size_t getCount() const override { return m_buffer->getSize() / sizeof(unsigned int); }
+                [[nodiscard]] unsigned int getId() const override { return m_buffer->getId(); }
+
+            private:
+                std::shared_ptr<NxStreamBuffer> m_buffer;
+        };
+
+    }
+
+    std::shared_ptr<NxStreamBuffer> createStreamBuffer(const size_t size)
+    {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return std::make_shared<NxHeadlessStreamBuffer>(size);
+        #ifdef NX_GRAPHICS_API_OPENGL
+            return std::make_shared<NxOpenGlStreamBuffer>(size);
+        #else
+            THROW_EXCEPTION(NxUnknownGraphicsApi, "UNKNOWN");
+        #endif
+    }
+
+    std::shared_ptr<NxVertexBuffer> createStreamVertexBuffer(std::shared_ptr<NxStreamBuffer> buffer,
+                                                             const NxBufferLayout &layout)
+    {
+        if (!buffer)
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Stream buffer is null");
+        return std::make_shared<StreamVertexBuffer>(std::move(buffer), layout);
+    }
+
+    std::shared_ptr<NxIndexBuffer> createStreamIndexBuffer(std::shared_ptr<NxStreamBuffer> buffer)
+    {
+        if (!buffer)
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Stream buffer is null");
+        return std::make_shared<StreamIndexBuffer>(std::move(buffer));
+    }
+
+    void NxStreamRing::setBuffer(std::shared_ptr<NxStreamBuffer> buffer)
+    {
+        m_buffer = std::move(buffer);
+        m_head = 0;
+        m_regionStart = 0;
+        m_regionEnd = 0;
+    }
+
+    size_t NxStreamRing::getCapacity() const
+    {
+        return m_buffer ? m_buffer->getSize() / m_elementSize : 0;
+    }
+
+    std::optional<size_t> NxStreamRing::placement(const size_t count) const
+    {
+        const size_t capacity = getCapacity();
+        if (m_regionEnd != m_regionStart) {
+            if (m_regionEnd + count > capacity)
+                return std::nullopt;
+            return m_regionEnd;
+        }
+        if (count > capacity)
+            return std::nullopt;
+        return m_head + count > capacity ? 0 : m_head;
+    }
+
+    bool NxStreamRing::canAppend(const size_t count) const
+    {
+        const auto offset = placement(count);
+        return offset && (count == 0 || !m_buffer->isRangeLocked(*offset * m_elementSize, count * m_elementSize));
+    }
+
+    size_t NxStreamRing::append(const size_t count)
+    {
+        const auto offset = placement(count);
+        if (!offset) {
+            if (m_regionEnd != m_regionStart && count <= getCapacity())
+                THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Stream ring region must be closed before wrapping");
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER",
+                            std::format("{} elements do not fit in a stream ring of {}", count, getCapacity()));
+        }
+        if (count == 0)
+            return *offset;
+        if (m_buffer->isRangeLocked(*offset * m_elementSize, count * m_elementSize)) {
+            ++m_stallCount;
+            m_buffer->waitRange(*offset * m_elementSize, count * m_elementSize);
+        }
+        if (m_regionEnd == m_regionStart)
+            m_regionStart = *offset;
+        m_regionEnd = *offset + count;
+        return *offset;
+    }
+
+    void NxStreamRing::close()
+    {
+        if (m_regionEnd != m_regionStart)
+            m_buffer->lockRange(m_regionStart * m_elementSize, (m_regionEnd - m_regionStart) * m_elementSize);
+        m_head = m_regionEnd;
+        m_regionStart = m_regionEnd;
+    }
+
+    std::byte *NxStreamRing::getElement(const size_t index) const
+    {
+        return m_buffer->getMapping() + index * m_elementSize;
+    }
+
+}
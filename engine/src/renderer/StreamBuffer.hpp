@@ -0,0 +1,171 @@
+//// StreamBuffer.hpp /////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the persistently mapped buffers streaming dynamic geometry
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Buffer.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+namespace nexo::renderer {
+
+    enum class NxStreamBufferTarget {
+        VERTEX,
+        INDEX
+    };
+
+    /**
+     * @class NxStreamBuffer
+     * @brief Buffer persistently mapped in client memory, written by the CPU while the GPU reads other parts of it.
+     *
+     * Nothing is uploaded: writes to the mapping are visible to the draws issued after them. A range read by draws
+     * is fenced with `lockRange` once they are issued, and must not be written again before `isRangeLocked` returns
+     * false or `waitRange` returns.
+     *
+     * @note Stream buffers are only meant to be used on the rendering thread.
+     */
+    class NxStreamBuffer {
+        public:
+            virtual ~NxStreamBuffer() = default;
+
+            /**
+             * @brief Binds the buffer as the vertex or index buffer of the pipeline.
+             */
+            virtual void bind(NxStreamBufferTarget target) const = 0;
+            virtual void unbind(NxStreamBufferTarget target) const = 0;
+
+            [[nodiscard]] virtual std::byte *getMapping() = 0;
+            [[nodiscard]] virtual size_t getSize() const = 0;
+
+            /**
+             * @brief Fences a range read by the draws issued so far.
+             */
+            virtual void lockRange(size_t offset, size_t size) = 0;
+
+            /**
+             * @brief Tells whether the GPU may still read a part of the range, without waiting.
+             */
+            [[nodiscard]] virtual bool isRangeLocked(size_t offset, size_t size) = 0;
+
+            /**
+             * @brief Blocks until the GPU is done with every fenced part of the range.
+             */
+            virtual void waitRange(size_t offset, size_t size) = 0;
+
+            [[nodiscard]] virtual unsigned int getId() const = 0;
+    };
+
+    /**
+     * @brief Creates a stream buffer of the given size (in bytes) on the active graphics API.
+     *
+     * Throws:
+     * - NxUnknownGraphicsApi exception if no graphics API is defined.
+     */
+    std::shared_ptr<NxStreamBuffer> createStreamBuffer(size_t size);
+
+    /**
+     * @brief Vertex buffer reading from a stream buffer, to attach it to a vertex array.
+     *
+     * `setData` and `setSubData` write to the mapping, the caller is responsible for the range not being locked.
+     */
+    std::shared_ptr<NxVertexBuffer> createStreamVertexBuffer(std::shared_ptr<NxStreamBuffer> buffer,
+                                                             const NxBufferLayout &layout);
+
+    /**
+     * @brief Index buffer reading from a stream buffer, its count is the number of indices the buffer can hold.
+     */
+    std::shared_ptr<NxIndexBuffer> createStreamIndexBuffer(std::shared_ptr<NxStreamBuffer> buffer);
+
+    /**
+     * @class NxStreamRing
+     * @brief Hands out the elements of a stream buffer as a ring, never overwriting what the GPU still reads.
+     *
+     * Elements are appended to an open region, which is contiguous so it can be drawn by a single call selecting
+     * it through its first index or base vertex. Once its draws are issued, `close` fences the region and the next
+     * one starts after it, wrapping to the beginning of the buffer when the end is reached.
+     */
+    class NxStreamRing {
+        public:
+            explicit NxStreamRing(size_t elementSize) : m_elementSize(elementSize) {}
+
+            /**
+             * @brief Streams to a new buffer, starting over from its beginning.
+             *
+             * The previous buffer is released as is: its fenced ranges must not be written anymore.
+             */
+            void setBuffer(std::shared_ptr<NxStreamBuffer> buffer);
+            [[nodiscard]] const std::shared_ptr<NxStreamBuffer> &getBuffer() const { return m_buffer; }
+
+            /**
+             * @brief Number of elements the buffer holds, 0 without a buffer.
+             */
+            [[nodiscard]] size_t getCapacity() const;
+
+            /**
+             * @brief Tells whether `append` would return without waiting for the GPU.
+             */
+            [[nodiscard]] bool canAppend(size_t count) const;
+
+            /**
+             * @brief Appends elements to the open region.
+             *
+             * Waits for the GPU to release the elements when `canAppend` is false. An empty region starts at the
+             * head of the ring, or at the beginning of the buffer when the elements do not fit before its end.
+             *
+             * @return Offset of the first appended element in the buffer.
+             *
+             * Throws:
+             * - NxInvalidValue if the elements do not fit in the buffer, or after the open region: close it first.
+             */
+            size_t append(size_t count);
+
+            /**
+             * @brief Fences the open region, to call once the draws reading it are issued.
+             */
+            void close();
+
+            [[nodiscard]] size_t getRegionStart() const { return m_regionStart; }
+            [[nodiscard]] size_t getRegionCount() const { return m_regionEnd - m_regionStart; }
+
+            /**
+             * @brief Mapped memory of an element of the buffer.
+             */
+            [[nodiscard]] std::byte *getElement(size_t index) const;
+
+            /**
+             * @brief Number of times `append` waited for the GPU.
+             */
+            [[nodiscard]] size_t getStallCount() const { return m_stallCount; }
+
+        private:
+            /**
+             * @brief Offset where `count` elements would be appended, nullopt when they cannot fit.
+             */
+            [[nodiscard]] std::optional<size_t> placement(size_t count) const;
+
+            std::shared_ptr<NxStreamBuffer> m_buffer;
+            size_t m_elementSize;
+            size_t m_head = 0;          //< End of the last closed region
+            size_t m_regionStart = 0;
+            size_t m_regionEnd = 0;
+            size_t m_stallCount = 0;
+    };
+
+}
@@ -17,14 +17,19 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "Texture.hpp"
+#include "TextureRegistry.hpp"
 #include "Renderer.hpp"
 #include "renderer/RendererExceptions.hpp"
 #include "String.hpp"
 
+#include "GraphicsApi.hpp"
+#include "headless/HeadlessTexture2D.hpp"
 #ifdef NX_GRAPHICS_API_OPENGL
     #include "opengl/OpenGlTexture2D.hpp"
 #endif
 
+#include <algorithm>
+
 namespace nexo::renderer {
 
     NxTextureFormat NxTextureFormatFromString(const std::string_view& format)
@@ -33,6 +38,10 @@ namespace nexo::renderer {
         if (iequals(format, "RG8"))   return NxTextureFormat::RG8;
         if (iequals(format, "RGB8"))  return NxTextureFormat::RGB8;
         if (iequals(format, "RGBA8")) return NxTextureFormat::RGBA8;
+        if (iequals(format, "BC1"))   return NxTextureFormat::BC1;
+        if (iequals(format, "BC3"))   return NxTextureFormat::BC3;
+        if (iequals(format, "BC5"))   return NxTextureFormat::BC5;
+        if (iequals(format, "BC7"))   return NxTextureFormat::BC7;
         return NxTextureFormat::INVALID;
     }
 
@@ -46,10 +55,37 @@ namespace nexo::renderer {
         }
     }
 
+    void NxTextureCheckMipLevels(const std::span<const NxTextureMipLevel> levels, const NxTextureFormat format,
+                                 const std::string &backendApi)
+    {
+        if (levels.empty())
+            THROW_EXCEPTION(NxInvalidValue, backendApi, "Mip chain is empty");
+        for (size_t i = 0; i < levels.size(); ++i) {
+            const auto &level = levels[i];
+            if (!level.data)
+                THROW_EXCEPTION(NxInvalidValue, backendApi, "Mip level data is null");
+            if (i > 0 && (level.width != std::max(levels[i - 1].width / 2, 1u)
+                          || level.height != std::max(levels[i - 1].height / 2, 1u)))
+                THROW_EXCEPTION(NxInvalidValue, backendApi, "Mip level is not half the size of the previous one");
+            if (const size_t expectedSize = NxTextureFormatImageSize(format, level.width, level.height);
+                level.size != expectedSize)
+                THROW_EXCEPTION(NxTextureSizeMismatch, backendApi, level.size, expectedSize);
+        }
+    }
+
+    // Every texture gets its registry handle as soon as it exists
+    static std::shared_ptr<NxTexture2D> registered(std::shared_ptr<NxTexture2D> texture)
+    {
+        NxTextureRegistry::get().add(texture);
+        return texture;
+    }
+
     std::shared_ptr<NxTexture2D> NxTexture2D::create(unsigned int width, unsigned int height)
     {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return registered(std::make_shared<NxHeadlessTexture2D>(width, height));
         #ifdef NX_GRAPHICS_API_OPENGL
-            return std::make_shared<NxOpenGlTexture2D>(width, height);
+            return registered(std::make_shared<NxOpenGlTexture2D>(width, height));
         #else
             THROW_EXCEPTION(NxUnknownGraphicsApi, "UNKNOWN");
         #endif
@@ -58,8 +94,10 @@ namespace nexo::renderer {
     std::shared_ptr<NxTexture2D> NxTexture2D::create(const uint8_t *buffer, unsigned int width, unsigned int height,
         NxTextureFormat format)
     {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return registered(std::make_shared<NxHeadlessTexture2D>(buffer, width, height, format));
         #ifdef NX_GRAPHICS_API_OPENGL
-            return std::make_shared<NxOpenGlTexture2D>(buffer, width, height, format);
+            return registered(std::make_shared<NxOpenGlTexture2D>(buffer, width, height, format));
         #else
             THROW_EXCEPTION(NxUnknownGraphicsApi, "UNKNOWN");
         #endif
@@ -67,8 +105,10 @@ namespace nexo::renderer {
 
     std::shared_ptr<NxTexture2D> NxTexture2D::create(const uint8_t* buffer, unsigned int len)
     {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return registered(std::make_shared<NxHeadlessTexture2D>(buffer, len));
         #ifdef NX_GRAPHICS_API_OPENGL
-            return std::make_shared<NxOpenGlTexture2D>(buffer, len);
+            return registered(std::make_shared<NxOpenGlTexture2D>(buffer, len));
         #else
             THROW_EXCEPTION(NxUnknownGraphicsApi, "UNKNOWN");
         #endif
@@ -76,8 +116,22 @@ namespace nexo::renderer {
 
     std::shared_ptr<NxTexture2D> NxTexture2D::create(const std::string &path)
     {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return registered(std::make_shared<NxHeadlessTexture2D>(path));
+        #ifdef NX_GRAPHICS_API_OPENGL
+            return registered(std::make_shared<NxOpenGlTexture2D>(path));
+        #else
+            THROW_EXCEPTION(NxUnknownGraphicsApi, "UNKNOWN");
+        #endif
+    }
+
+    std::shared_ptr<NxTexture2D> NxTexture2D::create(const std::span<const NxTextureMipLevel> levels,
+        const NxTextureFormat format)
+    {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return registered(std::make_shared<NxHeadlessTexture2D>(levels, format));
         #ifdef NX_GRAPHICS_API_OPENGL
-            return std::make_shared<NxOpenGlTexture2D>(path);
+            return registered(std::make_shared<NxOpenGlTexture2D>(levels, format));
         #else
             THROW_EXCEPTION(NxUnknownGraphicsApi, "UNKNOWN");
         #endif
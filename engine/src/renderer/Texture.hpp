@@ -17,7 +17,10 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 
@@ -69,8 +72,10 @@ namespace nexo::renderer {
      * - `RG8` represents a two-channel texture with 8 bits per channel.
      * - `RGB8` represents a three-channel texture with 8 bits per channel.
      * - `RGBA8` represents a four-channel texture with 8 bits per channel.
+     * - `BC1` to `BC7` are block compressed formats, storing 4x4 pixel blocks in 8 or 16 bytes.
      *
      * @note If a texture format is invalid, it is represented by `INVALID`, which value is 0.
+     * @note Uncompressed formats are numbered after their channel count.
      */
     enum class NxTextureFormat {
         INVALID = 0, // Invalid texture format, used for error reporting
@@ -80,9 +85,42 @@ namespace nexo::renderer {
         RGB8,        // 3 channels RED GREEN BLUE, 8 bits per channel
         RGBA8,       // 4 channels RED GREEN BLUE ALPHA, 8 bits per channel
 
+        BC1,         // RGB, 8 bytes per 4x4 block (DXT1)
+        BC3,         // RGBA, 16 bytes per 4x4 block (DXT5)
+        BC5,         // RG, 16 bytes per 4x4 block (two BC4 channels)
+        BC7,         // RGBA, 16 bytes per 4x4 block
+
         _NB_FORMATS_ // Number of texture formats, used for array sizing
     };
 
+    [[nodiscard]] constexpr bool NxTextureFormatIsCompressed(const NxTextureFormat format)
+    {
+        return format >= NxTextureFormat::BC1 && format < NxTextureFormat::_NB_FORMATS_;
+    }
+
+    /**
+     * @brief Returns the size in bytes of a width x height image stored in the given format.
+     *
+     * Block compressed images are made of whole 4x4 blocks, so their size is rounded up to a multiple of the block.
+     */
+    [[nodiscard]] constexpr size_t NxTextureFormatImageSize(const NxTextureFormat format, const unsigned int width,
+                                                            const unsigned int height)
+    {
+        const size_t blocks = static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4);
+        switch (format) {
+            case NxTextureFormat::R8:
+            case NxTextureFormat::RG8:
+            case NxTextureFormat::RGB8:
+            case NxTextureFormat::RGBA8:
+                return static_cast<size_t>(width) * height * static_cast<size_t>(format);
+            case NxTextureFormat::BC1: return blocks * 8;
+            case NxTextureFormat::BC3:
+            case NxTextureFormat::BC5:
+            case NxTextureFormat::BC7: return blocks * 16;
+            default: return 0;
+        }
+    }
+
     /**
      * @brief Converts a NxTextureFormat enum value to its string representation.
      *
@@ -99,6 +137,10 @@ namespace nexo::renderer {
             case NxTextureFormat::RG8:   return "RG8";
             case NxTextureFormat::RGB8:  return "RGB8";
             case NxTextureFormat::RGBA8: return "RGBA8";
+            case NxTextureFormat::BC1:   return "BC1";
+            case NxTextureFormat::BC3:   return "BC3";
+            case NxTextureFormat::BC5:   return "BC5";
+            case NxTextureFormat::BC7:   return "BC7";
             default: return "INVALID";
         }
     }
@@ -127,6 +169,31 @@ namespace nexo::renderer {
      */
     void NxTextureFormatConvertArgb8ToRgba8(uint8_t *bytes, size_t size);
 
+    /**
+     * @brief One level of a mip chain, pointing to pixels stored in the level's texture format.
+     */
+    struct NxTextureMipLevel {
+        const uint8_t *data = nullptr;
+        size_t size = 0;
+        unsigned int width = 0;
+        unsigned int height = 0;
+    };
+
+    /**
+     * @brief Checks a mip chain before its upload.
+     *
+     * @throws NxInvalidValue If the chain is empty, a level has no data or is not half the size of the previous one.
+     * @throws NxTextureSizeMismatch If the size of a level does not match its dimensions in the given format.
+     */
+    void NxTextureCheckMipLevels(std::span<const NxTextureMipLevel> levels, NxTextureFormat format,
+                                 const std::string &backendApi);
+
+    /**
+     * @brief Stable identifier of a 2D texture in the `NxTextureRegistry`.
+     */
+    using NxTextureHandle = uint32_t;
+    constexpr NxTextureHandle NX_INVALID_TEXTURE_HANDLE = std::numeric_limits<NxTextureHandle>::max();
+
     class NxTexture2D :  public NxTexture {
         public:
             /**
@@ -211,6 +278,36 @@ namespace nexo::renderer {
             * ```
             */
             static std::shared_ptr<NxTexture2D> create(const std::string &path);
+
+            /**
+             * @brief Creates a 2D texture from a precomputed mip chain.
+             *
+             * The levels are uploaded as they are, without any conversion: block compressed formats are handed to the
+             * GPU still compressed. Textures created this way cannot be updated with `setData`.
+             *
+             * @param levels Mip levels, from the full resolution image down, each level half the size of the previous.
+             * @param format Format of every level.
+             * @return A shared pointer to the created `NxTexture2D` instance.
+             *
+             * Example:
+             * ```cpp
+             * const auto cooked = assets::TextureCooker::load("textures/brick_wall.nxtex");
+             * auto texture = NxTexture2D::create(cooked.mipLevels(), cooked.format);
+             * ```
+             */
+            static std::shared_ptr<NxTexture2D> create(std::span<const NxTextureMipLevel> levels, NxTextureFormat format);
+
+            /**
+             * @brief Returns the handle assigned to the texture by the `NxTextureRegistry`.
+             *
+             * Textures built through the `create` factories are registered right away, the handle stays the same for
+             * the whole lifetime of the texture. Returns NX_INVALID_TEXTURE_HANDLE for a texture never registered.
+             */
+            [[nodiscard]] NxTextureHandle getHandle() const { return m_handle; }
+
+        private:
+            friend class NxTextureRegistry;
+            NxTextureHandle m_handle = NX_INVALID_TEXTURE_HANDLE;
     };
 
 }
@@ -0,0 +1,214 @@
+//// TextureUploadQueue.cpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the asynchronous texture decode and upload queue
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "TextureUploadQueue.hpp"
+#include "TextureRegistry.hpp"
+#include "RendererExceptions.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stb_image.h>
+
+namespace nexo::renderer {
+
+    static NxTextureImage imageFromStb(stbi_uc *data, const int width, const int height, const int channels,
+                                       const bool flipVertically, const std::string &debugPath)
+    {
+        if (channels < 1 || channels > 4) {
+            stbi_image_free(data);
+            THROW_EXCEPTION(NxTextureUnsupportedFormat, "DECODE", channels, debugPath);
+        }
+
+        NxTextureImage image;
+        image.width = static_cast<unsigned int>(width);
+        image.height = static_cast<unsigned int>(height);
+        // Formats are numbered after their channel count
+        image.format = static_cast<NxTextureFormat>(channels);
+
+        const size_t rowSize = static_cast<size_t>(width) * static_cast<size_t>(channels);
+        image.pixels.resize(rowSize * static_cast<size_t>(height));
+        // Flipped by hand, the decode functions pin the flip of stb_image off for the calling thread
+        for (size_t row = 0; row < image.height; ++row) {
+            const size_t sourceRow = flipVertically ? image.height - 1 - row : row;
+            std::copy_n(data + sourceRow * rowSize, rowSize, image.pixels.data() + row * rowSize);
+        }
+        stbi_image_free(data);
+        return image;
+    }
+
+    NxTextureImage NxDecodeTextureFile(const std::string &path, const bool flipVertically)
+    {
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        // The synchronous loaders set the process-wide flip, it must not flip the rows a second time
+        stbi_set_flip_vertically_on_load_thread(0);
+        stbi_uc *data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+        if (!data)
+            THROW_EXCEPTION(NxFileNotFoundException, path);
+        return imageFromStb(data, width, height, channels, flipVertically, path);
+    }
+
+    NxTextureImage NxDecodeTextureMemory(const uint8_t *buffer, const size_t len, const bool flipVertically)
+    {
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        stbi_set_flip_vertically_on_load_thread(0);
+        stbi_uc *data = stbi_load_from_memory(buffer, static_cast<int>(len), &width, &height, &channels, 0);
+        if (!data)
+            THROW_EXCEPTION(NxTextureUnsupportedFormat, "DECODE", channels, "(buffer)");
+        return imageFromStb(data, width, height, channels, flipVertically, "(buffer)");
+    }
+
+    NxStreamedTexture2D::NxStreamedTexture2D(std::shared_ptr<NxTexture2D> placeholder)
+        : m_placeholder(std::move(placeholder))
+    {
+        if (!m_placeholder)
+            THROW_EXCEPTION(NxInvalidValue, "STREAMING", "Placeholder texture is null");
+    }
+
+    void NxStreamedTexture2D::setData(void *data, const size_t size)
+    {
+        if (!m_resident) {
+            LOG(NEXO_WARN, "NxStreamedTexture2D: setData ignored, the texture is not uploaded yet");
+            return;
+        }
+        m_resident->setData(data, size);
+    }
+
+    NxTextureUploadQueue &NxTextureUploadQueue::get()
+    {
+        static NxTextureUploadQueue queue;
+        return queue;
+    }
+
+    std::shared_ptr<NxTexture2D> NxTextureUploadQueue::placeholder()
+    {
+        if (!m_placeholder) {
+            m_placeholder = NxTexture2D::create(1, 1);
+            unsigned int white = 0xffffffff;
+            m_placeholder->setData(&white, sizeof(unsigned int));
+        }
+        return m_placeholder;
+    }
+
+    std::shared_ptr<NxStreamedTexture2D> NxTextureUploadQueue::enqueue(Decoder decoder, std::string debugName)
+    {
+        auto texture = std::make_shared<NxStreamedTexture2D>(placeholder());
+        NxTextureRegistry::get().add(texture);
+
+        {
+            std::scoped_lock lock(m_mutex);
+            ++m_decoding;
+        }
+        m_workers.submit([this, weakTexture = std::weak_ptr(texture), decoder = std::move(decoder),
+                          debugName = std::move(debugName)] {
+            DecodedTexture decoded{weakTexture, {}, debugName, {}};
+            // Nobody is waiting for this texture anymore, skip the decode
+            if (!weakTexture.expired()) {
+                try {
+                    decoded.image = decoder();
+                } catch (const std::exception &e) {
+                    decoded.error = e.what();
+                }
+            }
+            {
+                std::scoped_lock lock(m_mutex);
+                m_decoded.push_back(std::move(decoded));
+                --m_decoding;
+            }
+            m_decodeDone.notify_all();
+        });
+        return texture;
+    }
+
+    void NxTextureUploadQueue::upload(DecodedTexture &decoded)
+    {
+        const auto texture = decoded.texture.lock();
+        if (!texture)
+            return;
+        if (!decoded.error.empty()) {
+            LOG(NEXO_WARN, "NxTextureUploadQueue: failed to decode {}: {}", decoded.debugName, decoded.error);
+            texture->m_status = NxStreamedTexture2D::Status::FAILED;
+            return;
+        }
+        try {
+            const auto &image = decoded.image;
+            texture->m_resident = NxTexture2D::create(image.pixels.data(), image.width, image.height, image.format);
+            texture->m_status = NxStreamedTexture2D::Status::RESIDENT;
+        } catch (const Exception &e) {
+            LOG(NEXO_WARN, "NxTextureUploadQueue: failed to upload {}: {}", decoded.debugName, e.getMessage());
+            texture->m_status = NxStreamedTexture2D::Status::FAILED;
+        }
+    }
+
+    size_t NxTextureUploadQueue::processUploads(const size_t byteBudget)
+    {
+        size_t uploadedBytes = 0;
+        bool first = true;
+        while (true) {
+            DecodedTexture decoded;
+            {
+                std::scoped_lock lock(m_mutex);
+                if (m_decoded.empty())
+                    break;
+                const size_t size = m_decoded.front().image.pixels.size();
+                if (!first && uploadedBytes + size > byteBudget)
+                    break;
+                decoded = std::move(m_decoded.front());
+                m_decoded.pop_front();
+            }
+            // Released textures and failed decodes do not count against the budget
+            if (!decoded.texture.expired() && decoded.error.empty()) {
+                uploadedBytes += decoded.image.pixels.size();
+                first = false;
+            }
+            upload(decoded);
+        }
+        return uploadedBytes;
+    }
+
+    void NxTextureUploadQueue::waitForDecodes()
+    {
+        std::unique_lock lock(m_mutex);
+        m_decodeDone.wait(lock, [this] { return m_decoding == 0; });
+    }
+
+    void NxTextureUploadQueue::finish()
+    {
+        waitForDecodes();
+        processUploads(std::numeric_limits<size_t>::max());
+    }
+
+    void NxTextureUploadQueue::shutdown()
+    {
+        waitForDecodes();
+        std::scoped_lock lock(m_mutex);
+        m_decoded.clear();
+        m_placeholder.reset();
+    }
+
+    size_t NxTextureUploadQueue::pendingCount() const
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_decoding + m_decoded.size();
+    }
+
+}
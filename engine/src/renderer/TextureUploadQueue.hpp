@@ -0,0 +1,205 @@
+//// TextureUploadQueue.hpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the asynchronous texture decode and upload queue
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Texture.hpp"
+#include "core/thread/WorkerPool.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @brief Decoded pixels of a 2D texture, ready to be uploaded.
+     *
+     * Rows are tightly packed and the first pixel is the bottom-left-most one, as expected by
+     * `NxTexture2D::create(const uint8_t *, unsigned int, unsigned int, NxTextureFormat)`.
+     */
+    struct NxTextureImage {
+        std::vector<uint8_t> pixels;
+        unsigned int width = 0;
+        unsigned int height = 0;
+        NxTextureFormat format = NxTextureFormat::INVALID;
+    };
+
+    /**
+     * @brief Decodes an image file (any format supported by stb_image) on the calling thread.
+     *
+     * @param path Path of the image file.
+     * @param flipVertically Whether the first decoded row should be the bottom one.
+     * @throws NxFileNotFoundException If the file cannot be read or decoded.
+     * @throws NxTextureUnsupportedFormat If the image has an unsupported channel count.
+     */
+    NxTextureImage NxDecodeTextureFile(const std::string &path, bool flipVertically = true);
+
+    /**
+     * @brief Decodes an image file held in memory on the calling thread.
+     *
+     * @throws NxTextureUnsupportedFormat If the buffer cannot be decoded.
+     */
+    NxTextureImage NxDecodeTextureMemory(const uint8_t *buffer, size_t len, bool flipVertically = false);
+
+    /**
+     * @class NxStreamedTexture2D
+     * @brief Texture whose pixels are still being decoded or waiting for their upload.
+     *
+     * Until the upload completes every call is forwarded to a placeholder texture, afterwards to the uploaded texture.
+     * Holders of the texture never need to swap it: the object keeps its identity (and registry handle) for its whole
+     * lifetime.
+     */
+    class NxStreamedTexture2D final : public NxTexture2D {
+        public:
+            enum class Status {
+                PENDING,    ///< Decoding or waiting for its upload, the placeholder is used
+                RESIDENT,   ///< Uploaded
+                FAILED      ///< Decoding or uploading failed, the placeholder is kept
+            };
+
+            explicit NxStreamedTexture2D(std::shared_ptr<NxTexture2D> placeholder);
+            ~NxStreamedTexture2D() override = default;
+
+            [[nodiscard]] Status getStatus() const { return m_status; }
+            [[nodiscard]] bool isResident() const { return m_status == Status::RESIDENT; }
+
+            [[nodiscard]] unsigned int getWidth() const override { return target().getWidth(); }
+            [[nodiscard]] unsigned int getHeight() const override { return target().getHeight(); }
+            [[nodiscard]] unsigned int getMaxTextureSize() const override { return target().getMaxTextureSize(); }
+            [[nodiscard]] unsigned int getId() const override { return target().getId(); }
+
+            void bind(const unsigned int slot = 0) const override { target().bind(slot); }
+            void unbind(const unsigned int slot = 0) const override { target().unbind(slot); }
+
+            /**
+             * @brief Updates the uploaded texture, ignored (with a warning) while the placeholder is in use.
+             */
+            void setData(void *data, size_t size) override;
+
+        private:
+            friend class NxTextureUploadQueue;
+
+            [[nodiscard]] const NxTexture2D &target() const { return m_resident ? *m_resident : *m_placeholder; }
+
+            std::shared_ptr<NxTexture2D> m_placeholder;
+            std::shared_ptr<NxTexture2D> m_resident;
+            Status m_status = Status::PENDING;
+    };
+
+    /**
+     * @class NxTextureUploadQueue
+     * @brief Decodes textures on worker threads and uploads them from the rendering thread under a per-frame budget.
+     *
+     * `enqueue` immediately returns a `NxStreamedTexture2D` showing the placeholder and schedules the decoder on the
+     * worker pool. Decoded images wait in the queue until `processUploads` (called once per frame by the application)
+     * turns them into GPU textures, stopping once the frame byte budget is spent so loading many large textures is
+     * spread over several frames instead of stalling one.
+     *
+     * A texture released before its upload is simply dropped from the queue.
+     *
+     * @note `enqueue` and `processUploads` must be called from the rendering thread.
+     */
+    class NxTextureUploadQueue {
+        public:
+            static constexpr size_t DEFAULT_FRAME_BUDGET = 32 * 1024 * 1024;
+
+            using Decoder = std::function<NxTextureImage()>;
+
+            static NxTextureUploadQueue &get();
+
+            /**
+             * @brief Schedules a texture decode on the worker pool.
+             *
+             * @param decoder Callable producing the pixels, run on a worker thread. Exceptions it throws mark the
+             *                texture as failed.
+             * @param debugName Name used in the logs.
+             * @return The texture, showing the placeholder until its upload.
+             */
+            std::shared_ptr<NxStreamedTexture2D> enqueue(Decoder decoder, std::string debugName = "(buffer)");
+
+            /**
+             * @brief Uploads decoded textures until the frame budget is spent.
+             *
+             * At least one texture is uploaded per call when one is ready, even if it is larger than the budget.
+             *
+             * @return The number of bytes uploaded.
+             */
+            size_t processUploads() { return processUploads(m_frameBudget); }
+            size_t processUploads(size_t byteBudget);
+
+            /**
+             * @brief Blocks until every scheduled decode is done, without uploading anything.
+             */
+            void waitForDecodes();
+
+            /**
+             * @brief Waits for every pending decode and uploads everything, regardless of the budget.
+             */
+            void finish();
+
+            void setFrameBudget(const size_t bytes) { m_frameBudget = bytes; }
+            [[nodiscard]] size_t getFrameBudget() const { return m_frameBudget; }
+
+            /**
+             * @brief Waits for the pending decodes, drops the textures not uploaded yet and releases the placeholder.
+             *
+             * The queue holds the placeholder for its whole lifetime otherwise, and being a static singleton it would
+             * only be released once the graphics context is gone. The queue can still be used afterwards, a new
+             * placeholder is then created.
+             */
+            void shutdown();
+
+            /**
+             * @brief Texture shown until the upload completes, a 1x1 white texture is created if none was set.
+             */
+            void setPlaceholder(std::shared_ptr<NxTexture2D> placeholder) { m_placeholder = std::move(placeholder); }
+
+            /// Number of textures either being decoded or waiting for their upload
+            [[nodiscard]] size_t pendingCount() const;
+
+        private:
+            NxTextureUploadQueue() = default;
+
+            struct DecodedTexture {
+                std::weak_ptr<NxStreamedTexture2D> texture;
+                NxTextureImage image;
+                std::string debugName;
+                std::string error;
+            };
+
+            std::shared_ptr<NxTexture2D> placeholder();
+            void upload(DecodedTexture &decoded);
+
+            std::shared_ptr<NxTexture2D> m_placeholder;
+            size_t m_frameBudget = DEFAULT_FRAME_BUDGET;
+
+            mutable std::mutex m_mutex;
+            std::condition_variable m_decodeDone;
+            std::deque<DecodedTexture> m_decoded;
+            size_t m_decoding = 0;
+
+            // Declared last so the workers are joined before the state they report to is destroyed
+            thread::WorkerPool m_workers;
+    };
+
+}
@@ -17,6 +17,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "VertexArray.hpp"
 #include "renderer/RendererExceptions.hpp"
+#include "GraphicsApi.hpp"
+#include "headless/HeadlessVertexArray.hpp"
 #ifdef NX_GRAPHICS_API_OPENGL
     #include "opengl/OpenGlVertexArray.hpp"
 #endif
@@ -25,6 +27,8 @@ namespace nexo::renderer {
 
     std::shared_ptr<NxVertexArray> createVertexArray()
     {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return std::make_shared<NxHeadlessVertexArray>();
         #ifdef NX_GRAPHICS_API_OPENGL
             return std::make_shared<NxOpenGlVertexArray>();
         #else
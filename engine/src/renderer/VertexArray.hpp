@@ -21,6 +21,18 @@
 
 namespace nexo::renderer {
 
+    /**
+     * @brief Part of a vertex array drawn by a mesh.
+     *
+     * Meshes sharing the buffers of the mesh pool (see `NxMeshPool`) each draw their own range, the others draw the
+     * whole index buffer of their vertex array.
+     */
+    struct NxMeshRange {
+        uint32_t indexCount = 0;    ///< Number of indices to draw, 0 for the whole index buffer
+        uint32_t firstIndex = 0;
+        int32_t baseVertex = 0;     ///< Added to every index before fetching the vertex
+    };
+
     /**
     * @class NxVertexArray
     * @brief Abstract class representing a vertex array in the rendering system.
@@ -0,0 +1,228 @@
+//// VertexFormat /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the compact vertex formats
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "VertexFormat.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace nexo::renderer {
+
+    static constexpr float SNORM16_MAX = 32767.0f;
+    static constexpr float UNORM16_MAX = 65535.0f;
+    // The tangent keeps 14 bits for its second component, the sign of the stored value being the handedness
+    static constexpr float TANGENT_Y_MAX = 16383.0f;
+
+    static int16_t toSnorm16(const float value)
+    {
+        return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * SNORM16_MAX));
+    }
+
+    static float fromSnorm16(const int16_t value)
+    {
+        // Same conversion as the one done by OpenGL for normalized attributes
+        return std::max(static_cast<float>(value) / SNORM16_MAX, -1.0f);
+    }
+
+    static glm::vec2 encodeOctahedralFloat(const glm::vec3 &direction)
+    {
+        const float l1Norm = std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z);
+        if (l1Norm <= 0.0f)
+            return {0.0f, 0.0f};
+
+        const glm::vec3 n = direction / l1Norm;
+        if (n.z >= 0.0f)
+            return {n.x, n.y};
+        // Fold the lower hemisphere over the diagonals of the square
+        return {(1.0f - std::abs(n.y)) * (n.x >= 0.0f ? 1.0f : -1.0f),
+                (1.0f - std::abs(n.x)) * (n.y >= 0.0f ? 1.0f : -1.0f)};
+    }
+
+    static glm::vec3 decodeOctahedralFloat(const glm::vec2 &encoded)
+    {
+        glm::vec3 n(encoded.x, encoded.y, 1.0f - std::abs(encoded.x) - std::abs(encoded.y));
+        const float t = std::max(-n.z, 0.0f);
+        n.x += n.x >= 0.0f ? -t : t;
+        n.y += n.y >= 0.0f ? -t : t;
+        return glm::normalize(n);
+    }
+
+    uint16_t floatToHalf(const float value)
+    {
+        const auto bits = std::bit_cast<uint32_t>(value);
+        const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+        const uint32_t magnitude = bits & 0x7fffffffu;
+
+        if (magnitude >= 0x7f800000u) // Infinity and NaN
+            return sign | 0x7c00u | (magnitude > 0x7f800000u ? 0x0200u : 0u);
+        if (magnitude >= 0x477ff000u) // Rounds over 65504, the largest half float
+            return sign | 0x7c00u;
+        if (magnitude < 0x38800000u) { // Under 2^-14, subnormal half float
+            const float scaled = std::bit_cast<float>(magnitude) * 16777216.0f; // 2^24
+            return sign | static_cast<uint16_t>(std::nearbyint(scaled));
+        }
+
+        // Rebias the exponent from 127 to 15 and round the mantissa to the nearest even value
+        uint32_t half = (magnitude - 0x38000000u) >> 13;
+        const uint32_t remainder = magnitude & 0x1fffu;
+        if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u)))
+            ++half;
+        return sign | static_cast<uint16_t>(half);
+    }
+
+    float halfToFloat(const uint16_t value)
+    {
+        const uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+        const uint32_t exponent = (value >> 10) & 0x1fu;
+        const uint32_t mantissa = value & 0x3ffu;
+
+        if (exponent == 0) {
+            const float subnormal = std::ldexp(static_cast<float>(mantissa), -24);
+            return sign ? -subnormal : subnormal;
+        }
+        if (exponent == 0x1fu)
+            return std::bit_cast<float>(sign | 0x7f800000u | (mantissa << 13));
+        return std::bit_cast<float>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+    }
+
+    std::array<int16_t, 2> encodeOctahedral(const glm::vec3 &direction)
+    {
+        const glm::vec2 encoded = encodeOctahedralFloat(direction);
+        return {toSnorm16(encoded.x), toSnorm16(encoded.y)};
+    }
+
+    glm::vec3 decodeOctahedral(const std::array<int16_t, 2> &encoded)
+    {
+        return decodeOctahedralFloat({fromSnorm16(encoded[0]), fromSnorm16(encoded[1])});
+    }
+
+    std::array<int16_t, 2> encodeTangent(const glm::vec3 &tangent, const float bitangentSign)
+    {
+        const glm::vec2 encoded = encodeOctahedralFloat(tangent);
+        const auto y = static_cast<int16_t>(std::lround((std::clamp(encoded.y, -1.0f, 1.0f) * 0.5f + 0.5f) * TANGENT_Y_MAX));
+        return {toSnorm16(encoded.x), bitangentSign < 0.0f ? static_cast<int16_t>(-y - 1) : y};
+    }
+
+    glm::vec4 decodeTangent(const std::array<int16_t, 2> &encoded)
+    {
+        const bool mirrored = encoded[1] < 0;
+        const float y = static_cast<float>(mirrored ? -encoded[1] - 1 : encoded[1]) / TANGENT_Y_MAX * 2.0f - 1.0f;
+        return {decodeOctahedralFloat({fromSnorm16(encoded[0]), y}), mirrored ? -1.0f : 1.0f};
+    }
+
+    unsigned int vertexFormatStride(const NxVertexFormat format)
+    {
+        switch (format) {
+            case NxVertexFormat::STANDARD: return sizeof(NxVertex);
+            case NxVertexFormat::COMPACT: return sizeof(NxCompactVertex);
+            case NxVertexFormat::COMPACT_QUANTIZED: return sizeof(NxQuantizedVertex);
+        }
+        return 0;
+    }
+
+    NxBufferLayout vertexFormatLayout(const NxVertexFormat format)
+    {
+        switch (format) {
+            case NxVertexFormat::STANDARD:
+                return {
+                    {NxShaderDataType::FLOAT3, "aPos"},
+                    {NxShaderDataType::FLOAT2, "aTexCoord"},
+                    {NxShaderDataType::FLOAT3, "aNormal"},
+                    {NxShaderDataType::FLOAT3, "aTangent"},
+                    {NxShaderDataType::FLOAT3, "aBiTangent"},
+                    {NxShaderDataType::INT, "aEntityID"}
+                };
+            case NxVertexFormat::COMPACT:
+                return {
+                    {NxShaderDataType::FLOAT3, "aPos"},
+                    {NxShaderDataType::HALF2, "aTexCoord"},
+                    {NxShaderDataType::SHORT2, "aNormal", true},
+                    {NxShaderDataType::SHORT2, "aTangent", true}
+                };
+            case NxVertexFormat::COMPACT_QUANTIZED:
+                return {
+                    {NxShaderDataType::USHORT4, "aPos", true},
+                    {NxShaderDataType::HALF2, "aTexCoord"},
+                    {NxShaderDataType::SHORT2, "aNormal", true},
+                    {NxShaderDataType::SHORT2, "aTangent", true}
+                };
+        }
+        return {};
+    }
+
+    template<typename CompactVertex>
+    static void packCompactAttributes(const NxVertex &vertex, CompactVertex &packed)
+    {
+        packed.texCoord = {floatToHalf(vertex.texCoord.x), floatToHalf(vertex.texCoord.y)};
+        packed.normal = encodeOctahedral(vertex.normal);
+        const float handedness = glm::dot(glm::cross(vertex.normal, vertex.tangent), vertex.bitangent);
+        packed.tangent = encodeTangent(vertex.tangent, handedness < 0.0f ? -1.0f : 1.0f);
+    }
+
+    NxPackedVertices packVertices(const std::span<const NxVertex> vertices, const NxVertexFormat format)
+    {
+        NxPackedVertices packed;
+        packed.decode.format = format;
+        packed.data.resize(vertices.size() * vertexFormatStride(format));
+
+        switch (format) {
+            case NxVertexFormat::STANDARD:
+                if (!vertices.empty())
+                    std::memcpy(packed.data.data(), vertices.data(), packed.data.size());
+                break;
+            case NxVertexFormat::COMPACT: {
+                auto *out = reinterpret_cast<NxCompactVertex *>(packed.data.data());
+                for (size_t i = 0; i < vertices.size(); ++i) {
+                    out[i].position = vertices[i].position;
+                    packCompactAttributes(vertices[i], out[i]);
+                }
+                break;
+            }
+            case NxVertexFormat::COMPACT_QUANTIZED: {
+                if (vertices.empty())
+                    break;
+                glm::vec3 minPosition(std::numeric_limits<float>::max());
+                glm::vec3 maxPosition(std::numeric_limits<float>::lowest());
+                for (const NxVertex &vertex : vertices) {
+                    minPosition = glm::min(minPosition, vertex.position);
+                    maxPosition = glm::max(maxPosition, vertex.position);
+                }
+                // A flat axis still needs a non null extent to be divided by, its vertices all quantize to 0
+                const glm::vec3 extent = glm::max(maxPosition - minPosition, glm::vec3(std::numeric_limits<float>::min()));
+                packed.decode.positionMin = minPosition;
+                packed.decode.positionExtent = extent;
+
+                auto *out = reinterpret_cast<NxQuantizedVertex *>(packed.data.data());
+                for (size_t i = 0; i < vertices.size(); ++i) {
+                    const glm::vec3 normalized = (vertices[i].position - minPosition) / extent;
+                    for (int axis = 0; axis < 3; ++axis)
+                        out[i].position[axis] = static_cast<uint16_t>(std::lround(std::clamp(normalized[axis], 0.0f, 1.0f) * UNORM16_MAX));
+                    out[i].position[3] = 0;
+                    packCompactAttributes(vertices[i], out[i]);
+                }
+                break;
+            }
+        }
+        return packed;
+    }
+
+}
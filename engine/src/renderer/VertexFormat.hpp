@@ -0,0 +1,157 @@
+//// VertexFormat /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the compact vertex formats
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Buffer.hpp"
+#include "Renderer3D.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <span>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @enum NxVertexFormat
+     * @brief Memory layout of the vertices of a mesh.
+     *
+     * - STANDARD: NxVertex as is, 60 bytes.
+     * - COMPACT: NxCompactVertex, full precision positions with half float texture coordinates and
+     *   octahedral normal and tangent, 24 bytes.
+     * - COMPACT_QUANTIZED: NxQuantizedVertex, same as COMPACT with positions stored as 16-bit fractions of the
+     *   mesh bounding box, 20 bytes.
+     *
+     * The values are mirrored by resources/shaders/common/vertex_decode.glsl.
+     */
+    enum class NxVertexFormat : uint8_t {
+        STANDARD = 0,
+        COMPACT = 1,
+        COMPACT_QUANTIZED = 2
+    };
+
+    /**
+     * @brief Compact vertex, the entity id is not stored since the mesh shaders take it as a uniform.
+     */
+    struct NxCompactVertex {
+        glm::vec3 position;
+        std::array<uint16_t, 2> texCoord;   //< Half floats
+        std::array<int16_t, 2> normal;      //< Octahedral, signed normalized
+        std::array<int16_t, 2> tangent;     //< Octahedral, signed normalized, see encodeTangent
+    };
+
+    /**
+     * @brief Compact vertex with its position quantized relative to the mesh bounding box.
+     */
+    struct NxQuantizedVertex {
+        std::array<uint16_t, 4> position;   //< Unsigned normalized, the last component is padding
+        std::array<uint16_t, 2> texCoord;
+        std::array<int16_t, 2> normal;
+        std::array<int16_t, 2> tangent;
+    };
+
+    static_assert(sizeof(NxCompactVertex) == 24);
+    static_assert(sizeof(NxQuantizedVertex) == 20);
+
+    /**
+     * @brief What the vertex shader needs to decode the vertices of a mesh.
+     *
+     * Object space positions are rebuilt as positionMin + position * positionExtent for the quantized format.
+     */
+    struct NxVertexDecode {
+        NxVertexFormat format = NxVertexFormat::STANDARD;
+        glm::vec3 positionMin{0.0f};
+        glm::vec3 positionExtent{1.0f};
+    };
+
+    /**
+     * @brief Vertices converted to a given format, ready to be uploaded to a vertex buffer.
+     */
+    struct NxPackedVertices {
+        std::vector<std::byte> data;
+        NxVertexDecode decode;
+    };
+
+    /**
+     * @brief Returns the size in bytes of one vertex of the given format.
+     */
+    [[nodiscard]] unsigned int vertexFormatStride(NxVertexFormat format);
+
+    /**
+     * @brief Returns the buffer layout of the given format.
+     *
+     * Every format keeps the attribute locations of the standard one (position, texture coordinates, normal,
+     * tangent), the compact formats only drop the bitangent and the entity id.
+     */
+    [[nodiscard]] NxBufferLayout vertexFormatLayout(NxVertexFormat format);
+
+    /**
+     * @brief Converts vertices to the given format.
+     *
+     * @param vertices Vertices to convert.
+     * @param format Format of the packed vertices.
+     * @return The packed vertices and their decode parameters.
+     */
+    [[nodiscard]] NxPackedVertices packVertices(std::span<const NxVertex> vertices, NxVertexFormat format);
+
+    /**
+     * @brief Converts a float to a half float, rounding to the nearest value.
+     *
+     * Values too large for a half float become infinite, values too small become zero.
+     */
+    [[nodiscard]] uint16_t floatToHalf(float value);
+
+    /**
+     * @brief Converts a half float back to a float.
+     */
+    [[nodiscard]] float halfToFloat(uint16_t value);
+
+    /**
+     * @brief Encodes a unit vector on the octahedron, as two signed normalized components.
+     *
+     * A null vector encodes to +Z.
+     */
+    [[nodiscard]] std::array<int16_t, 2> encodeOctahedral(const glm::vec3 &direction);
+
+    /**
+     * @brief Decodes a unit vector encoded with encodeOctahedral.
+     */
+    [[nodiscard]] glm::vec3 decodeOctahedral(const std::array<int16_t, 2> &encoded);
+
+    /**
+     * @brief Encodes a tangent and the handedness of its bitangent.
+     *
+     * The tangent is encoded on the octahedron, the second component keeps 14 bits of precision and its sign
+     * holds the handedness, so the bitangent can be rebuilt as sign * cross(normal, tangent).
+     *
+     * @param tangent Tangent to encode.
+     * @param bitangentSign Handedness of the tangent frame, negative for mirrored texture coordinates.
+     */
+    [[nodiscard]] std::array<int16_t, 2> encodeTangent(const glm::vec3 &tangent, float bitangentSign);
+
+    /**
+     * @brief Decodes a tangent encoded with encodeTangent.
+     *
+     * @return The tangent in xyz and the bitangent sign in w.
+     */
+    [[nodiscard]] glm::vec4 decodeTangent(const std::array<int16_t, 2> &encoded);
+
+}
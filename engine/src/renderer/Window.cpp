@@ -18,6 +18,8 @@
 
 #include "Window.hpp"
 #include "renderer/RendererExceptions.hpp"
+#include "GraphicsApi.hpp"
+#include "headless/HeadlessWindow.hpp"
 #ifdef NX_GRAPHICS_API_OPENGL
     #include "opengl/OpenGlWindow.hpp"
 #endif
@@ -26,6 +28,8 @@ namespace nexo::renderer {
 
     std::shared_ptr<NxWindow> NxWindow::create(int width, int height, const std::string &title)
     {
+        if (NxGetGraphicsApi() == NxGraphicsApi::HEADLESS)
+            return std::make_shared<NxHeadlessWindow>(width, height, title);
         #ifdef NX_GRAPHICS_API_OPENGL
             return std::make_shared<NxOpenGlWindow>(width, height, title);
         #else
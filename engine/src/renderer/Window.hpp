@@ -81,6 +81,36 @@ namespace nexo::renderer {
             virtual void shutdown() = 0;
             virtual void onUpdate() = 0;
 
+            /**
+            * @brief Presents the back buffer, the first half of onUpdate().
+            *
+            * Must be called from the thread the graphics context is current on.
+            */
+            virtual void swapBuffers() = 0;
+
+            /**
+            * @brief Processes the pending window events, the second half of onUpdate().
+            *
+            * Must be called from the main thread.
+            */
+            virtual void pollEvents() = 0;
+
+            /**
+            * @brief Makes the graphics context of the window current on the calling thread, or detaches it from it.
+            *
+            * Used to hand the context over to the render thread (see `NxRenderThread`) and back.
+            *
+            * @param current True to attach the context to the calling thread, false to release it.
+            */
+            virtual void makeContextCurrent(bool current) = 0;
+
+            /**
+            * @brief Tells whether the graphics context can be made current on another thread than the main one.
+            *
+            * The application renders on a dedicated thread by default when it can (see `NxRenderThread`).
+            */
+            [[nodiscard]] virtual bool supportsContextHandoff() const = 0;
+
             [[nodiscard]] virtual unsigned int getWidth() const = 0;
             [[nodiscard]] virtual unsigned int getHeight() const = 0;
 
@@ -98,6 +128,13 @@ namespace nexo::renderer {
             [[nodiscard]] virtual bool isVsync() const = 0;
 
 
+            /**
+            * @brief Returns the time elapsed since the window system was initialized, in seconds.
+            *
+            * This is the clock the application uses to compute its frame delta time.
+            */
+            [[nodiscard]] virtual double getTime() const = 0;
+
             [[nodiscard]] virtual bool isOpen() const = 0;
             virtual void close() = 0;
 
@@ -0,0 +1,68 @@
+//// HeadlessBuffer.cpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the headless vertex and index buffers
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "HeadlessBuffer.hpp"
+#include "HeadlessCommandLog.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+namespace nexo::renderer {
+
+    NxHeadlessVertexBuffer::NxHeadlessVertexBuffer([[maybe_unused]] const float *vertices, const unsigned int size)
+        : _id(NxHeadlessCommandLog::get().generateId()), _size(size)
+    {
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::UPLOAD_BUFFER, _id, size);
+    }
+
+    NxHeadlessVertexBuffer::NxHeadlessVertexBuffer(const unsigned int size)
+        : _id(NxHeadlessCommandLog::get().generateId()), _size(size)
+    {
+    }
+
+    void NxHeadlessVertexBuffer::setData([[maybe_unused]] void *data, const size_t size)
+    {
+        if (size > _size)
+            _size = size;
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::UPLOAD_BUFFER, _id, size);
+    }
+
+    void NxHeadlessVertexBuffer::setSubData([[maybe_unused]] const void *data, const size_t size, const size_t offset)
+    {
+        if (offset + size > _size)
+            THROW_EXCEPTION(NxInvalidValue, "HEADLESS", "Vertex buffer range exceeds its size");
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::UPLOAD_BUFFER, _id, size);
+    }
+
+    NxHeadlessIndexBuffer::NxHeadlessIndexBuffer() : _id(NxHeadlessCommandLog::get().generateId())
+    {
+    }
+
+    void NxHeadlessIndexBuffer::setData([[maybe_unused]] unsigned int *indices, const size_t count)
+    {
+        _count = count;
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::UPLOAD_BUFFER, _id, count * sizeof(unsigned int));
+    }
+
+    void NxHeadlessIndexBuffer::setSubData([[maybe_unused]] const unsigned int *indices, const size_t count,
+                                           const size_t offset)
+    {
+        if (offset + count > _count)
+            THROW_EXCEPTION(NxInvalidValue, "HEADLESS", "Index buffer range exceeds its count");
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::UPLOAD_BUFFER, _id, count * sizeof(unsigned int));
+    }
+
+}
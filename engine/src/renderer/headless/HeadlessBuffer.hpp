@@ -0,0 +1,75 @@
+//// HeadlessBuffer.hpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the headless vertex and index buffers
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "renderer/Buffer.hpp"
+
+namespace nexo::renderer {
+
+    /**
+    * @class NxHeadlessVertexBuffer
+    * @brief Vertex buffer of the headless backend, only keeps track of its size and layout.
+    */
+    class NxHeadlessVertexBuffer final : public NxVertexBuffer {
+        public:
+            NxHeadlessVertexBuffer(const float *vertices, unsigned int size);
+            explicit NxHeadlessVertexBuffer(unsigned int size);
+            ~NxHeadlessVertexBuffer() override = default;
+
+            void bind() const override {}
+            void unbind() const override {}
+
+            void setLayout(const NxBufferLayout &layout) override { _layout = layout; };
+            [[nodiscard]] NxBufferLayout getLayout() const override { return _layout; };
+
+            void setData(void *data, size_t size) override;
+            void setSubData(const void *data, size_t size, size_t offset) override;
+
+            [[nodiscard]] unsigned int getId() const override { return _id; };
+            [[nodiscard]] size_t getSize() const { return _size; }
+
+        private:
+            unsigned int _id{};
+            size_t _size = 0;
+            NxBufferLayout _layout;
+    };
+
+    /**
+    * @class NxHeadlessIndexBuffer
+    * @brief Index buffer of the headless backend, only keeps track of its index count.
+    */
+    class NxHeadlessIndexBuffer final : public NxIndexBuffer {
+        public:
+            NxHeadlessIndexBuffer();
+            ~NxHeadlessIndexBuffer() override = default;
+
+            void bind() const override {}
+            void unbind() const override {}
+
+            void setData(unsigned int *indices, size_t count) override;
+            void setSubData(const unsigned int *indices, size_t count, size_t offset) override;
+            [[nodiscard]] size_t getCount() const override { return _count; };
+
+            [[nodiscard]] unsigned int getId() const override { return _id; };
+
+        private:
+            unsigned int _id{};
+            size_t _count = 0;
+    };
+
+}
@@ -0,0 +1,158 @@
+//// HeadlessCommandLog.cpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the headless renderer command log
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "HeadlessCommandLog.hpp"
+
+#include <algorithm>
+#include <format>
+
+namespace nexo::renderer {
+
+    std::string_view NxHeadlessCommandTypeToString(const NxHeadlessCommandType type)
+    {
+        switch (type) {
+            case NxHeadlessCommandType::CLEAR:               return "CLEAR";
+            case NxHeadlessCommandType::SET_VIEWPORT:        return "SET_VIEWPORT";
+            case NxHeadlessCommandType::SET_STATE:           return "SET_STATE";
+            case NxHeadlessCommandType::DRAW_INDEXED:        return "DRAW_INDEXED";
+            case NxHeadlessCommandType::DRAW_UNINDEXED:      return "DRAW_UNINDEXED";
+            case NxHeadlessCommandType::MULTI_DRAW_INDIRECT: return "MULTI_DRAW_INDIRECT";
+            case NxHeadlessCommandType::BIND_SHADER:         return "BIND_SHADER";
+            case NxHeadlessCommandType::BIND_VERTEX_ARRAY:   return "BIND_VERTEX_ARRAY";
+            case NxHeadlessCommandType::BIND_TEXTURE:        return "BIND_TEXTURE";
+            case NxHeadlessCommandType::BIND_FRAMEBUFFER:    return "BIND_FRAMEBUFFER";
+            case NxHeadlessCommandType::BIND_STORAGE_BUFFER: return "BIND_STORAGE_BUFFER";
+            case NxHeadlessCommandType::SET_UNIFORM:         return "SET_UNIFORM";
+            case NxHeadlessCommandType::UPLOAD_BUFFER:       return "UPLOAD_BUFFER";
+            case NxHeadlessCommandType::UPLOAD_TEXTURE:      return "UPLOAD_TEXTURE";
+            case NxHeadlessCommandType::READ_PIXELS:         return "READ_PIXELS";
+            case NxHeadlessCommandType::READ_PIXELS_ASYNC:   return "READ_PIXELS_ASYNC";
+            case NxHeadlessCommandType::WAIT_FENCE:          return "WAIT_FENCE";
+            case NxHeadlessCommandType::END_FRAME:           return "END_FRAME";
+        }
+        return "UNKNOWN";
+    }
+
+    NxHeadlessCommandLog &NxHeadlessCommandLog::get()
+    {
+        static NxHeadlessCommandLog instance;
+        return instance;
+    }
+
+    static void accumulate(NxHeadlessStats &stats, const NxHeadlessCommandType type, const uint64_t value)
+    {
+        switch (type) {
+            case NxHeadlessCommandType::CLEAR:
+                ++stats.clears;
+                break;
+            case NxHeadlessCommandType::SET_VIEWPORT:
+            case NxHeadlessCommandType::SET_STATE:
+                ++stats.stateChanges;
+                break;
+            case NxHeadlessCommandType::DRAW_INDEXED:
+                ++stats.drawCalls;
+                stats.indices += value;
+                break;
+            case NxHeadlessCommandType::DRAW_UNINDEXED:
+                ++stats.drawCalls;
+                stats.vertices += value;
+                break;
+            case NxHeadlessCommandType::MULTI_DRAW_INDIRECT:
+                ++stats.drawCalls;
+                stats.indirectDraws += value;
+                break;
+            case NxHeadlessCommandType::BIND_SHADER:
+                ++stats.shaderBinds;
+                break;
+            case NxHeadlessCommandType::BIND_VERTEX_ARRAY:
+                ++stats.vertexArrayBinds;
+                break;
+            case NxHeadlessCommandType::BIND_TEXTURE:
+                ++stats.textureBinds;
+                break;
+            case NxHeadlessCommandType::BIND_FRAMEBUFFER:
+                ++stats.framebufferBinds;
+                break;
+            case NxHeadlessCommandType::BIND_STORAGE_BUFFER:
+                ++stats.storageBufferBinds;
+                break;
+            case NxHeadlessCommandType::SET_UNIFORM:
+                ++stats.uniformUploads;
+                break;
+            case NxHeadlessCommandType::UPLOAD_BUFFER:
+            case NxHeadlessCommandType::UPLOAD_TEXTURE:
+                ++stats.bufferUploads;
+                stats.uploadedBytes += value;
+                break;
+            case NxHeadlessCommandType::READ_PIXELS:
+                ++stats.pixelReadStalls;
+                break;
+            case NxHeadlessCommandType::READ_PIXELS_ASYNC:
+                ++stats.asyncPixelReads;
+                break;
+            case NxHeadlessCommandType::WAIT_FENCE:
+                ++stats.fenceWaits;
+                break;
+            case NxHeadlessCommandType::END_FRAME:
+                ++stats.frames;
+                break;
+        }
+    }
+
+    void NxHeadlessCommandLog::record(const NxHeadlessCommandType type, const unsigned int target, const uint64_t value,
+                                      const std::string_view name)
+    {
+        accumulate(m_totalStats, type, value);
+        accumulate(m_frameStats, type, value);
+        if (m_recording)
+            m_commands.push_back({type, target, value, std::string(name)});
+    }
+
+    void NxHeadlessCommandLog::endFrame()
+    {
+        record(NxHeadlessCommandType::END_FRAME, 0, m_totalStats.frames);
+        m_lastFrameStats = m_frameStats;
+        m_frameStats = {};
+    }
+
+    size_t NxHeadlessCommandLog::count(const NxHeadlessCommandType type) const
+    {
+        return static_cast<size_t>(std::ranges::count(m_commands, type, &NxHeadlessCommand::type));
+    }
+
+    void NxHeadlessCommandLog::clear()
+    {
+        m_commands.clear();
+        m_totalStats = {};
+        m_frameStats = {};
+        m_lastFrameStats = {};
+    }
+
+    std::string NxHeadlessCommandLog::dump() const
+    {
+        std::string result;
+        for (const auto &[type, target, value, name] : m_commands) {
+            result += std::format("{} target={} value={}", NxHeadlessCommandTypeToString(type), target, value);
+            if (!name.empty())
+                result += std::format(" name={}", name);
+            result += '\n';
+        }
+        return result;
+    }
+
+}
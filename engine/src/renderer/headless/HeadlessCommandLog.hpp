@@ -0,0 +1,144 @@
+//// HeadlessCommandLog.hpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the headless renderer command log
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nexo::renderer {
+
+    enum class NxHeadlessCommandType : uint8_t {
+        CLEAR,
+        SET_VIEWPORT,
+        SET_STATE,
+        DRAW_INDEXED,
+        DRAW_UNINDEXED,
+        MULTI_DRAW_INDIRECT,
+        BIND_SHADER,
+        BIND_VERTEX_ARRAY,
+        BIND_TEXTURE,
+        BIND_FRAMEBUFFER,
+        BIND_STORAGE_BUFFER,
+        SET_UNIFORM,
+        UPLOAD_BUFFER,
+        UPLOAD_TEXTURE,
+        READ_PIXELS,
+        READ_PIXELS_ASYNC,
+        WAIT_FENCE,
+        END_FRAME
+    };
+
+    [[nodiscard]] std::string_view NxHeadlessCommandTypeToString(NxHeadlessCommandType type);
+
+    /**
+     * @struct NxHeadlessCommand
+     * @brief One render call captured by the headless backend.
+     *
+     * `target` is the id of the object the call acts on (shader, vertex array, framebuffer...),
+     * `value` holds the call payload (index count, byte size, texture slot or state value) and
+     * `name` the uniform or render state name when there is one.
+     */
+    struct NxHeadlessCommand {
+        NxHeadlessCommandType type;
+        unsigned int target = 0;
+        uint64_t value = 0;
+        std::string name;
+    };
+
+    /**
+     * @struct NxHeadlessStats
+     * @brief Deterministic counters of the render calls issued to the headless backend.
+     */
+    struct NxHeadlessStats {
+        uint64_t frames = 0;
+        uint64_t drawCalls = 0;
+        uint64_t indices = 0;           ///< Indices submitted by indexed draws
+        uint64_t vertices = 0;          ///< Vertices submitted by non indexed draws
+        uint64_t indirectDraws = 0;     ///< Draws submitted by multi draw indirect calls, each call is one draw call
+        uint64_t clears = 0;
+        uint64_t stateChanges = 0;      ///< Viewport, depth, stencil, culling and draw buffer changes
+        uint64_t shaderBinds = 0;
+        uint64_t vertexArrayBinds = 0;
+        uint64_t textureBinds = 0;
+        uint64_t framebufferBinds = 0;
+        uint64_t storageBufferBinds = 0;
+        uint64_t uniformUploads = 0;    ///< Uniform uploads that went past the uniform cache
+        uint64_t bufferUploads = 0;
+        uint64_t uploadedBytes = 0;     ///< Bytes uploaded to buffers and textures
+        uint64_t pixelReadStalls = 0;   ///< Synchronous pixel reads, each waiting for the GPU to finish its work
+        uint64_t asyncPixelReads = 0;
+        uint64_t fenceWaits = 0;        ///< Waits for the GPU to release a range of a stream buffer
+
+        bool operator==(const NxHeadlessStats &other) const = default;
+    };
+
+    /**
+     * @class NxHeadlessCommandLog
+     * @brief Sink of every call made to the headless renderer backend.
+     *
+     * Statistics are always updated, for the running frame and the whole session. The calls themselves
+     * are only stored while recording is enabled, so long benchmarks do not grow the log.
+     * Object ids are handed out sequentially, which keeps two runs of the same scene byte for byte identical.
+     */
+    class NxHeadlessCommandLog {
+        public:
+            static NxHeadlessCommandLog &get();
+
+            [[nodiscard]] unsigned int generateId() { return ++m_lastId; }
+
+            void record(NxHeadlessCommandType type, unsigned int target = 0, uint64_t value = 0, std::string_view name = {});
+
+            /**
+             * @brief Closes the current frame: records an END_FRAME command and publishes the frame statistics.
+             */
+            void endFrame();
+
+            void setRecording(const bool enabled) { m_recording = enabled; }
+            [[nodiscard]] bool isRecording() const { return m_recording; }
+
+            [[nodiscard]] const std::vector<NxHeadlessCommand> &getCommands() const { return m_commands; }
+            [[nodiscard]] size_t count(NxHeadlessCommandType type) const;
+
+            [[nodiscard]] const NxHeadlessStats &getStats() const { return m_totalStats; }
+            [[nodiscard]] const NxHeadlessStats &getFrameStats() const { return m_frameStats; }
+            [[nodiscard]] const NxHeadlessStats &getLastFrameStats() const { return m_lastFrameStats; }
+
+            /**
+             * @brief Drops the recorded commands and zeroes the statistics. Object ids keep increasing.
+             */
+            void clear();
+
+            /**
+             * @brief Human readable listing of the recorded commands, one per line.
+             */
+            [[nodiscard]] std::string dump() const;
+
+        private:
+            NxHeadlessCommandLog() = default;
+
+            std::vector<NxHeadlessCommand> m_commands;
+            NxHeadlessStats m_totalStats;
+            NxHeadlessStats m_frameStats;
+            NxHeadlessStats m_lastFrameStats;
+            unsigned int m_lastId = 0;
+            bool m_recording = false;
+    };
+
+}
@@ -0,0 +1,160 @@
+//// HeadlessFramebuffer.cpp //////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the headless framebuffer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "HeadlessFramebuffer.hpp"
+#include "HeadlessCommandLog.hpp"
+#include "renderer/RendererExceptions.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace nexo::renderer {
+
+    static size_t pixelSize(const std::type_info &ti)
+    {
+        if (ti == typeid(int) || ti == typeid(unsigned int) || ti == typeid(float))
+            return sizeof(int);
+        if (ti == typeid(glm::vec4))
+            return sizeof(glm::vec4);
+        THROW_EXCEPTION(NxFramebufferUnsupportedColorFormat, "HEADLESS");
+    }
+
+    NxHeadlessFramebuffer::NxHeadlessFramebuffer(NxFramebufferSpecs specs) : m_specs(std::move(specs))
+    {
+        if (!m_specs.width || !m_specs.height)
+            THROW_EXCEPTION(NxFramebufferResizingFailed, "HEADLESS", false, m_specs.width, m_specs.height);
+        if (m_specs.width > MAX_FRAMEBUFFER_SIZE || m_specs.height > MAX_FRAMEBUFFER_SIZE)
+            THROW_EXCEPTION(NxFramebufferResizingFailed, "HEADLESS", true, m_specs.width, m_specs.height);
+
+        auto &log = NxHeadlessCommandLog::get();
+        m_id = log.generateId();
+        for (const auto &format : m_specs.attachments.attachments) {
+            if (format.textureFormat == NxFrameBufferTextureFormats::DEPTH24STENCIL8)
+                m_depthAttachment = log.generateId();
+            else if (format.textureFormat != NxFrameBufferTextureFormats::NONE) {
+                m_colorAttachments.push_back(log.generateId());
+                m_colorFormats.push_back(format.textureFormat);
+            }
+        }
+        m_clearValues.resize(m_colorAttachments.size());
+    }
+
+    void NxHeadlessFramebuffer::bind()
+    {
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::BIND_FRAMEBUFFER, m_id);
+    }
+
+    void NxHeadlessFramebuffer::bindAsTexture(const unsigned int slot, const unsigned int attachment)
+    {
+        if (attachment >= m_colorAttachments.size())
+            THROW_EXCEPTION(NxFramebufferInvalidIndex, "HEADLESS", static_cast<int>(attachment));
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::BIND_TEXTURE, m_colorAttachments[attachment], slot);
+    }
+
+    void NxHeadlessFramebuffer::bindDepthAsTexture(const unsigned int slot)
+    {
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::BIND_TEXTURE, m_depthAttachment, slot);
+    }
+
+    void NxHeadlessFramebuffer::copy(const std::shared_ptr<NxFramebuffer> source)
+    {
+        if (!source) {
+            LOG(NEXO_ERROR, "Cannot copy from null framebuffer");
+            return;
+        }
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::BIND_FRAMEBUFFER, m_id, source->getFramebufferId(), "copy");
+        if (const auto headlessSource = std::dynamic_pointer_cast<NxHeadlessFramebuffer>(source)) {
+            const size_t count = std::min(m_clearValues.size(), headlessSource->m_clearValues.size());
+            std::copy_n(headlessSource->m_clearValues.begin(), count, m_clearValues.begin());
+        }
+    }
+
+    void NxHeadlessFramebuffer::resize(const unsigned int width, const unsigned int height)
+    {
+        if (!width || !height)
+            THROW_EXCEPTION(NxFramebufferResizingFailed, "HEADLESS", false, width, height);
+        if (width > MAX_FRAMEBUFFER_SIZE || height > MAX_FRAMEBUFFER_SIZE)
+            THROW_EXCEPTION(NxFramebufferResizingFailed, "HEADLESS", true, width, height);
+        m_specs.width = width;
+        m_specs.height = height;
+    }
+
+    glm::vec2 NxHeadlessFramebuffer::getSize() const
+    {
+        return {m_specs.width, m_specs.height};
+    }
+
+    void NxHeadlessFramebuffer::getPixelWrapper(const unsigned int attachementIndex, [[maybe_unused]] const int x,
+                                                [[maybe_unused]] const int y, void *result, const std::type_info &ti) const
+    {
+        if (attachementIndex >= m_clearValues.size())
+            THROW_EXCEPTION(NxFramebufferInvalidIndex, "HEADLESS", static_cast<int>(attachementIndex));
+        std::memcpy(result, m_clearValues[attachementIndex].data(), pixelSize(ti));
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::READ_PIXELS, m_colorAttachments[attachementIndex], 1);
+    }
+
+    void NxHeadlessFramebuffer::readPixelsAsync(const unsigned int attachmentIndex, const int x, const int y,
+                                                const unsigned int width, const unsigned int height,
+                                                NxPixelReadCallback callback)
+    {
+        if (attachmentIndex >= m_clearValues.size())
+            THROW_EXCEPTION(NxFramebufferInvalidIndex, "HEADLESS", static_cast<int>(attachmentIndex));
+        if (m_colorFormats[attachmentIndex] != NxFrameBufferTextureFormats::RED_INTEGER)
+            THROW_EXCEPTION(NxFramebufferUnsupportedColorFormat, "HEADLESS");
+
+        NxPixelReadback readback;
+        readback.x = std::max(x, 0);
+        readback.y = std::max(y, 0);
+        const int right = std::min(x + static_cast<int>(width), static_cast<int>(m_specs.width));
+        const int top = std::min(y + static_cast<int>(height), static_cast<int>(m_specs.height));
+        if (right <= readback.x || top <= readback.y) {
+            callback(readback);
+            return;
+        }
+        readback.width = static_cast<unsigned int>(right - readback.x);
+        readback.height = static_cast<unsigned int>(top - readback.y);
+
+        int value = 0;
+        std::memcpy(&value, m_clearValues[attachmentIndex].data(), sizeof(int));
+        readback.pixels.assign(static_cast<size_t>(readback.width) * readback.height, value);
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::READ_PIXELS_ASYNC, m_colorAttachments[attachmentIndex],
+                                           readback.pixels.size());
+        m_pendingPixelReads.emplace_back(std::move(readback), std::move(callback));
+    }
+
+    void NxHeadlessFramebuffer::pollPixelReads([[maybe_unused]] const bool wait)
+    {
+        // Swapped out first, the callbacks may queue new reads
+        std::vector<std::pair<NxPixelReadback, NxPixelReadCallback>> completed;
+        completed.swap(m_pendingPixelReads);
+        for (const auto &[readback, callback] : completed)
+            if (callback)
+                callback(readback);
+    }
+
+    void NxHeadlessFramebuffer::clearAttachmentWrapper(const unsigned int attachmentIndex, const void *value,
+                                                       const std::type_info &ti) const
+    {
+        if (attachmentIndex >= m_clearValues.size())
+            THROW_EXCEPTION(NxFramebufferInvalidIndex, "HEADLESS", static_cast<int>(attachmentIndex));
+        std::memcpy(m_clearValues[attachmentIndex].data(), value, pixelSize(ti));
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::CLEAR, m_colorAttachments[attachmentIndex]);
+    }
+
+}
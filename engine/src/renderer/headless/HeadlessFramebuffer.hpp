@@ -0,0 +1,89 @@
+//// HeadlessFramebuffer.hpp //////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the headless framebuffer
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "renderer/Framebuffer.hpp"
+
+#include <array>
+#include <cstddef>
+#include <glm/glm.hpp>
+
+namespace nexo::renderer {
+
+    /**
+    * @class NxHeadlessFramebuffer
+    * @brief Framebuffer of the headless backend.
+    *
+    * No pixel storage is allocated. Each color attachment remembers the last value it was cleared with and
+    * `getPixel` returns it, so pixel readbacks (e.g. mouse picking) stay deterministic: they report the clear
+    * value since nothing is ever rasterized. Asynchronous reads complete on the next `pollPixelReads`.
+    */
+    class NxHeadlessFramebuffer final : public NxFramebuffer {
+        public:
+            static constexpr unsigned int MAX_FRAMEBUFFER_SIZE = 8192;
+
+            explicit NxHeadlessFramebuffer(NxFramebufferSpecs specs);
+            ~NxHeadlessFramebuffer() override = default;
+
+            void bind() override;
+            void bindAsTexture(unsigned int slot = 0, unsigned int attachment = 0) override;
+            void bindDepthAsTexture(unsigned int slot = 0) override;
+            void unbind() override {}
+
+            void setClearColor(const glm::vec4 &color) override { m_clearColor = color; }
+
+            void copy(std::shared_ptr<NxFramebuffer> source) override;
+
+            [[nodiscard]] unsigned int getFramebufferId() const override { return m_id; }
+
+            void resize(unsigned int width, unsigned int height) override;
+            [[nodiscard]] glm::vec2 getSize() const override;
+
+            void getPixelWrapper(unsigned int attachementIndex, int x, int y, void *result, const std::type_info &ti) const override;
+            void readPixelsAsync(unsigned int attachmentIndex, int x, int y, unsigned int width, unsigned int height,
+                                 NxPixelReadCallback callback) override;
+            void pollPixelReads(bool wait = false) override;
+            [[nodiscard]] size_t getPendingPixelReads() const override { return m_pendingPixelReads.size(); }
+
+            void clearAttachmentWrapper(unsigned int attachmentIndex, const void *value, const std::type_info &ti) const override;
+
+            NxFramebufferSpecs &getSpecs() override { return m_specs; }
+            [[nodiscard]] const NxFramebufferSpecs &getSpecs() const override { return m_specs; }
+
+            [[nodiscard]] unsigned int getNbColorAttachments() const override { return static_cast<unsigned int>(m_colorAttachments.size()); }
+            [[nodiscard]] unsigned int getColorAttachmentId(const unsigned int index = 0) const override { return m_colorAttachments[index]; }
+            [[nodiscard]] unsigned int getDepthAttachmentId() const override { return m_depthAttachment; }
+
+            [[nodiscard]] bool hasDepthAttachment() const override { return m_depthAttachment != 0; }
+            [[nodiscard]] bool hasStencilAttachment() const override { return m_depthAttachment != 0; }
+            [[nodiscard]] bool hasDepthStencilAttachment() const override { return m_depthAttachment != 0; }
+
+        private:
+            using PixelValue = std::array<std::byte, sizeof(glm::vec4)>;
+
+            unsigned int m_id = 0;
+            NxFramebufferSpecs m_specs;
+            glm::vec4 m_clearColor = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+            std::vector<unsigned int> m_colorAttachments;
+            std::vector<NxFrameBufferTextureFormats> m_colorFormats;
+            unsigned int m_depthAttachment = 0;
+            mutable std::vector<PixelValue> m_clearValues;
+            std::vector<std::pair<NxPixelReadback, NxPixelReadCallback>> m_pendingPixelReads;
+    };
+
+}
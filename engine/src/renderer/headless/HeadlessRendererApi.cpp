@@ -0,0 +1,164 @@
+//// HeadlessRendererApi.cpp //////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the headless renderer api
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "HeadlessRendererApi.hpp"
+#include "HeadlessCommandLog.hpp"
+#include "renderer/RendererExceptions.hpp"
+#include "Logger.hpp"
+
+namespace nexo::renderer {
+
+    void NxHeadlessRendererApi::init()
+    {
+        m_initialized = true;
+        LOG(NEXO_DEV, "Headless renderer api initialized");
+    }
+
+    void NxHeadlessRendererApi::recordState(const std::string_view name, const uint64_t value) const
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "HEADLESS");
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::SET_STATE, 0, value, name);
+    }
+
+    void NxHeadlessRendererApi::setViewport(const unsigned int x, const unsigned int y, const unsigned int width, const unsigned int height)
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "HEADLESS");
+        if (!width || !height)
+            THROW_EXCEPTION(NxGraphicsApiViewportResizingFailure, "HEADLESS", false, width, height);
+        if (width > MAX_VIEWPORT_SIZE || height > MAX_VIEWPORT_SIZE)
+            THROW_EXCEPTION(NxGraphicsApiViewportResizingFailure, "HEADLESS", true, width, height);
+        const uint64_t packedSize = static_cast<uint64_t>(width) << 32 | height;
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::SET_VIEWPORT, x << 16 | y, packedSize);
+    }
+
+    void NxHeadlessRendererApi::getMaxViewportSize(unsigned int *width, unsigned int *height)
+    {
+        *width = MAX_VIEWPORT_SIZE;
+        *height = MAX_VIEWPORT_SIZE;
+    }
+
+    void NxHeadlessRendererApi::clear()
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "HEADLESS");
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::CLEAR);
+    }
+
+    void NxHeadlessRendererApi::setClearColor([[maybe_unused]] const glm::vec4 &color)
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "HEADLESS");
+    }
+
+    void NxHeadlessRendererApi::setClearDepth([[maybe_unused]] const float depth)
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "HEADLESS");
+    }
+
+    void NxHeadlessRendererApi::setDepthTest(const bool enable)
+    {
+        recordState("depthTest", enable);
+    }
+
+    void NxHeadlessRendererApi::setDepthFunc(const unsigned int func)
+    {
+        recordState("depthFunc", func);
+    }
+
+    void NxHeadlessRendererApi::setDepthMask(const bool enable)
+    {
+        recordState("depthMask", enable);
+    }
+
+    void NxHeadlessRendererApi::drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, const size_t indexCount,
+                                            [[maybe_unused]] const size_t firstIndex,
+                                            [[maybe_unused]] const int baseVertex)
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "HEADLESS");
+        if (!vertexArray)
+            THROW_EXCEPTION(NxInvalidValue, "HEADLESS", "Vertex array cannot be null");
+        size_t count = indexCount;
+        if (!count && vertexArray->getIndexBuffer())
+            count = vertexArray->getIndexBuffer()->getCount();
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::DRAW_INDEXED, vertexArray->getId(), count);
+    }
+
+    void NxHeadlessRendererApi::multiDrawIndexedIndirect(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                                         const std::span<const NxDrawIndexedIndirectCommand> commands)
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "HEADLESS");
+        if (!vertexArray)
+            THROW_EXCEPTION(NxInvalidValue, "HEADLESS", "Vertex array cannot be null");
+        if (commands.empty())
+            return;
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::MULTI_DRAW_INDIRECT, vertexArray->getId(),
+                                           commands.size());
+    }
+
+    void NxHeadlessRendererApi::drawUnIndexed(const size_t verticesCount)
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "HEADLESS");
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::DRAW_UNINDEXED, 0, verticesCount);
+    }
+
+    void NxHeadlessRendererApi::setStencilTest(const bool enable)
+    {
+        recordState("stencilTest", enable);
+    }
+
+    void NxHeadlessRendererApi::setStencilMask(const unsigned int mask)
+    {
+        recordState("stencilMask", mask);
+    }
+
+    void NxHeadlessRendererApi::setStencilFunc(const unsigned int func, const int ref, const unsigned int mask)
+    {
+        recordState("stencilFunc", static_cast<uint64_t>(func) << 32 | static_cast<uint64_t>(ref & 0xFF) << 8 | (mask & 0xFF));
+    }
+
+    void NxHeadlessRendererApi::setStencilOp(const unsigned int sfail, const unsigned int dpfail, const unsigned int dppass)
+    {
+        recordState("stencilOp", static_cast<uint64_t>(sfail & 0xFFFF) << 32 | (dpfail & 0xFFFF) << 16 | (dppass & 0xFFFF));
+    }
+
+    void NxHeadlessRendererApi::setCulling(const bool enable)
+    {
+        recordState("culling", enable);
+    }
+
+    void NxHeadlessRendererApi::setCulledFace(const CulledFace face)
+    {
+        recordState("culledFace", static_cast<uint64_t>(face));
+    }
+
+    void NxHeadlessRendererApi::setWindingOrder(const WindingOrder order)
+    {
+        recordState("windingOrder", static_cast<uint64_t>(order));
+    }
+
+    void NxHeadlessRendererApi::setDrawBuffers(const unsigned int count)
+    {
+        recordState("drawBuffers", count);
+    }
+}
@@ -0,0 +1,71 @@
+//// HeadlessRendererApi.hpp //////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the headless renderer api
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "renderer/RendererAPI.hpp"
+
+namespace nexo::renderer {
+
+    /**
+    * @class NxHeadlessRendererApi
+    * @brief GPU-less implementation of the renderer api.
+    *
+    * Validates its arguments like the OpenGL implementation does, then records the call
+    * into the `NxHeadlessCommandLog` instead of sending it to a driver.
+    */
+    class NxHeadlessRendererApi final : public NxRendererApi {
+        public:
+            static constexpr unsigned int MAX_VIEWPORT_SIZE = 16384;
+
+            void init() override;
+
+            void setViewport(unsigned int x, unsigned int y, unsigned int width, unsigned int height) override;
+            void getMaxViewportSize(unsigned int *width, unsigned int *height) override;
+
+            void clear() override;
+            void setClearColor(const glm::vec4 &color) override;
+            void setClearDepth(float depth) override;
+
+            void setDepthTest(bool enable) override;
+            void setDepthFunc(unsigned int func) override;
+            void setDepthMask(bool enable) override;
+
+            void drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, size_t indexCount = 0,
+                             size_t firstIndex = 0, int baseVertex = 0) override;
+            void multiDrawIndexedIndirect(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                          std::span<const NxDrawIndexedIndirectCommand> commands) override;
+            [[nodiscard]] bool supportsMultiDrawIndirect() const override { return true; }
+            void drawUnIndexed(size_t verticesCount) override;
+
+            void setStencilTest(bool enable) override;
+            void setStencilMask(unsigned int mask) override;
+            void setStencilFunc(unsigned int func, int ref, unsigned int mask) override;
+            void setStencilOp(unsigned int sfail, unsigned int dpfail, unsigned int dppass) override;
+
+            void setCulling(bool enable) override;
+            void setCulledFace(CulledFace face) override;
+            void setWindingOrder(WindingOrder order) override;
+
+            void setDrawBuffers(unsigned int count) override;
+
+        private:
+            bool m_initialized = false;
+
+            void recordState(std::string_view name, uint64_t value) const;
+    };
+}
@@ -0,0 +1,288 @@
+//// HeadlessShader.cpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the headless shader
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "HeadlessShader.hpp"
+#include "HeadlessCommandLog.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+#include <cctype>
+#include <functional>
+#include <regex>
+
+namespace nexo::renderer {
+
+    namespace {
+
+        using StructMap = std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>>;
+        using DefineMap = std::unordered_map<std::string, int>;
+
+        std::string stripComments(const std::string &src)
+        {
+            static const std::regex comments(R"(//[^\n]*|/\*[\s\S]*?\*/)");
+            return std::regex_replace(src, comments, "");
+        }
+
+        int arraySize(const std::string &token, const DefineMap &defines)
+        {
+            if (token.empty())
+                return 0;
+            if (std::isdigit(static_cast<unsigned char>(token.front())))
+                return std::stoi(token);
+            const auto it = defines.find(token);
+            return it == defines.end() ? 0 : it->second;
+        }
+
+        /**
+        * @brief Registers a uniform the way the OpenGL driver reports it: struct uniforms are flattened into
+        * "name.member" / "name[i].member" and arrays expose both their base name and each "name[i]" element.
+        */
+        void addUniform(std::unordered_map<std::string, UniformInfo> &infos, const std::string &type,
+                        const std::string &name, const int size, const StructMap &structs, const DefineMap &defines,
+                        const unsigned int depth = 0)
+        {
+            const auto structIt = structs.find(type);
+            const auto addOne = [&](const std::string &fullName) {
+                if (structIt == structs.end() || depth > 4) {
+                    infos.try_emplace(fullName, UniformInfo{fullName, static_cast<int>(infos.size()), 0, 1});
+                    return;
+                }
+                for (const auto &[memberType, memberDecl] : structIt->second) {
+                    static const std::regex member(R"((\w+)\s*(?:\[\s*(\w+)\s*\])?)");
+                    if (std::smatch m; std::regex_match(memberDecl, m, member))
+                        addUniform(infos, memberType, fullName + "." + m[1].str(), arraySize(m[2].str(), defines),
+                                   structs, defines, depth + 1);
+                }
+            };
+
+            if (size <= 0) {
+                addOne(name);
+                return;
+            }
+            if (structIt == structs.end())
+                infos.try_emplace(name, UniformInfo{name, static_cast<int>(infos.size()), 0, size});
+            for (int i = 0; i < size; ++i)
+                addOne(name + "[" + std::to_string(i) + "]");
+        }
+
+        std::string sourceForStage(const std::string &src, const std::string_view stage)
+        {
+            const std::string token = "#type " + std::string(stage);
+            const size_t begin = src.find(token);
+            if (begin == std::string::npos)
+                return {};
+            const size_t bodyBegin = src.find_first_of("\r\n", begin);
+            if (bodyBegin == std::string::npos)
+                return {};
+            const size_t end = src.find("#type", bodyBegin);
+            return src.substr(bodyBegin, end == std::string::npos ? std::string::npos : end - bodyBegin);
+        }
+
+    }
+
+    NxHeadlessShader::NxHeadlessShader(const std::string &path)
+    {
+        const std::string src = loadSource(path);
+        const std::string vertexSource = sourceForStage(src, "vertex");
+        const std::string fragmentSource = sourceForStage(src, "fragment");
+        if (vertexSource.empty() || fragmentSource.empty())
+            THROW_EXCEPTION(NxShaderCreationFailed, "HEADLESS", "Missing vertex or fragment stage", path);
+
+        auto lastSlash = path.find_last_of("/\\");
+        lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+        const auto lastDot = path.rfind('.');
+        const auto count = lastDot == std::string::npos ? path.size() - lastSlash : lastDot - lastSlash;
+        m_name = path.substr(lastSlash, count);
+        reflect(vertexSource, fragmentSource);
+    }
+
+    NxHeadlessShader::NxHeadlessShader(std::string name, const std::string_view &vertexSource,
+                                       const std::string_view &fragmentSource) : m_name(std::move(name))
+    {
+        reflect(std::string(vertexSource), std::string(fragmentSource));
+    }
+
+    void NxHeadlessShader::reflect(const std::string &vertexSource, const std::string &fragmentSource)
+    {
+        m_id = NxHeadlessCommandLog::get().generateId();
+        const std::string vertex = stripComments(vertexSource);
+        const std::string all = vertex + "\n" + stripComments(fragmentSource);
+
+        DefineMap defines;
+        static const std::regex defineRegex(R"(#define\s+(\w+)\s+(\d+))");
+        for (std::sregex_iterator it(all.begin(), all.end(), defineRegex), end; it != end; ++it)
+            defines[(*it)[1].str()] = std::stoi((*it)[2].str());
+
+        StructMap structs;
+        static const std::regex structRegex(R"(struct\s+(\w+)\s*\{([^}]*)\})");
+        static const std::regex memberRegex(R"((\w+)\s+(\w+\s*(?:\[\s*\w+\s*\])?)\s*;)");
+        for (std::sregex_iterator it(all.begin(), all.end(), structRegex), end; it != end; ++it) {
+            auto &members = structs[(*it)[1].str()];
+            const std::string body = (*it)[2].str();
+            for (std::sregex_iterator m(body.begin(), body.end(), memberRegex); m != end; ++m)
+                members.emplace_back((*m)[1].str(), (*m)[2].str());
+        }
+
+        static const std::regex uniformRegex(R"(uniform\s+(\w+)\s+(\w+)\s*(?:\[\s*(\w+)\s*\])?\s*;)");
+        for (std::sregex_iterator it(all.begin(), all.end(), uniformRegex), end; it != end; ++it)
+            addUniform(m_uniformInfos, (*it)[1].str(), (*it)[2].str(), arraySize((*it)[3].str(), defines),
+                       structs, defines);
+
+        static const std::regex attributeRegex(
+            R"(layout\s*\(\s*location\s*=\s*(\d+)\s*\)\s*in\s+(\w+)\s+(\w+)\s*;)");
+        for (std::sregex_iterator it(vertex.begin(), vertex.end(), attributeRegex), end; it != end; ++it) {
+            const int location = std::stoi((*it)[1].str());
+            m_attributeInfos[location] = AttributeInfo{(*it)[3].str(), location, 0, 1};
+        }
+
+        static const std::unordered_map<std::string, std::function<void(RequiredAttributes&)>> attributeMappers = {
+            {"aPos", [](RequiredAttributes& attrs) { attrs.bitsUnion.flags.position = true; }},
+            {"aNormal", [](RequiredAttributes& attrs) { attrs.bitsUnion.flags.normal = true; }},
+            {"aTangent", [](RequiredAttributes& attrs) { attrs.bitsUnion.flags.tangent = true; }},
+            {"aBiTangent", [](RequiredAttributes& attrs) { attrs.bitsUnion.flags.bitangent = true; }},
+            {"aTexCoord", [](RequiredAttributes& attrs) { attrs.bitsUnion.flags.uv0 = true; }}
+        };
+
+        for (const auto& [location, info] : m_attributeInfos) {
+            const auto it = attributeMappers.find(info.name);
+            if (it != attributeMappers.end()) {
+                it->second(m_requiredAttributes);
+            }
+        }
+    }
+
+    void NxHeadlessShader::bind() const
+    {
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::BIND_SHADER, m_id);
+    }
+
+    bool NxHeadlessShader::upload(const std::string &name) const
+    {
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::SET_UNIFORM, m_id, 0, name);
+        m_uniformCache.clearDirtyFlag(name);
+        return true;
+    }
+
+    bool NxHeadlessShader::setUniformFloat(const std::string &name, const float value) const
+    {
+        if (!NxShader::hasUniform(name))
+            return false;
+        return NxShader::setUniformFloat(name, value) || upload(name);
+    }
+
+    bool NxHeadlessShader::setUniformFloat2(const std::string &name, const glm::vec2 &values) const
+    {
+        if (!NxShader::hasUniform(name))
+            return false;
+        return NxShader::setUniformFloat2(name, values) || upload(name);
+    }
+
+    bool NxHeadlessShader::setUniformFloat3(const std::string &name, const glm::vec3 &values) const
+    {
+        if (!NxShader::hasUniform(name))
+            return false;
+        return NxShader::setUniformFloat3(name, values) || upload(name);
+    }
+
+    bool NxHeadlessShader::setUniformFloat4(const std::string &name, const glm::vec4 &values) const
+    {
+        if (!NxShader::hasUniform(name))
+            return false;
+        return NxShader::setUniformFloat4(name, values) || upload(name);
+    }
+
+    bool NxHeadlessShader::setUniformMatrix(const std::string &name, const glm::mat4 &matrix) const
+    {
+        if (!NxShader::hasUniform(name))
+            return false;
+        return NxShader::setUniformMatrix(name, matrix) || upload(name);
+    }
+
+    bool NxHeadlessShader::setUniformBool(const std::string &name, const bool value) const
+    {
+        if (!NxShader::hasUniform(name))
+            return false;
+        return NxShader::setUniformBool(name, value) || upload(name);
+    }
+
+    bool NxHeadlessShader::setUniformInt(const std::string &name, const int value) const
+    {
+        if (!NxShader::hasUniform(name))
+            return false;
+        return NxShader::setUniformInt(name, value) || upload(name);
+    }
+
+    bool NxHeadlessShader::setUniformIntArray(const std::string &name, [[maybe_unused]] const int *values,
+                                              [[maybe_unused]] const unsigned int count) const
+    {
+        if (!NxShader::hasUniform(name))
+            return false;
+        return upload(name);
+    }
+
+    bool NxHeadlessShader::setUniformFloat(const NxShaderUniforms uniform, const float value) const
+    {
+        return setUniformFloat(ShaderUniformsName.at(uniform), value);
+    }
+
+    bool NxHeadlessShader::setUniformFloat3(const NxShaderUniforms uniform, const glm::vec3 &values) const
+    {
+        return setUniformFloat3(ShaderUniformsName.at(uniform), values);
+    }
+
+    bool NxHeadlessShader::setUniformFloat4(const NxShaderUniforms uniform, const glm::vec4 &values) const
+    {
+        return setUniformFloat4(ShaderUniformsName.at(uniform), values);
+    }
+
+    bool NxHeadlessShader::setUniformMatrix(const NxShaderUniforms uniform, const glm::mat4 &matrix) const
+    {
+        return setUniformMatrix(ShaderUniformsName.at(uniform), matrix);
+    }
+
+    bool NxHeadlessShader::setUniformInt(const NxShaderUniforms uniform, const int value) const
+    {
+        return setUniformInt(ShaderUniformsName.at(uniform), value);
+    }
+
+    bool NxHeadlessShader::setUniformIntArray(const NxShaderUniforms uniform, const int *values, const unsigned int count) const
+    {
+        return setUniformIntArray(ShaderUniformsName.at(uniform), values, count);
+    }
+
+    void NxHeadlessShader::bindStorageBuffer(const unsigned int index) const
+    {
+        if (index >= m_storageBuffers.size())
+            THROW_EXCEPTION(NxOutOfRangeException, index, m_storageBuffers.size());
+        m_storageBuffers[index]->bind();
+    }
+
+    void NxHeadlessShader::unbindStorageBuffer(const unsigned int index) const
+    {
+        if (index >= m_storageBuffers.size())
+            THROW_EXCEPTION(NxOutOfRangeException, index, m_storageBuffers.size());
+        m_storageBuffers[index]->unbind();
+    }
+
+    void NxHeadlessShader::bindStorageBufferBase(const unsigned int index, const unsigned int bindingLocation) const
+    {
+        if (index >= m_storageBuffers.size())
+            THROW_EXCEPTION(NxOutOfRangeException, index, m_storageBuffers.size());
+        m_storageBuffers[index]->bindBase(bindingLocation);
+    }
+
+}
@@ -0,0 +1,73 @@
+//// HeadlessShader.hpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the headless shader
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "renderer/Shader.hpp"
+
+namespace nexo::renderer {
+
+    /**
+    * @class NxHeadlessShader
+    * @brief Shader of the headless backend.
+    *
+    * Nothing is compiled: the GLSL source is reflected textually instead (uniform declarations, struct members,
+    * `#define` array sizes and vertex inputs) so that `hasUniform`, the uniform cache and mesh compatibility checks
+    * behave like with the OpenGL backend. Every uniform that actually reaches the "GPU" (i.e. is not filtered out by
+    * the uniform cache) is recorded as a SET_UNIFORM command.
+    */
+    class NxHeadlessShader final : public NxShader {
+        public:
+            explicit NxHeadlessShader(const std::string &path);
+            NxHeadlessShader(std::string name, const std::string_view &vertexSource, const std::string_view &fragmentSource);
+            ~NxHeadlessShader() override = default;
+
+            void bind() const override;
+            void unbind() const override {}
+
+            bool setUniformFloat(const std::string &name, float value) const override;
+            bool setUniformFloat2(const std::string &name, const glm::vec2 &values) const override;
+            bool setUniformFloat3(const std::string &name, const glm::vec3 &values) const override;
+            bool setUniformFloat4(const std::string &name, const glm::vec4 &values) const override;
+            bool setUniformMatrix(const std::string &name, const glm::mat4 &matrix) const override;
+            bool setUniformBool(const std::string &name, bool value) const override;
+            bool setUniformInt(const std::string &name, int value) const override;
+            bool setUniformIntArray(const std::string &name, const int *values, unsigned int count) const override;
+
+            bool setUniformFloat(NxShaderUniforms uniform, float value) const override;
+            bool setUniformFloat3(NxShaderUniforms uniform, const glm::vec3 &values) const override;
+            bool setUniformFloat4(NxShaderUniforms uniform, const glm::vec4 &values) const override;
+            bool setUniformMatrix(NxShaderUniforms uniform, const glm::mat4 &matrix) const override;
+            bool setUniformInt(NxShaderUniforms uniform, int value) const override;
+            bool setUniformIntArray(NxShaderUniforms uniform, const int *values, unsigned int count) const override;
+
+            void bindStorageBuffer(unsigned int index) const override;
+            void bindStorageBufferBase(unsigned int index, unsigned int bindingLocation) const override;
+            void unbindStorageBuffer(unsigned int index) const override;
+
+            [[nodiscard]] const std::string &getName() const override { return m_name; };
+            unsigned int getProgramId() const override { return m_id; };
+
+        private:
+            std::string m_name;
+            unsigned int m_id = 0;
+
+            void reflect(const std::string &vertexSource, const std::string &fragmentSource);
+            bool upload(const std::string &name) const;
+    };
+
+}
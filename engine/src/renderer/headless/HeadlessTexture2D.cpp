@@ -0,0 +1,118 @@
+//// HeadlessTexture2D.cpp ////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the headless 2D texture
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "HeadlessTexture2D.hpp"
+#include "HeadlessCommandLog.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+#include <stb_image.h>
+
+namespace nexo::renderer {
+
+    NxHeadlessTexture2D::NxHeadlessTexture2D(const unsigned int width, const unsigned int height)
+    {
+        create(width, height, 4, "(empty)");
+    }
+
+    NxHeadlessTexture2D::NxHeadlessTexture2D(const uint8_t *buffer, const unsigned int width, const unsigned int height,
+        const NxTextureFormat format)
+    {
+        if (!buffer)
+            THROW_EXCEPTION(NxInvalidValue, "HEADLESS", "Buffer is null");
+        if (format <= NxTextureFormat::INVALID || NxTextureFormatIsCompressed(format))
+            THROW_EXCEPTION(NxTextureUnsupportedFormat, "HEADLESS", static_cast<int>(format), "");
+        // Formats are numbered after their channel count
+        create(width, height, static_cast<int>(format), "(buffer)");
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::UPLOAD_TEXTURE, m_id,
+                                           static_cast<uint64_t>(m_width) * m_height * m_channels);
+    }
+
+    NxHeadlessTexture2D::NxHeadlessTexture2D(const std::string &path)
+    {
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        if (!stbi_info(path.c_str(), &width, &height, &channels))
+            THROW_EXCEPTION(NxFileNotFoundException, path);
+        create(static_cast<unsigned int>(width), static_cast<unsigned int>(height), channels, path);
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::UPLOAD_TEXTURE, m_id,
+                                           static_cast<uint64_t>(m_width) * m_height * m_channels);
+    }
+
+    NxHeadlessTexture2D::NxHeadlessTexture2D(const uint8_t *buffer, const unsigned int len)
+    {
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        if (!stbi_info_from_memory(buffer, static_cast<int>(len), &width, &height, &channels))
+            THROW_EXCEPTION(NxTextureUnsupportedFormat, "HEADLESS", channels, "(buffer)");
+        create(static_cast<unsigned int>(width), static_cast<unsigned int>(height), channels, "(buffer)");
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::UPLOAD_TEXTURE, m_id,
+                                           static_cast<uint64_t>(m_width) * m_height * m_channels);
+    }
+
+    NxHeadlessTexture2D::NxHeadlessTexture2D(const std::span<const NxTextureMipLevel> levels,
+                                             const NxTextureFormat format)
+    {
+        NxTextureCheckMipLevels(levels, format, "HEADLESS");
+        int channels = 0;
+        switch (format) {
+            case NxTextureFormat::BC5: channels = 2; break;
+            case NxTextureFormat::BC1: channels = 3; break;
+            case NxTextureFormat::BC3:
+            case NxTextureFormat::BC7: channels = 4; break;
+            default: channels = static_cast<int>(format); break;
+        }
+        create(levels.front().width, levels.front().height, channels, "(mip chain)");
+        m_mipLevelCount = static_cast<unsigned int>(levels.size());
+        m_format = format;
+        size_t uploadedBytes = 0;
+        for (const auto &level : levels)
+            uploadedBytes += level.size;
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::UPLOAD_TEXTURE, m_id, uploadedBytes);
+    }
+
+    void NxHeadlessTexture2D::create(const unsigned int width, const unsigned int height, const int channels,
+                                     const std::string &debugPath)
+    {
+        if (channels < 1 || channels > 4)
+            THROW_EXCEPTION(NxTextureUnsupportedFormat, "HEADLESS", channels, debugPath);
+        if (width > MAX_TEXTURE_SIZE || height > MAX_TEXTURE_SIZE)
+            THROW_EXCEPTION(NxTextureInvalidSize, "HEADLESS", width, height, MAX_TEXTURE_SIZE);
+        m_width = width;
+        m_height = height;
+        m_channels = static_cast<unsigned int>(channels);
+        m_format = static_cast<NxTextureFormat>(channels);
+        m_id = NxHeadlessCommandLog::get().generateId();
+    }
+
+    void NxHeadlessTexture2D::bind(const unsigned int slot) const
+    {
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::BIND_TEXTURE, m_id, slot);
+    }
+
+    void NxHeadlessTexture2D::setData([[maybe_unused]] void *data, const size_t size)
+    {
+        if (NxTextureFormatIsCompressed(m_format))
+            THROW_EXCEPTION(NxTextureUnsupportedFormat, "HEADLESS", static_cast<int>(m_channels), "(mip chain)");
+        if (const size_t expectedSize = static_cast<size_t>(m_width) * m_height * m_channels; size != expectedSize)
+            THROW_EXCEPTION(NxTextureSizeMismatch, "HEADLESS", size, expectedSize);
+        NxHeadlessCommandLog::get().record(NxHeadlessCommandType::UPLOAD_TEXTURE, m_id, size);
+    }
+
+}
@@ -0,0 +1,67 @@
+//// HeadlessTexture2D.hpp ////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the headless 2D texture
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "renderer/Texture.hpp"
+
+namespace nexo::renderer {
+
+    /**
+    * @class NxHeadlessTexture2D
+    * @brief 2D texture of the headless backend.
+    *
+    * Image files and buffers are only probed for their size and channel count, the pixels are never decoded,
+    * so loading a scene headless costs the same I/O but none of the decode or upload time.
+    */
+    class NxHeadlessTexture2D final : public NxTexture2D {
+        public:
+            static constexpr unsigned int MAX_TEXTURE_SIZE = 16384;
+
+            ~NxHeadlessTexture2D() override = default;
+
+            explicit NxHeadlessTexture2D(const std::string &path);
+            NxHeadlessTexture2D(unsigned int width, unsigned int height);
+            NxHeadlessTexture2D(const uint8_t *buffer, unsigned int width, unsigned int height, NxTextureFormat format);
+            NxHeadlessTexture2D(const uint8_t *buffer, unsigned int len);
+            NxHeadlessTexture2D(std::span<const NxTextureMipLevel> levels, NxTextureFormat format);
+
+            [[nodiscard]] unsigned int getWidth() const override {return m_width;};
+            [[nodiscard]] unsigned int getHeight() const override {return m_height;};
+            [[nodiscard]] unsigned int getMaxTextureSize() const override { return MAX_TEXTURE_SIZE; }
+            [[nodiscard]] unsigned int getId() const override {return m_id;};
+            [[nodiscard]] unsigned int getChannels() const { return m_channels; }
+            [[nodiscard]] unsigned int getMipLevelCount() const { return m_mipLevelCount; }
+            [[nodiscard]] NxTextureFormat getFormat() const { return m_format; }
+
+            void bind(unsigned int slot = 0) const override;
+            void unbind([[maybe_unused]] unsigned int slot = 0) const override {}
+
+            void setData(void *data, size_t size) override;
+
+        private:
+            void create(unsigned int width, unsigned int height, int channels, const std::string &debugPath);
+
+            unsigned int m_width{};
+            unsigned int m_height{};
+            unsigned int m_channels{};
+            unsigned int m_id{};
+            unsigned int m_mipLevelCount = 1;
+            NxTextureFormat m_format = NxTextureFormat::INVALID;
+    };
+
+}
@@ -0,0 +1,113 @@
+//// HeadlessWindow.hpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the headless window
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "renderer/Window.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace nexo::renderer {
+
+    /**
+    * @class NxHeadlessWindow
+    * @brief Window of the headless backend.
+    *
+    * No native window or GL context is created. The window stays open until `close()` is called and exposes a
+    * virtual clock that advances by a fixed step on every `onUpdate()`, so a headless run produces the same delta
+    * times (and therefore the same frames) on every machine. `onUpdate()` also closes the current frame of the
+    * command log.
+    *
+    * There is no context either, the window only remembers which thread last made it current so the render
+    * thread hand-over can be tested.
+    */
+    class NxHeadlessWindow final : public NxWindow {
+        public:
+            static constexpr double DEFAULT_TIME_STEP = 1.0 / 60.0;
+
+            explicit NxHeadlessWindow(const int width = 1920,
+                                      const int height = 1080,
+                                      const std::string &title = "Nexo window") :
+                    _props(width, height, title) {}
+
+            void init() override { _open = true; }
+            void shutdown() override { _open = false; }
+            void onUpdate() override;
+
+            void swapBuffers() override;
+            void pollEvents() override { _time += _timeStep; }
+            void makeContextCurrent(const bool current) override
+            {
+                _contextThread = current ? std::this_thread::get_id() : std::thread::id();
+            }
+            [[nodiscard]] bool supportsContextHandoff() const override { return true; }
+
+            /**
+            * @brief Thread the context was last made current on, a default id when it is not current anywhere.
+            */
+            [[nodiscard]] std::thread::id getContextThread() const { return _contextThread; }
+
+            [[nodiscard]] unsigned int getWidth() const override { return _props.width; }
+            [[nodiscard]] unsigned int getHeight() const override { return _props.height; }
+
+            void getDpiScale(float *x, float *y) const override { *x = 1.0f; *y = 1.0f; }
+
+            void setWindowIcon([[maybe_unused]] const std::filesystem::path& iconPath) override {}
+
+            void setTitle(const std::string& title) override { _props.title = title; }
+            [[nodiscard]] const std::string& getTitle() const override { return _props.title; }
+
+            void setDarkMode(const bool enabled) override { _props.isDarkMode = enabled; }
+            [[nodiscard]] bool isDarkMode() const override { return _props.isDarkMode; }
+
+            void setVsync(const bool enabled) override { _props.vsync = enabled; }
+            [[nodiscard]] bool isVsync() const override { return _props.vsync; }
+
+            [[nodiscard]] double getTime() const override { return _time; }
+
+            /**
+            * @brief Sets the amount of virtual time added to the clock on each `onUpdate()`.
+            */
+            void setTimeStep(const double step) { _timeStep = step; }
+
+            [[nodiscard]] bool isOpen() const override { return _open; }
+            void close() override;
+
+            [[nodiscard]] void *window() const override { return nullptr; }
+            void setErrorCallback([[maybe_unused]] void *fctPtr) override {}
+            void setResizeCallback(ResizeCallback callback) override { _props.resizeCallback = std::move(callback); }
+            void setCloseCallback(CloseCallback callback) override { _props.closeCallback = std::move(callback); }
+            void setKeyCallback(KeyCallback callback) override { _props.keyCallback = std::move(callback); }
+            void setMouseClickCallback(MouseClickCallback callback) override { _props.mouseClickCallback = std::move(callback); }
+            void setMouseScrollCallback(MouseScrollCallback callback) override { _props.mouseScrollCallback = std::move(callback); }
+            void setMouseMoveCallback(MouseMoveCallback callback) override { _props.mouseMoveCallback = std::move(callback); }
+            void setFileDropCallback(FileDropCallback callback) override { _props.fileDropCallback = std::move(callback); }
+
+            // Linux specific method
+#ifdef __linux__
+            void setWaylandAppId([[maybe_unused]] const char* appId) override {}
+            void setWmClass([[maybe_unused]] const char* className, [[maybe_unused]] const char* instanceName) override {}
+#endif
+        private:
+            NxWindowProperty _props;
+            bool _open = true;
+            double _time = 0.0;
+            double _timeStep = DEFAULT_TIME_STEP;
+            std::atomic<std::thread::id> _contextThread{std::this_thread::get_id()};
+    };
+}
@@ -58,6 +58,11 @@ namespace nexo::renderer {
         glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
     }
 
+    void NxOpenGlVertexBuffer::setSubData(const void *data, const size_t size, const size_t offset)
+    {
+        glNamedBufferSubData(_id, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+    }
+
 
     // INDEX BUFFER
 
@@ -88,6 +93,13 @@ namespace nexo::renderer {
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned int), indices, GL_STATIC_DRAW);
     }
 
+    void NxOpenGlIndexBuffer::setSubData(const unsigned int *indices, const size_t count, const size_t offset)
+    {
+        // Named access, binding the buffer would change the element buffer of the bound vertex array
+        glNamedBufferSubData(_id, static_cast<GLintptr>(offset * sizeof(unsigned int)),
+                             static_cast<GLsizeiptr>(count * sizeof(unsigned int)), indices);
+    }
+
     size_t NxOpenGlIndexBuffer::getCount() const
     {
         return _count;
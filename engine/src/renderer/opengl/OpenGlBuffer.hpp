@@ -112,6 +112,7 @@ namespace nexo::renderer {
              * - Use this method for dynamically updating buffer content.
              */
             void setData(void *data, size_t size) override;
+            void setSubData(const void *data, size_t size, size_t offset) override;
 
             [[nodiscard]] unsigned int getId() const override { return _id; };
 
@@ -184,6 +185,7 @@ namespace nexo::renderer {
             * - Sets the `_count` member to track the number of indices in the buffer.
             */
             void setData(unsigned int *indices, size_t count) override;
+            void setSubData(const unsigned int *indices, size_t count, size_t offset) override;
 
             /**
             * @brief Retrieves the number of indices in the buffer.
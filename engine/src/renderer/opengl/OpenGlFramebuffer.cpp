@@ -19,6 +19,8 @@
 #include "OpenGlFramebuffer.hpp"
 #include "Logger.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 #include <glm/gtc/type_ptr.hpp>
 
@@ -210,6 +212,12 @@ namespace nexo::renderer {
         glDeleteFramebuffers(1, &m_id);
         glDeleteTextures(static_cast<int>(m_colorAttachments.size()), m_colorAttachments.data());
         glDeleteTextures(1, &m_depthAttachment);
+        for (auto &read : m_pixelReads) {
+            if (read.fence)
+                glDeleteSync(read.fence);
+            if (read.pbo)
+                glDeleteBuffers(1, &read.pbo);
+        }
     }
 
     void NxOpenGlFramebuffer::invalidate()
@@ -418,6 +426,102 @@ namespace nexo::renderer {
             THROW_EXCEPTION(NxFramebufferUnsupportedColorFormat, "OPENGL");
     }
 
+    void NxOpenGlFramebuffer::readPixelsAsync(const unsigned int attachmentIndex, const int x, const int y,
+                                              const unsigned int width, const unsigned int height,
+                                              NxPixelReadCallback callback)
+    {
+        if (attachmentIndex >= m_colorAttachments.size())
+            THROW_EXCEPTION(NxFramebufferInvalidIndex, "OPENGL", attachmentIndex);
+        const int format = framebufferTextureFormatToOpenGlFormat(m_colorAttachmentsSpecs[attachmentIndex].textureFormat);
+        if (format != GL_RED_INTEGER)
+            THROW_EXCEPTION(NxFramebufferUnsupportedColorFormat, "OPENGL");
+
+        NxPixelReadback readback;
+        readback.x = std::max(x, 0);
+        readback.y = std::max(y, 0);
+        const int right = std::min(x + static_cast<int>(width), static_cast<int>(m_specs.width));
+        const int top = std::min(y + static_cast<int>(height), static_cast<int>(m_specs.height));
+        if (right <= readback.x || top <= readback.y) {
+            callback(readback);
+            return;
+        }
+        readback.width = static_cast<unsigned int>(right - readback.x);
+        readback.height = static_cast<unsigned int>(top - readback.y);
+
+        // The oldest slot is reused, its read must be completed first however long the GPU takes
+        while (m_pendingPixelReads.size() == PIXEL_READ_RING_SIZE && !completeOldestPixelRead(true))
+            LOG(NEXO_WARN, "Waiting for the GPU to complete a read of framebuffer {}", m_id);
+        const unsigned int slot = m_nextPixelRead;
+        m_nextPixelRead = (m_nextPixelRead + 1) % PIXEL_READ_RING_SIZE;
+        auto &read = m_pixelReads[slot];
+
+        const auto size = static_cast<GLsizeiptr>(readback.width * readback.height * sizeof(int));
+        if (!read.pbo)
+            glGenBuffers(1, &read.pbo);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, read.pbo);
+        if (read.capacity < size) {
+            glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+            read.capacity = size;
+        }
+
+        GLint previousReadFramebuffer = 0;
+        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousReadFramebuffer);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, m_id);
+        glReadBuffer(GL_COLOR_ATTACHMENT0 + attachmentIndex);
+        // With a pack buffer bound the last argument is an offset in it, the call returns without waiting
+        glReadPixels(readback.x, readback.y, static_cast<GLsizei>(readback.width),
+                     static_cast<GLsizei>(readback.height), GL_RED_INTEGER, GL_INT, nullptr);
+        read.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(previousReadFramebuffer));
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        read.readback = std::move(readback);
+        read.callback = std::move(callback);
+        m_pendingPixelReads.push_back(slot);
+    }
+
+    bool NxOpenGlFramebuffer::completeOldestPixelRead(const bool wait)
+    {
+        auto &read = m_pixelReads[m_pendingPixelReads.front()];
+        constexpr GLuint64 waitTimeout = 1'000'000'000; // 1 second, in nanoseconds
+        const GLenum status = glClientWaitSync(read.fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+                                               wait ? waitTimeout : 0);
+        if (status == GL_TIMEOUT_EXPIRED)
+            return false;
+        glDeleteSync(read.fence);
+        read.fence = nullptr;
+        m_pendingPixelReads.pop_front();
+
+        auto &pixels = read.readback.pixels;
+        pixels.resize(static_cast<size_t>(read.readback.width) * read.readback.height);
+        const auto size = static_cast<GLsizeiptr>(pixels.size() * sizeof(int));
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, read.pbo);
+        const void *data = status != GL_WAIT_FAILED
+                               ? glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT)
+                               : nullptr;
+        if (data) {
+            std::memcpy(pixels.data(), data, static_cast<size_t>(size));
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        } else {
+            LOG(NEXO_WARN, "Asynchronous read of framebuffer {} failed", m_id);
+            std::ranges::fill(pixels, -1);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        // Moved out first, the callback may queue another read in this slot
+        const NxPixelReadCallback callback = std::move(read.callback);
+        const NxPixelReadback readback = std::move(read.readback);
+        read.callback = nullptr;
+        if (callback)
+            callback(readback);
+        return true;
+    }
+
+    void NxOpenGlFramebuffer::pollPixelReads(const bool wait)
+    {
+        while (!m_pendingPixelReads.empty() && completeOldestPixelRead(wait)) {}
+    }
+
     void NxOpenGlFramebuffer::clearAttachmentWrapper(const unsigned int attachmentIndex, const void *value, const std::type_info &ti) const
     {
         // Add more types here when necessary
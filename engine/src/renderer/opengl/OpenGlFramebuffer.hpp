@@ -23,6 +23,8 @@
 #include <glad/glad.h>
 #include <glm/fwd.hpp>
 #include <glm/glm.hpp>
+#include <array>
+#include <deque>
 #include <iostream>
 
 namespace nexo::renderer {
@@ -182,6 +184,17 @@ namespace nexo::renderer {
             }
             void getPixelWrapper(unsigned int attachementIndex, int x, int y, void *result, const std::type_info &ti) const override;
 
+            /**
+             * @brief Reads the region into a pixel buffer object and fences it, the read is mapped once the fence
+             * is signaled.
+             *
+             * Up to PIXEL_READ_RING_SIZE reads are in flight, queuing one more waits for the oldest.
+             */
+            void readPixelsAsync(unsigned int attachmentIndex, int x, int y, unsigned int width, unsigned int height,
+                                 NxPixelReadCallback callback) override;
+            void pollPixelReads(bool wait = false) override;
+            [[nodiscard]] size_t getPendingPixelReads() const override { return m_pendingPixelReads.size(); }
+
 
             /**
              * @brief Clears the specified attachment with a given value.
@@ -226,5 +239,20 @@ namespace nexo::renderer {
 
             std::vector<unsigned int> m_colorAttachments;
             unsigned int m_depthAttachment = 0;
+
+            static constexpr unsigned int PIXEL_READ_RING_SIZE = 4;
+
+            struct PixelRead {
+                GLuint pbo = 0;
+                GLsizeiptr capacity = 0;
+                GLsync fence = nullptr;
+                NxPixelReadback readback;
+                NxPixelReadCallback callback;
+            };
+            std::array<PixelRead, PIXEL_READ_RING_SIZE> m_pixelReads;
+            std::deque<unsigned int> m_pendingPixelReads;   ///< Ring slots in submission order
+            unsigned int m_nextPixelRead = 0;
+
+            bool completeOldestPixelRead(bool wait);
     };
 }
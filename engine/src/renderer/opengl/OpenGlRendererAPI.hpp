@@ -121,12 +121,24 @@ namespace nexo::renderer {
              *
              * @param vertexArray A shared pointer to the `NxVertexArray` containing vertex and index data.
              * @param indexCount The number of indices to draw. If zero, all indices in the buffer are used.
+             * @param firstIndex Index of the first index to draw.
+             * @param baseVertex Value added to every index.
              *
              * Throws:
              * - NxGraphicsApiNotInitialized if OpenGL is not initialized.
              * - NxInvalidValue if the `vertexArray` is null.
              */
-            void drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, size_t indexCount = 0) override;
+            void drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, size_t indexCount = 0,
+                             size_t firstIndex = 0, int baseVertex = 0) override;
+
+            /**
+             * @brief Uploads the draws to the indirect buffer and issues them with `glMultiDrawElementsIndirect`.
+             *
+             * The indirect buffer is orphaned on every call and grows with the largest draw list.
+             */
+            void multiDrawIndexedIndirect(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                          std::span<const NxDrawIndexedIndirectCommand> commands) override;
+            [[nodiscard]] bool supportsMultiDrawIndirect() const override { return m_multiDrawIndirect; }
 
             void drawUnIndexed(size_t verticesCount) override;
 
@@ -138,9 +150,15 @@ namespace nexo::renderer {
             void setCulling(bool enable) override;
             void setCulledFace(CulledFace face) override;
             void setWindingOrder(WindingOrder order) override;
+
+            void setDrawBuffers(unsigned int count) override;
         private:
             bool m_initialized = false;
             unsigned int m_maxWidth = 0;
             unsigned int m_maxHeight = 0;
+            // The shaders need gl_DrawIDARB to find the object of each draw of an indirect call, even on 4.6 contexts
+            bool m_multiDrawIndirect = false;
+            unsigned int m_indirectBuffer = 0;
+            size_t m_indirectBufferSize = 0;
     };
 }
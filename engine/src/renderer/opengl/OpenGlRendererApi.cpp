@@ -21,8 +21,12 @@
 
 #include "OpenGlRendererAPI.hpp"
 #include "Logger.hpp"
+#include "ShaderCache.hpp"
 
 #include <glad/glad.h>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
 
 namespace nexo::renderer {
 
@@ -44,6 +48,32 @@ namespace nexo::renderer {
         glGetIntegerv(GL_MAX_VIEWPORT_DIMS, maxViewportSize);
         m_maxWidth = static_cast<unsigned int>(maxViewportSize[0]);
         m_maxHeight = static_cast<unsigned int>(maxViewportSize[1]);
+
+        // Program binaries are only valid for the driver that produced them
+        GLint binaryFormatCount = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount);
+        auto &shaderCache = NxShaderBinaryCache::get();
+        if (binaryFormatCount > 0) {
+            const auto glString = [](const GLenum name) {
+                const auto *str = reinterpret_cast<const char *>(glGetString(name));
+                return std::string(str ? str : "");
+            };
+            shaderCache.setDriverIdentity(glString(GL_VENDOR) + '|' + glString(GL_RENDERER) + '|' +
+                                          glString(GL_VERSION));
+        } else
+            shaderCache.setEnabled(false);
+
+        // The shaders are #version 430 and read gl_DrawIDARB, the core gl_DrawID of 4.6 contexts is not visible to
+        // them: the extension is required whatever the context version
+        m_multiDrawIndirect = false;
+        GLint extensionCount = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+        for (GLint i = 0; i < extensionCount && !m_multiDrawIndirect; ++i) {
+            const auto *extension = reinterpret_cast<const char *>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+            m_multiDrawIndirect = extension && std::strcmp(extension, "GL_ARB_shader_draw_parameters") == 0;
+        }
+        if (!m_multiDrawIndirect)
+            LOG(NEXO_WARN, "GL_ARB_shader_draw_parameters is not supported, static meshes will not be batched");
         m_initialized = true;
         LOG(NEXO_DEV, "Opengl renderer api initialized");
     }
@@ -113,14 +143,46 @@ namespace nexo::renderer {
             glDepthMask(GL_FALSE);
     }
 
-    void NxOpenGlRendererApi::drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, size_t indexCount)
+    void NxOpenGlRendererApi::drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, const size_t indexCount,
+                                          const size_t firstIndex, const int baseVertex)
     {
         if (!m_initialized)
             THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
         if (!vertexArray)
             THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Vertex array cannot be null");
         const size_t count = indexCount ? indexCount : vertexArray->getIndexBuffer()->getCount();
-        glDrawElements(GL_TRIANGLES, static_cast<int>(count), GL_UNSIGNED_INT, nullptr);
+        if (!firstIndex && !baseVertex) {
+            glDrawElements(GL_TRIANGLES, static_cast<int>(count), GL_UNSIGNED_INT, nullptr);
+            return;
+        }
+        glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<int>(count), GL_UNSIGNED_INT,
+                                 reinterpret_cast<const void *>(firstIndex * sizeof(unsigned int)), baseVertex);
+    }
+
+    void NxOpenGlRendererApi::multiDrawIndexedIndirect(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                                       const std::span<const NxDrawIndexedIndirectCommand> commands)
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!vertexArray)
+            THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Vertex array cannot be null");
+        if (!m_multiDrawIndirect)
+            THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Multi draw indirect is not supported by this context");
+        if (commands.empty())
+            return;
+
+        if (!m_indirectBuffer)
+            glCreateBuffers(1, &m_indirectBuffer);
+        const size_t size = commands.size_bytes();
+        // Orphaned every call so the upload never waits for the previous draws to be read
+        if (size > m_indirectBufferSize)
+            m_indirectBufferSize = std::max(size, m_indirectBufferSize * 2);
+        glNamedBufferData(m_indirectBuffer, static_cast<GLsizeiptr>(m_indirectBufferSize), nullptr, GL_STREAM_DRAW);
+        glNamedBufferSubData(m_indirectBuffer, 0, static_cast<GLsizeiptr>(size), commands.data());
+
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_indirectBuffer);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(commands.size()), 0);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
     }
 
     void NxOpenGlRendererApi::drawUnIndexed(size_t verticesCount)
@@ -192,4 +254,17 @@ namespace nexo::renderer {
         else if (order == WindingOrder::CW)
             glFrontFace(GL_CW);
     }
+
+    void NxOpenGlRendererApi::setDrawBuffers(const unsigned int count)
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        constexpr GLenum attachments[] = {
+            GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2, GL_COLOR_ATTACHMENT3,
+            GL_COLOR_ATTACHMENT4, GL_COLOR_ATTACHMENT5, GL_COLOR_ATTACHMENT6, GL_COLOR_ATTACHMENT7
+        };
+        if (count > std::size(attachments))
+            THROW_EXCEPTION(NxOutOfRangeException, count, std::size(attachments));
+        glDrawBuffers(static_cast<int>(count), attachments);
+    }
 }
@@ -22,8 +22,10 @@
 #include "Shader.hpp"
 #include "renderer/RendererExceptions.hpp"
 #include "OpenGlShaderReflection.hpp"
+#include "renderer/ShaderCache.hpp"
 
 #include <array>
+#include <chrono>
 #include <vector>
 #include <glm/gtc/type_ptr.hpp>
 
@@ -41,16 +43,16 @@ namespace nexo::renderer {
 
     NxOpenGlShader::NxOpenGlShader(const std::string &path)
     {
-        const std::string src = readFile(path);
-        const auto shaderSources = preProcess(src, path);
-        compile(shaderSources);
-
         auto lastSlash = path.find_last_of("/\\");
         lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
         const auto lastDot = path.rfind('.');
         const auto count = lastDot == std::string::npos ? path.size() - lastSlash : lastDot - lastSlash;
         m_name = path.substr(lastSlash, count);
-        setupUniformLocations();
+
+        const std::string src = loadSource(path);
+        const auto shaderSources = preProcess(src, path);
+        // Keyed by the expanded source, like NxShaderBinaryCache::prefetch
+        build(NxShaderBinaryCache::makeKey(NxShaderBinaryCache::get().getDriverIdentity(), src), shaderSources);
     }
 
     NxOpenGlShader::NxOpenGlShader(std::string name, const std::string_view &vertexSource,
@@ -59,8 +61,11 @@ namespace nexo::renderer {
         std::unordered_map<GLenum, std::string> preProcessedSource;
         preProcessedSource[GL_VERTEX_SHADER] = vertexSource;
         preProcessedSource[GL_FRAGMENT_SHADER] = fragmentSource;
-        compile(preProcessedSource);
-        setupUniformLocations();
+        std::string source(vertexSource);
+        source += '\0';
+        source += fragmentSource;
+        build(NxShaderBinaryCache::makeKey(NxShaderBinaryCache::get().getDriverIdentity(), source),
+              preProcessedSource);
     }
 
     NxOpenGlShader::~NxOpenGlShader()
@@ -107,6 +112,66 @@ namespace nexo::renderer {
         return shaderSources;
     }
 
+    void NxOpenGlShader::build(const uint64_t cacheKey, const std::unordered_map<GLenum, std::string> &shaderSources)
+    {
+        auto &cache = NxShaderBinaryCache::get();
+        const auto start = std::chrono::steady_clock::now();
+        if (loadFromCache(cacheKey)) {
+            cache.recordBuild(true, std::chrono::steady_clock::now() - start);
+            return;
+        }
+
+        compile(shaderSources);
+        setupUniformLocations();
+        storeToCache(cacheKey);
+        cache.recordBuild(false, std::chrono::steady_clock::now() - start);
+    }
+
+    bool NxOpenGlShader::loadFromCache(const uint64_t cacheKey)
+    {
+        auto &cache = NxShaderBinaryCache::get();
+        auto binary = cache.load(cacheKey);
+        if (!binary)
+            return false;
+
+        const GLuint program = glCreateProgram();
+        glProgramBinary(program, binary->format, binary->data.data(), static_cast<GLsizei>(binary->data.size()));
+        GLint isLinked = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+        if (isLinked == GL_FALSE) {
+            // Drivers may refuse their own binaries after an update, rebuild from source
+            LOG(NEXO_WARN, "Cached binary rejected by the driver for shader {}, recompiling", m_name);
+            glDeleteProgram(program);
+            cache.reject(cacheKey);
+            return false;
+        }
+        m_id = program;
+        m_uniformInfos = std::move(binary->uniforms);
+        m_attributeInfos = std::move(binary->attributes);
+        mapRequiredAttributes();
+        return true;
+    }
+
+    void NxOpenGlShader::storeToCache(const uint64_t cacheKey) const
+    {
+        auto &cache = NxShaderBinaryCache::get();
+        if (!cache.isEnabled())
+            return;
+        GLint length = 0;
+        glGetProgramiv(m_id, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0)
+            return;
+
+        NxShaderBinary binary;
+        binary.data.resize(static_cast<size_t>(length));
+        GLenum format = 0;
+        glGetProgramBinary(m_id, length, nullptr, &format, binary.data.data());
+        binary.format = format;
+        binary.uniforms = m_uniformInfos;
+        binary.attributes = m_attributeInfos;
+        cache.store(cacheKey, binary);
+    }
+
     void NxOpenGlShader::compile(const std::unordered_map<GLenum, std::string> &shaderSources)
     {
         // Vertex and fragment shaders are successfully compiled.
@@ -154,6 +219,8 @@ namespace nexo::renderer {
         }
         m_id = program;
 
+        if (NxShaderBinaryCache::get().isEnabled())
+            glProgramParameteri(m_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
         // Link our program
         glLinkProgram(m_id);
 
@@ -188,7 +255,11 @@ namespace nexo::renderer {
     {
         m_uniformInfos = ShaderReflection::reflectUniforms(m_id);
         m_attributeInfos = ShaderReflection::reflectAttributes(m_id);
+        mapRequiredAttributes();
+    }
 
+    void NxOpenGlShader::mapRequiredAttributes()
+    {
         static const std::unordered_map<std::string, std::function<void(RequiredAttributes&)>> attributeMappers = {
             {"aPos", [](RequiredAttributes& attrs) { attrs.bitsUnion.flags.position = true; }},
             {"aNormal", [](RequiredAttributes& attrs) { attrs.bitsUnion.flags.normal = true; }},
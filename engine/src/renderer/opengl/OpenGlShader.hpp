@@ -89,8 +89,12 @@ namespace nexo::renderer {
             unsigned int m_id = 0;
 
             static std::unordered_map<GLenum, std::string> preProcess(const std::string_view &src, const std::string &filePath);
+            void build(uint64_t cacheKey, const std::unordered_map<GLenum, std::string> &shaderSources);
+            bool loadFromCache(uint64_t cacheKey);
+            void storeToCache(uint64_t cacheKey) const;
             void compile(const std::unordered_map<GLenum, std::string> &shaderSources);
             void setupUniformLocations();
+            void mapRequiredAttributes();
             int getUniformLocation(const std::string& name) const;
     };
 
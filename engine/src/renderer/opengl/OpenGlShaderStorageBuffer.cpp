@@ -43,7 +43,7 @@ namespace nexo::renderer {
 		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 	}
 
-	void NxOpenGlShaderStorageBuffer::setData(void* data, size_t size)
+	void NxOpenGlShaderStorageBuffer::setData(const void* data, size_t size)
 	{
 		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_id);
 		glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, size, data);
@@ -0,0 +1,106 @@
+//// OpenGlStreamBuffer.cpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the opengl persistently mapped stream buffer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "OpenGlStreamBuffer.hpp"
+#include "Logger.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+#include <algorithm>
+
+namespace nexo::renderer {
+
+    static GLenum toOpenGlTarget(const NxStreamBufferTarget target)
+    {
+        return target == NxStreamBufferTarget::INDEX ? GL_ELEMENT_ARRAY_BUFFER : GL_ARRAY_BUFFER;
+    }
+
+    static bool overlaps(const size_t offset, const size_t size, const size_t otherOffset, const size_t otherSize)
+    {
+        return offset < otherOffset + otherSize && otherOffset < offset + size;
+    }
+
+    NxOpenGlStreamBuffer::NxOpenGlStreamBuffer(const size_t size) : m_size(size)
+    {
+        constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers(1, &m_id);
+        glNamedBufferStorage(m_id, static_cast<GLsizeiptr>(size), nullptr, flags);
+        m_mapping = static_cast<std::byte *>(glMapNamedBufferRange(m_id, 0, static_cast<GLsizeiptr>(size), flags));
+        if (!m_mapping) {
+            glDeleteBuffers(1, &m_id);
+            THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Failed to map the stream buffer");
+        }
+    }
+
+    NxOpenGlStreamBuffer::~NxOpenGlStreamBuffer()
+    {
+        for (const auto &lock : m_locks)
+            glDeleteSync(lock.fence);
+        // The driver keeps the storage alive until the draws still reading it are done
+        glUnmapNamedBuffer(m_id);
+        glDeleteBuffers(1, &m_id);
+    }
+
+    void NxOpenGlStreamBuffer::bind(const NxStreamBufferTarget target) const
+    {
+        glBindBuffer(toOpenGlTarget(target), m_id);
+    }
+
+    void NxOpenGlStreamBuffer::unbind(const NxStreamBufferTarget target) const
+    {
+        glBindBuffer(toOpenGlTarget(target), 0);
+    }
+
+    void NxOpenGlStreamBuffer::lockRange(const size_t offset, const size_t size)
+    {
+        m_locks.push_back({offset, size, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)});
+    }
+
+    bool NxOpenGlStreamBuffer::isRangeLocked(const size_t offset, const size_t size)
+    {
+        bool locked = false;
+        std::erase_if(m_locks, [&](const Lock &lock) {
+            if (!overlaps(offset, size, lock.offset, lock.size))
+                return false;
+            const GLenum status = glClientWaitSync(lock.fence, 0, 0);
+            if (status == GL_TIMEOUT_EXPIRED) {
+                locked = true;
+                return false;
+            }
+            glDeleteSync(lock.fence);
+            return true;
+        });
+        return locked;
+    }
+
+    void NxOpenGlStreamBuffer::waitRange(const size_t offset, const size_t size)
+    {
+        constexpr GLuint64 waitTimeout = 1'000'000'000; // 1 second, in nanoseconds
+        std::erase_if(m_locks, [&](const Lock &lock) {
+            if (!overlaps(offset, size, lock.offset, lock.size))
+                return false;
+            GLenum status = glClientWaitSync(lock.fence, GL_SYNC_FLUSH_COMMANDS_BIT, waitTimeout);
+            while (status == GL_TIMEOUT_EXPIRED) {
+                LOG(NEXO_WARN, "Waiting for the GPU to release a range of stream buffer {}", m_id);
+                status = glClientWaitSync(lock.fence, GL_SYNC_FLUSH_COMMANDS_BIT, waitTimeout);
+            }
+            glDeleteSync(lock.fence);
+            return true;
+        });
+    }
+
+}
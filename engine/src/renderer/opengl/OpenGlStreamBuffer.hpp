@@ -0,0 +1,77 @@
+//// OpenGlStreamBuffer.hpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the opengl persistently mapped stream buffer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "renderer/StreamBuffer.hpp"
+
+#include <glad/glad.h>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @class NxOpenGlStreamBuffer
+     * @brief Immutable buffer storage mapped once for coherent, persistent writes.
+     *
+     * Locked ranges are guarded by fence syncs, polled or waited on when a range is about to be written again.
+     */
+    class NxOpenGlStreamBuffer final : public NxStreamBuffer {
+        public:
+            /**
+             * @brief Allocates the storage and maps it for the lifetime of the buffer.
+             *
+             * OpenGL Calls:
+             * - `glCreateBuffers`, `glNamedBufferStorage`: Allocates immutable storage, persistent and coherent.
+             * - `glMapNamedBufferRange`: Maps the whole storage for writing.
+             *
+             * Throws:
+             * - NxInvalidValue if the storage cannot be mapped.
+             */
+            explicit NxOpenGlStreamBuffer(size_t size);
+            ~NxOpenGlStreamBuffer() override;
+
+            NxOpenGlStreamBuffer(const NxOpenGlStreamBuffer &) = delete;
+            NxOpenGlStreamBuffer &operator=(const NxOpenGlStreamBuffer &) = delete;
+
+            void bind(NxStreamBufferTarget target) const override;
+            void unbind(NxStreamBufferTarget target) const override;
+
+            [[nodiscard]] std::byte *getMapping() override { return m_mapping; }
+            [[nodiscard]] size_t getSize() const override { return m_size; }
+
+            void lockRange(size_t offset, size_t size) override;
+            [[nodiscard]] bool isRangeLocked(size_t offset, size_t size) override;
+            void waitRange(size_t offset, size_t size) override;
+
+            [[nodiscard]] unsigned int getId() const override { return m_id; }
+
+        private:
+            struct Lock {
+                size_t offset;
+                size_t size;
+                GLsync fence;
+            };
+
+            unsigned int m_id = 0;
+            size_t m_size = 0;
+            std::byte *m_mapping = nullptr;
+            std::vector<Lock> m_locks;
+    };
+
+}
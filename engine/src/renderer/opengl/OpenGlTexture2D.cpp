@@ -23,6 +23,14 @@
 
 #include <stb_image.h>
 
+// S3TC is an extension, the loader may not define its enums
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+    #define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
 namespace nexo::renderer {
 
     NxOpenGlTexture2D::NxOpenGlTexture2D(const unsigned int width, const unsigned int height) : m_width(width), m_height(height)
@@ -84,6 +92,60 @@ namespace nexo::renderer {
         stbi_image_free(data);
     }
 
+    NxOpenGlTexture2D::NxOpenGlTexture2D(const std::span<const NxTextureMipLevel> levels, const NxTextureFormat format)
+    {
+        NxTextureCheckMipLevels(levels, format, "OPENGL");
+
+        GLint internalFormat = 0;
+        GLenum dataFormat = 0;
+        switch (format) {
+            case NxTextureFormat::R8: internalFormat = GL_R8; dataFormat = GL_RED; break;
+            case NxTextureFormat::RG8: internalFormat = GL_RG8; dataFormat = GL_RG; break;
+            case NxTextureFormat::RGB8: internalFormat = GL_RGB8; dataFormat = GL_RGB; break;
+            case NxTextureFormat::RGBA8: internalFormat = GL_RGBA8; dataFormat = GL_RGBA; break;
+            case NxTextureFormat::BC1: internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+            case NxTextureFormat::BC3: internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+            case NxTextureFormat::BC5: internalFormat = GL_COMPRESSED_RG_RGTC2; break;
+            case NxTextureFormat::BC7: internalFormat = GL_COMPRESSED_RGBA_BPTC_UNORM; break;
+            default:
+                THROW_EXCEPTION(NxTextureUnsupportedFormat, "OPENGL", static_cast<int>(format), "(mip chain)");
+        }
+
+        const unsigned int maxTextureSize = getMaxTextureSize();
+        if (levels.front().width > maxTextureSize || levels.front().height > maxTextureSize)
+            THROW_EXCEPTION(NxTextureInvalidSize, "OPENGL", levels.front().width, levels.front().height, maxTextureSize);
+
+        m_internalFormat = internalFormat;
+        m_dataFormat = dataFormat;
+        m_compressed = NxTextureFormatIsCompressed(format);
+        m_width = levels.front().width;
+        m_height = levels.front().height;
+
+        glGenTextures(1, &m_id);
+        glBindTexture(GL_TEXTURE_2D, m_id);
+        // Uncompressed rows are tightly packed, whatever their channel count
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        for (size_t i = 0; i < levels.size(); ++i) {
+            const auto &level = levels[i];
+            const auto glLevel = static_cast<GLint>(i);
+            const auto glWidth = static_cast<GLsizei>(level.width);
+            const auto glHeight = static_cast<GLsizei>(level.height);
+            if (m_compressed)
+                glCompressedTexImage2D(GL_TEXTURE_2D, glLevel, static_cast<GLenum>(m_internalFormat), glWidth,
+                                       glHeight, 0, static_cast<GLsizei>(level.size), level.data);
+            else
+                glTexImage2D(GL_TEXTURE_2D, glLevel, m_internalFormat, glWidth, glHeight, 0, m_dataFormat,
+                             GL_UNSIGNED_BYTE, level.data);
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levels.size() - 1));
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, levels.size() > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
     NxOpenGlTexture2D::~NxOpenGlTexture2D()
     {
         glDeleteTextures(1, &m_id);
@@ -95,7 +157,8 @@ namespace nexo::renderer {
         int height = 0;
         int channels = 0;
         //TODO: Set this conditionnaly based on the type of texture
-        //stbi_set_flip_vertically_on_load(1);
+        // Same as the file loader, the flip is process-wide and would otherwise depend on the previous loads
+        stbi_set_flip_vertically_on_load(1);
         stbi_uc *data = stbi_load_from_memory(buffer, static_cast<int>(len), &width, &height, &channels, 0);
         if (!data)
             THROW_EXCEPTION(NxTextureUnsupportedFormat, "OPENGL", channels, "(buffer)");
@@ -118,6 +181,8 @@ namespace nexo::renderer {
 
     void NxOpenGlTexture2D::setData(void *data, const size_t size)
     {
+        if (m_compressed)
+            THROW_EXCEPTION(NxTextureUnsupportedFormat, "OPENGL", 0, m_path.empty() ? "(mip chain)" : m_path);
         if (const size_t expectedSize = static_cast<size_t>(m_width) * m_height * (m_dataFormat == GL_RGBA ? 4 : 3); size != expectedSize)
             THROW_EXCEPTION(NxTextureSizeMismatch, "OPENGL", size, expectedSize);
         glBindTexture(GL_TEXTURE_2D, m_id);
@@ -128,6 +128,21 @@ namespace nexo::renderer {
              */
             NxOpenGlTexture2D(const uint8_t *buffer, unsigned int len);
 
+            /**
+             * @brief Creates an OpenGL 2D texture from a precomputed mip chain.
+             *
+             * Block compressed levels are uploaded with glCompressedTexImage2D, without any transcoding, and the
+             * texture samples its mips with trilinear filtering.
+             *
+             * @param levels Mip levels, from the full resolution image down.
+             * @param format Format of every level.
+             *
+             * @throws NxInvalidValue If the mip chain is malformed.
+             * @throws NxTextureSizeMismatch If the size of a level does not match its dimensions.
+             * @throws NxTextureUnsupportedFormat If the format is not supported.
+             */
+            NxOpenGlTexture2D(std::span<const NxTextureMipLevel> levels, NxTextureFormat format);
+
             [[nodiscard]] unsigned int getWidth() const override {return m_width;};
             [[nodiscard]] unsigned int getHeight() const override {return m_height;};
 
@@ -232,5 +247,6 @@ namespace nexo::renderer {
             unsigned int m_id{};
             GLint m_internalFormat{};
             GLenum m_dataFormat{};
+            bool m_compressed = false;
     };
 }
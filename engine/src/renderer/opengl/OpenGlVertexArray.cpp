@@ -50,6 +50,9 @@ namespace nexo::renderer {
             case NxShaderDataType::MAT3: return GL_FLOAT;
             case NxShaderDataType::MAT4: return GL_FLOAT;
             case NxShaderDataType::BOOL: return GL_BOOL;
+            case NxShaderDataType::HALF2: return GL_HALF_FLOAT;
+            case NxShaderDataType::SHORT2: return GL_SHORT;
+            case NxShaderDataType::USHORT4: return GL_UNSIGNED_SHORT;
             default: return 0;
         }
     }
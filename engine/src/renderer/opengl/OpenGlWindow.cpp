@@ -144,11 +144,26 @@ namespace nexo::renderer {
     }
 
     void NxOpenGlWindow::onUpdate()
+    {
+        swapBuffers();
+        pollEvents();
+    }
+
+    void NxOpenGlWindow::swapBuffers()
     {
         glfwSwapBuffers(_openGlWindow);
+    }
+
+    void NxOpenGlWindow::pollEvents()
+    {
         glfwPollEvents();
     }
 
+    void NxOpenGlWindow::makeContextCurrent(const bool current)
+    {
+        glfwMakeContextCurrent(current ? _openGlWindow : nullptr);
+    }
+
     void NxOpenGlWindow::setVsync(const bool enabled)
     {
         if (enabled)
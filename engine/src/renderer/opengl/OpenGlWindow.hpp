@@ -78,6 +78,12 @@ namespace nexo::renderer {
             */
             void onUpdate() override;
 
+            void swapBuffers() override;
+            void pollEvents() override;
+            void makeContextCurrent(bool current) override;
+            // GLFW contexts can be current on any thread, as long as it is a single one at a time
+            [[nodiscard]] bool supportsContextHandoff() const override { return true; }
+
             [[nodiscard]] unsigned int getWidth() const override { return _props.width; };
             [[nodiscard]] unsigned int getHeight() const override {return _props.height; };
 
@@ -103,6 +109,8 @@ namespace nexo::renderer {
             [[nodiscard]] bool isVsync() const override;
 
 
+            [[nodiscard]] double getTime() const override { return glfwGetTime(); }
+
             [[nodiscard]] bool isOpen() const override { return !glfwWindowShouldClose(_openGlWindow);};
             void close() override { glfwSetWindowShouldClose(_openGlWindow, GLFW_TRUE); };
 
@@ -43,6 +43,48 @@ namespace Nexo
         public UInt32 PerspectiveCameraTarget;
         public UInt32 PhysicsBodyComponent;
     }
+
+    [StructLayout(LayoutKind.Sequential)]
+    public unsafe struct ComponentColumn
+    {
+        public void* Data;
+        public UInt32* Entities;
+        public UInt64 Count;
+        public UInt64 Stride;
+    }
+
+    /// <summary>
+    /// Strided view over one field of every component of a type, pointing directly into native storage.
+    /// Invalidated by any component insertion or removal of that type.
+    /// </summary>
+    public readonly unsafe ref struct ComponentColumn<TField> where TField : unmanaged
+    {
+        private readonly ComponentColumn _column;
+
+        internal ComponentColumn(ComponentColumn column)
+        {
+            _column = column;
+        }
+
+        public int Count => (int)_column.Count;
+
+        public ref TField this[int index]
+        {
+            get
+            {
+                if ((UInt64)index >= _column.Count)
+                    throw new IndexOutOfRangeException();
+                return ref Unsafe.AsRef<TField>((byte*)_column.Data + (UInt64)index * _column.Stride);
+            }
+        }
+
+        public UInt32 EntityAt(int index)
+        {
+            if ((UInt64)index >= _column.Count)
+                throw new IndexOutOfRangeException();
+            return _column.Entities[index];
+        }
+    }
     
     /// <summary>
     /// Provides interop functionality for calling native C++ functions from C# using function pointers.
@@ -112,6 +154,12 @@ namespace Nexo
             [UnmanagedFunctionPointer(CallingConvention.Winapi, CharSet = CharSet.Ansi)]
             public delegate ComponentTypeIds NxGetComponentTypeIdsDelegate();
 
+            [UnmanagedFunctionPointer(CallingConvention.Winapi, CharSet = CharSet.Ansi)]
+            public delegate void NxAddComponentsDelegate(UInt32 *entities, UInt64 entityCount, UInt32 typeId, void *componentData);
+
+            [UnmanagedFunctionPointer(CallingConvention.Winapi, CharSet = CharSet.Ansi)]
+            public delegate ComponentColumn NxGetComponentColumnDelegate(UInt32 typeId, UInt64 fieldOffset);
+
             // Function pointers
             public HelloFromNativeDelegate NxHelloFromNative;
             public AddNumbersDelegate NxAddNumbers;
@@ -132,6 +180,8 @@ namespace Nexo
             public NxHasComponentDelegate NxHasComponent;
             public NxRegisterComponentDelegate NxRegisterComponent;
             public NxGetComponentTypeIdsDelegate NxGetComponentTypeIds;
+            public NxAddComponentsDelegate NxAddComponents;
+            public NxGetComponentColumnDelegate NxGetComponentColumn;
         }
 
         private static NativeApiCallbacks s_callbacks;
@@ -407,6 +457,37 @@ namespace Nexo
             }
         }
         
+        public static unsafe void AddComponents<T>(ReadOnlySpan<UInt32> entityIds, ReadOnlySpan<T> components) where T : unmanaged
+        {
+            if (!_typeToNativeIdMap.TryGetValue(typeof(T), out var typeId))
+                throw new InvalidOperationException($"Unsupported component type: {typeof(T)}");
+            if (entityIds.Length != components.Length)
+                throw new ArgumentException("There must be one component per entity");
+
+            try
+            {
+                fixed (UInt32* entities = entityIds)
+                fixed (T* data = components)
+                {
+                    s_callbacks.NxAddComponents.Invoke(entities, (UInt64)entityIds.Length, typeId, data);
+                }
+            }
+            catch (Exception ex)
+            {
+                Console.WriteLine($"Error calling AddComponents<{typeof(T)}>: {ex.Message}");
+            }
+        }
+
+        public static ComponentColumn<TField> GetComponentColumn<T, TField>(String fieldName)
+            where T : unmanaged where TField : unmanaged
+        {
+            if (!_typeToNativeIdMap.TryGetValue(typeof(T), out var typeId))
+                throw new InvalidOperationException($"Unsupported component type: {typeof(T)}");
+
+            var fieldOffset = (UInt64)Marshal.OffsetOf<T>(fieldName);
+            return new ComponentColumn<TField>(s_callbacks.NxGetComponentColumn.Invoke(typeId, fieldOffset));
+        }
+
         public static void RemoveComponent<T>(UInt32 entityId) where T : unmanaged
         {
             if (!_typeToNativeIdMap.TryGetValue(typeof(T), out var typeId))
@@ -219,6 +219,59 @@ namespace nexo::scripting {
             };
         }
 
+        void NxAddComponents(const ecs::Entity *entities, const UInt64 entityCount, const UInt32 componentTypeId, const void *componentData)
+        {
+            if (componentTypeId >= ecs::MAX_COMPONENT_TYPE) {
+                LOG(NEXO_ERROR, "NxAddComponents: Maximum component type ID exceeded");
+                return;
+            }
+            if (entityCount == 0)
+                return;
+            if (entities == nullptr || componentData == nullptr) {
+                LOG(NEXO_ERROR, "NxAddComponents: entities or componentData is null");
+                return;
+            }
+            const auto& coordinator = *Application::m_coordinator;
+
+            try {
+                coordinator.addComponents(std::span(entities, entityCount), static_cast<ecs::ComponentType>(componentTypeId), componentData);
+            } catch (const ecs::ComponentNotRegistered &) {
+                LOG(NEXO_ERROR, "NxAddComponents: Component type {} is not registered", componentTypeId);
+            } catch (const std::exception &e) {
+                LOG(NEXO_ERROR, "NxAddComponents: {}", e.what());
+            }
+        }
+
+        ComponentColumn NxGetComponentColumn(const UInt32 componentTypeId, const UInt64 fieldOffset)
+        {
+            if (componentTypeId >= ecs::MAX_COMPONENT_TYPE) {
+                LOG(NEXO_ERROR, "NxGetComponentColumn: Maximum component type ID exceeded");
+                return {};
+            }
+            const auto& coordinator = *Application::m_coordinator;
+
+            try {
+                const auto componentArray = coordinator.getComponentArray(static_cast<ecs::ComponentType>(componentTypeId));
+                if (fieldOffset >= componentArray->getComponentSize()) {
+                    LOG(NEXO_ERROR, "NxGetComponentColumn: Field offset {} is outside of the component", fieldOffset);
+                    return {};
+                }
+
+                const auto column = componentArray->column<std::byte>(fieldOffset);
+                return ComponentColumn {
+                    .data = column.empty() ? nullptr : column.data(),
+                    .entities = componentArray->entities().data(),
+                    .count = column.size(),
+                    .stride = column.stride(),
+                };
+            } catch (const ecs::ComponentNotRegistered &) {
+                LOG(NEXO_ERROR, "NxGetComponentColumn: Component type {} is not registered", componentTypeId);
+            } catch (const std::exception &e) {
+                LOG(NEXO_ERROR, "NxGetComponentColumn: {}", e.what());
+            }
+            return {};
+        }
+
         void NxCreateBodyFromShape(ecs::Entity entity, Vector3 position, Vector3 size, Vector3 rotation, UInt32 shapeType, UInt32 motionType)
         {
             const auto& app = Application::getInstance();
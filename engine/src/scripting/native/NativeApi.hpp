@@ -85,6 +85,13 @@ namespace nexo::scripting {
             UInt32 PhysicsBodyComponent;
         };
 
+        struct ComponentColumn {
+            void *data;                 // Address of the field in the first component, null if empty
+            const ecs::Entity *entities; // Entity owning each element
+            UInt64 count;               // Number of components
+            UInt64 stride;              // Distance in bytes between two elements
+        };
+
         NEXO_RET(void) NxHelloFromNative(void);
         NEXO_RET(Int32) NxAddNumbers(Int32 a, Int32 b);
         NEXO_RET(const char*) NxGetNativeMessage(void);
@@ -99,6 +106,8 @@ namespace nexo::scripting {
         NEXO_RET(bool) NxHasComponent(ecs::Entity entity, UInt32 componentTypeId);
         NEXO_RET(Int64) NxRegisterComponent(const char *name, UInt64 componentSize, const Field *fields, UInt64 fieldCount);
         NEXO_RET(ComponentTypeIds) NxGetComponentTypeIds();
+        NEXO_RET(void) NxAddComponents(const ecs::Entity *entities, UInt64 entityCount, UInt32 componentTypeId, const void *componentData);
+        NEXO_RET(ComponentColumn) NxGetComponentColumn(UInt32 componentTypeId, UInt64 fieldOffset);
 
         NEXO_RET(ecs::Entity) NxCreateTetrahedron(Vector3 position, Vector3 size, Vector3 rotation, Vector4 color);
         NEXO_RET(ecs::Entity) NxCreatePyramid(Vector3 position, Vector3 size, Vector3 rotation, Vector4 color);
@@ -135,6 +144,8 @@ namespace nexo::scripting {
         ApiCallback<bool(ecs::Entity, UInt32)> NxHasComponent{&scripting::NxHasComponent};
         ApiCallback<Int64(const char*, UInt64, const Field *, UInt64)> NxRegisterComponent{&scripting::NxRegisterComponent};
         ApiCallback<ComponentTypeIds()> NxGetComponentTypeIds{&scripting::NxGetComponentTypeIds};
+        ApiCallback<void(const ecs::Entity *, UInt64, UInt32, const void *)> NxAddComponents{&scripting::NxAddComponents};
+        ApiCallback<ComponentColumn(UInt32, UInt64)> NxGetComponentColumn{&scripting::NxGetComponentColumn};
     };
 
     inline NativeApiCallbacks nativeApiCallbacks;
@@ -51,21 +51,22 @@ namespace nexo::system {
         }
         nexo::Logger::resetOnce(NEXO_LOG_ONCE_KEY("No camera found in scene {}, skipping", sceneName));
 
-		const auto cameraSpan = get<components::CameraComponent>();
+		auto cameraSpan = get<components::CameraComponent>();
 		const auto transformComponentArray = get<components::TransformComponent>();
 		const auto entitySpan = m_group->entities();
 		renderContext.cameras.reserve(partition->count);
 
 		for (size_t i = partition->startIndex; i < partition->startIndex + partition->count; ++i)
 		{
-			const auto &cameraComponent = cameraSpan[i];
+			auto &cameraComponent = cameraSpan[i];
 			if (!cameraComponent.render)
 				continue;
 			const auto &transformComponent = transformComponentArray->get(entitySpan[i]);
 			glm::mat4 projectionMatrix = cameraComponent.getProjectionMatrix();
 			glm::mat4 viewMatrix = cameraComponent.getViewMatrix(transformComponent);
 			const glm::mat4 viewProjectionMatrix = projectionMatrix * viewMatrix;
-			components::CameraContext context{viewProjectionMatrix, transformComponent.pos, cameraComponent.clearColor, cameraComponent.m_renderTarget, cameraComponent.pipeline};
+			components::CameraContext context{viewProjectionMatrix, transformComponent.pos, cameraComponent.clearColor, cameraComponent.m_renderTarget, &cameraComponent.pipeline,
+			                                  viewMatrix, projectionMatrix, cameraComponent.nearPlane, cameraComponent.farPlane};
 			renderContext.cameras.push_back(context);
 		}
 	}
@@ -34,10 +34,11 @@ namespace nexo::system {
 	*
 	* This system iterates over all active camera entities and computes their view-projection
 	* matrices using the CameraComponent and TransformComponent. The computed CameraContext is
-	* then pushed into the RenderContext (a singleton component).
+	* then pushed into the RenderContext (a singleton component), along with a pointer to the camera's
+	* render pipeline so the pipeline is not copied every frame.
 	*
 	* @note Component Access Rights:
-	*  - READ access to components::CameraComponent (owned)
+	*  - WRITE access to components::CameraComponent (owned, its pipeline receives the frame's draw commands)
 	*  - READ access to components::SceneTag (non-owned)
 	*  - READ access to components::TransformComponent (non-owned)
 	*  - WRITE access to components::RenderContext (singleton)
@@ -47,7 +48,7 @@ namespace nexo::system {
 	*/
 	class CameraContextSystem final : public ecs::GroupSystem<
 		ecs::Owned<
-			ecs::Read<components::CameraComponent>>,
+			ecs::Write<components::CameraComponent>>,
         ecs::NonOwned<
         	ecs::Read<components::SceneTag>,
          	ecs::Read<components::TransformComponent>>,
@@ -89,7 +89,7 @@ namespace nexo::system {
         const components::TransformComponent& transform,
         const ShapeType shapeType,
         const JPH::EMotionType motionType
-    ) const
+    )
     {
         const JPH::ShapeSettings* shapeSettings = nullptr;
 
@@ -171,26 +171,20 @@ namespace nexo::system {
             motionType == JPH::EMotionType::Dynamic ? Layers::MOVING : Layers::NON_MOVING
         );
 
-        const JPH::Body* body = bodyInterface->CreateBody(bodySettings);
-        if (!body) {
-            LOG(NEXO_ERROR, "Body creation failed.");
+        const JPH::BodyID bodyID = addBody({bodySettings});
+        if (bodyID.IsInvalid())
             return {};
-        }
-
-        bodyInterface->AddBody(body->GetID(),
-            motionType == JPH::EMotionType::Dynamic ? JPH::EActivation::Activate : JPH::EActivation::DontActivate
-        );
 
         const auto type = motionType == JPH::EMotionType::Dynamic
             ? components::PhysicsBodyComponent::Type::Dynamic
             : components::PhysicsBodyComponent::Type::Static;
 
-        coord->addComponent(entity, components::PhysicsBodyComponent{ body->GetID(), type });
+        coord->addComponent(entity, components::PhysicsBodyComponent{ bodyID, type });
 
-        return body->GetID();
+        return bodyID;
     }
 
-    JPH::BodyID PhysicsSystem::createDynamicBody(const ecs::Entity entity, const components::TransformComponent& transform) const
+    JPH::BodyID PhysicsSystem::createDynamicBody(const ecs::Entity entity, const components::TransformComponent& transform)
     {
         const JPH::Vec3 halfExtent(transform.size.x * 0.5f, transform.size.y * 0.5f, transform.size.z * 0.5f);
         const JPH::BoxShapeSettings shapeSettings(halfExtent);
@@ -204,20 +198,18 @@ namespace nexo::system {
             Layers::MOVING
         );
 
-        const JPH::Body* body = bodyInterface->CreateBody(bodySettings);
+        const JPH::BodyID bodyID = addBody({bodySettings});
 
         // Inertia => Non tested
         // if (body->IsDynamic()) {
         //     body->GetMotionProperties()->SetInverseInertia(JPH::Vec3::sReplicate(1.0f), JPH::Quat::sIdentity());
         // }
 
-        bodyInterface->AddBody(body->GetID(), JPH::EActivation::Activate);
-
-        coord->addComponent(entity, components::PhysicsBodyComponent{ body->GetID(), components::PhysicsBodyComponent::Type::Dynamic });
-        return body->GetID();
+        coord->addComponent(entity, components::PhysicsBodyComponent{ bodyID, components::PhysicsBodyComponent::Type::Dynamic });
+        return bodyID;
     }
 
-    JPH::BodyID PhysicsSystem::createStaticBody(ecs::Entity entity, const components::TransformComponent& transform) const
+    JPH::BodyID PhysicsSystem::createStaticBody(ecs::Entity entity, const components::TransformComponent& transform)
     {
         JPH::BoxShapeSettings baseShapeSettings(
             JPH::Vec3(transform.size.x * 0.5f, transform.size.y * 0.5f, transform.size.z * 0.5f)
@@ -239,11 +231,10 @@ namespace nexo::system {
             Layers::NON_MOVING
         );
 
-        JPH::Body* body = bodyInterface->CreateBody(bodySettings);
-        bodyInterface->AddBody(body->GetID(), JPH::EActivation::DontActivate);
+        const JPH::BodyID bodyID = addBody({bodySettings, true});
 
-        coord->addComponent(entity, components::PhysicsBodyComponent{ body->GetID(), components::PhysicsBodyComponent::Type::Static });
-        return body->GetID();
+        coord->addComponent(entity, components::PhysicsBodyComponent{ bodyID, components::PhysicsBodyComponent::Type::Static });
+        return bodyID;
     }
 
     JPH::BodyID PhysicsSystem::createBody(const components::TransformComponent& transform, JPH::EMotionType motionType) const
@@ -284,6 +275,61 @@ namespace nexo::system {
         }
     }
 
+    JPH::BodyID PhysicsSystem::addBody(const BodyRecord &record)
+    {
+        const JPH::Body* body = bodyInterface->CreateBody(record.settings);
+        if (!body) {
+            LOG(NEXO_ERROR, "Body creation failed.");
+            return {};
+        }
+
+        const JPH::BodyID bodyID = body->GetID();
+        bodyInterface->AddBody(bodyID,
+            record.settings.mMotionType == JPH::EMotionType::Dynamic ? JPH::EActivation::Activate : JPH::EActivation::DontActivate
+        );
+        m_bodyRecords[bodyID.GetIndexAndSequenceNumber()] = record;
+        return bodyID;
+    }
+
+    void PhysicsSystem::rebuildBodies()
+    {
+        // Bodies created during play have no entity anymore, and restored components may reference destroyed bodies
+        JPH::BodyIDVector bodyIDs;
+        physicsSystem->GetBodies(bodyIDs);
+        for (const JPH::BodyID bodyID : bodyIDs) {
+            if (bodyInterface->IsAdded(bodyID))
+                bodyInterface->RemoveBody(bodyID);
+            bodyInterface->DestroyBody(bodyID);
+        }
+
+        const auto records = std::move(m_bodyRecords);
+        m_bodyRecords.clear();
+        for (const ecs::Entity entity : entities) {
+            const auto& transform = getComponent<components::TransformComponent>(entity);
+            auto& physicsBody = getComponent<components::PhysicsBodyComponent>(entity);
+
+            const JPH::RVec3 position(transform.pos.x, transform.pos.y, transform.pos.z);
+            const JPH::Quat rotation = JPH::Quat(transform.quat.x, transform.quat.y, transform.quat.z, transform.quat.w).Normalized();
+
+            BodyRecord record;
+            if (const auto it = records.find(physicsBody.bodyID.GetIndexAndSequenceNumber()); it != records.end()) {
+                record = it->second;
+                record.settings.mPosition = position;
+                if (!record.rotationInShape)
+                    record.settings.mRotation = rotation;
+            } else {
+                const bool dynamic = physicsBody.type == components::PhysicsBodyComponent::Type::Dynamic;
+                record.settings = JPH::BodyCreationSettings(
+                    new JPH::BoxShapeSettings(JPH::Vec3(transform.size.x * 0.5f, transform.size.y * 0.5f, transform.size.z * 0.5f)),
+                    position, rotation,
+                    dynamic ? JPH::EMotionType::Dynamic : JPH::EMotionType::Static,
+                    dynamic ? Layers::MOVING : Layers::NON_MOVING
+                );
+            }
+            physicsBody.bodyID = addBody(record);
+        }
+    }
+
     void PhysicsSystem::applyForce(const JPH::BodyID bodyID, const JPH::Vec3& force) const
     {
         bodyInterface->AddForce(bodyID, force);
@@ -33,6 +33,7 @@
 #include <QuerySystem.hpp>
 #include <components/PhysicsBodyComponent.hpp>
 #include <components/Transform.hpp>
+#include <unordered_map>
 #include <vector>
 
 namespace nexo::system
@@ -182,16 +183,25 @@ namespace nexo::system
         void init();
         void update();
 
-        JPH::BodyID createDynamicBody(ecs::Entity entity, const components::TransformComponent& transform) const;
-        JPH::BodyID createStaticBody(ecs::Entity entity, const components::TransformComponent& transform) const;
+        JPH::BodyID createDynamicBody(ecs::Entity entity, const components::TransformComponent& transform);
+        JPH::BodyID createStaticBody(ecs::Entity entity, const components::TransformComponent& transform);
 
         JPH::BodyID createBody(const components::TransformComponent& transform, JPH::EMotionType motionType) const;
         JPH::BodyID createBodyFromShape(ecs::Entity entity, const components::TransformComponent& transform,
-                                        ShapeType shapeType, JPH::EMotionType motionType) const;
+                                        ShapeType shapeType, JPH::EMotionType motionType);
 
 
         void syncTransformsToBodies(ecs::Coordinator& coordinator) const;
 
+        /**
+         * @brief Destroys every body of the physics world and creates them again from the physics components.
+         *
+         * Used when the components are restored behind the physics world, e.g. when leaving play mode: bodies
+         * created in the meantime are destroyed, and each entity gets a new body with the settings its previous one
+         * was created with, at its transform. Entities whose body was not created by the system get a box.
+         */
+        void rebuildBodies();
+
         void applyForce(JPH::BodyID bodyID, const JPH::Vec3& force) const;
         void setGravity(const JPH::Vec3& gravity) const;
         void activateBody(JPH::BodyID bodyID) const;
@@ -201,6 +211,16 @@ namespace nexo::system
         const JPH::BodyLockInterface* getBodyLockInterface() const { return bodyLockInterface; }
 
     private:
+        struct BodyRecord {
+            JPH::BodyCreationSettings settings;
+            bool rotationInShape = false; //< Static bodies bake their rotation in their shape
+        };
+
+        /**
+         * @brief Creates and adds a body, recording its settings to rebuild it later.
+         */
+        JPH::BodyID addBody(const BodyRecord &record);
+
         JPH::TempAllocatorImpl* tempAllocator{};
         JPH::JobSystemThreadPool* jobSystem{};
         JPH::PhysicsSystem* physicsSystem{};
@@ -214,6 +234,9 @@ namespace nexo::system
 
         double m_lastPhysicsTime = 0.0;
 
+        // Keyed by body ID, the records keep the shapes alive once their body is destroyed
+        std::unordered_map<JPH::uint32, BodyRecord> m_bodyRecords;
+
         // Using hard value because Jolt documentation advice that the physics simulation should be able to be at 60fps all the time
         constexpr static float fixedTimestep = 1.0f / 60.0f;
     };
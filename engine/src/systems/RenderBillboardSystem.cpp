@@ -23,61 +23,31 @@
 #include "renderer/ShaderLibrary.hpp"
 #include "renderer/Renderer3D.hpp"
 #include "components/Editor.hpp"
+#include "core/memory/FrameArena.hpp"
+
+#include <array>
 
 namespace nexo::system {
     /**
-    * @brief Sets up the lighting uniforms in the given shader.
+    * @brief Sets up the lighting uniforms in the given draw command.
     *
-    * This static helper function binds the provided shader and sets uniforms for ambient, directional,
-    * point, and spot lights based on the current lightContext data. After updating the uniforms, the shader is unbound.
+    * This static helper function sets the uniforms for the ambient and directional lights based on the current
+    * lightContext data. Point and spot lights come from the light clusters the camera pipeline binds.
     *
-    * @param shader Shared pointer to the shader used for rendering.
+    * @param cmd Draw command receiving the light values.
     * @param lightContext The light context containing lighting information for the scene.
     *
     * @note The light context must contain valid values for:
     *  - ambientLight
-    *  - directionalLights (and directionalLightCount)
-    *  - pointLights (and pointLightCount)
-    *  - spotLights (and spotLightCount)
+    *  - dirLight
     */
     void RenderBillboardSystem::setupLights(renderer::DrawCommand &cmd, const components::LightContext& lightContext)
     {
-        cmd.uniforms["uAmbientLight"] = lightContext.ambientLight;
-
-        cmd.uniforms["uNumPointLights"] = static_cast<int>(lightContext.pointLightCount);
-        cmd.uniforms["uNumSpotLights"] = static_cast<int>(lightContext.spotLightCount);
+        cmd.setUniform("uAmbientLight", lightContext.ambientLight);
 
         const auto &directionalLight = lightContext.dirLight;
-        cmd.uniforms["uDirLight.direction"] = directionalLight.direction;
-        cmd.uniforms["uDirLight.color"] = glm::vec4(directionalLight.color, 1.0f);
-
-        const auto &pointLightComponentArray = coord->getComponentArray<components::PointLightComponent>();
-        const auto &transformComponentArray = coord->getComponentArray<components::TransformComponent>();
-        for (unsigned int i = 0; i < lightContext.pointLightCount; ++i)
-        {
-            const auto &pointLight = pointLightComponentArray->get(lightContext.pointLights[i]);
-            const auto &transform = transformComponentArray->get(lightContext.pointLights[i]);
-            cmd.uniforms[std::format("uPointLights[{}].position", i)] = transform.pos;
-            cmd.uniforms[std::format("uPointLights[{}].color", i)] = glm::vec4(pointLight.color, 1.0f);
-            cmd.uniforms[std::format("uPointLights[{}].constant", i)] = pointLight.constant;
-            cmd.uniforms[std::format("uPointLights[{}].linear", i)] = pointLight.linear;
-            cmd.uniforms[std::format("uPointLights[{}].quadratic", i)] = pointLight.quadratic;
-        }
-
-        const auto &spotLightComponentArray = coord->getComponentArray<components::SpotLightComponent>();
-        for (unsigned int i = 0; i < lightContext.spotLightCount; ++i)
-        {
-            const auto &spotLight = spotLightComponentArray->get(lightContext.spotLights[i]);
-            const auto &transform = transformComponentArray->get(lightContext.spotLights[i]);
-            cmd.uniforms[std::format("uSpotLights[{}].position", i)] = transform.pos;
-            cmd.uniforms[std::format("uSpotLights[{}].color", i)] = glm::vec4(spotLight.color, 1.0f);
-            cmd.uniforms[std::format("uSpotLights[{}].constant", i)] = spotLight.constant;
-            cmd.uniforms[std::format("uSpotLights[{}].linear", i)] = spotLight.linear;
-            cmd.uniforms[std::format("uSpotLights[{}].quadratic", i)] = spotLight.quadratic;
-            cmd.uniforms[std::format("uSpotLights[{}].direction", i)] = spotLight.direction;
-            cmd.uniforms[std::format("uSpotLights[{}].cutOff", i)] = spotLight.cutOff;
-            cmd.uniforms[std::format("uSpotLights[{}].outerCutoff", i)] = spotLight.outerCutoff;
-        }
+        cmd.setUniform("uDirLight.direction", directionalLight.direction);
+        cmd.setUniform("uDirLight.color", glm::vec4(directionalLight.color, 1.0f));
     }
 
     static glm::mat4 createBillboardTransformMatrix(
@@ -111,28 +81,62 @@ namespace nexo::system {
             };
     }
 
+    static glm::mat4 createBillboardModelMatrix(const glm::vec3 &cameraPosition,
+                                                const components::TransformComponent &transform)
+    {
+        return glm::translate(glm::mat4(1.0f), transform.pos) *
+               createBillboardTransformMatrix(cameraPosition, transform) *
+               glm::scale(glm::mat4(1.0f), glm::vec3(transform.size.x, transform.size.y, 1.0f));
+    }
+
+    /**
+    * @brief Gives a draw command the quad of a billboard, streamed when the command is executed.
+    *
+    * The billboard faces the camera of the command, so its quad is rebuilt every frame, in world space.
+    */
+    static void setBillboardGeometry(renderer::DrawCommand &cmd, const glm::mat4 &model, const ecs::Entity entity)
+    {
+        // Corners of the 1x1 quad centered at the origin, as texture coordinates
+        static constexpr std::array<glm::vec2, 4> corners = {
+            glm::vec2(0.0f, 0.0f), glm::vec2(1.0f, 0.0f), glm::vec2(1.0f, 1.0f), glm::vec2(0.0f, 1.0f)
+        };
+        static constexpr std::array<unsigned int, 6> indices = {0, 1, 2, 2, 3, 0};
+
+        cmd.type = renderer::CommandType::STREAMED;
+        const glm::vec3 normal = glm::normalize(glm::vec3(model[2]));
+        cmd.vertices.resize(corners.size());
+        for (size_t i = 0; i < corners.size(); ++i) {
+            auto &vertex = cmd.vertices[i];
+            vertex.position = glm::vec3(model * glm::vec4(corners[i] - 0.5f, 0.0f, 1.0f));
+            vertex.texCoord = corners[i];
+            vertex.normal = normal;
+            vertex.tangent = glm::vec3(0.0f);
+            vertex.bitangent = glm::vec3(0.0f);
+            vertex.entityID = static_cast<int>(entity);
+        }
+        cmd.indices.assign(indices.begin(), indices.end());
+        cmd.setUniform("uMatModel", glm::mat4(1.0f));
+    }
+
     static renderer::DrawCommand createSelectedDrawCommand(
-        const glm::vec3 &cameraPosition,
-        const components::BillboardComponent &mesh,
-        const std::shared_ptr<assets::Material> &materialAsset,
-        const components::TransformComponent &transform)
+        const ecs::Entity entity,
+        const glm::mat4 &model,
+        const std::shared_ptr<assets::Material> &materialAsset)
     {
-        renderer::DrawCommand cmd;
-        cmd.vao = mesh.vao;
+        renderer::DrawCommand cmd(memory::FrameArena::get().resource());
+        setBillboardGeometry(cmd, model, entity);
+        cmd.setVertexDecode({});
         const bool isOpaque = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->isOpaque : true;
         if (isOpaque)
             cmd.shader = renderer::ShaderLibrary::getInstance().get("Flat color");
         else {
             cmd.shader = renderer::ShaderLibrary::getInstance().get("Albedo unshaded transparent");
-            cmd.uniforms["uMaterial.albedoColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoColor : glm::vec4(0.0f);
+            cmd.texturePage = renderer::NxRenderer3D::get().reserveTextureSlots(1);
+            cmd.setUniform("uMaterial.albedoColor", materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoColor : glm::vec4(0.0f));
             const auto albedoTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoTexture.lock() : nullptr;
             const auto albedoTexture = albedoTextureAsset && albedoTextureAsset->isLoaded() ? albedoTextureAsset->getData()->texture : nullptr;
-            cmd.uniforms["uMaterial.albedoTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(albedoTexture);
+            cmd.setUniform("uMaterial.albedoTexIndex", renderer::NxRenderer3D::get().getTextureIndex(albedoTexture));
         }
-        const glm::mat4 &billboardRotation = createBillboardTransformMatrix(cameraPosition, transform);
-        cmd.uniforms["uMatModel"]= glm::translate(glm::mat4(1.0f), transform.pos) *
-                                    billboardRotation *
-                                    glm::scale(glm::mat4(1.0f), glm::vec3(transform.size.x, transform.size.y, 1.0f));
         cmd.filterMask = 0;
         cmd.filterMask = renderer::F_OUTLINE_MASK;
         return cmd;
@@ -140,40 +144,37 @@ namespace nexo::system {
 
     static renderer::DrawCommand createDrawCommand(
         const ecs::Entity entity,
-        const glm::vec3 &cameraPosition,
+        const glm::mat4 &model,
         const std::shared_ptr<renderer::NxShader> &shader,
-        const components::BillboardComponent &billboard,
-        const std::shared_ptr<assets::Material> &materialAsset,
-        const components::TransformComponent &transform)
+        const std::shared_ptr<assets::Material> &materialAsset)
     {
-        renderer::DrawCommand cmd;
-        cmd.vao = billboard.vao;
+        renderer::DrawCommand cmd(memory::FrameArena::get().resource());
+        setBillboardGeometry(cmd, model, entity);
         cmd.shader = shader;
-        const glm::mat4 &billboardRotation = createBillboardTransformMatrix(cameraPosition, transform);
-        cmd.uniforms["uMatModel"]= glm::translate(glm::mat4(1.0f), transform.pos) *
-                                    billboardRotation *
-                                    glm::scale(glm::mat4(1.0f), glm::vec3(transform.size.x, transform.size.y, 1.0f));
-        cmd.uniforms["uEntityId"] = static_cast<int>(entity);
+        cmd.setVertexDecode({});
+        cmd.setUniform("uEntityId", static_cast<int>(entity));
 
-        cmd.uniforms["uMaterial.albedoColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoColor : glm::vec4(0.0f);
+        // Albedo, specular, emissive and roughness maps
+        cmd.texturePage = renderer::NxRenderer3D::get().reserveTextureSlots(4);
+        cmd.setUniform("uMaterial.albedoColor", materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoColor : glm::vec4(0.0f));
         const auto albedoTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoTexture.lock() : nullptr;
         const auto albedoTexture = albedoTextureAsset && albedoTextureAsset->isLoaded() ? albedoTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.albedoTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(albedoTexture);
+        cmd.setUniform("uMaterial.albedoTexIndex", renderer::NxRenderer3D::get().getTextureIndex(albedoTexture));
 
-        cmd.uniforms["uMaterial.specularColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->specularColor : glm::vec4(0.0f);
+        cmd.setUniform("uMaterial.specularColor", materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->specularColor : glm::vec4(0.0f));
         const auto specularTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->metallicMap.lock() : nullptr;
         const auto specularTexture = specularTextureAsset && specularTextureAsset->isLoaded() ? specularTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.specularTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(specularTexture);
+        cmd.setUniform("uMaterial.specularTexIndex", renderer::NxRenderer3D::get().getTextureIndex(specularTexture));
 
-        cmd.uniforms["uMaterial.emissiveColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->emissiveColor : glm::vec3(0.0f);
+        cmd.setUniform("uMaterial.emissiveColor", materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->emissiveColor : glm::vec3(0.0f));
         const auto emissiveTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->emissiveMap.lock() : nullptr;
         const auto emissiveTexture = emissiveTextureAsset && emissiveTextureAsset->isLoaded() ? emissiveTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.emissiveTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(emissiveTexture);
+        cmd.setUniform("uMaterial.emissiveTexIndex", renderer::NxRenderer3D::get().getTextureIndex(emissiveTexture));
 
-        cmd.uniforms["uMaterial.roughness"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->roughness : 1.0f;
+        cmd.setUniform("uMaterial.roughness", materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->roughness : 1.0f);
         const auto roughnessTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->roughnessMap.lock() : nullptr;
         const auto roughnessTexture = roughnessTextureAsset && roughnessTextureAsset->isLoaded() ? roughnessTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.roughnessTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(roughnessTexture);
+        cmd.setUniform("uMaterial.roughnessTexIndex", renderer::NxRenderer3D::get().getTextureIndex(roughnessTexture));
 
         cmd.filterMask = 0;
         cmd.filterMask |= renderer::F_FORWARD_PASS;
@@ -202,43 +203,34 @@ namespace nexo::system {
         Logger::resetOnce(NEXO_LOG_ONCE_KEY("Nothing to render in scene {}, skipping", sceneName));
 
 		const auto transformComponentArray = get<components::TransformComponent>();
-		const auto billboardSpan = get<components::BillboardComponent>();
 		const auto materialComponentArray = get<components::MaterialComponent>();
 		const std::span<const ecs::Entity> entitySpan = m_group->entities();
+		static const std::string noShader;
 
 		for (auto &camera : renderContext.cameras) {
-            std::vector<renderer::DrawCommand> drawCommands;
             for (size_t i = partition->startIndex; i < partition->startIndex + partition->count; ++i) {
                 const ecs::Entity entity = entitySpan[i];
                 if (coord->entityHasComponent<components::CameraComponent>(entity) && sceneType != SceneType::EDITOR)
                     continue;
                 const auto &transform = transformComponentArray->get(entitySpan[i]);
                 const auto &materialAsset = materialComponentArray->get(entitySpan[i]).material.lock();
-                const auto &billboard = billboardSpan[i];
-                std::string shaderStr = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->shader : "";
+                const std::string &shaderStr = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->shader : noShader;
                 auto shader = renderer::ShaderLibrary::getInstance().get(shaderStr);
-                auto cmd = createDrawCommand(
-                    entity,
-                    camera.cameraPosition,
-                    shader,
-                    billboard,
-                    materialAsset,
-                    transform
-                );
-                cmd.uniforms["uViewProjection"] = camera.viewProjectionMatrix;
-                cmd.uniforms["uCamPos"] = camera.cameraPosition;
+                const glm::mat4 model = createBillboardModelMatrix(camera.cameraPosition, transform);
+                auto cmd = createDrawCommand(entity, model, shader, materialAsset);
+                cmd.setUniform("uViewProjection", camera.viewProjectionMatrix);
+                cmd.setUniform("uCamPos", camera.cameraPosition);
                 setupLights(cmd, renderContext.sceneLights);
-                drawCommands.push_back(cmd);
+                camera.pipeline->addDrawCommand(std::move(cmd));
 
                 if (coord->entityHasComponent<components::SelectedTag>(entity)) {
-                    auto selectedCmd = createSelectedDrawCommand(camera.cameraPosition, billboard, materialAsset, transform);
-                    selectedCmd.uniforms["uViewProjection"] = camera.viewProjectionMatrix;
-                    selectedCmd.uniforms["uCamPos"] = camera.cameraPosition;
+                    auto selectedCmd = createSelectedDrawCommand(entity, model, materialAsset);
+                    selectedCmd.setUniform("uViewProjection", camera.viewProjectionMatrix);
+                    selectedCmd.setUniform("uCamPos", camera.cameraPosition);
                     setupLights(selectedCmd, renderContext.sceneLights);
-                    drawCommands.push_back(selectedCmd);
+                    camera.pipeline->addDrawCommand(std::move(selectedCmd));
                 }
             }
-            camera.pipeline.addDrawCommands(drawCommands);
 		}
 	}
 }
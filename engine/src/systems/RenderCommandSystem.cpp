@@ -19,8 +19,13 @@
 #include "RenderCommandSystem.hpp"
 #include "Renderer3D.hpp"
 #include "renderer/DrawCommand.hpp"
+#include "renderer/LightClusters.hpp"
+#include "renderer/MeshLod.hpp"
+#include "renderer/OcclusionCuller.hpp"
+#include "renderer/RenderCommand.hpp"
 #include "components/Editor.hpp"
 #include "components/Light.hpp"
+#include "components/Occluder.hpp"
 #include "components/Render3D.hpp"
 #include "components/RenderContext.hpp"
 #include "components/SceneComponents.hpp"
@@ -28,113 +33,257 @@
 #include "components/StaticMesh.hpp"
 #include "components/Transform.hpp"
 #include "core/event/Input.hpp"
+#include "core/memory/FrameArena.hpp"
+#include "core/spatial/Bounds.hpp"
 #include "math/Projection.hpp"
 #include "math/Vector.hpp"
 #include "renderPasses/Masks.hpp"
 #include "Application.hpp"
 #include "renderer/ShaderLibrary.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <glm/gtc/type_ptr.hpp>
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp>
 
 namespace nexo::system {
 
+    namespace {
+        // Mesh drawn by a multi draw indirect batch instead of its own draw command
+        struct BatchCandidate {
+            std::shared_ptr<renderer::NxShader> shader;
+            std::shared_ptr<renderer::NxVertexArray> vao;
+            renderer::NxVertexFormat vertexFormat;
+            renderer::NxMeshRange range;
+            uint32_t texturePage;
+            renderer::NxObjectData object;
+        };
+    }
+
     /**
-    * @brief Sets up the lighting uniforms in the given shader.
+    * @brief Sets up the lighting uniforms in the given uniform map.
     *
-    * This static helper function binds the provided shader and sets uniforms for ambient, directional,
-    * point, and spot lights based on the current lightContext data. After updating the uniforms, the shader is unbound.
+    * This static helper function fills the uniforms for the ambient and directional lights based on the current
+    * lightContext data. Lights do not depend on the camera, so this is done once per frame on the shared
+    * uniforms. Point and spot lights are read from the light clusters of each camera instead (see binLights).
     *
-    * @param shader Shared pointer to the shader used for rendering.
+    * @param uniforms Uniform map receiving the light values.
     * @param lightContext The light context containing lighting information for the scene.
     *
     * @note The light context must contain valid values for:
     *  - ambientLight
-    *  - directionalLights (and directionalLightCount)
-    *  - pointLights (and pointLightCount)
-    *  - spotLights (and spotLightCount)
+    *  - dirLight
     */
-    void RenderCommandSystem::setupLights(renderer::DrawCommand &cmd, const components::LightContext& lightContext)
+    void RenderCommandSystem::setupLights(renderer::UniformMap &uniforms, const components::LightContext& lightContext)
     {
-        cmd.uniforms["uAmbientLight"] = lightContext.ambientLight;
-
-        cmd.uniforms["uNumPointLights"] = static_cast<int>(lightContext.pointLightCount);
-        cmd.uniforms["uNumSpotLights"] = static_cast<int>(lightContext.spotLightCount);
+        renderer::DrawCommand::setUniform(uniforms, "uAmbientLight", lightContext.ambientLight);
 
         const auto &directionalLight = lightContext.dirLight;
-        cmd.uniforms["uDirLight.direction"] = directionalLight.direction;
-        cmd.uniforms["uDirLight.color"] = glm::vec4(directionalLight.color, 1.0f);
+        renderer::DrawCommand::setUniform(uniforms, "uDirLight.direction", directionalLight.direction);
+        renderer::DrawCommand::setUniform(uniforms, "uDirLight.color", glm::vec4(directionalLight.color, 1.0f));
+    }
 
-        const auto &pointLightComponentArray = coord->getComponentArray<components::PointLightComponent>();
+    /**
+    * @brief Bins the point and spot lights of the scene in the light clusters of every camera.
+    *
+    * The lights are converted once to their storage buffer layout, then each camera pipeline keeps the ones
+    * reaching its frustum, grouped by cluster. The view matrix and the cluster depth parameters the shaders need to
+    * find the cluster of a fragment are set as view uniforms.
+    *
+    * @param cameras Cameras rendering the scene this frame.
+    * @param lightContext The light context containing the point and spot light entities of the scene.
+    * @param frameResource Memory resource of the frame, for the converted lights.
+    */
+    void RenderCommandSystem::binLights(const std::vector<components::CameraContext> &cameras,
+                                        const components::LightContext &lightContext,
+                                        std::pmr::memory_resource *frameResource)
+    {
         const auto &transformComponentArray = coord->getComponentArray<components::TransformComponent>();
-        for (unsigned int i = 0; i < lightContext.pointLightCount; ++i)
+
+        std::pmr::vector<renderer::NxPointLightData> pointLights(frameResource);
+        pointLights.reserve(lightContext.pointLights.size());
+        const auto &pointLightComponentArray = coord->getComponentArray<components::PointLightComponent>();
+        for (const ecs::Entity entity : lightContext.pointLights)
         {
-            const auto &pointLight = pointLightComponentArray->get(lightContext.pointLights[i]);
-            const auto &transform = transformComponentArray->get(lightContext.pointLights[i]);
-            cmd.uniforms[std::format("uPointLights[{}].position", i)] = transform.pos;
-            cmd.uniforms[std::format("uPointLights[{}].color", i)] = glm::vec4(pointLight.color, 1.0f);
-            cmd.uniforms[std::format("uPointLights[{}].constant", i)] = pointLight.constant;
-            cmd.uniforms[std::format("uPointLights[{}].linear", i)] = pointLight.linear;
-            cmd.uniforms[std::format("uPointLights[{}].quadratic", i)] = pointLight.quadratic;
+            const auto &pointLight = pointLightComponentArray->get(entity);
+            const auto &transform = transformComponentArray->get(entity);
+            pointLights.push_back({
+                glm::vec4(transform.pos, pointLight.maxDistance),
+                glm::vec4(pointLight.color, 1.0f),
+                glm::vec4(pointLight.constant, pointLight.linear, pointLight.quadratic, 0.0f)
+            });
         }
 
+        std::pmr::vector<renderer::NxSpotLightData> spotLights(frameResource);
+        spotLights.reserve(lightContext.spotLights.size());
         const auto &spotLightComponentArray = coord->getComponentArray<components::SpotLightComponent>();
-        for (unsigned int i = 0; i < lightContext.spotLightCount; ++i)
+        for (const ecs::Entity entity : lightContext.spotLights)
         {
-            const auto &spotLight = spotLightComponentArray->get(lightContext.spotLights[i]);
-            const auto &transform = transformComponentArray->get(lightContext.spotLights[i]);
-            cmd.uniforms[std::format("uSpotLights[{}].position", i)] = transform.pos;
-            cmd.uniforms[std::format("uSpotLights[{}].color", i)] = glm::vec4(spotLight.color, 1.0f);
-            cmd.uniforms[std::format("uSpotLights[{}].constant", i)] = spotLight.constant;
-            cmd.uniforms[std::format("uSpotLights[{}].linear", i)] = spotLight.linear;
-            cmd.uniforms[std::format("uSpotLights[{}].quadratic", i)] = spotLight.quadratic;
-            cmd.uniforms[std::format("uSpotLights[{}].direction", i)] = spotLight.direction;
-            cmd.uniforms[std::format("uSpotLights[{}].cutOff", i)] = spotLight.cutOff;
-            cmd.uniforms[std::format("uSpotLights[{}].outerCutoff", i)] = spotLight.outerCutoff;
+            const auto &spotLight = spotLightComponentArray->get(entity);
+            const auto &transform = transformComponentArray->get(entity);
+            spotLights.push_back({
+                glm::vec4(transform.pos, spotLight.maxDistance),
+                glm::vec4(spotLight.direction, spotLight.cutOff),
+                glm::vec4(spotLight.color, 1.0f),
+                glm::vec4(spotLight.constant, spotLight.linear, spotLight.quadratic, spotLight.outerCutoff)
+            });
+        }
+
+        for (const auto &camera : cameras) {
+            auto &clusters = camera.pipeline->getLightClusters();
+            clusters.build(camera.viewMatrix, camera.projectionMatrix, camera.nearPlane, camera.farPlane,
+                           pointLights, spotLights);
+            camera.pipeline->setViewUniform("uView", camera.viewMatrix);
+            camera.pipeline->setViewUniform("uClusterDepth", clusters.getDepthParams());
+        }
+    }
+
+    /**
+    * @brief Finds the entities whose bounds reach the frustum of each camera, in the spatial index of the scene.
+    *
+    * @param cameras Cameras of the frame.
+    * @param sceneId Rendered scene, -1 to skip frustum culling.
+    * @param resource Frame resource the lists are allocated from.
+    * @return One sorted list of entities per camera, empty when the scene is not culled.
+    */
+    static std::pmr::vector<std::pmr::vector<ecs::Entity>> queryFrustums(
+        const std::vector<components::CameraContext> &cameras,
+        const int sceneId,
+        std::pmr::memory_resource *resource)
+    {
+        std::pmr::vector<std::pmr::vector<ecs::Entity>> inFrustum(resource);
+        if (sceneId == -1)
+            return inFrustum;
+        spatial::DynamicBvh *index =
+            Application::getInstance().getSpatialIndexSystem()->getSceneIndex(static_cast<unsigned int>(sceneId));
+        if (!index)
+            return inFrustum;
+        inFrustum.reserve(cameras.size());
+        for (const auto &camera : cameras) {
+            const auto entities = index->queryFrustum(spatial::Frustum::fromMatrix(camera.viewProjectionMatrix));
+            auto &visible = inFrustum.emplace_back(entities.begin(), entities.end());
+            std::ranges::sort(visible);
+        }
+        return inFrustum;
+    }
+
+    /**
+    * @brief Rasterizes the occluders of the rendered scene in the occlusion culler of every camera.
+    *
+    * @param cameras Cameras rendering the scene this frame.
+    * @param sceneId Scene being rendered, occluders of the other scenes are ignored.
+    * @return true if the scene has at least one occluder, false if the occlusion stage can be skipped.
+    */
+    bool RenderCommandSystem::rasterizeOccluders(const std::vector<components::CameraContext> &cameras,
+                                                 const unsigned int sceneId)
+    {
+        const auto &occluderComponentArray = coord->getComponentArray<components::OccluderComponent>();
+        const auto &transformComponentArray = coord->getComponentArray<components::TransformComponent>();
+        const auto &sceneTagComponentArray = coord->getComponentArray<components::SceneTag>();
+
+        bool hasOccluders = false;
+        for (const auto &camera : cameras) {
+            auto &culler = camera.pipeline->getOcclusionCuller();
+            culler.begin(camera.viewProjectionMatrix);
+            for (const ecs::Entity entity : occluderComponentArray->entities()) {
+                if (!sceneTagComponentArray->hasComponent(entity) || !transformComponentArray->hasComponent(entity))
+                    continue;
+                const auto &sceneTag = sceneTagComponentArray->get(entity);
+                if (sceneTag.id != sceneId || !sceneTag.isRendered)
+                    continue;
+                const auto &occluder = occluderComponentArray->get(entity);
+                culler.addOccluder(occluder.vertices, occluder.indices, transformComponentArray->get(entity).worldMatrix);
+            }
+            culler.rasterize();
+            hasOccluders |= culler.hasOccluders();
+        }
+        return hasOccluders;
+    }
+
+    /**
+    * @brief Picks the level of detail of a mesh for the frame.
+    *
+    * Each camera picks a level from the size of the mesh on its render target, the finest of them is drawn so a
+    * single command suits every camera. The level is kept per entity for the hysteresis of the next frame.
+    *
+    * @return 0 for the full resolution mesh, i for mesh.lods[i - 1].
+    */
+    unsigned int RenderCommandSystem::selectLod(const ecs::Entity entity,
+                                                const components::StaticMeshComponent &mesh,
+                                                const components::TransformComponent &transform,
+                                                const std::vector<components::CameraContext> &cameras,
+                                                const float threshold)
+    {
+        if (mesh.lods.empty() || cameras.empty())
+            return 0;
+        if (entity >= m_meshLods.size())
+            m_meshLods.resize(entity + 1, 0);
+
+        auto lod = static_cast<unsigned int>(mesh.lods.size());
+        for (const auto &camera : cameras) {
+            const float pixelScale = renderer::computeLodPixelScale(
+                transform.worldMatrix, mesh.localMin, mesh.localMax,
+                camera.viewMatrix, camera.projectionMatrix,
+                camera.renderTarget->getSize().y);
+            lod = std::min(lod, renderer::selectMeshLod(mesh.lods, pixelScale, threshold, m_meshLods[entity]));
         }
+        m_meshLods[entity] = static_cast<uint8_t>(lod);
+        return lod;
+    }
+
+    static const std::shared_ptr<renderer::NxVertexArray> &lodVertexArray(const components::StaticMeshComponent &mesh,
+                                                                          const unsigned int lod)
+    {
+        return lod == 0 ? mesh.vao : mesh.lods[lod - 1].vao;
+    }
+
+    static const renderer::NxMeshRange &lodRange(const components::StaticMeshComponent &mesh, const unsigned int lod)
+    {
+        return lod == 0 ? mesh.range : mesh.lods[lod - 1].range;
     }
 
     static renderer::DrawCommand createOutlineDrawCommand(const components::CameraContext &camera)
     {
-        renderer::DrawCommand cmd;
+        renderer::DrawCommand cmd(memory::FrameArena::get().resource());
         cmd.type = renderer::CommandType::FULL_SCREEN;
         cmd.filterMask = 0;
         cmd.filterMask |= renderer::F_OUTLINE_PASS;
         cmd.shader = renderer::ShaderLibrary::getInstance().get("Outline pulse flat");
 
-        cmd.uniforms["uViewProjection"] = camera.viewProjectionMatrix;
-        cmd.uniforms["uCamPos"] = camera.cameraPosition;
+        cmd.setUniform("uViewProjection", camera.viewProjectionMatrix);
+        cmd.setUniform("uCamPos", camera.cameraPosition);
 
-        cmd.uniforms["uMaskTexture"] = 0;
-        cmd.uniforms["uDepthTexture"] = 1;
-        cmd.uniforms["uDepthMaskTexture"] = 2;
-        cmd.uniforms["uTime"] = static_cast<float>(glfwGetTime());
+        cmd.setUniform("uMaskTexture", 0);
+        cmd.setUniform("uDepthTexture", 1);
+        cmd.setUniform("uDepthMaskTexture", 2);
+        cmd.setUniform("uTime", static_cast<float>(Application::getInstance().getWorldState().time.totalTime));
         const glm::vec2 screenSize = {camera.renderTarget->getSize().x, camera.renderTarget->getSize().y};
-        cmd.uniforms["uScreenSize"] = screenSize;
-        cmd.uniforms["uOutlineWidth"] = 10.0f;
+        cmd.setUniform("uScreenSize", screenSize);
+        cmd.setUniform("uOutlineWidth", 10.0f);
         return cmd;
     }
 
     static renderer::DrawCommand createGridDrawCommand(const components::CameraContext &camera, const components::RenderContext &renderContext)
     {
-        renderer::DrawCommand cmd;
+        renderer::DrawCommand cmd(memory::FrameArena::get().resource());
         cmd.type = renderer::CommandType::FULL_SCREEN;
         cmd.filterMask = 0;
         cmd.filterMask |= renderer::F_GRID_PASS;
         cmd.shader = renderer::ShaderLibrary::getInstance().get("Grid shader");
 
-        cmd.uniforms["uViewProjection"] = camera.viewProjectionMatrix;
-        cmd.uniforms["uCamPos"] = camera.cameraPosition;
+        cmd.setUniform("uViewProjection", camera.viewProjectionMatrix);
+        cmd.setUniform("uCamPos", camera.cameraPosition);
 
         const components::RenderContext::GridParams &gridParams = renderContext.gridParams;
-        cmd.uniforms["uGridSize"] = gridParams.gridSize;
-        cmd.uniforms["uGridCellSize"] = gridParams.cellSize;
-        cmd.uniforms["uGridMinPixelsBetweenCells"] = gridParams.minPixelsBetweenCells;
+        cmd.setUniform("uGridSize", gridParams.gridSize);
+        cmd.setUniform("uGridCellSize", gridParams.cellSize);
+        cmd.setUniform("uGridMinPixelsBetweenCells", gridParams.minPixelsBetweenCells);
         constexpr glm::vec4 gridColorThin = {0.5f, 0.55f, 0.7f, 0.6f};
         constexpr glm::vec4 gridColorThick = {0.7f, 0.75f, 0.9f, 0.8f};
-        cmd.uniforms["uGridColorThin"] = gridColorThin;
-        cmd.uniforms["uGridColorThick"] = gridColorThick;
+        cmd.setUniform("uGridColorThin", gridColorThin);
+        cmd.setUniform("uGridColorThick", gridColorThick);
 
 
         const glm::vec2 globalMousePos = event::getMousePosition();
@@ -198,29 +347,108 @@ namespace nexo::system {
             }
         }
 
-        cmd.uniforms["uMouseWorldPos"] = mouseWorldPos;
-        cmd.uniforms["uTime"] = static_cast<float>(glfwGetTime());
+        cmd.setUniform("uMouseWorldPos", mouseWorldPos);
+        cmd.setUniform("uTime", static_cast<float>(Application::getInstance().getWorldState().time.totalTime));
         return cmd;
     }
 
+    /**
+    * @brief Adds the commands drawing the debug lines of the frame to a camera.
+    *
+    * Each line is a quad facing the camera, about the same width on screen whatever its distance, streamed when the
+    * command is executed. Consecutive lines of the same color share a command.
+    */
+    static void addDebugLineCommands(const components::CameraContext &camera,
+                                     const std::vector<components::RenderContext::DebugLine> &lines)
+    {
+        // Half width of a line, relative to its distance to the camera
+        constexpr float halfWidthPerDistance = 0.0015f;
+        const auto shader = renderer::ShaderLibrary::getInstance().get("Albedo unshaded transparent");
+
+        for (size_t first = 0; first < lines.size();) {
+            const glm::vec4 &color = lines[first].color;
+            renderer::DrawCommand cmd(memory::FrameArena::get().resource());
+            cmd.type = renderer::CommandType::STREAMED;
+            cmd.shader = shader;
+            cmd.filterMask = renderer::F_FORWARD_PASS;
+            cmd.setVertexDecode({});
+            cmd.setUniform("uMatModel", glm::mat4(1.0f));
+            cmd.setUniform("uMaterial.albedoColor", color);
+            cmd.setUniform("uMaterial.albedoTexIndex", 0);
+            cmd.setUniform("uEntityId", -1);
+
+            size_t last = first;
+            for (; last < lines.size() && lines[last].color == color; ++last) {
+                const auto &line = lines[last];
+                const glm::vec3 direction = line.end - line.start;
+                const glm::vec3 side = glm::cross(camera.cameraPosition - (line.start + line.end) * 0.5f, direction);
+                if (glm::length(side) <= std::numeric_limits<float>::epsilon())
+                    continue;
+                // Counter clockwise seen from the camera, the back faces are culled
+                const glm::vec3 unitSide = glm::normalize(side);
+                const glm::vec3 startOffset = unitSide * glm::distance(camera.cameraPosition, line.start) * halfWidthPerDistance;
+                const glm::vec3 endOffset = unitSide * glm::distance(camera.cameraPosition, line.end) * halfWidthPerDistance;
+                const auto firstVertex = static_cast<unsigned int>(cmd.vertices.size());
+                for (const glm::vec3 &position : {line.start - startOffset, line.end - endOffset,
+                                                  line.end + endOffset, line.start + startOffset}) {
+                    renderer::NxVertex &vertex = cmd.vertices.emplace_back();
+                    vertex.position = position;
+                    vertex.texCoord = glm::vec2(0.0f);
+                    vertex.normal = glm::vec3(0.0f);
+                    vertex.tangent = glm::vec3(0.0f);
+                    vertex.bitangent = glm::vec3(0.0f);
+                    vertex.entityID = -1;
+                }
+                for (const unsigned int index : {0u, 1u, 2u, 2u, 3u, 0u})
+                    cmd.indices.push_back(firstVertex + index);
+            }
+            first = last;
+            if (!cmd.indices.empty())
+                camera.pipeline->addDrawCommand(std::move(cmd));
+        }
+    }
+
+    /**
+    * @brief Adds the twelve edges of a box to the debug lines of the frame.
+    */
+    static void addBoxLines(std::vector<components::RenderContext::DebugLine> &lines, const spatial::Aabb &box,
+                            const glm::vec4 &color)
+    {
+        const auto corner = [&box](const int index) {
+            return glm::vec3(index & 1 ? box.max.x : box.min.x, index & 2 ? box.max.y : box.min.y,
+                             index & 4 ? box.max.z : box.min.z);
+        };
+        for (int index = 0; index < 8; ++index) {
+            // Edges towards the corners one bit higher on each axis
+            for (const int axis : {1, 2, 4}) {
+                if (!(index & axis))
+                    lines.push_back({corner(index), corner(index | axis), color});
+            }
+        }
+    }
+
     static renderer::DrawCommand createSelectedDrawCommand(
         const components::StaticMeshComponent &mesh,
+        const unsigned int lod,
         const std::shared_ptr<assets::Material> &materialAsset,
         const components::TransformComponent &transform)
     {
-        renderer::DrawCommand cmd;
-        cmd.vao = mesh.vao;
+        renderer::DrawCommand cmd(memory::FrameArena::get().resource());
+        cmd.vao = lodVertexArray(mesh, lod);
+        cmd.range = lodRange(mesh, lod);
+        cmd.setVertexDecode(mesh.vertexDecode);
         const bool isOpaque = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->isOpaque : true;
         if (isOpaque)
             cmd.shader = renderer::ShaderLibrary::getInstance().get("Flat color");
         else {
             cmd.shader = renderer::ShaderLibrary::getInstance().get("Albedo unshaded transparent");
-            cmd.uniforms["uMaterial.albedoColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoColor : glm::vec4(0.0f);
+            cmd.texturePage = renderer::NxRenderer3D::get().reserveTextureSlots(1);
+            cmd.setUniform("uMaterial.albedoColor", materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoColor : glm::vec4(0.0f));
             const auto albedoTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoTexture.lock() : nullptr;
             const auto albedoTexture = albedoTextureAsset && albedoTextureAsset->isLoaded() ? albedoTextureAsset->getData()->texture : nullptr;
-            cmd.uniforms["uMaterial.albedoTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(albedoTexture);
+            cmd.setUniform("uMaterial.albedoTexIndex", renderer::NxRenderer3D::get().getTextureIndex(albedoTexture));
         }
-        cmd.uniforms["uMatModel"] = transform.worldMatrix;
+        cmd.setUniform("uMatModel", transform.worldMatrix);
         cmd.filterMask = 0;
         cmd.filterMask = renderer::F_OUTLINE_MASK;
         return cmd;
@@ -230,40 +458,134 @@ namespace nexo::system {
         const ecs::Entity entity,
         const std::shared_ptr<renderer::NxShader> &shader,
         const components::StaticMeshComponent &mesh,
+        const unsigned int lod,
         const std::shared_ptr<assets::Material> &materialAsset,
         const components::TransformComponent &transform)
     {
-        renderer::DrawCommand cmd;
-        cmd.vao = mesh.vao;
+        renderer::DrawCommand cmd(memory::FrameArena::get().resource());
+        cmd.vao = lodVertexArray(mesh, lod);
+        cmd.range = lodRange(mesh, lod);
         cmd.shader = shader;
-        cmd.uniforms["uMatModel"] = transform.worldMatrix;
-        cmd.uniforms["uEntityId"] = static_cast<int>(entity);
-
-        cmd.uniforms["uMaterial.albedoColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoColor : glm::vec4(0.0f);
+        cmd.setVertexDecode(mesh.vertexDecode);
+        // The mesh shaders keep the value a batch left otherwise, see renderer::DrawBatch
+        cmd.setUniform("uBatched", false);
+        cmd.setUniform("uMatModel", transform.worldMatrix);
+        cmd.setUniform("uEntityId", static_cast<int>(entity));
+
+        // Albedo, specular, emissive and roughness maps
+        cmd.texturePage = renderer::NxRenderer3D::get().reserveTextureSlots(4);
+        cmd.setUniform("uMaterial.albedoColor", materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoColor : glm::vec4(0.0f));
         const auto albedoTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoTexture.lock() : nullptr;
         const auto albedoTexture = albedoTextureAsset && albedoTextureAsset->isLoaded() ? albedoTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.albedoTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(albedoTexture);
+        cmd.setUniform("uMaterial.albedoTexIndex", renderer::NxRenderer3D::get().getTextureIndex(albedoTexture));
 
-        cmd.uniforms["uMaterial.specularColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->specularColor : glm::vec4(0.0f);
+        cmd.setUniform("uMaterial.specularColor", materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->specularColor : glm::vec4(0.0f));
         const auto specularTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->metallicMap.lock() : nullptr;
         const auto specularTexture = specularTextureAsset && specularTextureAsset->isLoaded() ? specularTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.specularTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(specularTexture);
+        cmd.setUniform("uMaterial.specularTexIndex", renderer::NxRenderer3D::get().getTextureIndex(specularTexture));
 
-        cmd.uniforms["uMaterial.emissiveColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->emissiveColor : glm::vec3(0.0f);
+        cmd.setUniform("uMaterial.emissiveColor", materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->emissiveColor : glm::vec3(0.0f));
         const auto emissiveTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->emissiveMap.lock() : nullptr;
         const auto emissiveTexture = emissiveTextureAsset && emissiveTextureAsset->isLoaded() ? emissiveTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.emissiveTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(emissiveTexture);
+        cmd.setUniform("uMaterial.emissiveTexIndex", renderer::NxRenderer3D::get().getTextureIndex(emissiveTexture));
 
-        cmd.uniforms["uMaterial.roughness"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->roughness : 1.0f;
+        cmd.setUniform("uMaterial.roughness", materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->roughness : 1.0f);
         const auto roughnessTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->roughnessMap.lock() : nullptr;
         const auto roughnessTexture = roughnessTextureAsset && roughnessTextureAsset->isLoaded() ? roughnessTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.roughnessTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(roughnessTexture);
+        cmd.setUniform("uMaterial.roughnessTexIndex", renderer::NxRenderer3D::get().getTextureIndex(roughnessTexture));
 
         cmd.filterMask = 0;
         cmd.filterMask |= renderer::F_FORWARD_PASS;
         return cmd;
     }
 
+    static renderer::NxObjectData createObjectData(
+        const ecs::Entity entity,
+        const components::StaticMeshComponent &mesh,
+        const std::shared_ptr<assets::Material> &materialAsset,
+        const components::TransformComponent &transform)
+    {
+        const auto *material = materialAsset && materialAsset->isLoaded() ? materialAsset->getData().get() : nullptr;
+        const auto albedoTextureAsset = material ? material->albedoTexture.lock() : nullptr;
+        const auto albedoTexture = albedoTextureAsset && albedoTextureAsset->isLoaded() ? albedoTextureAsset->getData()->texture : nullptr;
+        const auto specularTextureAsset = material ? material->metallicMap.lock() : nullptr;
+        const auto specularTexture = specularTextureAsset && specularTextureAsset->isLoaded() ? specularTextureAsset->getData()->texture : nullptr;
+
+        return {
+            transform.worldMatrix,
+            material ? material->albedoColor : glm::vec4(0.0f),
+            material ? material->specularColor : glm::vec4(0.0f),
+            glm::vec4(mesh.vertexDecode.positionMin, material ? material->roughness : 1.0f),
+            glm::vec4(mesh.vertexDecode.positionExtent, 0.0f),
+            glm::ivec4(
+                renderer::NxRenderer3D::get().getTextureIndex(albedoTexture),
+                renderer::NxRenderer3D::get().getTextureIndex(specularTexture),
+                static_cast<int>(entity),
+                0)
+        };
+    }
+
+    /**
+    * @brief Groups the meshes sharing a shader and a vertex array into multi draw indirect batches.
+    *
+    * The meshes are sorted by shader, vertex array, texture page then albedo and specular textures, each run of them
+    * becomes a batch whose draws read their object from the shared list in the same order. The textures are part of
+    * the key because the sampler array must be indexed the same way by every draw of a call.
+    *
+    * @param candidates Meshes eligible to batching, sorted in place.
+    * @param drawCommands Frame list receiving the batches and their objects.
+    * @return The number of batches built.
+    */
+    static unsigned int buildBatches(std::pmr::vector<BatchCandidate> &candidates,
+                                     renderer::SharedDrawCommands &drawCommands)
+    {
+        std::ranges::sort(candidates, [](const BatchCandidate &a, const BatchCandidate &b) {
+            const unsigned int programA = a.shader->getProgramId();
+            const unsigned int programB = b.shader->getProgramId();
+            if (programA != programB)
+                return programA < programB;
+            if (a.vao->getId() != b.vao->getId())
+                return a.vao->getId() < b.vao->getId();
+            if (a.texturePage != b.texturePage)
+                return a.texturePage < b.texturePage;
+            if (a.object.info.x != b.object.info.x)
+                return a.object.info.x < b.object.info.x;
+            return a.object.info.y < b.object.info.y;
+        });
+
+        auto *resource = drawCommands.batches.get_allocator().resource();
+        drawCommands.objects.reserve(drawCommands.objects.size() + candidates.size());
+        unsigned int batchCount = 0;
+        for (size_t begin = 0; begin < candidates.size();) {
+            const BatchCandidate &first = candidates[begin];
+            renderer::DrawBatch &batch = drawCommands.batches.emplace_back(resource);
+            batch.shader = first.shader;
+            batch.vao = first.vao;
+            batch.vertexFormat = first.vertexFormat;
+            batch.firstObject = static_cast<uint32_t>(drawCommands.objects.size());
+            batch.filterMask = renderer::F_FORWARD_PASS;
+            batch.texturePage = first.texturePage;
+            batch.albedoTexIndex = first.object.info.x;
+            batch.specularTexIndex = first.object.info.y;
+
+            size_t end = begin;
+            while (end < candidates.size() && candidates[end].shader == first.shader && candidates[end].vao == first.vao
+                   && candidates[end].texturePage == first.texturePage
+                   && candidates[end].object.info.x == first.object.info.x
+                   && candidates[end].object.info.y == first.object.info.y)
+                ++end;
+            batch.draws.reserve(end - begin);
+            for (size_t i = begin; i < end; ++i) {
+                const renderer::NxMeshRange &range = candidates[i].range;
+                batch.draws.push_back({range.indexCount, 1, range.firstIndex, range.baseVertex, 0});
+                drawCommands.objects.push_back(candidates[i].object);
+            }
+            ++batchCount;
+            begin = end;
+        }
+        return batchCount;
+    }
+
 	void RenderCommandSystem::update()
 	{
 		auto &renderContext = getSingleton<components::RenderContext>();
@@ -289,42 +611,135 @@ namespace nexo::system {
 		const auto meshSpan = get<components::StaticMeshComponent>();
 		const auto materialSpan = get<components::MaterialComponent>();
 		const std::span<const ecs::Entity> entitySpan = m_group->entities();
+		static const std::string noShader;
+
+        // Everything built here only lives for the frame, allocate it from the frame arena
+        std::pmr::memory_resource *frameResource = memory::FrameArena::get().resource();
+        const auto sharedDrawCommands = std::allocate_shared<renderer::SharedDrawCommands>(
+            std::pmr::polymorphic_allocator<renderer::SharedDrawCommands>(frameResource), frameResource);
+        auto &drawCommands = sharedDrawCommands->commands;
+        drawCommands.reserve(partition->count);
+
+        // The occlusion stage only runs when the scene designates occluders
+        auto &cameras = renderContext.cameras;
+        const std::pmr::vector<std::pmr::vector<ecs::Entity>> inFrustum =
+            queryFrustums(cameras, renderContext.frustumCulling ? renderContext.sceneRendered : -1, frameResource);
+        const bool frustumCulling = !inFrustum.empty();
+        const bool occlusionCulling = renderContext.occlusionCulling && rasterizeOccluders(cameras, sceneRendered);
+        std::pmr::vector<uint8_t> visibleInCamera(cameras.size(), 1, frameResource);
+        unsigned int simplifiedMeshCount = 0;
+
+        // Pooled meshes share their vertex arrays, the ones drawn by every camera are batched
+        const bool batching = renderContext.batchStaticMeshes && renderer::NxRenderCommand::supportsMultiDrawIndirect();
+        std::pmr::vector<BatchCandidate> batchCandidates(frameResource);
 
-        std::vector<renderer::DrawCommand> drawCommands;
 		for (size_t i = partition->startIndex; i < partition->startIndex + partition->count; ++i) {
 		    const ecs::Entity entity = entitySpan[i];
             if (coord->entityHasComponent<components::CameraComponent>(entity) && sceneType != SceneType::EDITOR)
                 continue;
             const auto &transform = transformSpan[i];
             const auto &materialAsset = materialSpan[i].material.lock();
-            std::string shaderStr = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->shader : "";
+            const std::string &shaderStr = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->shader : noShader;
             const auto &mesh = meshSpan[i];
             auto shader = renderer::ShaderLibrary::getInstance().get(shaderStr);
             if (!shader)
                 continue;
-            drawCommands.push_back(createDrawCommand(
-                entity,
-                shader,
-                mesh,
-                materialAsset,
-                transform)
-            );
 
-            if (coord->entityHasComponent<components::SelectedTag>(entity))
-                drawCommands.push_back(createSelectedDrawCommand(mesh, materialAsset, transform));
+            size_t visibleCount = cameras.size();
+            const bool occlusionTested = occlusionCulling && !coord->entityHasComponent<components::OccluderComponent>(entity);
+            if (frustumCulling || occlusionTested) {
+                visibleCount = 0;
+                for (size_t c = 0; c < cameras.size(); ++c) {
+                    bool visible = !frustumCulling || std::ranges::binary_search(inFrustum[c], entity);
+                    if (visible && occlusionTested) {
+                        auto &culler = cameras[c].pipeline->getOcclusionCuller();
+                        visible = !culler.isOccluded(mesh.localMin, mesh.localMax, transform.worldMatrix);
+                    }
+                    visibleInCamera[c] = visible;
+                    visibleCount += visible;
+                }
+                if (visibleCount == 0)
+                    continue;
+            }
+
+            const unsigned int lod = selectLod(entity, mesh, transform, cameras, renderContext.lodErrorThreshold);
+            if (lod != 0)
+                simplifiedMeshCount += static_cast<unsigned int>(visibleCount);
+
+            const bool isSelected = coord->entityHasComponent<components::SelectedTag>(entity);
+            if (isSelected && sceneType == SceneType::EDITOR && renderContext.showSelectionBounds) {
+                constexpr glm::vec4 selectionBoundsColor = {1.0f, 0.6f, 0.1f, 1.0f};
+                addBoxLines(renderContext.debugLines,
+                            spatial::Aabb::fromTransformed(mesh.localMin, mesh.localMax, transform.worldMatrix),
+                            selectionBoundsColor);
+            }
+            const bool isOpaque = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->isOpaque : true;
+            const bool pooled = lod == 0 ? mesh.allocation != nullptr : mesh.lods[lod - 1].allocation != nullptr;
+            if (batching && pooled && isOpaque && visibleCount == cameras.size() && shader->hasUniform("uBatched")) {
+                // Albedo and specular maps
+                const uint32_t texturePage = renderer::NxRenderer3D::get().reserveTextureSlots(2);
+                batchCandidates.push_back({
+                    shader, lodVertexArray(mesh, lod), mesh.vertexDecode.format, lodRange(mesh, lod), texturePage,
+                    createObjectData(entity, mesh, materialAsset, transform)
+                });
+                if (isSelected)
+                    drawCommands.push_back(createSelectedDrawCommand(mesh, lod, materialAsset, transform));
+                continue;
+            }
+            if (visibleCount == cameras.size()) {
+                drawCommands.push_back(createDrawCommand(
+                    entity,
+                    shader,
+                    mesh,
+                    lod,
+                    materialAsset,
+                    transform)
+                );
+                if (isSelected)
+                    drawCommands.push_back(createSelectedDrawCommand(mesh, lod, materialAsset, transform));
+                continue;
+            }
+
+            // Hidden from some of the cameras only, give the command to the others
+            const renderer::DrawCommand drawCommand = createDrawCommand(entity, shader, mesh, lod, materialAsset, transform);
+            for (size_t c = 0; c < cameras.size(); ++c) {
+                if (!visibleInCamera[c])
+                    continue;
+                cameras[c].pipeline->addDrawCommand(drawCommand);
+                if (isSelected)
+                    cameras[c].pipeline->addDrawCommand(createSelectedDrawCommand(mesh, lod, materialAsset, transform));
+            }
 		}
 
-		for (auto &camera : renderContext.cameras) {
-            for (auto &cmd : drawCommands) {
-                cmd.uniforms["uViewProjection"] = camera.viewProjectionMatrix;
-                cmd.uniforms["uCamPos"] = camera.cameraPosition;
-                setupLights(cmd, renderContext.sceneLights);
+        unsigned int occlusionTestedCount = 0;
+        unsigned int occludedCount = 0;
+        if (occlusionCulling) {
+            for (const auto &camera : cameras) {
+                occlusionTestedCount += camera.pipeline->getOcclusionCuller().getStats().testedCount;
+                occludedCount += camera.pipeline->getOcclusionCuller().getStats().occludedCount;
             }
-            camera.pipeline.addDrawCommands(drawCommands);
+        }
+        renderer::NxRenderer3D::get().setOcclusionStats(occlusionTestedCount, occludedCount);
+        renderer::NxRenderer3D::get().setLodStats(simplifiedMeshCount);
+
+        const auto batchStart = std::chrono::steady_clock::now();
+        const unsigned int batchCount = buildBatches(batchCandidates, *sharedDrawCommands);
+        const std::chrono::duration<float, std::milli> batchTime = std::chrono::steady_clock::now() - batchStart;
+        renderer::NxRenderer3D::get().setBatchStats(batchCount, static_cast<unsigned int>(batchCandidates.size()),
+                                                    batchTime.count());
+
+        setupLights(sharedDrawCommands->uniforms, renderContext.sceneLights);
+        binLights(renderContext.cameras, renderContext.sceneLights, frameResource);
+
+		for (auto &camera : cameras) {
+            camera.pipeline->setSharedDrawCommands(sharedDrawCommands);
+            camera.pipeline->setViewUniform("uViewProjection", camera.viewProjectionMatrix);
+            camera.pipeline->setViewUniform("uCamPos", camera.cameraPosition);
             if (sceneType == SceneType::EDITOR && renderContext.gridParams.enabled)
-                camera.pipeline.addDrawCommand(createGridDrawCommand(camera, renderContext));
+                camera.pipeline->addDrawCommand(createGridDrawCommand(camera, renderContext));
             if (sceneType == SceneType::EDITOR)
-                camera.pipeline.addDrawCommand(createOutlineDrawCommand(camera));
+                camera.pipeline->addDrawCommand(createOutlineDrawCommand(camera));
+            addDebugLineCommands(camera, renderContext.debugLines);
 		}
 	}
 }
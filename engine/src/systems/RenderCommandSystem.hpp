@@ -26,6 +26,9 @@
 #include "components/StaticMesh.hpp"
 #include "components/Transform.hpp"
 
+#include <memory_resource>
+#include <vector>
+
 namespace nexo::system {
 
 	/**
@@ -57,6 +60,17 @@ namespace nexo::system {
                 void update();
 
 			private:
-			    static void setupLights(renderer::DrawCommand &cmd, const components::LightContext& lightContext);
+			    static void setupLights(renderer::UniformMap &uniforms, const components::LightContext& lightContext);
+			    static void binLights(const std::vector<components::CameraContext> &cameras,
+			                          const components::LightContext &lightContext,
+			                          std::pmr::memory_resource *frameResource);
+			    static bool rasterizeOccluders(const std::vector<components::CameraContext> &cameras, unsigned int sceneId);
+			    unsigned int selectLod(ecs::Entity entity,
+			                           const components::StaticMeshComponent &mesh,
+			                           const components::TransformComponent &transform,
+			                           const std::vector<components::CameraContext> &cameras,
+			                           float threshold);
+
+			    std::vector<uint8_t> m_meshLods; //< Level of detail drawn for each entity on the last frame
 	};
 }
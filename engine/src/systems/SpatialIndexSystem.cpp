@@ -0,0 +1,97 @@
+//// SpatialIndexSystem.cpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the spatial index system
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "SpatialIndexSystem.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace nexo::system {
+
+    SpatialIndexSystem::SpatialIndexSystem()
+    {
+        coord->enableChangeTracking<components::TransformComponent>();
+        coord->enableChangeTracking<components::StaticMeshComponent>();
+        coord->enableChangeTracking<components::SceneTag>();
+    }
+
+    void SpatialIndexSystem::update()
+    {
+        const auto &renderContext = getSingleton<components::RenderContext>();
+        // Only the frustum culling of the render command system reads the index every frame
+        if (renderContext.sceneRendered == -1 || !renderContext.frustumCulling)
+            return;
+
+        const auto sceneRendered = static_cast<unsigned int>(renderContext.sceneRendered);
+        auto &index = m_sceneIndices[sceneRendered];
+        const ecs::Tick currentTick = coord->getCurrentTick();
+        // The history of the changes made while the scene was not rendered may have been trimmed
+        if (index.syncedTick == ecs::NULL_TICK || currentTick - index.syncedTick > coord->getChangeRetention())
+            rebuildIndex(index, sceneRendered);
+        else
+            updateChangedEntities(index, sceneRendered);
+        // Inclusive: the changes made later during this tick are seen by the next update
+        index.syncedTick = currentTick;
+        index.bvh.refit();
+    }
+
+    void SpatialIndexSystem::rebuildIndex(SceneIndex &index, const unsigned int sceneId)
+    {
+        m_changedEntities.assign(index.bvh.entities().begin(), index.bvh.entities().end());
+        for (const ecs::Entity entity : m_changedEntities)
+            syncEntity(index.bvh, entity, sceneId);
+        for (const ecs::Entity entity : entities)
+            syncEntity(index.bvh, entity, sceneId);
+    }
+
+    void SpatialIndexSystem::updateChangedEntities(SceneIndex &index, const unsigned int sceneId)
+    {
+        const ecs::Tick since = index.syncedTick;
+        m_changedEntities = coord->getModifiedSince<components::TransformComponent>(since);
+        std::ranges::move(coord->getModifiedSince<components::StaticMeshComponent>(since),
+                          std::back_inserter(m_changedEntities));
+        std::ranges::move(coord->getModifiedSince<components::SceneTag>(since), std::back_inserter(m_changedEntities));
+        std::ranges::move(coord->getRemovedSince<components::TransformComponent>(since),
+                          std::back_inserter(m_changedEntities));
+        std::ranges::move(coord->getRemovedSince<components::StaticMeshComponent>(since),
+                          std::back_inserter(m_changedEntities));
+        std::ranges::move(coord->getRemovedSince<components::SceneTag>(since), std::back_inserter(m_changedEntities));
+        // An entity can be reported by several components, syncing it twice is harmless
+        for (const ecs::Entity entity : m_changedEntities)
+            syncEntity(index.bvh, entity, sceneId);
+    }
+
+    void SpatialIndexSystem::syncEntity(spatial::DynamicBvh &bvh, const ecs::Entity entity, const unsigned int sceneId)
+    {
+        if (!entities.contains(entity) || getComponent<components::SceneTag>(entity).id != sceneId) {
+            bvh.remove(entity);
+            return;
+        }
+        const auto &mesh = getComponent<components::StaticMeshComponent>(entity);
+        const auto &transform = getComponent<components::TransformComponent>(entity);
+        bvh.update(entity, spatial::Aabb::fromTransformed(mesh.localMin, mesh.localMax, transform.worldMatrix));
+    }
+
+    spatial::DynamicBvh *SpatialIndexSystem::getSceneIndex(const unsigned int sceneId)
+    {
+        const auto it = m_sceneIndices.find(sceneId);
+        return it != m_sceneIndices.end() ? &it->second.bvh : nullptr;
+    }
+
+}
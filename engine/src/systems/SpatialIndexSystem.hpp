@@ -0,0 +1,94 @@
+//// SpatialIndexSystem.hpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the spatial index system
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ecs/QuerySystem.hpp"
+#include "components/RenderContext.hpp"
+#include "components/SceneComponents.hpp"
+#include "components/StaticMesh.hpp"
+#include "components/Transform.hpp"
+#include "core/spatial/DynamicBvh.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace nexo::system {
+
+    /**
+    * @brief System keeping a bounding volume hierarchy of the renderable entities of each scene.
+    *
+    * Every frame, the entities of the rendered scene whose transform, mesh or scene changed since the scene was last
+    * rendered are updated in the hierarchy of that scene, and the ones that left the scene or lost a component are
+    * removed from it. The changes come from the change tracking of those components, which the system enables. When
+    * a scene was not rendered for longer than the change history is kept, its hierarchy is rebuilt from every
+    * entity. The hierarchies answer frustum, ray, box and nearest neighbour queries without scanning every entity.
+    *
+    * The render command system culls the meshes outside the view of the cameras with them, so the hierarchies are
+    * only updated while RenderContext::frustumCulling is enabled. Must run after the transform systems, so the bounds
+    * use the world matrices of the frame.
+    *
+    * @note Component Access Rights:
+    *  - READ access to components::TransformComponent
+    *  - READ access to components::StaticMeshComponent
+    *  - READ access to components::SceneTag
+    *  - READ access to components::RenderContext (singleton)
+    */
+    class SpatialIndexSystem final : public ecs::QuerySystem<
+        ecs::Read<components::TransformComponent>,
+        ecs::Read<components::StaticMeshComponent>,
+        ecs::Read<components::SceneTag>,
+        ecs::ReadSingleton<components::RenderContext>> {
+            public:
+                SpatialIndexSystem();
+
+                void update();
+
+                /**
+                * @brief Returns the spatial index of a scene, as of its last update.
+                *
+                * @param sceneId Id of the scene.
+                * @return The hierarchy of the scene, nullptr if the scene has never been rendered.
+                */
+                [[nodiscard]] spatial::DynamicBvh *getSceneIndex(unsigned int sceneId);
+
+            private:
+                struct SceneIndex {
+                    spatial::DynamicBvh bvh;
+                    ecs::Tick syncedTick = ecs::NULL_TICK;  //< Tick of the last update, NULL_TICK before the first one
+                };
+
+                /**
+                * @brief Inserts every entity of the scene and removes the ones that are not part of it anymore.
+                */
+                void rebuildIndex(SceneIndex &index, unsigned int sceneId);
+
+                /**
+                * @brief Applies the component changes made since the last update of the scene.
+                */
+                void updateChangedEntities(SceneIndex &index, unsigned int sceneId);
+
+                /**
+                * @brief Inserts or updates an entity, or removes it when it does not belong to the scene anymore.
+                */
+                void syncEntity(spatial::DynamicBvh &bvh, ecs::Entity entity, unsigned int sceneId);
+
+                std::unordered_map<unsigned int, SceneIndex> m_sceneIndices;
+                std::vector<ecs::Entity> m_changedEntities;
+    };
+}
@@ -51,15 +51,16 @@ namespace nexo::system {
             if (!transformComponentArray->hasComponent(rootEntity))
                 continue;
 
-            auto& rootTransform = transformComponentArray->get(rootEntity);
-            glm::mat4 rootWorldMatrix = calculateLocalMatrix(rootTransform);
-            rootTransform.worldMatrix = rootWorldMatrix;
+            const auto& rootTransform = transformComponentArray->array()->get(rootEntity);
+            const glm::mat4 rootWorldMatrix = calculateLocalMatrix(rootTransform);
+            if (rootTransform.worldMatrix != rootWorldMatrix)
+                transformComponentArray->get(rootEntity).worldMatrix = rootWorldMatrix;
             updateChildTransforms(transformComponentArray, rootTransform.children, rootWorldMatrix);
         }
     }
 
     void TransformHierarchySystem::updateChildTransforms(
-        const std::shared_ptr<ecs::ComponentArray<components::TransformComponent>> &transformComponentArray,
+        const ecs::TrackedComponentArray<components::TransformComponent> &transformComponentArray,
         const std::vector<ecs::Entity>& children,
         const glm::mat4& parentWorldMatrix)
     {
@@ -67,13 +68,15 @@ namespace nexo::system {
             if (!transformComponentArray->hasComponent(childEntity))
                 continue;
 
-            auto& transform = transformComponentArray->get(childEntity);
+            // Read without marking it modified, only the world matrices that changed are written
+            const auto& transform = transformComponentArray->array()->get(childEntity);
 
-            glm::mat4 localMatrix = calculateLocalMatrix(transform);
-            transform.worldMatrix = parentWorldMatrix * localMatrix;
+            const glm::mat4 worldMatrix = parentWorldMatrix * calculateLocalMatrix(transform);
+            if (transform.worldMatrix != worldMatrix)
+                transformComponentArray->get(childEntity).worldMatrix = worldMatrix;
 
             if (!transform.children.empty())
-                updateChildTransforms(transformComponentArray, transform.children, transform.worldMatrix);
+                updateChildTransforms(transformComponentArray, transform.children, worldMatrix);
         }
     }
 
@@ -49,7 +49,7 @@ namespace nexo::system {
                     * @param parentTransform The parent's transform component
                     */
                 void updateChildTransforms(
-                    const std::shared_ptr<ecs::ComponentArray<components::TransformComponent>> &transformComponentArray,
+                    const ecs::TrackedComponentArray<components::TransformComponent> &transformComponentArray,
                     const std::vector<ecs::Entity>& children,
                     const glm::mat4& parentWorldMatrix);
                 [[nodiscard]] glm::mat4 calculateLocalMatrix(const components::TransformComponent& transform) const;
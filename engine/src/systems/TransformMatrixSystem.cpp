@@ -17,6 +17,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "TransformMatrixSystem.hpp"
+#include "components/Parent.hpp"
 #include "components/Transform.hpp"
 
 #define GLM_ENABLE_EXPERIMENTAL
@@ -35,9 +36,16 @@ namespace nexo::system {
             auto &sceneTag = getComponent<components::SceneTag>(entity);
 			if (sceneTag.id != sceneRendered)
 				continue;
+            // Only the transforms that moved are written, so the change tracking reports them alone
+            const auto &current = peekComponent<components::TransformComponent>(entity);
+            const glm::mat4 localMatrix = createTransformMatrix(current);
+            // The world matrix of a child is the hierarchy system's, which checks it every frame
+            if (localMatrix == current.localMatrix && (current.worldMatrix == localMatrix ||
+                                                       coord->entityHasComponent<components::ParentComponent>(entity)))
+                continue;
             auto &transform = getComponent<components::TransformComponent>(entity);
-            transform.localMatrix = createTransformMatrix(transform);
-            transform.worldMatrix = transform.localMatrix;
+            transform.localMatrix = localMatrix;
+            transform.worldMatrix = localMatrix;
         }
     }
 
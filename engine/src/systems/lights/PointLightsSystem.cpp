@@ -47,15 +47,9 @@ namespace nexo::system {
         }
         nexo::Logger::resetOnce(NEXO_LOG_ONCE_KEY("No point light found in scene {}, skipping", sceneName));
 
-		if (partition->count > MAX_POINT_LIGHTS)
-		    THROW_EXCEPTION(core::TooManyPointLightsException, sceneRendered, partition->count);
-
 		const std::span<const ecs::Entity> entitySpan = m_group->entities();
-
-		for (size_t i = partition->startIndex; i < partition->startIndex + partition->count; ++i)
-		{
-			renderContext.sceneLights.pointLights[renderContext.sceneLights.pointLightCount] = entitySpan[i];
-			renderContext.sceneLights.pointLightCount++;
-		}
+		renderContext.sceneLights.pointLights.insert(renderContext.sceneLights.pointLights.end(),
+			entitySpan.begin() + static_cast<std::ptrdiff_t>(partition->startIndex),
+			entitySpan.begin() + static_cast<std::ptrdiff_t>(partition->startIndex + partition->count));
 	}
 }
@@ -46,15 +46,9 @@ namespace nexo::system {
         }
         nexo::Logger::resetOnce(NEXO_LOG_ONCE_KEY("No spot light found in scene {}, skipping", sceneName));
 
-		if (partition->count > MAX_SPOT_LIGHTS)
-		    THROW_EXCEPTION(core::TooManySpotLightsException, sceneRendered, partition->count);
-
 		const std::span<const ecs::Entity> entitySpan = m_group->entities();
-
-		for (size_t i = partition->startIndex; i < partition->startIndex + partition->count; ++i)
-		{
-			renderContext.sceneLights.spotLights[renderContext.sceneLights.spotLightCount] = entitySpan[i];
-			renderContext.sceneLights.spotLightCount++;
-		}
+		renderContext.sceneLights.spotLights.insert(renderContext.sceneLights.spotLights.end(),
+			entitySpan.begin() + static_cast<std::ptrdiff_t>(partition->startIndex),
+			entitySpan.begin() + static_cast<std::ptrdiff_t>(partition->startIndex + partition->count));
 	}
 }
@@ -1,10 +1,9 @@
 #type vertex
 #version 430 core
-layout(location = 0) in vec3 aPos;
+layout(location = 0) in vec4 aPos;
 layout(location = 1) in vec2 aTexCoord;
-layout(location = 2) in vec3 aNormal;
-layout(location = 3) in vec3 aTangent;
-layout(location = 4) in vec3 aBiTangent;
+
+#include "common/vertex_decode.glsl"
 
 uniform mat4 uViewProjection;
 uniform mat4 uMatModel;
@@ -13,7 +12,7 @@ out vec2 vTexCoord;
 
 void main()
 {
-    vec4 worldPos = uMatModel * vec4(aPos, 1.0);
+    vec4 worldPos = uMatModel * vec4(decodePosition(aPos), 1.0);
     vTexCoord = aTexCoord;
     gl_Position = uViewProjection * worldPos;
 }
@@ -0,0 +1,27 @@
+// Per object data of the batched meshes, must match NxObjectData in renderer/DrawCommand.hpp
+// The including stage enables GL_ARB_shader_draw_parameters right after its #version directive
+struct ObjectData {
+    mat4 model;
+    vec4 albedoColor;
+    vec4 specularColor;
+    vec4 positionMin;       // w: roughness
+    vec4 positionExtent;
+    ivec4 info;             // x: albedo texture index, y: specular texture index, z: entity id
+};
+// The texture indices are shared by the objects of a batch, the fragment stage reads them from the batch uniforms
+
+layout(std430, binding = 3) readonly buffer ObjectDataBuffer {
+    ObjectData uObjects[];
+};
+
+// Set by batches only, the object of a draw is uObjects[uObjectOffset + DRAW_ID]
+uniform bool uBatched;
+uniform int uObjectOffset;
+
+// Batches are only built when the driver lists the extension (see NxOpenGlRendererApi::init), the fallback is only
+// compiled for the draws that are not batched
+#ifdef GL_ARB_shader_draw_parameters
+#define DRAW_ID gl_DrawIDARB
+#else
+#define DRAW_ID 0
+#endif
@@ -0,0 +1,52 @@
+// Decoding of the mesh vertex formats, must match renderer/VertexFormat.hpp
+#define VERTEX_FORMAT_STANDARD 0
+#define VERTEX_FORMAT_COMPACT 1
+#define VERTEX_FORMAT_COMPACT_QUANTIZED 2
+
+// Left unset by draws of standard vertices, which decode to themselves
+uniform int uVertexFormat;
+uniform vec3 uPositionMin;
+uniform vec3 uPositionExtent;
+
+vec3 decodePosition(vec4 position)
+{
+    if (uVertexFormat == VERTEX_FORMAT_COMPACT_QUANTIZED)
+        return uPositionMin + position.xyz * uPositionExtent;
+    return position.xyz;
+}
+
+// Batched meshes share the format of their draw call but each one has its own bounds
+vec3 decodePosition(vec4 position, vec3 positionMin, vec3 positionExtent)
+{
+    if (uVertexFormat == VERTEX_FORMAT_COMPACT_QUANTIZED)
+        return positionMin + position.xyz * positionExtent;
+    return position.xyz;
+}
+
+vec3 decodeOctahedral(vec2 encoded)
+{
+    vec3 n = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+    float t = max(-n.z, 0.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+vec3 decodeNormal(vec4 normal)
+{
+    if (uVertexFormat == VERTEX_FORMAT_STANDARD)
+        return normal.xyz;
+    return decodeOctahedral(normal.xy);
+}
+
+// Returns the tangent in xyz and the handedness of the bitangent in w
+vec4 decodeTangent(vec4 tangent, vec3 bitangent, vec3 normal)
+{
+    if (uVertexFormat == VERTEX_FORMAT_STANDARD)
+        return vec4(tangent.xyz, dot(cross(normal, tangent.xyz), bitangent) < 0.0 ? -1.0 : 1.0);
+    // The second component keeps 14 bits, its sign is the handedness
+    float y = round(tangent.y * 32767.0);
+    float handedness = y < 0.0 ? -1.0 : 1.0;
+    y = (y < 0.0 ? -y - 1.0 : y) / 16383.0 * 2.0 - 1.0;
+    return vec4(decodeOctahedral(vec2(tangent.x, y)), handedness);
+}
@@ -1,13 +1,15 @@
 #type vertex
 #version 430 core
-layout(location = 0) in vec3 aPos;
+layout(location = 0) in vec4 aPos;
+
+#include "common/vertex_decode.glsl"
 
 uniform mat4 uViewProjection;
 uniform mat4 uMatModel;
 
 void main()
 {
-    vec4 worldPos = uMatModel * vec4(aPos, 1.0);
+    vec4 worldPos = uMatModel * vec4(decodePosition(aPos), 1.0);
     gl_Position = uViewProjection * worldPos;
 }
 
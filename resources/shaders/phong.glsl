@@ -1,8 +1,13 @@
 #type vertex
 #version 430 core
-layout(location = 0) in vec3 aPos;
+#extension GL_ARB_shader_draw_parameters : enable
+// Four components so the quantized formats can be read too, see common/vertex_decode.glsl
+layout(location = 0) in vec4 aPos;
 layout(location = 1) in vec2 aTexCoord;
-layout(location = 2) in vec3 aNormal;
+layout(location = 2) in vec4 aNormal;
+
+#include "common/vertex_decode.glsl"
+#include "common/object_data.glsl"
 
 uniform mat4 uViewProjection;
 uniform mat4 uMatModel;
@@ -10,17 +15,42 @@ uniform mat4 uMatModel;
 out vec3 vFragPos;
 out vec2 vTexCoord;
 out vec3 vNormal;
+out vec4 vClipPos;
+
+// Material of the batched meshes, the fragment stage reads uMaterial otherwise
+flat out int vBatched;
+flat out vec4 vAlbedoColor;
+flat out vec4 vSpecularColor;
+flat out float vRoughness;
+flat out int vEntityId;
 
 void main()
 {
-    vec4 worldPos = uMatModel * vec4(aPos, 1.0);
+    mat4 model = uMatModel;
+    vec3 position;
+    vBatched = uBatched ? 1 : 0;
+    if (uBatched)
+    {
+        ObjectData object = uObjects[uObjectOffset + DRAW_ID];
+        model = object.model;
+        position = decodePosition(aPos, object.positionMin.xyz, object.positionExtent.xyz);
+        vAlbedoColor = object.albedoColor;
+        vSpecularColor = object.specularColor;
+        vRoughness = object.positionMin.w;
+        vEntityId = object.info.z;
+    }
+    else
+        position = decodePosition(aPos);
+
+    vec4 worldPos = model * vec4(position, 1.0);
     vFragPos = worldPos.xyz;
 
     vTexCoord = aTexCoord;
 
-    vNormal = mat3(transpose(inverse(uMatModel))) * aNormal;
+    vNormal = mat3(transpose(inverse(model))) * decodeNormal(aNormal);
 
     gl_Position = uViewProjection * vec4(vFragPos, 1.0);
+    vClipPos = gl_Position;
 }
 
 #type fragment
@@ -28,8 +58,11 @@ void main()
 layout(location = 0) out vec4 FragColor;
 layout(location = 1) out int EntityID;
 
-#define MAX_POINT_LIGHTS 10
-#define MAX_SPOT_LIGHTS 10
+// Must match the cluster grid of renderer/LightClusters.hpp
+#define CLUSTER_TILES_X 16
+#define CLUSTER_TILES_Y 9
+#define CLUSTER_SLICES 24
+#define CLUSTER_COUNT (CLUSTER_TILES_X * CLUSTER_TILES_Y * CLUSTER_SLICES)
 
 // Light definitions.
 struct DirectionalLight {
@@ -38,39 +71,55 @@ struct DirectionalLight {
 };
 
 struct PointLight {
-    vec3 position;
+    vec4 position;      // w: range
     vec4 color;
-
-    float constant;
-    float linear;
-    float quadratic;
+    vec4 attenuation;   // constant, linear, quadratic
 };
 
 struct SpotLight {
-    vec3 position;
-    vec3 direction;
+    vec4 position;      // w: range
+    vec4 direction;     // w: cos of the inner cut off
     vec4 color;
-    float cutOff;
-    float outerCutoff;
-    float constant;
-    float linear;
-    float quadratic;
+    vec4 attenuation;   // constant, linear, quadratic, w: cos of the outer cut off
+};
+
+layout(std430, binding = 0) readonly buffer PointLightBuffer {
+    PointLight uPointLights[];
+};
+
+layout(std430, binding = 1) readonly buffer SpotLightBuffer {
+    SpotLight uSpotLights[];
+};
+
+// x: offset in uLightIndices, y: point light count, z: spot light count (listed after the point lights)
+layout(std430, binding = 2) readonly buffer LightClusterBuffer {
+    uvec4 uClusters[CLUSTER_COUNT];
+    uint uLightIndices[];
 };
 
 in vec3 vFragPos;
 in vec2 vTexCoord;
 in vec3 vNormal;
+in vec4 vClipPos;
+
+flat in int vBatched;
+flat in vec4 vAlbedoColor;
+flat in vec4 vSpecularColor;
+flat in float vRoughness;
+flat in int vEntityId;
 
 uniform sampler2D uTexture[32];
+// Texture indices of the batched meshes, uniform so the sampler array is indexed the same way by every draw
+uniform int uBatchAlbedoTex;
+uniform int uBatchSpecularTex;
 
 uniform vec3 uCamPos;
 
 uniform vec3 uAmbientLight;
 uniform DirectionalLight uDirLight;
-uniform PointLight uPointLights[MAX_POINT_LIGHTS];
-uniform int uNumPointLights;
-uniform SpotLight uSpotLights[MAX_SPOT_LIGHTS];
-uniform int uNumSpotLights;
+
+uniform mat4 uView;
+uniform vec2 uClusterDepth; // scale and bias turning log(view depth) into a slice
 
 struct Material {
     vec4 albedoColor;
@@ -87,6 +136,8 @@ struct Material {
     int opacityTexIndex; // Default: 0 (white texture)
 };
 uniform Material uMaterial;
+// uMaterial, or the material of the batched object drawn
+Material material;
 
 uniform int uEntityId;
 
@@ -97,29 +148,29 @@ vec3 CalcDirLight(DirectionalLight light, vec3 normal, vec3 viewDir)
     float diff = max(dot(normal, lightDir), 0.0);
     // specular shading
     vec3 reflectDir = reflect(-lightDir, normal);
-    float shininess = mix(128.0, 2.0, uMaterial.roughness);
+    float shininess = mix(128.0, 2.0, material.roughness);
     float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);
     // combine results
-    vec3 diffuse = light.color.rgb * diff * uMaterial.albedoColor.rgb * vec3(texture(uTexture[uMaterial.albedoTexIndex], vTexCoord));
-    vec3 specular = light.color.rgb * spec * uMaterial.specularColor.rgb * vec3(texture(uTexture[uMaterial.specularTexIndex], vTexCoord));
+    vec3 diffuse = light.color.rgb * diff * material.albedoColor.rgb * vec3(texture(uTexture[material.albedoTexIndex], vTexCoord));
+    vec3 specular = light.color.rgb * spec * material.specularColor.rgb * vec3(texture(uTexture[material.specularTexIndex], vTexCoord));
     return (diffuse + specular);
 }
 
 vec3 CalcPointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
 {
-    vec3 lightDir = normalize(light.position - fragPos);
+    vec3 lightDir = normalize(light.position.xyz - fragPos);
     // diffuse shading
     float diff = max(dot(normal, lightDir), 0.0);
     // specular shading
     vec3 reflectDir = reflect(-lightDir, normal);
-    float shininess = mix(128.0, 2.0, uMaterial.roughness);
+    float shininess = mix(128.0, 2.0, material.roughness);
     float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);
     // attenuation
-    float distance = length(light.position - fragPos);
-    float attenuation = 1.0 / (light.constant + light.linear * distance + light.quadratic * (distance * distance));
+    float distance = length(light.position.xyz - fragPos);
+    float attenuation = 1.0 / (light.attenuation.x + light.attenuation.y * distance + light.attenuation.z * (distance * distance));
     // combine results
-    vec3 diffuse = light.color.rgb * diff * uMaterial.albedoColor.rgb * vec3(texture(uTexture[uMaterial.albedoTexIndex], vTexCoord));
-    vec3 specular = light.color.rgb * spec * uMaterial.specularColor.rgb * vec3(texture(uTexture[uMaterial.specularTexIndex], vTexCoord));
+    vec3 diffuse = light.color.rgb * diff * material.albedoColor.rgb * vec3(texture(uTexture[material.albedoTexIndex], vTexCoord));
+    vec3 specular = light.color.rgb * spec * material.specularColor.rgb * vec3(texture(uTexture[material.specularTexIndex], vTexCoord));
     diffuse *= attenuation;
     specular *= attenuation;
     return (diffuse + specular);
@@ -127,50 +178,82 @@ vec3 CalcPointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
 
 vec3 CalcSpotLight(SpotLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
 {
-    vec3 lightDir = normalize(light.position - fragPos);
+    vec3 lightDir = normalize(light.position.xyz - fragPos);
     // diffuse shading
     float diff = max(dot(normal, lightDir), 0.0);
     // specular shading
     vec3 reflectDir = reflect(-lightDir, normal);
-    float shininess = mix(128.0, 2.0, uMaterial.roughness);
+    float shininess = mix(128.0, 2.0, material.roughness);
     float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);
     // attenuation
-    float distance = length(light.position - fragPos);
-    float attenuation = 1.0 / (light.constant + light.linear * distance + light.quadratic * (distance * distance));
+    float distance = length(light.position.xyz - fragPos);
+    float attenuation = 1.0 / (light.attenuation.x + light.attenuation.y * distance + light.attenuation.z * (distance * distance));
     // spotlight intensity
-    float theta = dot(lightDir, normalize(-light.direction));
-    float epsilon = light.cutOff - light.outerCutoff;
-    float intensity = clamp((theta - light.outerCutoff) / epsilon, 0.0, 1.0);
+    float theta = dot(lightDir, normalize(-light.direction.xyz));
+    float epsilon = light.direction.w - light.attenuation.w;
+    float intensity = clamp((theta - light.attenuation.w) / epsilon, 0.0, 1.0);
     // combine results
-    vec3 diffuse = light.color.rgb * diff * uMaterial.albedoColor.rgb * vec3(texture(uTexture[uMaterial.albedoTexIndex], vTexCoord));
-    vec3 specular = light.color.rgb * spec * uMaterial.specularColor.rgb * vec3(texture(uTexture[uMaterial.specularTexIndex], vTexCoord));
+    vec3 diffuse = light.color.rgb * diff * material.albedoColor.rgb * vec3(texture(uTexture[material.albedoTexIndex], vTexCoord));
+    vec3 specular = light.color.rgb * spec * material.specularColor.rgb * vec3(texture(uTexture[material.specularTexIndex], vTexCoord));
     diffuse *= attenuation * intensity;
     specular *= attenuation * intensity;
     return (diffuse + specular);
 }
 
+// Index of the cluster containing the fragment, or -1 outside of the grid
+int GetClusterIndex()
+{
+    float depth = -(uView * vec4(vFragPos, 1.0)).z;
+    if (depth <= 0.0)
+        return -1;
+    int slice = clamp(int(floor(log(depth) * uClusterDepth.x + uClusterDepth.y)), 0, CLUSTER_SLICES - 1);
+    vec2 ndc = clamp(vClipPos.xy / vClipPos.w * 0.5 + 0.5, 0.0, 0.9999);
+    ivec2 tile = ivec2(ndc * vec2(CLUSTER_TILES_X, CLUSTER_TILES_Y));
+    return (slice * CLUSTER_TILES_Y + tile.y) * CLUSTER_TILES_X + tile.x;
+}
+
 void main()
 {
+    material = uMaterial;
+    int entityId = uEntityId;
+    if (vBatched != 0)
+    {
+        material.albedoColor = vAlbedoColor;
+        material.albedoTexIndex = uBatchAlbedoTex;
+        material.specularColor = vSpecularColor;
+        material.specularTexIndex = uBatchSpecularTex;
+        material.roughness = vRoughness;
+        entityId = vEntityId;
+    }
+
     vec3 norm = normalize(vNormal);
     vec3 viewDir = normalize(uCamPos - vFragPos);
     vec3 result = vec3(0.0);
-    if (texture(uTexture[uMaterial.albedoTexIndex], vTexCoord).a < 0.1)
+    if (texture(uTexture[material.albedoTexIndex], vTexCoord).a < 0.1)
         discard;
-    vec3 ambient = uAmbientLight * uMaterial.albedoColor.rgb * vec3(texture(uTexture[uMaterial.albedoTexIndex], vTexCoord));
+    vec3 ambient = uAmbientLight * material.albedoColor.rgb * vec3(texture(uTexture[material.albedoTexIndex], vTexCoord));
     result += ambient;
 
     result += CalcDirLight(uDirLight, norm, viewDir);
 
-    for (int i = 0; i < uNumPointLights; i++)
+    // Only the lights reaching the cluster of the fragment are shaded
+    int clusterIndex = GetClusterIndex();
+    if (clusterIndex >= 0)
     {
-        result += CalcPointLight(uPointLights[i], norm, vFragPos, viewDir);
-    }
+        uvec4 cluster = uClusters[clusterIndex];
+        uint pointEnd = cluster.x + cluster.y;
+        for (uint i = cluster.x; i < pointEnd; i++)
+        {
+            result += CalcPointLight(uPointLights[uLightIndices[i]], norm, vFragPos, viewDir);
+        }
 
-    for (int i = 0; i < uNumSpotLights; i++)
-    {
-        result += CalcSpotLight(uSpotLights[i], norm, vFragPos, viewDir);
+        uint spotEnd = pointEnd + cluster.z;
+        for (uint i = pointEnd; i < spotEnd; i++)
+        {
+            result += CalcSpotLight(uSpotLights[uLightIndices[i]], norm, vFragPos, viewDir);
+        }
     }
 
     FragColor = vec4(result, 1.0);
-    EntityID = uEntityId;
+    EntityID = entityId;
 }
@@ -0,0 +1,302 @@
+//// ChangeTracker.test.cpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the component change tracking
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "ChangeTracker.hpp"
+#include "Coordinator.hpp"
+#include "QuerySystem.hpp"
+#include "GroupSystem.hpp"
+
+namespace nexo::ecs {
+
+    struct TrackedPosition {
+        float x = 0.0f;
+    };
+
+    struct TrackedVelocity {
+        float v = 0.0f;
+    };
+
+    // =========================================================
+    // ==================== CHANGE TRACKER =====================
+    // =========================================================
+
+    TEST(ChangeTrackerTest, DisabledTrackerRecordsNothing) {
+        ChangeTracker tracker;
+        tracker.onAdded(1);
+        tracker.onModified(1);
+        tracker.onRemoved(1);
+
+        std::vector<Entity> out;
+        tracker.collect(ChangeKind::ADDED, NULL_TICK, out);
+        EXPECT_TRUE(out.empty());
+        EXPECT_EQ(tracker.logSize(), 0);
+    }
+
+    TEST(ChangeTrackerTest, ModificationsAreLoggedOncePerTick) {
+        ChangeTracker tracker;
+        tracker.setEnabled(true);
+        tracker.setCurrentTick(5);
+        tracker.onModified(3);
+        tracker.onModified(3);
+        tracker.onModified(3);
+        EXPECT_EQ(tracker.logSize(), 1);
+
+        tracker.setCurrentTick(6);
+        tracker.onModified(3);
+        EXPECT_EQ(tracker.logSize(), 2);
+    }
+
+    TEST(ChangeTrackerTest, CollectReportsEachEntityOnce) {
+        ChangeTracker tracker;
+        tracker.setEnabled(true);
+        tracker.setCurrentTick(1);
+        tracker.onAdded(7);
+        tracker.setCurrentTick(2);
+        tracker.onModified(7);
+        tracker.setCurrentTick(3);
+        tracker.onModified(7);
+
+        std::vector<Entity> out;
+        tracker.collect(ChangeKind::MODIFIED, 1, out);
+        ASSERT_EQ(out.size(), 1);
+        EXPECT_EQ(out[0], 7);
+
+        out.clear();
+        tracker.collect(ChangeKind::MODIFIED, 4, out);
+        EXPECT_TRUE(out.empty());
+    }
+
+    TEST(ChangeTrackerTest, RemovedThenReaddedIsNotReportedAsRemoved) {
+        ChangeTracker tracker;
+        tracker.setEnabled(true);
+        tracker.setCurrentTick(1);
+        tracker.onAdded(2);
+        tracker.setCurrentTick(2);
+        tracker.onRemoved(2);
+        tracker.onAdded(2);
+
+        std::vector<Entity> removed;
+        tracker.collect(ChangeKind::REMOVED, 1, removed);
+        EXPECT_TRUE(removed.empty());
+
+        std::vector<Entity> added;
+        tracker.collect(ChangeKind::ADDED, 2, added);
+        ASSERT_EQ(added.size(), 1);
+        EXPECT_EQ(added[0], 2);
+    }
+
+    TEST(ChangeTrackerTest, TrimDropsOldRecordsButKeepsEntityTicks) {
+        ChangeTracker tracker;
+        tracker.setEnabled(true);
+        tracker.setCurrentTick(1);
+        tracker.onAdded(0);
+        tracker.setCurrentTick(10);
+        tracker.onAdded(1);
+
+        tracker.trim(5);
+        std::vector<Entity> out;
+        tracker.collect(ChangeKind::ADDED, NULL_TICK, out);
+        ASSERT_EQ(out.size(), 1);
+        EXPECT_EQ(out[0], 1);
+        EXPECT_TRUE(tracker.changedSince(0, ChangeKind::ADDED, 1));
+    }
+
+    // =========================================================
+    // =============== COORDINATOR INTEGRATION =================
+    // =========================================================
+
+    class ChangeTrackingTest : public ::testing::Test {
+    protected:
+        std::shared_ptr<Coordinator> coordinator;
+
+        void SetUp() override {
+            coordinator = std::make_shared<Coordinator>();
+            coordinator->init();
+            System::coord = coordinator;
+
+            coordinator->registerComponent<TrackedPosition>();
+            coordinator->registerComponent<TrackedVelocity>();
+            coordinator->enableChangeTracking<TrackedPosition>();
+        }
+
+        void TearDown() override {
+            System::coord = nullptr;
+        }
+    };
+
+    class TrackedQuerySystem final : public QuerySystem<Write<TrackedPosition>, Read<TrackedVelocity>> {};
+
+    class TrackedGroupSystem final : public GroupSystem<Owned<Write<TrackedPosition>>, NonOwned<Read<TrackedVelocity>>> {};
+
+    TEST_F(ChangeTrackingTest, AddedAndRemovedSinceTick) {
+        const Entity first = coordinator->createEntity();
+        const Entity second = coordinator->createEntity();
+        coordinator->addComponent(first, TrackedPosition{});
+
+        const Tick tick = coordinator->advanceTick();
+        coordinator->addComponent(second, TrackedPosition{});
+        coordinator->removeComponent<TrackedPosition>(first);
+
+        const auto added = coordinator->getAddedSince<TrackedPosition>(tick);
+        ASSERT_EQ(added.size(), 1);
+        EXPECT_EQ(added[0], second);
+
+        const auto removed = coordinator->getRemovedSince<TrackedPosition>(tick);
+        ASSERT_EQ(removed.size(), 1);
+        EXPECT_EQ(removed[0], first);
+    }
+
+    TEST_F(ChangeTrackingTest, DestroyedEntityIsReportedAsRemoved) {
+        const Entity entity = coordinator->createEntity();
+        coordinator->addComponent(entity, TrackedPosition{});
+        const Tick tick = coordinator->advanceTick();
+        coordinator->destroyEntity(entity);
+
+        const auto removed = coordinator->getRemovedSince<TrackedPosition>(tick);
+        ASSERT_EQ(removed.size(), 1);
+        EXPECT_EQ(removed[0], entity);
+        EXPECT_TRUE(coordinator->getModifiedSince<TrackedPosition>(FIRST_TICK).empty());
+    }
+
+    TEST_F(ChangeTrackingTest, QuerySystemWriteAccessMarksModified) {
+        const Entity moved = coordinator->createEntity();
+        const Entity idle = coordinator->createEntity();
+        coordinator->addComponent(moved, TrackedPosition{});
+        coordinator->addComponent(moved, TrackedVelocity{});
+        coordinator->addComponent(idle, TrackedPosition{});
+        coordinator->addComponent(idle, TrackedVelocity{});
+        auto system = coordinator->registerQuerySystem<TrackedQuerySystem>();
+
+        const Tick tick = coordinator->advanceTick();
+        system->getComponent<TrackedPosition>(moved).x = 4.0f;
+        [[maybe_unused]] const auto &velocity = system->getComponent<TrackedVelocity>(idle);
+
+        const auto modified = coordinator->getModifiedSince<TrackedPosition>(tick);
+        ASSERT_EQ(modified.size(), 1);
+        EXPECT_EQ(modified[0], moved);
+    }
+
+    TEST_F(ChangeTrackingTest, GroupSystemWriteAccessMarksModified) {
+        std::vector<Entity> entities;
+        for (int i = 0; i < 4; ++i) {
+            const Entity entity = coordinator->createEntity();
+            coordinator->addComponent(entity, TrackedPosition{});
+            coordinator->addComponent(entity, TrackedVelocity{});
+            entities.push_back(entity);
+        }
+        auto system = std::make_shared<TrackedGroupSystem>();
+
+        const Tick tick = coordinator->advanceTick();
+        auto positions = system->get<TrackedPosition>();
+        positions[2].x = 1.0f;
+
+        const auto modified = coordinator->getModifiedSince<TrackedPosition>(tick);
+        ASSERT_EQ(modified.size(), 1);
+        EXPECT_EQ(modified[0], system->getEntities()[2]);
+    }
+
+    TEST_F(ChangeTrackingTest, GroupSystemRangeForWritesMarkModified) {
+        for (int i = 0; i < 3; ++i) {
+            const Entity entity = coordinator->createEntity();
+            coordinator->addComponent(entity, TrackedPosition{});
+            coordinator->addComponent(entity, TrackedVelocity{});
+        }
+        auto system = std::make_shared<TrackedGroupSystem>();
+        auto positions = system->get<TrackedPosition>();
+        static_assert(std::random_access_iterator<decltype(positions.begin())>);
+
+        const Tick tick = coordinator->advanceTick();
+        for (auto &position : positions)
+            position.x = 1.0f;
+
+        auto modified = coordinator->getModifiedSince<TrackedPosition>(tick);
+        std::vector<Entity> expected(system->getEntities().begin(), system->getEntities().end());
+        std::ranges::sort(modified);
+        std::ranges::sort(expected);
+        EXPECT_EQ(modified, expected);
+    }
+
+    class NonOwnedWriteGroupSystem final : public GroupSystem<Owned<Read<TrackedVelocity>>, NonOwned<Write<TrackedPosition>>> {};
+
+    TEST_F(ChangeTrackingTest, NonOwnedGroupWriteAccessMarksModified) {
+        const Entity moved = coordinator->createEntity();
+        const Entity idle = coordinator->createEntity();
+        for (const Entity entity : {moved, idle}) {
+            coordinator->addComponent(entity, TrackedPosition{});
+            coordinator->addComponent(entity, TrackedVelocity{});
+        }
+        auto system = std::make_shared<NonOwnedWriteGroupSystem>();
+
+        const Tick tick = coordinator->advanceTick();
+        const auto positions = system->get<TrackedPosition>();
+        positions->get(moved).x = 2.0f;
+
+        const auto modified = coordinator->getModifiedSince<TrackedPosition>(tick);
+        ASSERT_EQ(modified.size(), 1);
+        EXPECT_EQ(modified[0], moved);
+    }
+
+    TEST_F(ChangeTrackingTest, ComponentsAddedBeforeTrackingAreTracked) {
+        const Entity moved = coordinator->createEntity();
+        const Entity idle = coordinator->createEntity();
+        coordinator->addComponent(moved, TrackedVelocity{});
+        coordinator->addComponent(idle, TrackedVelocity{});
+        const Tick enabledTick = coordinator->advanceTick();
+        coordinator->enableChangeTracking<TrackedVelocity>();
+
+        // The existing components are reported once, at the tick the tracking started
+        EXPECT_EQ(coordinator->getModifiedSince<TrackedVelocity>(enabledTick).size(), 2);
+        EXPECT_TRUE(coordinator->getAddedSince<TrackedVelocity>(enabledTick).empty());
+
+        const Tick tick = coordinator->advanceTick();
+        coordinator->getComponent<TrackedVelocity>(moved).v = 3.0f;
+        coordinator->markModified<TrackedVelocity>(moved);
+
+        const auto modified = coordinator->getModifiedSince<TrackedVelocity>(tick);
+        ASSERT_EQ(modified.size(), 1);
+        EXPECT_EQ(modified[0], moved);
+
+        coordinator->removeComponent<TrackedVelocity>(idle);
+        const auto removed = coordinator->getRemovedSince<TrackedVelocity>(tick);
+        ASSERT_EQ(removed.size(), 1);
+        EXPECT_EQ(removed[0], idle);
+    }
+
+    TEST_F(ChangeTrackingTest, UntrackedComponentReportsNothing) {
+        const Entity entity = coordinator->createEntity();
+        coordinator->addComponent(entity, TrackedVelocity{});
+        coordinator->markModified<TrackedVelocity>(entity);
+
+        EXPECT_TRUE(coordinator->getAddedSince<TrackedVelocity>(NULL_TICK).empty());
+        EXPECT_TRUE(coordinator->getModifiedSince<TrackedVelocity>(NULL_TICK).empty());
+    }
+
+    TEST_F(ChangeTrackingTest, HistoryOlderThanRetentionIsTrimmed) {
+        coordinator->setChangeRetention(2);
+        const Entity entity = coordinator->createEntity();
+        coordinator->addComponent(entity, TrackedPosition{});
+
+        for (int i = 0; i < 5; ++i)
+            coordinator->advanceTick();
+
+        EXPECT_TRUE(coordinator->getAddedSince<TrackedPosition>(NULL_TICK).empty());
+    }
+
+}
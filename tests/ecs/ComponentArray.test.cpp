@@ -389,4 +389,127 @@ namespace nexo::ecs {
         EXPECT_EQ(componentArray->get(2).value, 20);
         EXPECT_EQ(componentArray->get(4).value, 40);
     }
+
+    // =========================================================
+    // ============= TYPE-ERASED COMPONENT ARRAY ===============
+    // =========================================================
+
+    struct ScriptComponent {
+        float speed;
+        int id;
+        double weight;
+    };
+
+    TEST(TypeErasedComponentArrayTest, StorageIsAlignedAndGrowsGeometrically) {
+        TypeErasedComponentArray array(sizeof(ScriptComponent), 4);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(array.getRawData()) % COMPONENT_STORAGE_ALIGNMENT, 0);
+
+        size_t reallocations = 0;
+        size_t lastCapacity = array.capacity();
+        for (Entity e = 0; e < 1000; ++e) {
+            const ScriptComponent component{1.0f, static_cast<int>(e), 2.0};
+            array.insertRaw(e, &component);
+            if (array.capacity() != lastCapacity) {
+                ++reallocations;
+                lastCapacity = array.capacity();
+            }
+        }
+
+        EXPECT_LE(reallocations, 8);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(array.getRawData()) % COMPONENT_STORAGE_ALIGNMENT, 0);
+        EXPECT_EQ(static_cast<const ScriptComponent *>(array.getRawComponent(999))->id, 999);
+    }
+
+    TEST(TypeErasedComponentArrayTest, BatchInsertCopiesEveryComponent) {
+        TypeErasedComponentArray array(sizeof(ScriptComponent), 4);
+        std::vector<Entity> entities;
+        std::vector<ScriptComponent> components;
+        for (Entity e = 0; e < 100; ++e) {
+            entities.push_back(e * 2);
+            components.push_back({static_cast<float>(e), static_cast<int>(e), 0.5});
+        }
+
+        array.insertRawBatch(entities, components.data());
+
+        ASSERT_EQ(array.size(), 100);
+        EXPECT_EQ(static_cast<const ScriptComponent *>(array.getRawComponent(42))->id, 21);
+        EXPECT_FALSE(array.hasComponent(41));
+    }
+
+    TEST(TypeErasedComponentArrayTest, BatchInsertRejectsInvalidEntitiesAtomically) {
+        TypeErasedComponentArray array(sizeof(ScriptComponent));
+        const ScriptComponent component{};
+        array.insertRaw(5, &component);
+
+        const std::vector<Entity> entities = {1, 2, 5};
+        const std::vector<ScriptComponent> components(entities.size());
+        EXPECT_THROW(array.insertRawBatch(entities, components.data()), InternalError);
+        EXPECT_EQ(array.size(), 1);
+        EXPECT_FALSE(array.hasComponent(1));
+
+        const std::vector<Entity> duplicates = {3, 3};
+        EXPECT_THROW(array.insertRawBatch(duplicates, components.data()), InternalError);
+        EXPECT_FALSE(array.hasComponent(3));
+    }
+
+    TEST(TypeErasedComponentArrayTest, ColumnWalksOneField) {
+        TypeErasedComponentArray array(sizeof(ScriptComponent));
+        for (Entity e = 0; e < 10; ++e) {
+            const ScriptComponent component{static_cast<float>(e), static_cast<int>(e), 0.0};
+            array.insertRaw(e, &component);
+        }
+        array.remove(3);
+
+        auto ids = array.column<int>(offsetof(ScriptComponent, id));
+        ASSERT_EQ(ids.size(), 9);
+        EXPECT_EQ(ids.stride(), sizeof(ScriptComponent));
+        for (size_t i = 0; i < ids.size(); ++i)
+            EXPECT_EQ(static_cast<Entity>(ids[i]), array.entities()[i]);
+
+        for (float &speed : array.column<float>(offsetof(ScriptComponent, speed)))
+            speed *= 2.0f;
+        EXPECT_EQ(static_cast<const ScriptComponent *>(array.getRawComponent(7))->speed, 14.0f);
+
+        EXPECT_THROW(static_cast<void>(array.column<double>(sizeof(ScriptComponent) - 4)), OutOfRange);
+    }
+
+    TEST(TypeErasedComponentArrayTest, ArenaReusesReleasedBlocks) {
+        const auto arena = std::make_shared<ComponentArena>();
+        {
+            TypeErasedComponentArray array(sizeof(ScriptComponent), 16, arena);
+            for (Entity e = 0; e < 64; ++e) {
+                const ScriptComponent component{};
+                array.insertRaw(e, &component);
+            }
+            EXPECT_GT(arena->pooledBytes(), 0);
+        }
+        const size_t reserved = arena->reservedBytes();
+        EXPECT_EQ(arena->pooledBytes(), reserved);
+
+        TypeErasedComponentArray other(sizeof(ScriptComponent), 64, arena);
+        EXPECT_EQ(arena->reservedBytes(), reserved);
+        EXPECT_LT(arena->pooledBytes(), reserved);
+
+        arena->trim();
+        EXPECT_EQ(arena->pooledBytes(), 0);
+        EXPECT_GE(arena->reservedBytes(), other.capacity() * sizeof(ScriptComponent));
+    }
+
+    TEST(TypeErasedComponentArrayTest, RemoveAndGroupKeepDataConsistent) {
+        TypeErasedComponentArray array(sizeof(ScriptComponent), 2, std::make_shared<ComponentArena>());
+        for (Entity e = 0; e < 200; ++e) {
+            const ScriptComponent component{0.0f, static_cast<int>(e), 0.0};
+            array.insertRaw(e, &component);
+        }
+        array.addToGroup(150);
+        for (Entity e = 0; e < 190; ++e) {
+            if (e != 150)
+                array.remove(e);
+        }
+
+        ASSERT_EQ(array.size(), 11);
+        EXPECT_EQ(array.getEntityAtIndex(0), 150);
+        for (const Entity e : array.entities())
+            EXPECT_EQ(static_cast<const ScriptComponent *>(array.getRawComponent(e))->id, static_cast<int>(e));
+    }
 }
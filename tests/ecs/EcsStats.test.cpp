@@ -0,0 +1,208 @@
+//// EcsStats.test.cpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the ECS statistics
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "Coordinator.hpp"
+#include "EcsStats.hpp"
+
+#include <algorithm>
+#include <memory>
+
+namespace nexo::ecs {
+
+    // Same layout as the GroupSystem test components so no extra type id is consumed
+    struct Position {
+        float x, y, z;
+
+        Position(float x = 0.0f, float y = 0.0f, float z = 0.0f)
+            : x(x), y(y), z(z) {}
+
+        bool operator==(const Position& other) const {
+            return x == other.x && y == other.y && z == other.z;
+        }
+    };
+
+    struct Velocity {
+        float vx, vy, vz;
+
+        Velocity(float vx = 0.0f, float vy = 0.0f, float vz = 0.0f)
+            : vx(vx), vy(vy), vz(vz) {}
+
+        bool operator==(const Velocity& other) const {
+            return vx == other.vx && vy == other.vy && vz == other.vz;
+        }
+    };
+
+    class EcsStatsTest : public ::testing::Test {
+    protected:
+        std::shared_ptr<Coordinator> coordinator;
+        std::vector<Entity> entities;
+
+        void SetUp() override
+        {
+            coordinator = std::make_shared<Coordinator>();
+            coordinator->init();
+            coordinator->registerComponent<Position>();
+            coordinator->registerComponent<Velocity>();
+
+            for (int i = 0; i < 10; ++i) {
+                Entity entity = coordinator->createEntity();
+                entities.push_back(entity);
+                coordinator->addComponent(entity, Position(static_cast<float>(i), 0.0f, 0.0f));
+                if (i % 2 == 0)
+                    coordinator->addComponent(entity, Velocity(1.0f, 0.0f, 0.0f));
+            }
+        }
+
+        static const ComponentTypeStats *find(const EcsStats &stats, const ComponentType type)
+        {
+            const auto it = std::ranges::find(stats.components, type, &ComponentTypeStats::type);
+            return it == stats.components.end() ? nullptr : &*it;
+        }
+    };
+
+    TEST_F(EcsStatsTest, ReportsLiveCountsAndMemory)
+    {
+        const EcsStats stats = coordinator->collectStats();
+        EXPECT_EQ(stats.livingEntities, entities.size());
+
+        const auto *position = find(stats, coordinator->getComponentType<Position>());
+        const auto *velocity = find(stats, coordinator->getComponentType<Velocity>());
+        ASSERT_NE(position, nullptr);
+        ASSERT_NE(velocity, nullptr);
+
+        EXPECT_EQ(position->name, "Position");
+        EXPECT_EQ(position->array.componentSize, sizeof(Position));
+        EXPECT_EQ(position->array.count, 10u);
+        EXPECT_EQ(velocity->array.count, 5u);
+        EXPECT_GE(position->array.dataBytes, 10 * sizeof(Position));
+        EXPECT_GE(position->array.capacity, position->array.count);
+        EXPECT_GT(position->array.sparseBytes, 0u);
+
+        size_t total = 0;
+        for (const auto &component : stats.components)
+            total += component.array.totalBytes();
+        EXPECT_EQ(stats.totalBytes(), total);
+    }
+
+    TEST_F(EcsStatsTest, CountsInsertsAndRemoves)
+    {
+        if constexpr (!ECS_STATS_ENABLED)
+            GTEST_SKIP() << "ECS statistics counters are compiled out";
+
+        coordinator->removeComponent<Position>(entities[0]);
+        coordinator->removeComponent<Position>(entities[1]);
+
+        const EcsStats stats = coordinator->collectStats();
+        const auto *position = find(stats, coordinator->getComponentType<Position>());
+        ASSERT_NE(position, nullptr);
+        EXPECT_EQ(position->array.counters.inserts, 10u);
+        EXPECT_EQ(position->array.counters.removes, 2u);
+        EXPECT_EQ(position->array.count, 8u);
+    }
+
+    TEST_F(EcsStatsTest, CountsGroupMovesAndSwaps)
+    {
+        if constexpr (!ECS_STATS_ENABLED)
+            GTEST_SKIP() << "ECS statistics counters are compiled out";
+
+        const auto group = coordinator->registerGroup<Position>(get<Velocity>());
+        EXPECT_EQ(group->size(), 5u);
+
+        EcsStats stats = coordinator->collectStats();
+        const auto *position = find(stats, coordinator->getComponentType<Position>());
+        ASSERT_NE(position, nullptr);
+        EXPECT_EQ(position->array.groupSize, 5u);
+        EXPECT_EQ(position->array.counters.groupMoves, 5u);
+        EXPECT_GT(position->array.counters.groupSwaps, 0u);
+
+        ASSERT_EQ(stats.groups.size(), 1u);
+        EXPECT_EQ(stats.groups[0].name, "Owned<Position>, NonOwned<Velocity>");
+        EXPECT_EQ(stats.groups[0].size, 5u);
+
+        // Entities joining or leaving after the group exists go through the group counters
+        coordinator->addComponent(entities[1], Velocity());
+        coordinator->removeComponent<Velocity>(entities[0]);
+        stats = coordinator->collectStats();
+        EXPECT_EQ(stats.groups[0].size, 5u);
+        EXPECT_EQ(stats.groups[0].counters.entitiesAdded, 1u);
+        EXPECT_EQ(stats.groups[0].counters.entitiesRemoved, 1u);
+        EXPECT_EQ(find(stats, coordinator->getComponentType<Position>())->array.counters.groupMoves, 7u);
+    }
+
+    TEST_F(EcsStatsTest, CountsPartitionRebuilds)
+    {
+        if constexpr (!ECS_STATS_ENABLED)
+            GTEST_SKIP() << "ECS statistics counters are compiled out";
+
+        const auto group = coordinator->registerGroup<Position>(get<Velocity>());
+        const auto bucket = [](const Position &p) { return static_cast<int>(p.x) % 3; };
+
+        (void)group->getPartitionView<Position, int>(bucket);
+        (void)group->getPartitionView<Position, int>(bucket);
+        EcsStats stats = coordinator->collectStats();
+        ASSERT_EQ(stats.groups.size(), 1u);
+        EXPECT_EQ(stats.groups[0].partitionViews, 1u);
+        EXPECT_EQ(stats.groups[0].counters.partitionRebuilds, 1u);
+
+        group->invalidatePartitions();
+        (void)group->getPartitionView<Position, int>(bucket);
+        stats = coordinator->collectStats();
+        EXPECT_EQ(stats.groups[0].counters.partitionRebuilds, 2u);
+        EXPECT_GE(stats.groups[0].counters.partitionRebuildMs, stats.groups[0].counters.lastPartitionRebuildMs);
+    }
+
+    TEST_F(EcsStatsTest, ResetClearsCountersButNotMemory)
+    {
+        const auto group = coordinator->registerGroup<Position>(get<Velocity>());
+        coordinator->removeComponent<Position>(entities[1]);
+        coordinator->resetStatCounters();
+
+        const EcsStats stats = coordinator->collectStats();
+        const auto *position = find(stats, coordinator->getComponentType<Position>());
+        ASSERT_NE(position, nullptr);
+        EXPECT_EQ(position->array.counters.inserts, 0u);
+        EXPECT_EQ(position->array.counters.removes, 0u);
+        EXPECT_EQ(position->array.counters.groupMoves, 0u);
+        EXPECT_EQ(position->array.counters.groupSwaps, 0u);
+        EXPECT_EQ(position->array.count, 9u);
+        ASSERT_EQ(stats.groups.size(), 1u);
+        EXPECT_EQ(stats.groups[0].counters.entitiesAdded, 0u);
+        EXPECT_EQ(stats.groups[0].size, group->size());
+    }
+
+    TEST_F(EcsStatsTest, JsonDumpListsComponentsAndGroups)
+    {
+        (void)coordinator->registerGroup<Position>(get<Velocity>());
+        const std::string json = coordinator->collectStats().toJson();
+
+        EXPECT_EQ(json.front(), '{');
+        EXPECT_NE(json.find("\"livingEntities\": 10"), std::string::npos);
+        EXPECT_NE(json.find("\"name\": \"Position\""), std::string::npos);
+        EXPECT_NE(json.find("\"name\": \"Velocity\""), std::string::npos);
+        EXPECT_NE(json.find("\"name\": \"Owned<Position>, NonOwned<Velocity>\""), std::string::npos);
+        EXPECT_NE(json.find("\"partitionRebuilds\""), std::string::npos);
+    }
+
+    TEST(EcsStatsNames, ReadableTypeNameStripsNamespaces)
+    {
+        EXPECT_EQ(readableTypeName(typeid(Position).name()), "Position");
+        EXPECT_EQ(readableTypeName(typeid(int).name()), "int");
+    }
+
+}
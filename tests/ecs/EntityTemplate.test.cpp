@@ -0,0 +1,194 @@
+//// EntityTemplate.test.cpp //////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for entity templates and bulk instantiation
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <string>
+#include "EntityTemplate.hpp"
+#include "Coordinator.hpp"
+#include "QuerySystem.hpp"
+#include "GroupSystem.hpp"
+
+namespace nexo::ecs {
+
+    // Same definitions as in the system tests, component type IDs are shared by the whole test binary
+    struct Position {
+        float x, y, z;
+
+        Position(float x = 0.0f, float y = 0.0f, float z = 0.0f)
+            : x(x), y(y), z(z) {}
+
+        bool operator==(const Position& other) const {
+            return x == other.x && y == other.y && z == other.z;
+        }
+    };
+
+    struct Tag {
+        std::string name;
+        int category;
+
+        Tag(const std::string& name = "", int category = 0)
+            : name(name), category(category) {}
+
+        bool operator==(const Tag& other) const {
+            return name == other.name && category == other.category;
+        }
+    };
+
+    struct PrefabLink {
+        Entity parent = INVALID_ENTITY;
+    };
+
+    class TemplateQuerySystem final : public QuerySystem<Read<Position>, Read<PrefabLink>> {};
+
+    class TemplateGroupSystem final : public GroupSystem<Owned<Read<Position>>, NonOwned<Read<Tag>>> {};
+
+    class EntityTemplateTest : public ::testing::Test {
+    protected:
+        std::shared_ptr<Coordinator> coordinator;
+        Entity root = INVALID_ENTITY;
+        Entity child = INVALID_ENTITY;
+        Entity leaf = INVALID_ENTITY;
+
+        void SetUp() override {
+            coordinator = std::make_shared<Coordinator>();
+            coordinator->init();
+            System::coord = coordinator;
+
+            coordinator->registerComponent<Position>();
+            coordinator->registerComponent<Tag>();
+            coordinator->registerComponent<PrefabLink>();
+            coordinator->setInstantiateHook<PrefabLink>([](PrefabLink &link, const EntityRemap &remap) {
+                link.parent = remap(link.parent);
+            });
+
+            // root <- child <- leaf
+            root = coordinator->createEntity();
+            coordinator->addComponent(root, Position(1.0f, 2.0f, 3.0f));
+            coordinator->addComponent(root, Tag("root", 1));
+            child = coordinator->createEntity();
+            coordinator->addComponent(child, Position(4.0f));
+            coordinator->addComponent(child, PrefabLink{root});
+            leaf = coordinator->createEntity();
+            coordinator->addComponent(leaf, Tag("leaf", 3));
+            coordinator->addComponent(leaf, PrefabLink{child});
+        }
+
+        void TearDown() override {
+            System::coord = nullptr;
+        }
+
+        [[nodiscard]] EntityTemplate makeTemplate(const Signature excluded = {}) const
+        {
+            const std::vector hierarchy = {root, child, leaf};
+            return coordinator->createTemplate(hierarchy, excluded);
+        }
+    };
+
+    TEST_F(EntityTemplateTest, InstancesCopyEveryComponent) {
+        const EntityTemplate entityTemplate = makeTemplate();
+        const auto entities = coordinator->instantiateTemplate(entityTemplate, 4);
+
+        ASSERT_EQ(entities.size(), 12);
+        for (size_t copy = 0; copy < 4; ++copy) {
+            const Entity instanceRoot = entities[copy * 3];
+            const Entity instanceLeaf = entities[copy * 3 + 2];
+            EXPECT_EQ(coordinator->getComponent<Position>(instanceRoot), Position(1.0f, 2.0f, 3.0f));
+            EXPECT_EQ(coordinator->getComponent<Tag>(instanceLeaf), Tag("leaf", 3));
+            EXPECT_EQ(coordinator->getSignature(instanceLeaf), coordinator->getSignature(leaf));
+            EXPECT_FALSE(coordinator->entityHasComponent<Position>(instanceLeaf));
+        }
+    }
+
+    TEST_F(EntityTemplateTest, HookRemapsReferencesInsideTheTemplate) {
+        const Entity outside = coordinator->createEntity();
+        coordinator->addComponent(root, PrefabLink{outside});
+        const auto entities = coordinator->instantiateTemplate(makeTemplate(), 2);
+
+        for (size_t copy = 0; copy < 2; ++copy) {
+            const Entity *instance = &entities[copy * 3];
+            EXPECT_EQ(coordinator->getComponent<PrefabLink>(instance[0]).parent, outside);
+            EXPECT_EQ(coordinator->getComponent<PrefabLink>(instance[1]).parent, instance[0]);
+            EXPECT_EQ(coordinator->getComponent<PrefabLink>(instance[2]).parent, instance[1]);
+        }
+    }
+
+    TEST_F(EntityTemplateTest, InstancesDoNotShareComponents) {
+        const auto entities = coordinator->instantiateTemplate(makeTemplate(), 2);
+
+        coordinator->getComponent<Tag>(entities[0]).name = "renamed";
+        EXPECT_EQ(coordinator->getComponent<Tag>(entities[3]).name, "root");
+        EXPECT_EQ(coordinator->getComponent<Tag>(root).name, "root");
+    }
+
+    TEST_F(EntityTemplateTest, ExcludedComponentsAreLeftOut) {
+        Signature excluded;
+        excluded.set(coordinator->getComponentType<Tag>());
+        const auto entities = coordinator->instantiateTemplate(makeTemplate(excluded));
+
+        EXPECT_FALSE(coordinator->entityHasComponent<Tag>(entities[0]));
+        EXPECT_TRUE(coordinator->entityHasComponent<Position>(entities[0]));
+        EXPECT_EQ(coordinator->getSignature(entities[2]).count(), 1);
+    }
+
+    TEST_F(EntityTemplateTest, TemplateComponentIsGivenToEveryEntity) {
+        EntityTemplate entityTemplate = makeTemplate();
+        coordinator->setTemplateComponent(entityTemplate, Tag("stamped", 7));
+        coordinator->setTemplateComponent(entityTemplate, PrefabLink{});
+        const auto entities = coordinator->instantiateTemplate(entityTemplate, 2);
+
+        for (const Entity entity : entities) {
+            EXPECT_EQ(coordinator->getComponent<Tag>(entity), Tag("stamped", 7));
+            EXPECT_EQ(coordinator->getComponent<PrefabLink>(entity).parent, INVALID_ENTITY);
+        }
+        EXPECT_TRUE(coordinator->entityHasComponent<Position>(entities[3]));
+        EXPECT_EQ(coordinator->getSignature(entities[5]).count(), 2);
+    }
+
+    TEST_F(EntityTemplateTest, SystemsAndGroupsReceiveTheInstances) {
+        auto query = coordinator->registerQuerySystem<TemplateQuerySystem>();
+        auto group = coordinator->registerGroupSystem<TemplateGroupSystem>();
+        ASSERT_EQ(query->entities.size(), 1);
+        ASSERT_EQ(group->getEntities().size(), 1);
+
+        const auto entities = coordinator->instantiateTemplate(makeTemplate(), 3);
+
+        EXPECT_EQ(query->entities.size(), 4);
+        EXPECT_TRUE(query->entities.contains(entities[4]));
+        EXPECT_EQ(group->getEntities().size(), 4);
+        const auto grouped = group->getEntities();
+        EXPECT_NE(std::ranges::find(grouped, entities[6]), grouped.end());
+    }
+
+    TEST_F(EntityTemplateTest, LargeInstantiation) {
+        std::vector<Entity> hierarchy = {root};
+        for (int i = 0; i < 199; ++i) {
+            const Entity node = coordinator->createEntity();
+            coordinator->addComponent(node, Position(static_cast<float>(i)));
+            coordinator->addComponent(node, PrefabLink{hierarchy.back()});
+            hierarchy.push_back(node);
+        }
+        const EntityTemplate entityTemplate = coordinator->createTemplate(hierarchy);
+        const auto entities = coordinator->instantiateTemplate(entityTemplate, 1000);
+
+        ASSERT_EQ(entities.size(), 200000);
+        const Entity *lastInstance = &entities[999 * 200];
+        EXPECT_EQ(coordinator->getComponent<PrefabLink>(lastInstance[199]).parent, lastInstance[198]);
+        EXPECT_EQ(coordinator->getComponent<Position>(lastInstance[50]), Position(49.0f));
+    }
+
+}
@@ -0,0 +1,239 @@
+//// WorldSnapshot.test.cpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the world snapshot and restore
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include "WorldSnapshot.hpp"
+#include "Coordinator.hpp"
+#include "QuerySystem.hpp"
+#include "GroupSystem.hpp"
+
+namespace nexo::ecs {
+
+    // Same definitions as in the system tests, component type IDs are shared by the whole test binary
+    struct Position {
+        float x, y, z;
+
+        Position(float x = 0.0f, float y = 0.0f, float z = 0.0f)
+            : x(x), y(y), z(z) {}
+
+        bool operator==(const Position& other) const {
+            return x == other.x && y == other.y && z == other.z;
+        }
+    };
+
+    struct Tag {
+        std::string name;
+        int category;
+
+        Tag(const std::string& name = "", int category = 0)
+            : name(name), category(category) {}
+
+        bool operator==(const Tag& other) const {
+            return name == other.name && category == other.category;
+        }
+    };
+
+    class SnapshotQuerySystem final : public QuerySystem<Read<Position>> {};
+
+    class SnapshotGroupSystem final : public GroupSystem<Owned<Read<Position>>, NonOwned<Read<Tag>>> {};
+
+    static ComponentSerializer<Tag> makeTagSerializer()
+    {
+        ComponentSerializer<Tag> serializer;
+        serializer.serialize = [](const Tag &tag, std::vector<std::byte> &stream) {
+            const auto length = static_cast<std::uint32_t>(tag.name.size());
+            const size_t offset = stream.size();
+            stream.resize(offset + sizeof(length) + length + sizeof(int));
+            std::memcpy(stream.data() + offset, &length, sizeof(length));
+            std::memcpy(stream.data() + offset + sizeof(length), tag.name.data(), length);
+            std::memcpy(stream.data() + offset + sizeof(length) + length, &tag.category, sizeof(int));
+        };
+        serializer.deserialize = [](const std::span<const std::byte> stream, size_t &offset) {
+            std::uint32_t length = 0;
+            std::memcpy(&length, stream.data() + offset, sizeof(length));
+            offset += sizeof(length);
+            Tag tag(std::string(reinterpret_cast<const char *>(stream.data() + offset), length));
+            offset += length;
+            std::memcpy(&tag.category, stream.data() + offset, sizeof(int));
+            offset += sizeof(int);
+            return tag;
+        };
+        return serializer;
+    }
+
+    class WorldSnapshotTest : public ::testing::Test {
+    protected:
+        std::shared_ptr<Coordinator> coordinator;
+
+        void SetUp() override {
+            coordinator = std::make_shared<Coordinator>();
+            coordinator->init();
+            System::coord = coordinator;
+
+            coordinator->registerComponent<Position>();
+            coordinator->registerComponent<Tag>();
+        }
+
+        void TearDown() override {
+            System::coord = nullptr;
+        }
+
+        Entity createPositioned(const float x)
+        {
+            const Entity entity = coordinator->createEntity();
+            coordinator->addComponent(entity, Position(x, -x));
+            return entity;
+        }
+    };
+
+    TEST_F(WorldSnapshotTest, RestoreRevertsEntitiesAndComponents) {
+        const Entity kept = createPositioned(1.0f);
+        const Entity destroyed = createPositioned(2.0f);
+        const WorldSnapshot snapshot = coordinator->captureWorld();
+
+        coordinator->getComponent<Position>(kept).x = 10.0f;
+        coordinator->destroyEntity(destroyed);
+        const Entity created = createPositioned(3.0f);
+        const Entity extra = createPositioned(4.0f);
+        coordinator->addComponent(kept, Tag("player", 2));
+
+        coordinator->restoreWorld(snapshot);
+
+        EXPECT_EQ(created, destroyed);
+        EXPECT_EQ(coordinator->getAllEntitiesWith<Position>().size(), 2);
+        EXPECT_FLOAT_EQ(coordinator->getComponent<Position>(kept).x, 1.0f);
+        EXPECT_FLOAT_EQ(coordinator->getComponent<Position>(destroyed).y, -2.0f);
+        EXPECT_FALSE(coordinator->entityHasComponent<Position>(extra));
+        EXPECT_FALSE(coordinator->entityHasComponent<Tag>(kept));
+        EXPECT_EQ(coordinator->getSignature(extra).count(), 0);
+    }
+
+    TEST_F(WorldSnapshotTest, EntityIdsAreHandedOutInTheSameOrder) {
+        const Entity first = createPositioned(0.0f);
+        createPositioned(0.0f);
+        coordinator->destroyEntity(first);
+        const WorldSnapshot snapshot = coordinator->captureWorld();
+
+        const Entity recycled = coordinator->createEntity();
+        const Entity fresh = coordinator->createEntity();
+        coordinator->restoreWorld(snapshot);
+
+        EXPECT_EQ(coordinator->createEntity(), recycled);
+        EXPECT_EQ(coordinator->createEntity(), fresh);
+    }
+
+    TEST_F(WorldSnapshotTest, NonTrivialComponentsAreDeepCopied) {
+        const Entity entity = coordinator->createEntity();
+        coordinator->addComponent(entity, Tag("enemy", 3));
+        const WorldSnapshot snapshot = coordinator->captureWorld();
+
+        coordinator->getComponent<Tag>(entity).name = "ally";
+        coordinator->restoreWorld(snapshot);
+
+        EXPECT_EQ(coordinator->getComponent<Tag>(entity), Tag("enemy", 3));
+        EXPECT_FALSE(snapshot.isPersistable());
+        EXPECT_THROW(static_cast<void>(snapshot.toImage()), InvalidSnapshot);
+    }
+
+    TEST_F(WorldSnapshotTest, FileRoundTripWithSerializer) {
+        coordinator->setComponentSerializer(makeTagSerializer());
+        const Entity first = createPositioned(4.0f);
+        const Entity second = coordinator->createEntity();
+        coordinator->addComponent(second, Tag("door", 8));
+        const auto path = std::filesystem::temp_directory_path() / "nexo_world_snapshot_test.bin";
+        coordinator->captureWorld().saveToFile(path);
+
+        coordinator->destroyEntity(first);
+        coordinator->getComponent<Tag>(second).category = 0;
+        coordinator->restoreWorld(WorldSnapshot::loadFromFile(path));
+        std::filesystem::remove(path);
+
+        EXPECT_FLOAT_EQ(coordinator->getComponent<Position>(first).x, 4.0f);
+        EXPECT_EQ(coordinator->getComponent<Tag>(second), Tag("door", 8));
+    }
+
+    TEST_F(WorldSnapshotTest, ImageBlocksAreAligned) {
+        createPositioned(1.0f);
+        const WorldSnapshot snapshot = coordinator->captureWorld();
+        const auto image = snapshot.toImage();
+
+        EXPECT_EQ(image.size() % 64, 0);
+        const WorldSnapshot decoded = WorldSnapshot::fromImage(image);
+        ASSERT_EQ(decoded.componentArrays.size(), snapshot.componentArrays.size());
+        EXPECT_EQ(decoded.componentArrays[0].data, snapshot.componentArrays[0].data);
+        EXPECT_EQ(decoded.entities.livingEntities, snapshot.entities.livingEntities);
+    }
+
+    TEST_F(WorldSnapshotTest, InvalidImageThrows) {
+        std::vector<std::byte> image(256, std::byte{0x2a});
+        EXPECT_THROW(static_cast<void>(WorldSnapshot::fromImage(image)), InvalidSnapshot);
+
+        createPositioned(1.0f);
+        auto truncated = coordinator->captureWorld().toImage();
+        truncated.resize(truncated.size() / 2);
+        EXPECT_THROW(static_cast<void>(WorldSnapshot::fromImage(truncated)), InvalidSnapshot);
+    }
+
+    TEST_F(WorldSnapshotTest, QuerySystemsAreRepopulated) {
+        const Entity entity = createPositioned(1.0f);
+        auto system = coordinator->registerQuerySystem<SnapshotQuerySystem>();
+        const WorldSnapshot snapshot = coordinator->captureWorld();
+
+        createPositioned(2.0f);
+        coordinator->removeComponent<Position>(entity);
+        coordinator->restoreWorld(snapshot);
+
+        ASSERT_EQ(system->entities.size(), 1);
+        EXPECT_TRUE(system->entities.contains(entity));
+    }
+
+    TEST_F(WorldSnapshotTest, GroupsAreResynchronized) {
+        for (int i = 0; i < 3; ++i) {
+            const Entity entity = createPositioned(static_cast<float>(i));
+            coordinator->addComponent(entity, Tag());
+        }
+        const WorldSnapshot snapshot = coordinator->captureWorld();
+
+        // The group is created after the capture and must still see the restored entities
+        auto system = std::make_shared<SnapshotGroupSystem>();
+        const Entity extra = createPositioned(5.0f);
+        coordinator->addComponent(extra, Tag());
+        EXPECT_EQ(system->getEntities().size(), 4);
+
+        coordinator->restoreWorld(snapshot);
+        EXPECT_EQ(system->getEntities().size(), 3);
+    }
+
+    TEST_F(WorldSnapshotTest, RestoreIsRecordedByChangeTracking) {
+        coordinator->enableChangeTracking<Position>();
+        const WorldSnapshot snapshot = coordinator->captureWorld();
+        const Entity created = createPositioned(1.0f);
+        const Tick tick = coordinator->advanceTick();
+
+        coordinator->restoreWorld(snapshot);
+
+        const auto removed = coordinator->getRemovedSince<Position>(tick);
+        ASSERT_EQ(removed.size(), 1);
+        EXPECT_EQ(removed[0], created);
+    }
+
+}
@@ -0,0 +1,204 @@
+//// MeshOptimizer.test.cpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the mesh optimization functions
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include "assets/Assets/Model/MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+namespace nexo::assets {
+
+    class MeshOptimizerTest : public ::testing::Test {
+        protected:
+            std::vector<renderer::NxVertex> vertices;
+            std::vector<unsigned int> indices;
+
+            static renderer::NxVertex makeVertex(const glm::vec3 &position)
+            {
+                renderer::NxVertex vertex{};
+                vertex.position = position;
+                vertex.texCoord = {position.x, position.y};
+                return vertex;
+            }
+
+            void buildGrid(const unsigned int size)
+            {
+                for (unsigned int y = 0; y <= size; ++y) {
+                    for (unsigned int x = 0; x <= size; ++x)
+                        vertices.push_back(makeVertex({static_cast<float>(x), static_cast<float>(y), 0.0f}));
+                }
+                for (unsigned int y = 0; y < size; ++y) {
+                    for (unsigned int x = 0; x < size; ++x) {
+                        const unsigned int i = y * (size + 1) + x;
+                        indices.insert(indices.end(), {i, i + 1, i + size + 2, i, i + size + 2, i + size + 1});
+                    }
+                }
+            }
+
+            void addSphere(const float radius, const unsigned int rings, const unsigned int segments)
+            {
+                constexpr float pi = std::numbers::pi_v<float>;
+                const auto first = static_cast<unsigned int>(vertices.size());
+                for (unsigned int ring = 0; ring <= rings; ++ring) {
+                    const float phi = pi * static_cast<float>(ring) / static_cast<float>(rings);
+                    for (unsigned int segment = 0; segment <= segments; ++segment) {
+                        const float theta = 2.0f * pi * static_cast<float>(segment) / static_cast<float>(segments);
+                        vertices.push_back(makeVertex(radius * glm::vec3(std::sin(phi) * std::cos(theta), std::cos(phi),
+                                                                         std::sin(phi) * std::sin(theta))));
+                    }
+                }
+                for (unsigned int ring = 0; ring < rings; ++ring) {
+                    for (unsigned int segment = 0; segment < segments; ++segment) {
+                        const unsigned int a = first + ring * (segments + 1) + segment;
+                        const unsigned int b = a + segments + 1;
+                        indices.insert(indices.end(), {a, a + 1, b + 1, a, b + 1, b});
+                    }
+                }
+            }
+
+            void shuffleTriangles(const unsigned int seed = 7)
+            {
+                std::vector<std::array<unsigned int, 3>> triangles;
+                for (size_t i = 0; i < indices.size(); i += 3)
+                    triangles.push_back({indices[i], indices[i + 1], indices[i + 2]});
+                std::mt19937 rng(seed);
+                std::ranges::shuffle(triangles, rng);
+                indices.clear();
+                for (const auto &triangle : triangles)
+                    indices.insert(indices.end(), triangle.begin(), triangle.end());
+            }
+
+            // Triangles as sorted lists of corner positions, rotated to start at their smallest corner
+            [[nodiscard]] std::vector<std::array<float, 9>> triangleSet() const
+            {
+                std::vector<std::array<float, 9>> triangles;
+                for (size_t i = 0; i < indices.size(); i += 3) {
+                    std::array<glm::vec3, 3> corners = {
+                        vertices[indices[i]].position, vertices[indices[i + 1]].position, vertices[indices[i + 2]].position
+                    };
+                    auto less = [](const glm::vec3 &a, const glm::vec3 &b) {
+                        return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+                    };
+                    const auto smallest = std::ranges::min_element(corners, less) - corners.begin();
+                    std::ranges::rotate(corners, corners.begin() + smallest);
+                    triangles.push_back({corners[0].x, corners[0].y, corners[0].z, corners[1].x, corners[1].y,
+                                         corners[1].z, corners[2].x, corners[2].y, corners[2].z});
+                }
+                std::ranges::sort(triangles);
+                return triangles;
+            }
+    };
+
+    TEST_F(MeshOptimizerTest, AnalyzesFifoCache)
+    {
+        vertices.resize(4);
+        indices = {0, 1, 2, 2, 1, 3};
+        const VertexCacheStats stats = analyzeVertexCache(indices, vertices.size());
+        EXPECT_EQ(stats.transformedCount, 4u);
+        EXPECT_FLOAT_EQ(stats.acmr, 2.0f);
+        EXPECT_FLOAT_EQ(stats.atvr, 1.0f);
+
+        // In a cache of three, 3 evicts 0 even though 1 and 2 were used after it, then each reload evicts the next
+        indices = {0, 1, 2, 3, 1, 2, 0, 1, 2};
+        EXPECT_EQ(analyzeVertexCache(indices, vertices.size(), 3).transformedCount, 7u);
+    }
+
+    TEST_F(MeshOptimizerTest, WeldMergesIdenticalVertices)
+    {
+        buildGrid(8);
+        // Unindexed copy: every corner gets its own vertex
+        std::vector<renderer::NxVertex> unindexed;
+        for (const unsigned int index : indices)
+            unindexed.push_back(vertices[index]);
+        const auto expected = triangleSet();
+        const size_t gridVertexCount = vertices.size();
+        vertices = std::move(unindexed);
+        for (size_t i = 0; i < indices.size(); ++i)
+            indices[i] = static_cast<unsigned int>(i);
+
+        EXPECT_EQ(weldVertices(vertices, indices), gridVertexCount);
+        EXPECT_EQ(vertices.size(), gridVertexCount);
+        EXPECT_EQ(triangleSet(), expected);
+    }
+
+    TEST_F(MeshOptimizerTest, WeldKeepsVerticesWithDifferentAttributes)
+    {
+        vertices = {makeVertex(glm::vec3(0.0f)), makeVertex(glm::vec3(0.0f)), makeVertex(glm::vec3(1.0f))};
+        vertices[1].texCoord = {0.5f, 0.5f};
+        indices = {0, 1, 2, 2, 1, 0};
+        EXPECT_EQ(weldVertices(vertices, indices), 3u);
+        EXPECT_EQ(indices, (std::vector<unsigned int>{0, 1, 2, 2, 1, 0}));
+    }
+
+    TEST_F(MeshOptimizerTest, VertexCacheOptimizationLowersMissRatio)
+    {
+        buildGrid(64);
+        shuffleTriangles();
+        const auto expected = triangleSet();
+        const float shuffledAcmr = analyzeVertexCache(indices, vertices.size()).acmr;
+
+        optimizeVertexCache(indices, vertices.size());
+        const VertexCacheStats optimized = analyzeVertexCache(indices, vertices.size());
+        EXPECT_EQ(triangleSet(), expected);
+        EXPECT_GT(shuffledAcmr, 2.0f);
+        EXPECT_LT(optimized.acmr, 0.8f);
+        EXPECT_LT(optimized.atvr, 1.6f);
+    }
+
+    TEST_F(MeshOptimizerTest, OverdrawOrderDrawsOuterSurfacesFirst)
+    {
+        addSphere(0.5f, 16, 32);
+        addSphere(2.0f, 16, 32);
+        optimizeVertexCache(indices, vertices.size());
+        const auto expected = triangleSet();
+        const float cacheAcmr = analyzeVertexCache(indices, vertices.size()).acmr;
+
+        optimizeOverdraw(indices, vertices, 1.05f);
+        EXPECT_EQ(triangleSet(), expected);
+        EXPECT_LE(analyzeVertexCache(indices, vertices.size()).acmr, cacheAcmr * 1.05f + 0.05f);
+
+        // Every triangle of the outer sphere comes before the inner one, which it hides
+        const size_t outerIndexCount = indices.size() / 2;
+        for (size_t i = 0; i < outerIndexCount; ++i)
+            EXPECT_NEAR(glm::length(vertices[indices[i]].position), 2.0f, 1e-4f) << "index " << i;
+    }
+
+    TEST_F(MeshOptimizerTest, VertexFetchFollowsFirstUse)
+    {
+        buildGrid(16);
+        shuffleTriangles();
+        vertices.push_back(makeVertex(glm::vec3(-1.0f)));   // Never referenced
+        const auto expected = triangleSet();
+
+        EXPECT_EQ(optimizeVertexFetch(vertices, indices), 17u * 17u);
+        EXPECT_EQ(triangleSet(), expected);
+        unsigned int nextNew = 0;
+        for (const unsigned int index : indices) {
+            ASSERT_LE(index, nextNew);
+            nextNew = std::max(nextNew, index + 1);
+        }
+    }
+
+}
@@ -0,0 +1,219 @@
+//// MeshSimplifier.test.cpp //////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the mesh simplifier
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include "assets/Assets/Model/MeshSimplifier.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <set>
+#include <vector>
+
+namespace nexo::assets {
+
+    class MeshSimplifierTest : public ::testing::Test {
+        protected:
+            std::vector<glm::vec3> positions;
+            std::vector<unsigned int> indices;
+
+            // Grid of size x size quads covering [-1, 1] on x and y, heights given by a function of the position
+            template<typename HeightFunc>
+            void buildGrid(const unsigned int size, HeightFunc height)
+            {
+                for (unsigned int y = 0; y <= size; ++y) {
+                    for (unsigned int x = 0; x <= size; ++x) {
+                        const float px = -1.0f + 2.0f * static_cast<float>(x) / static_cast<float>(size);
+                        const float py = -1.0f + 2.0f * static_cast<float>(y) / static_cast<float>(size);
+                        positions.emplace_back(px, py, height(px, py));
+                    }
+                }
+                for (unsigned int y = 0; y < size; ++y) {
+                    for (unsigned int x = 0; x < size; ++x) {
+                        const unsigned int i = y * (size + 1) + x;
+                        indices.insert(indices.end(), {i, i + 1, i + size + 2, i, i + size + 2, i + size + 1});
+                    }
+                }
+            }
+
+            void buildSphere(const unsigned int rings, const unsigned int segments)
+            {
+                constexpr float pi = std::numbers::pi_v<float>;
+                positions.emplace_back(0.0f, 1.0f, 0.0f);
+                for (unsigned int ring = 1; ring < rings; ++ring) {
+                    const float phi = pi * static_cast<float>(ring) / static_cast<float>(rings);
+                    for (unsigned int segment = 0; segment < segments; ++segment) {
+                        const float theta = 2.0f * pi * static_cast<float>(segment) / static_cast<float>(segments);
+                        positions.emplace_back(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+                    }
+                }
+                positions.emplace_back(0.0f, -1.0f, 0.0f);
+                const auto bottom = static_cast<unsigned int>(positions.size() - 1);
+                auto ringVertex = [&](const unsigned int ring, const unsigned int segment) {
+                    return 1 + (ring - 1) * segments + segment % segments;
+                };
+                for (unsigned int segment = 0; segment < segments; ++segment) {
+                    indices.insert(indices.end(), {0, ringVertex(1, segment + 1), ringVertex(1, segment)});
+                    indices.insert(indices.end(), {bottom, ringVertex(rings - 1, segment), ringVertex(rings - 1, segment + 1)});
+                    for (unsigned int ring = 1; ring + 1 < rings; ++ring) {
+                        const unsigned int a = ringVertex(ring, segment);
+                        const unsigned int b = ringVertex(ring, segment + 1);
+                        const unsigned int c = ringVertex(ring + 1, segment);
+                        const unsigned int d = ringVertex(ring + 1, segment + 1);
+                        indices.insert(indices.end(), {a, b, d, a, d, c});
+                    }
+                }
+            }
+
+            void expectValidTriangles(const std::vector<unsigned int> &simplified) const
+            {
+                ASSERT_EQ(simplified.size() % 3, 0u);
+                for (size_t i = 0; i < simplified.size(); i += 3) {
+                    for (size_t corner = 0; corner < 3; ++corner)
+                        ASSERT_LT(simplified[i + corner], positions.size());
+                    EXPECT_NE(positions[simplified[i]], positions[simplified[i + 1]]);
+                    EXPECT_NE(positions[simplified[i + 1]], positions[simplified[i + 2]]);
+                    EXPECT_NE(positions[simplified[i]], positions[simplified[i + 2]]);
+                }
+            }
+    };
+
+    TEST_F(MeshSimplifierTest, KeepsMeshAlreadyUnderTarget)
+    {
+        buildGrid(4, [](float, float) { return 0.0f; });
+
+        const SimplifiedMesh result = simplifyMesh(positions, indices, indices.size());
+        EXPECT_EQ(result.indices, indices);
+        EXPECT_EQ(result.error, 0.0f);
+    }
+
+    TEST_F(MeshSimplifierTest, FlatGridCollapsesWithoutErrorAndKeepsCorners)
+    {
+        buildGrid(32, [](float, float) { return 0.0f; });
+
+        const SimplifiedMesh result = simplifyMesh(positions, indices, indices.size() / 20);
+        expectValidTriangles(result.indices);
+        EXPECT_LE(result.indices.size(), indices.size() / 10);
+        EXPECT_NEAR(result.error, 0.0f, 1e-4f);
+
+        const std::set<unsigned int> used(result.indices.begin(), result.indices.end());
+        for (const unsigned int corner : {0u, 32u, 33u * 32u, 33u * 33u - 1u})
+            EXPECT_TRUE(used.contains(corner)) << "corner " << corner;
+        // Borders only slide along themselves, the grid still covers the same rectangle
+        float area = 0.0f;
+        for (size_t i = 0; i < result.indices.size(); i += 3) {
+            const glm::vec3 normal = glm::cross(positions[result.indices[i + 1]] - positions[result.indices[i]],
+                                                positions[result.indices[i + 2]] - positions[result.indices[i]]);
+            EXPECT_GT(normal.z, 0.0f);
+            area += normal.z * 0.5f;
+        }
+        EXPECT_NEAR(area, 4.0f, 1e-3f);
+    }
+
+    TEST_F(MeshSimplifierTest, SphereReachesTargetWithBoundedError)
+    {
+        buildSphere(32, 64);
+
+        const SimplifiedMesh result = simplifyMesh(positions, indices, indices.size() / 4);
+        expectValidTriangles(result.indices);
+        EXPECT_LE(result.indices.size(), indices.size() / 4 + 6);
+        EXPECT_GT(result.error, 0.0f);
+        EXPECT_LT(result.error, 0.05f);
+    }
+
+    TEST_F(MeshSimplifierTest, ErrorBoundStopsTheSimplification)
+    {
+        buildSphere(32, 64);
+
+        const SimplifiedMesh loose = simplifyMesh(positions, indices, 0);
+        const SimplifiedMesh bounded = simplifyMesh(positions, indices, 0, 0.005f);
+        expectValidTriangles(bounded.indices);
+        EXPECT_LE(bounded.error, 0.005f);
+        EXPECT_GT(bounded.indices.size(), loose.indices.size());
+        EXPECT_LT(bounded.indices.size(), indices.size());
+    }
+
+    TEST_F(MeshSimplifierTest, CoarserTargetsGiveLargerErrors)
+    {
+        buildGrid(48, [](const float x, const float y) { return 0.2f * std::sin(3.0f * x) * std::cos(2.0f * y); });
+
+        float previousError = 0.0f;
+        size_t previousCount = indices.size();
+        for (const size_t divisor : {2u, 8u, 32u}) {
+            const SimplifiedMesh result = simplifyMesh(positions, indices, indices.size() / divisor);
+            expectValidTriangles(result.indices);
+            EXPECT_LT(result.indices.size(), previousCount);
+            EXPECT_GE(result.error, previousError);
+            previousError = result.error;
+            previousCount = result.indices.size();
+        }
+    }
+
+    TEST_F(MeshSimplifierTest, UvSeamStaysClosed)
+    {
+        buildGrid(32, [](const float x, const float y) { return 0.1f * x * x + 0.05f * y; });
+        // Split the column at x = 0 in two attribute sets, the right half uses the copies
+        constexpr unsigned int size = 32;
+        std::vector<unsigned int> seamCopy(positions.size(), 0);
+        for (unsigned int y = 0; y <= size; ++y) {
+            const unsigned int vertex = y * (size + 1) + size / 2;
+            seamCopy[vertex] = static_cast<unsigned int>(positions.size());
+            positions.push_back(positions[vertex]);
+        }
+        const auto originalCount = static_cast<unsigned int>(seamCopy.size());
+        for (size_t i = 0; i < indices.size(); i += 3) {
+            const float centroidX = positions[indices[i]].x + positions[indices[i + 1]].x + positions[indices[i + 2]].x;
+            if (centroidX <= 0.0f)
+                continue;
+            for (size_t corner = i; corner < i + 3; ++corner) {
+                if (seamCopy[indices[corner]] != 0)
+                    indices[corner] = seamCopy[indices[corner]];
+            }
+        }
+
+        const SimplifiedMesh result = simplifyMesh(positions, indices, indices.size() / 8);
+        expectValidTriangles(result.indices);
+        EXPECT_LT(result.indices.size(), indices.size() / 2);
+
+        std::set<float> leftSeam;
+        std::set<float> rightSeam;
+        for (size_t i = 0; i < result.indices.size(); i += 3) {
+            const float centroidX = positions[result.indices[i]].x + positions[result.indices[i + 1]].x +
+                                    positions[result.indices[i + 2]].x;
+            for (size_t corner = i; corner < i + 3; ++corner) {
+                const unsigned int vertex = result.indices[corner];
+                if (positions[vertex].x != 0.0f)
+                    continue;
+                // Each side keeps its own attribute set
+                if (centroidX < 0.0f) {
+                    EXPECT_LT(vertex, originalCount);
+                    leftSeam.insert(positions[vertex].y);
+                } else {
+                    EXPECT_GE(vertex, originalCount);
+                    rightSeam.insert(positions[vertex].y);
+                }
+            }
+        }
+        // Both sides stop at the same seam vertices, the seam does not open
+        EXPECT_EQ(leftSeam, rightSeam);
+        EXPECT_LT(leftSeam.size(), size + 1);
+    }
+
+}
@@ -0,0 +1,251 @@
+//// TextureCooker.test.cpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the offline texture cooker
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "assets/Assets/Texture/TextureCooker.hpp"
+#include "renderer/GraphicsApi.hpp"
+#include "renderer/headless/HeadlessTexture2D.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+
+namespace nexo::assets {
+
+    using renderer::NxTextureFormat;
+    using renderer::NxTextureImage;
+
+    class TextureCookerTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                m_previousApi = renderer::NxGetGraphicsApi();
+                renderer::NxSetGraphicsApi(renderer::NxGraphicsApi::HEADLESS);
+                m_directory = std::filesystem::temp_directory_path() / "nexo_texture_cooker_test";
+                std::filesystem::create_directories(m_directory);
+            }
+
+            void TearDown() override
+            {
+                std::filesystem::remove_all(m_directory);
+                renderer::NxSetGraphicsApi(m_previousApi);
+            }
+
+            // Smooth gradients with a bit of noise, close enough to a photo for the compression ratios to matter
+            static NxTextureImage makeImage(const unsigned int width, const unsigned int height)
+            {
+                NxTextureImage image{std::vector<uint8_t>(static_cast<size_t>(width) * height * 4), width, height,
+                                     NxTextureFormat::RGBA8};
+                uint32_t seed = 1234;
+                for (unsigned int y = 0; y < height; ++y) {
+                    for (unsigned int x = 0; x < width; ++x) {
+                        seed = seed * 1664525u + 1013904223u;
+                        uint8_t *pixel = image.pixels.data() + (static_cast<size_t>(y) * width + x) * 4;
+                        pixel[0] = static_cast<uint8_t>(x * 255 / width);
+                        pixel[1] = static_cast<uint8_t>(y * 255 / height);
+                        pixel[2] = static_cast<uint8_t>((seed >> 24) & 0x0f);
+                        pixel[3] = 255;
+                    }
+                }
+                return image;
+            }
+
+            std::filesystem::path m_directory;
+
+        private:
+            renderer::NxGraphicsApi m_previousApi = renderer::NxGraphicsApi::HEADLESS;
+    };
+
+    TEST_F(TextureCookerTest, MipChainGoesDownToOnePixel)
+    {
+        for (const auto filter : {TextureImportParameters::MipFilter::Box, TextureImportParameters::MipFilter::Kaiser}) {
+            const auto chain = TextureCooker::generateMipChain(makeImage(16, 4), filter);
+
+            ASSERT_EQ(chain.size(), 5u);
+            const std::vector<std::pair<unsigned int, unsigned int>> expected = {{16, 4}, {8, 2}, {4, 1}, {2, 1}, {1, 1}};
+            for (size_t i = 0; i < chain.size(); ++i) {
+                EXPECT_EQ(chain[i].width, expected[i].first);
+                EXPECT_EQ(chain[i].height, expected[i].second);
+                EXPECT_EQ(chain[i].pixels.size(), static_cast<size_t>(chain[i].width) * chain[i].height * 4);
+            }
+        }
+    }
+
+    TEST_F(TextureCookerTest, BoxFilterAveragesPixels)
+    {
+        const NxTextureImage image{{0, 100, 200, 255, 100, 100, 200, 255, 0, 0, 0, 255, 100, 0, 0, 255}, 2, 2,
+                                   NxTextureFormat::RGBA8};
+
+        const auto chain = TextureCooker::generateMipChain(image, TextureImportParameters::MipFilter::Box);
+
+        ASSERT_EQ(chain.size(), 2u);
+        EXPECT_EQ(chain[1].pixels, (std::vector<uint8_t>{50, 50, 100, 255}));
+    }
+
+    TEST_F(TextureCookerTest, KaiserFilterKeepsFlatImagesFlat)
+    {
+        NxTextureImage image{std::vector<uint8_t>(8 * 8 * 4, 0), 8, 8, NxTextureFormat::RGBA8};
+        for (size_t i = 0; i < image.pixels.size(); ++i)
+            image.pixels[i] = (i % 4 == 3) ? 255 : 128;
+
+        for (const auto &level : TextureCooker::generateMipChain(image, TextureImportParameters::MipFilter::Kaiser))
+            for (size_t i = 0; i < level.pixels.size(); ++i)
+                EXPECT_EQ(level.pixels[i], (i % 4 == 3) ? 255 : 128);
+    }
+
+    TEST_F(TextureCookerTest, SolidColorBlocksAreEncodedExactly)
+    {
+        NxTextureImage image{std::vector<uint8_t>(4 * 4 * 4, 0), 4, 4, NxTextureFormat::RGBA8};
+        for (size_t i = 0; i < image.pixels.size(); i += 4) {
+            image.pixels[i] = 255;
+            image.pixels[i + 3] = 255;
+        }
+
+        TextureImportParameters params;
+        params.generateMipmaps = false;
+        params.format = TextureImportParameters::Format::BC1;
+        const auto bc1 = TextureCooker(params).cook(image);
+        ASSERT_EQ(bc1.data.size(), 8u);
+        // Pure red in RGB565, every index pointing to the first endpoint
+        EXPECT_EQ(bc1.data[0] | bc1.data[1] << 8, 0xf800);
+        EXPECT_EQ(bc1.data[4] | bc1.data[5] | bc1.data[6] | bc1.data[7], 0);
+
+        params.format = TextureImportParameters::Format::BC7;
+        const auto bc7 = TextureCooker(params).cook(image);
+        ASSERT_EQ(bc7.data.size(), 16u);
+        EXPECT_EQ(bc7.data[0] & 0x7f, 1 << 6); // mode 6
+    }
+
+    TEST_F(TextureCookerTest, CookedLevelsMatchTheOutputFormat)
+    {
+        const auto image = makeImage(64, 32);
+        for (const auto format : {TextureImportParameters::Format::RGB, TextureImportParameters::Format::BC1,
+                                  TextureImportParameters::Format::BC3, TextureImportParameters::Format::BC5,
+                                  TextureImportParameters::Format::BC7}) {
+            TextureImportParameters params;
+            params.format = format;
+            const auto cooked = TextureCooker(params).cook(image);
+
+            ASSERT_EQ(cooked.levels.size(), 7u);
+            size_t offset = 0;
+            for (const auto &level : cooked.levels) {
+                EXPECT_EQ(level.offset, offset);
+                EXPECT_EQ(level.size, renderer::NxTextureFormatImageSize(cooked.format, level.width, level.height));
+                offset += level.size;
+            }
+            EXPECT_EQ(cooked.data.size(), offset);
+        }
+    }
+
+    TEST_F(TextureCookerTest, MaxSizeDropsTheLargestLevels)
+    {
+        TextureImportParameters params;
+        params.maxSize = 16;
+        const auto cooked = TextureCooker(params).cook(makeImage(64, 64));
+
+        ASSERT_EQ(cooked.levels.size(), 5u);
+        EXPECT_EQ(cooked.levels.front().width, 16u);
+        EXPECT_EQ(cooked.levels.front().height, 16u);
+    }
+
+    TEST_F(TextureCookerTest, SavedTextureLoadsAndUploadsAllLevels)
+    {
+        TextureImportParameters params;
+        params.format = TextureImportParameters::Format::BC3;
+        const auto cooked = TextureCooker(params).cook(makeImage(128, 64));
+        const auto path = m_directory / "texture.nxtex";
+        TextureCooker::save(cooked, path);
+
+        EXPECT_TRUE(TextureCooker::isCookedTexture(path));
+        const auto loaded = TextureCooker::load(path);
+        EXPECT_EQ(loaded.format, NxTextureFormat::BC3);
+        ASSERT_EQ(loaded.levels.size(), cooked.levels.size());
+        for (size_t i = 0; i < loaded.levels.size(); ++i) {
+            const auto &level = loaded.levels[i];
+            EXPECT_TRUE(std::equal(loaded.data.begin() + static_cast<std::ptrdiff_t>(level.offset),
+                                   loaded.data.begin() + static_cast<std::ptrdiff_t>(level.offset + level.size),
+                                   cooked.data.begin() + static_cast<std::ptrdiff_t>(cooked.levels[i].offset)));
+        }
+
+        const auto texture = renderer::NxTexture2D::create(loaded.mipLevels(), loaded.format);
+        const auto headless = std::dynamic_pointer_cast<renderer::NxHeadlessTexture2D>(texture);
+        ASSERT_NE(headless, nullptr);
+        EXPECT_EQ(headless->getWidth(), 128u);
+        EXPECT_EQ(headless->getMipLevelCount(), loaded.levels.size());
+        EXPECT_EQ(headless->getFormat(), NxTextureFormat::BC3);
+    }
+
+    TEST_F(TextureCookerTest, InvalidContainersAreRejected)
+    {
+        const auto path = m_directory / "broken.nxtex";
+        {
+            std::ofstream file(path, std::ios::binary);
+            file << "NXTX garbage";
+        }
+
+        EXPECT_TRUE(TextureCooker::isCookedTexture(path));
+        EXPECT_THROW(static_cast<void>(TextureCooker::load(path)), InvalidCookedTexture);
+        EXPECT_THROW(static_cast<void>(TextureCooker::load(m_directory / "missing.nxtex")), InvalidCookedTexture);
+    }
+
+    // The raw path stores the decoded RGBA8 pixels and has to build the mip chain every time it loads the texture
+    TEST_F(TextureCookerTest, CookedTextureIsSmallerAndFasterToLoadThanRawPixels)
+    {
+        const auto image = makeImage(1024, 1024);
+        const auto rawPath = m_directory / "texture.raw";
+        {
+            std::ofstream file(rawPath, std::ios::binary);
+            file.write(reinterpret_cast<const char *>(image.pixels.data()),
+                       static_cast<std::streamsize>(image.pixels.size()));
+        }
+        TextureImportParameters params;
+        params.format = TextureImportParameters::Format::BC1;
+        const auto cookedPath = m_directory / "texture.nxtex";
+        TextureCooker::save(TextureCooker(params).cook(image), cookedPath);
+
+        using Clock = std::chrono::steady_clock;
+        auto rawTime = Clock::duration::max();
+        auto cookedTime = Clock::duration::max();
+        size_t rawFootprint = 0;
+        size_t cookedFootprint = 0;
+        for (int run = 0; run < 3; ++run) {
+            auto start = Clock::now();
+            NxTextureImage raw{std::vector<uint8_t>(std::filesystem::file_size(rawPath)), 1024, 1024,
+                               NxTextureFormat::RGBA8};
+            std::ifstream file(rawPath, std::ios::binary);
+            file.read(reinterpret_cast<char *>(raw.pixels.data()), static_cast<std::streamsize>(raw.pixels.size()));
+            const auto chain = TextureCooker::generateMipChain(raw, TextureImportParameters::MipFilter::Box);
+            rawTime = std::min(rawTime, Clock::now() - start);
+            rawFootprint = 0;
+            for (const auto &level : chain)
+                rawFootprint += level.pixels.size();
+
+            start = Clock::now();
+            const auto cooked = TextureCooker::load(cookedPath);
+            cookedTime = std::min(cookedTime, Clock::now() - start);
+            cookedFootprint = cooked.pixelSize();
+        }
+
+        // BC1 stores 4 bits per pixel against 32 for RGBA8, minus the rounding of the smallest levels to whole blocks
+        EXPECT_LT(cookedFootprint * 7, rawFootprint);
+        EXPECT_LT(cookedTime, rawTime);
+    }
+
+}
@@ -38,6 +38,9 @@ public:
     glm::vec2 getSize() const override { return glm::vec2(0.0f); }
     void resize(unsigned int, unsigned int ) override {}
     void getPixelWrapper(unsigned int, int, int, void *, const std::type_info &) const override {}
+    void readPixelsAsync(unsigned int, int, int, unsigned int, unsigned int, nexo::renderer::NxPixelReadCallback) override {}
+    void pollPixelReads(bool) override {}
+    [[nodiscard]] size_t getPendingPixelReads() const override { return 0; }
     void clearAttachmentWrapper(unsigned int, const void *, const std::type_info &) const override {}
     [[nodiscard]] nexo::renderer::NxFramebufferSpecs &getSpecs() override { static nexo::renderer::NxFramebufferSpecs specs; return specs; }
     [[nodiscard]] const nexo::renderer::NxFramebufferSpecs &getSpecs() const override { static nexo::renderer::NxFramebufferSpecs specs; return specs; }
@@ -0,0 +1,121 @@
+//// FrameArena.test.cpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the per-frame linear allocator
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "core/memory/FrameArena.hpp"
+#include "core/memory/AllocationCounter.hpp"
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace nexo::memory {
+
+    TEST(LinearArenaTest, AllocationsAreAlignedAndContiguous)
+    {
+        LinearArena arena(1024);
+
+        void *first = arena.allocate(3, 1);
+        void *second = arena.allocate(16, 16);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % 16, 0u);
+        EXPECT_GT(second, first);
+        EXPECT_GE(arena.used(), 19u);
+        EXPECT_EQ(arena.overflowCount(), 0u);
+    }
+
+    TEST(LinearArenaTest, ResetRewindsTheCursor)
+    {
+        LinearArena arena(1024);
+
+        void *first = arena.allocate(64, 8);
+        arena.reset();
+        EXPECT_EQ(arena.used(), 0u);
+        EXPECT_EQ(arena.allocate(64, 8), first);
+        EXPECT_EQ(arena.peak(), 64u);
+    }
+
+    TEST(LinearArenaTest, OverflowIsCoalescedOnReset)
+    {
+        LinearArena arena(128);
+
+        for (int i = 0; i < 8; ++i)
+            static_cast<void>(arena.allocate(64, 8));
+        EXPECT_GT(arena.overflowCount(), 0u);
+        EXPECT_GE(arena.capacity(), 512u);
+
+        // After the reset a single block holds the whole frame, the same workload no longer overflows
+        arena.reset();
+        const size_t overflows = arena.overflowCount();
+        for (int i = 0; i < 8; ++i)
+            static_cast<void>(arena.allocate(64, 8));
+        EXPECT_EQ(arena.overflowCount(), overflows);
+    }
+
+    TEST(LinearArenaTest, BacksPmrContainers)
+    {
+        LinearArena arena(256);
+
+        std::pmr::vector<int> values(&arena);
+        for (int i = 0; i < 1000; ++i)
+            values.push_back(i);
+        EXPECT_EQ(values[999], 999);
+        EXPECT_GE(arena.used(), 1000 * sizeof(int));
+    }
+
+    TEST(LinearArenaTest, SteadyStateFramesDoNotAllocate)
+    {
+        if (!isAllocationTrackingEnabled())
+            GTEST_SKIP() << "Built without NEXO_TRACK_ALLOCATIONS";
+
+        LinearArena arena(64);
+        const auto frame = [&arena] {
+            std::pmr::vector<int> values(&arena);
+            for (int i = 0; i < 256; ++i)
+                values.push_back(i);
+            arena.reset();
+        };
+        // The first frame grows the arena to its working size
+        frame();
+
+        const AllocationStats before = getAllocationStats();
+        frame();
+        const AllocationStats delta = getAllocationStats() - before;
+        EXPECT_EQ(delta.allocations, 0u);
+    }
+
+    TEST(FrameArenaTest, PreviousFrameStaysValidForOneFrame)
+    {
+        FrameArena &frameArena = FrameArena::get();
+
+        LinearArena *frameN = &frameArena.current();
+        auto *value = static_cast<int *>(frameArena.resource()->allocate(sizeof(int), alignof(int)));
+        *value = 42;
+
+        frameArena.endFrame();
+        EXPECT_EQ(&frameArena.previous(), frameN);
+        EXPECT_NE(&frameArena.current(), frameN);
+        EXPECT_EQ(frameArena.current().used(), 0u);
+        EXPECT_EQ(*value, 42);
+        EXPECT_GT(frameN->used(), 0u);
+
+        frameArena.endFrame();
+        EXPECT_EQ(&frameArena.current(), frameN);
+        EXPECT_EQ(frameN->used(), 0u);
+    }
+
+}
@@ -31,7 +31,7 @@ class PhysicsSystemTest : public ::testing::Test {
         coordinator->init();
         coordinator->registerComponent<components::TransformComponent>();
         coordinator->registerComponent<components::PhysicsBodyComponent>();
-        physicsSystem = std::make_shared<system::PhysicsSystem>();
+        physicsSystem = coordinator->registerQuerySystem<system::PhysicsSystem>();
         physicsSystem->init();
     }
 };
@@ -80,3 +80,46 @@ TEST_F(PhysicsSystemTest, PhysicsUpdatesTransformPosition) {
     auto& updated = coordinator->getComponent<components::TransformComponent>(entity);
     EXPECT_NEAR(updated.pos.y, transform.pos.y, 1.0f); // should be falling slightly
 }
+
+TEST_F(PhysicsSystemTest, RebuildBodiesDestroysBodiesWithoutComponent) {
+    ecs::Entity entity = coordinator->createEntity();
+    components::TransformComponent transform{};
+    transform.pos = {0.0f, 5.0f, 0.0f};
+    transform.quat = {1.0f, 0.0f, 0.0f, 0.0f};
+    transform.size = {1.0f, 1.0f, 1.0f};
+    coordinator->addComponent(entity, transform);
+
+    const JPH::BodyID oldBodyID = physicsSystem->createDynamicBody(entity, transform);
+    const JPH::BodyID orphanBodyID = physicsSystem->createBody(transform, JPH::EMotionType::Dynamic);
+    physicsSystem->rebuildBodies();
+
+    const auto& bodyComp = coordinator->getComponent<components::PhysicsBodyComponent>(entity);
+    const JPH::BodyInterface* bodyInterface = physicsSystem->getBodyInterface();
+    EXPECT_NE(bodyComp.bodyID, oldBodyID);
+    EXPECT_TRUE(bodyInterface->IsAdded(bodyComp.bodyID));
+    EXPECT_FALSE(bodyInterface->IsAdded(oldBodyID));
+    EXPECT_FALSE(bodyInterface->IsAdded(orphanBodyID));
+    EXPECT_NEAR(bodyInterface->GetPosition(bodyComp.bodyID).GetY(), 5.0f, 1e-5f);
+}
+
+TEST_F(PhysicsSystemTest, RebuildBodiesRecreatesDestroyedBodies) {
+    ecs::Entity entity = coordinator->createEntity();
+    components::TransformComponent transform{};
+    transform.pos = {0.0f, 0.25f, 0.0f};
+    transform.quat = {1.0f, 0.0f, 0.0f, 0.0f};
+    transform.size = {20.0f, 0.5f, 20.0f};
+    coordinator->addComponent(entity, transform);
+
+    const JPH::BodyID oldBodyID = physicsSystem->createStaticBody(entity, transform);
+    JPH::BodyInterface* bodyInterface = physicsSystem->getBodyInterface();
+    bodyInterface->RemoveBody(oldBodyID);
+    bodyInterface->DestroyBody(oldBodyID);
+
+    coordinator->getComponent<components::TransformComponent>(entity).pos.x = 3.0f;
+    physicsSystem->rebuildBodies();
+
+    const auto& bodyComp = coordinator->getComponent<components::PhysicsBodyComponent>(entity);
+    EXPECT_TRUE(bodyInterface->IsAdded(bodyComp.bodyID));
+    EXPECT_EQ(bodyInterface->GetMotionType(bodyComp.bodyID), JPH::EMotionType::Static);
+    EXPECT_NEAR(bodyInterface->GetPosition(bodyComp.bodyID).GetX(), 3.0f, 1e-5f);
+}
@@ -0,0 +1,261 @@
+//// DynamicBvh.test.cpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the dynamic bounding volume hierarchy
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include "core/spatial/DynamicBvh.hpp"
+#include "ecs/ECSExceptions.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace nexo::spatial {
+
+    class DynamicBvhTest : public ::testing::Test {
+        protected:
+            // Boxes of 0.5 to 2 units scattered in a cube of the given half size
+            static std::vector<Aabb> randomBoxes(const size_t count, const float halfSize, const unsigned int seed = 42)
+            {
+                std::mt19937 rng(seed);
+                std::uniform_real_distribution position(-halfSize, halfSize);
+                std::uniform_real_distribution size(0.25f, 1.0f);
+                std::vector<Aabb> boxes;
+                boxes.reserve(count);
+                for (size_t i = 0; i < count; ++i) {
+                    const glm::vec3 center(position(rng), position(rng), position(rng));
+                    const glm::vec3 extent(size(rng), size(rng), size(rng));
+                    boxes.emplace_back(center - extent, center + extent);
+                }
+                return boxes;
+            }
+
+            static void fill(DynamicBvh &bvh, const std::vector<Aabb> &boxes)
+            {
+                for (size_t i = 0; i < boxes.size(); ++i)
+                    bvh.insert(static_cast<ecs::Entity>(i), boxes[i]);
+                bvh.refit();
+            }
+
+            static std::vector<ecs::Entity> sorted(const std::span<const ecs::Entity> entities)
+            {
+                std::vector<ecs::Entity> result(entities.begin(), entities.end());
+                std::ranges::sort(result);
+                return result;
+            }
+
+            // Queries test the inflated leaf bounds, so does the brute force reference
+            static std::vector<Aabb> inflated(const std::vector<Aabb> &boxes)
+            {
+                std::vector<Aabb> result;
+                for (const auto &box : boxes)
+                    result.push_back(box.inflated(DynamicBvh::DEFAULT_MARGIN));
+                return result;
+            }
+    };
+
+    TEST_F(DynamicBvhTest, EmptyTreeReturnsNothing)
+    {
+        DynamicBvh bvh;
+        EXPECT_TRUE(bvh.empty());
+        EXPECT_TRUE(bvh.queryAabb({glm::vec3(-1.0f), glm::vec3(1.0f)}).empty());
+        EXPECT_TRUE(bvh.queryRay(glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, 0.0f)).empty());
+        EXPECT_TRUE(bvh.queryNearest(glm::vec3(0.0f), 3).empty());
+        EXPECT_EQ(bvh.height(), 0u);
+        EXPECT_FLOAT_EQ(bvh.cost(), 0.0f);
+    }
+
+    TEST_F(DynamicBvhTest, InsertAndRemoveKeepEntitiesDense)
+    {
+        DynamicBvh bvh;
+        bvh.insert(3, {glm::vec3(0.0f), glm::vec3(1.0f)});
+        bvh.insert(7, {glm::vec3(2.0f), glm::vec3(3.0f)});
+        bvh.insert(9, {glm::vec3(4.0f), glm::vec3(5.0f)});
+        EXPECT_EQ(bvh.size(), 3u);
+        // Inserted entities are only linked by the refit
+        EXPECT_TRUE(bvh.queryAabb({glm::vec3(-10.0f), glm::vec3(10.0f)}).empty());
+        bvh.refit();
+        EXPECT_EQ(bvh.queryAabb({glm::vec3(-10.0f), glm::vec3(10.0f)}).size(), 3u);
+        EXPECT_TRUE(bvh.contains(7));
+        EXPECT_FALSE(bvh.contains(4));
+
+        bvh.remove(3);
+        EXPECT_EQ(bvh.size(), 2u);
+        EXPECT_FALSE(bvh.contains(3));
+        EXPECT_EQ(sorted(bvh.entities()), (std::vector<ecs::Entity>{7, 9}));
+        EXPECT_EQ(sorted(bvh.queryAabb({glm::vec3(-10.0f), glm::vec3(10.0f)})), (std::vector<ecs::Entity>{7, 9}));
+
+        bvh.remove(3);
+        EXPECT_EQ(bvh.size(), 2u);
+        EXPECT_THROW(static_cast<void>(bvh.getBounds(3)), ecs::OutOfRange);
+    }
+
+    TEST_F(DynamicBvhTest, SmallMovesStayInTheInflatedLeaf)
+    {
+        DynamicBvh bvh(0.5f);
+        bvh.insert(0, {glm::vec3(0.0f), glm::vec3(1.0f)});
+        bvh.refit();
+        EXPECT_FALSE(bvh.update(0, {glm::vec3(0.2f), glm::vec3(1.2f)}));
+        EXPECT_TRUE(bvh.update(0, {glm::vec3(5.0f), glm::vec3(6.0f)}));
+        bvh.refit();
+        EXPECT_EQ(bvh.getBounds(0).min, glm::vec3(4.5f));
+        EXPECT_EQ(bvh.getBounds(0).max, glm::vec3(6.5f));
+        EXPECT_TRUE(bvh.queryAabb({glm::vec3(0.0f), glm::vec3(1.0f)}).empty());
+    }
+
+    TEST_F(DynamicBvhTest, AabbQueryMatchesBruteForce)
+    {
+        const auto boxes = randomBoxes(2000, 50.0f);
+        const auto leaves = inflated(boxes);
+        DynamicBvh bvh;
+        fill(bvh, boxes);
+
+        const auto queries = randomBoxes(50, 50.0f, 7);
+        for (const auto &query : queries) {
+            const Aabb region = query.inflated(5.0f);
+            std::vector<ecs::Entity> expected;
+            for (size_t i = 0; i < leaves.size(); ++i)
+                if (leaves[i].overlaps(region))
+                    expected.push_back(static_cast<ecs::Entity>(i));
+            EXPECT_EQ(sorted(bvh.queryAabb(region)), expected);
+        }
+    }
+
+    TEST_F(DynamicBvhTest, FrustumQueryMatchesBruteForce)
+    {
+        const auto boxes = randomBoxes(2000, 50.0f);
+        const auto leaves = inflated(boxes);
+        DynamicBvh bvh;
+        fill(bvh, boxes);
+
+        const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 40.0f);
+        for (const glm::vec3 target : {glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(1.0f, 0.5f, 0.0f), glm::vec3(0.0f, -1.0f, 0.2f)}) {
+            const Frustum frustum = Frustum::fromMatrix(projection * glm::lookAt(glm::vec3(0.0f), target, glm::vec3(0.0f, 1.0f, 0.0f)));
+            std::vector<ecs::Entity> expected;
+            for (size_t i = 0; i < leaves.size(); ++i)
+                if (frustum.intersects(leaves[i]))
+                    expected.push_back(static_cast<ecs::Entity>(i));
+            const auto result = sorted(bvh.queryFrustum(frustum));
+            EXPECT_FALSE(result.empty());
+            EXPECT_EQ(result, expected);
+        }
+    }
+
+    TEST_F(DynamicBvhTest, RayQueryReturnsHitsNearestFirst)
+    {
+        DynamicBvh bvh(0.0f);
+        bvh.insert(1, {glm::vec3(9.0f, -1.0f, -1.0f), glm::vec3(10.0f, 1.0f, 1.0f)});
+        bvh.insert(2, {glm::vec3(4.0f, -1.0f, -1.0f), glm::vec3(5.0f, 1.0f, 1.0f)});
+        bvh.insert(3, {glm::vec3(4.0f, 3.0f, -1.0f), glm::vec3(5.0f, 4.0f, 1.0f)});
+        bvh.insert(4, {glm::vec3(-5.0f, -1.0f, -1.0f), glm::vec3(-4.0f, 1.0f, 1.0f)});
+        bvh.refit();
+
+        const auto hits = bvh.queryRay(glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+        EXPECT_EQ(std::vector<ecs::Entity>(hits.begin(), hits.end()), (std::vector<ecs::Entity>{2, 1}));
+
+        const auto shortHits = bvh.queryRay(glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, 0.0f), 6.0f);
+        EXPECT_EQ(std::vector<ecs::Entity>(shortHits.begin(), shortHits.end()), (std::vector<ecs::Entity>{2}));
+    }
+
+    TEST_F(DynamicBvhTest, NearestQueryMatchesBruteForce)
+    {
+        const auto boxes = randomBoxes(2000, 50.0f);
+        const auto leaves = inflated(boxes);
+        DynamicBvh bvh;
+        fill(bvh, boxes);
+
+        const glm::vec3 point(3.0f, -7.0f, 12.0f);
+        const auto nearest = bvh.queryNearest(point, 10);
+        ASSERT_EQ(nearest.size(), 10u);
+
+        std::vector<float> distances;
+        for (const auto &leaf : leaves)
+            distances.push_back(leaf.distanceSquared(point));
+        std::vector<float> expected = distances;
+        std::ranges::sort(expected);
+        for (size_t i = 0; i < nearest.size(); ++i)
+            EXPECT_FLOAT_EQ(distances[nearest[i]], expected[i]);
+
+        EXPECT_EQ(bvh.queryNearest(point, 5000).size(), boxes.size());
+    }
+
+    TEST_F(DynamicBvhTest, RefitFollowsMovedEntities)
+    {
+        auto boxes = randomBoxes(500, 20.0f);
+        DynamicBvh bvh;
+        fill(bvh, boxes);
+
+        // Move a few entities far away, the tree is refit without a rebuild
+        for (ecs::Entity entity = 0; entity < 10; ++entity) {
+            boxes[entity] = {boxes[entity].min + glm::vec3(100.0f), boxes[entity].max + glm::vec3(100.0f)};
+            EXPECT_TRUE(bvh.update(entity, boxes[entity]));
+        }
+        bvh.refit();
+        const auto moved = sorted(bvh.queryAabb({glm::vec3(70.0f), glm::vec3(130.0f)}));
+        EXPECT_EQ(moved, (std::vector<ecs::Entity>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    }
+
+    TEST_F(DynamicBvhTest, ScrambledTreeIsRebuilt)
+    {
+        auto boxes = randomBoxes(4000, 50.0f);
+        DynamicBvh bvh;
+        fill(bvh, boxes);
+        bvh.rebuild();
+        const float builtCost = bvh.cost();
+
+        // Swap the positions of the entities: refitting alone would leave a tree of huge overlapping nodes
+        std::mt19937 rng(3);
+        std::ranges::shuffle(boxes, rng);
+        for (size_t i = 0; i < boxes.size(); ++i)
+            bvh.update(static_cast<ecs::Entity>(i), boxes[i]);
+        bvh.refit();
+
+        EXPECT_LT(bvh.cost(), builtCost * 1.3f);
+        EXPECT_LE(bvh.height(), 40u);
+        const Aabb region{glm::vec3(-10.0f), glm::vec3(10.0f)};
+        std::vector<ecs::Entity> expected;
+        for (size_t i = 0; i < boxes.size(); ++i)
+            if (boxes[i].inflated(DynamicBvh::DEFAULT_MARGIN).overlaps(region))
+                expected.push_back(static_cast<ecs::Entity>(i));
+        EXPECT_EQ(sorted(bvh.queryAabb(region)), expected);
+    }
+
+    // The timings against the linear scan are measured by the spatialQueries benchmark
+    TEST_F(DynamicBvhTest, QueriesMatchLinearScanOnALargeTree)
+    {
+        constexpr size_t entityCount = 20'000;
+        const auto boxes = randomBoxes(entityCount, 200.0f);
+        DynamicBvh bvh;
+        fill(bvh, boxes);
+        ASSERT_EQ(bvh.size(), entityCount);
+
+        size_t treeHits = 0;
+        size_t scanHits = 0;
+        for (const auto &query : randomBoxes(50, 200.0f, 11)) {
+            const Aabb region = query.inflated(5.0f);
+            treeHits += bvh.queryAabb(region).size();
+            for (const auto &box : boxes)
+                scanHits += box.inflated(DynamicBvh::DEFAULT_MARGIN).overlaps(region);
+        }
+        EXPECT_GT(treeHits, 0u);
+        EXPECT_EQ(treeHits, scanHits);
+    }
+
+}
@@ -0,0 +1,164 @@
+//// SpatialIndexSystem.test.cpp //////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the spatial index system
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "ecs/Coordinator.hpp"
+#include "systems/SpatialIndexSystem.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+
+namespace nexo::system {
+
+    class SpatialIndexSystemTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                coordinator = std::make_shared<ecs::Coordinator>();
+                ecs::System::coord = coordinator;
+                coordinator->init();
+                coordinator->registerComponent<components::TransformComponent>();
+                coordinator->registerComponent<components::StaticMeshComponent>();
+                coordinator->registerComponent<components::SceneTag>();
+                coordinator->registerSingletonComponent<components::RenderContext>();
+                spatialIndexSystem = coordinator->registerQuerySystem<SpatialIndexSystem>();
+            }
+
+            ecs::Entity createMesh(const glm::vec3 &position, const unsigned int sceneId = 0) const
+            {
+                const ecs::Entity entity = coordinator->createEntity();
+                components::TransformComponent transform;
+                transform.pos = position;
+                transform.worldMatrix = glm::translate(glm::mat4(1.0f), position);
+                coordinator->addComponent(entity, transform);
+                coordinator->addComponent(entity, components::StaticMeshComponent{});
+                coordinator->addComponent(entity, components::SceneTag{sceneId, true, true});
+                return entity;
+            }
+
+            // Renders a frame of the scene as far as the index is concerned
+            void updateScene(const int sceneId = 0) const
+            {
+                coordinator->getSingletonComponent<components::RenderContext>().sceneRendered = sceneId;
+                spatialIndexSystem->update();
+                coordinator->advanceTick();
+            }
+
+            bool isIndexedAt(const ecs::Entity entity, const glm::vec3 &position, const unsigned int sceneId = 0) const
+            {
+                const auto hits = spatialIndexSystem->getSceneIndex(sceneId)->queryAabb({position, position});
+                return std::ranges::find(hits, entity) != hits.end();
+            }
+
+            std::shared_ptr<ecs::Coordinator> coordinator;
+            std::shared_ptr<SpatialIndexSystem> spatialIndexSystem;
+    };
+
+    TEST_F(SpatialIndexSystemTest, IndexesTheMeshesOfTheRenderedScene)
+    {
+        const ecs::Entity first = createMesh({0.0f, 0.0f, 0.0f});
+        const ecs::Entity second = createMesh({10.0f, 0.0f, 0.0f});
+        createMesh({20.0f, 0.0f, 0.0f}, 1);
+
+        updateScene();
+
+        const auto *index = spatialIndexSystem->getSceneIndex(0);
+        ASSERT_NE(index, nullptr);
+        EXPECT_EQ(index->size(), 2u);
+        EXPECT_TRUE(isIndexedAt(first, {0.0f, 0.0f, 0.0f}));
+        EXPECT_TRUE(isIndexedAt(second, {10.0f, 0.0f, 0.0f}));
+        EXPECT_EQ(spatialIndexSystem->getSceneIndex(1), nullptr);
+    }
+
+    TEST_F(SpatialIndexSystemTest, ModifiedTransformsMoveTheirEntity)
+    {
+        const ecs::Entity entity = createMesh({0.0f, 0.0f, 0.0f});
+        updateScene();
+
+        // Written outside of a Write access path, the way the editor does
+        coordinator->getComponent<components::TransformComponent>(entity).worldMatrix =
+            glm::translate(glm::mat4(1.0f), glm::vec3(50.0f, 0.0f, 0.0f));
+        updateScene();
+        // Without a change recorded the entity stays where it was
+        EXPECT_TRUE(isIndexedAt(entity, {0.0f, 0.0f, 0.0f}));
+
+        coordinator->markModified<components::TransformComponent>(entity);
+        updateScene();
+        EXPECT_TRUE(isIndexedAt(entity, {50.0f, 0.0f, 0.0f}));
+        EXPECT_FALSE(isIndexedAt(entity, {0.0f, 0.0f, 0.0f}));
+    }
+
+    TEST_F(SpatialIndexSystemTest, EntitiesLeaveTheIndexWithTheirComponentsOrScene)
+    {
+        const ecs::Entity meshRemoved = createMesh({0.0f, 0.0f, 0.0f});
+        const ecs::Entity destroyed = createMesh({10.0f, 0.0f, 0.0f});
+        const ecs::Entity moved = createMesh({20.0f, 0.0f, 0.0f});
+        updateScene();
+
+        coordinator->removeComponent<components::StaticMeshComponent>(meshRemoved);
+        coordinator->destroyEntity(destroyed);
+        coordinator->getComponent<components::SceneTag>(moved).id = 1;
+        coordinator->markModified<components::SceneTag>(moved);
+        updateScene();
+
+        const auto *index = spatialIndexSystem->getSceneIndex(0);
+        EXPECT_TRUE(index->empty());
+        updateScene(1);
+        EXPECT_TRUE(isIndexedAt(moved, {20.0f, 0.0f, 0.0f}, 1));
+    }
+
+    TEST_F(SpatialIndexSystemTest, SceneNotRenderedForLongerThanTheHistoryIsRebuilt)
+    {
+        coordinator->setChangeRetention(4);
+        const ecs::Entity entity = createMesh({0.0f, 0.0f, 0.0f});
+        updateScene();
+
+        coordinator->getComponent<components::TransformComponent>(entity).worldMatrix =
+            glm::translate(glm::mat4(1.0f), glm::vec3(50.0f, 0.0f, 0.0f));
+        coordinator->markModified<components::TransformComponent>(entity);
+        for (int frame = 0; frame < 8; ++frame)
+            updateScene(1);
+        updateScene();
+
+        EXPECT_TRUE(isIndexedAt(entity, {50.0f, 0.0f, 0.0f}));
+    }
+
+    TEST_F(SpatialIndexSystemTest, IndexIsOnlyUpdatedForFrustumCulling)
+    {
+        auto &renderContext = coordinator->getSingletonComponent<components::RenderContext>();
+        renderContext.frustumCulling = false;
+        const ecs::Entity entity = createMesh({0.0f, 0.0f, 0.0f});
+        updateScene();
+        EXPECT_EQ(spatialIndexSystem->getSceneIndex(0), nullptr);
+
+        // Turning the culling back on catches up with the changes made in the meantime
+        renderContext.frustumCulling = true;
+        updateScene();
+        coordinator->getComponent<components::TransformComponent>(entity).worldMatrix =
+            glm::translate(glm::mat4(1.0f), glm::vec3(50.0f, 0.0f, 0.0f));
+        coordinator->markModified<components::TransformComponent>(entity);
+        renderContext.frustumCulling = false;
+        updateScene();
+        EXPECT_TRUE(isIndexedAt(entity, {0.0f, 0.0f, 0.0f}));
+        renderContext.frustumCulling = true;
+        updateScene();
+        EXPECT_TRUE(isIndexedAt(entity, {50.0f, 0.0f, 0.0f}));
+    }
+
+}
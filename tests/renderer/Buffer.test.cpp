@@ -35,6 +35,7 @@ namespace nexo::renderer {
         MOCK_METHOD(void, setLayout, (const NxBufferLayout&), (override));
         MOCK_METHOD(NxBufferLayout, getLayout, (), (const, override));
         MOCK_METHOD(void, setData, (void*, size_t), (override));
+        MOCK_METHOD(void, setSubData, (const void*, size_t, size_t), (override));
         MOCK_METHOD(unsigned int, getId, (), (const, override));
     };
 
@@ -43,6 +44,7 @@ namespace nexo::renderer {
         MOCK_METHOD(void, bind, (), (const, override));
         MOCK_METHOD(void, unbind, (), (const, override));
         MOCK_METHOD(void, setData, (unsigned int*, size_t), (override));
+        MOCK_METHOD(void, setSubData, (const unsigned int*, size_t, size_t), (override));
         MOCK_METHOD(size_t, getCount, (), (const, override));
         MOCK_METHOD(unsigned int, getId, (), (const, override));
     };
@@ -150,6 +152,9 @@ namespace nexo::renderer {
         EXPECT_EQ(shaderDataTypeSize(NxShaderDataType::INT3), 12);
         EXPECT_EQ(shaderDataTypeSize(NxShaderDataType::INT4), 16);
         EXPECT_EQ(shaderDataTypeSize(NxShaderDataType::BOOL), 1);
+        EXPECT_EQ(shaderDataTypeSize(NxShaderDataType::HALF2), 4);
+        EXPECT_EQ(shaderDataTypeSize(NxShaderDataType::SHORT2), 4);
+        EXPECT_EQ(shaderDataTypeSize(NxShaderDataType::USHORT4), 8);
         EXPECT_EQ(shaderDataTypeSize(NxShaderDataType::NONE), 0);
     }
 
@@ -176,6 +181,9 @@ namespace nexo::renderer {
         EXPECT_EQ(NxBufferElements(NxShaderDataType::MAT3, "").getComponentCount(), 9);
         EXPECT_EQ(NxBufferElements(NxShaderDataType::MAT4, "").getComponentCount(), 16);
         EXPECT_EQ(NxBufferElements(NxShaderDataType::BOOL, "").getComponentCount(), 1);
+        EXPECT_EQ(NxBufferElements(NxShaderDataType::HALF2, "").getComponentCount(), 2);
+        EXPECT_EQ(NxBufferElements(NxShaderDataType::SHORT2, "").getComponentCount(), 2);
+        EXPECT_EQ(NxBufferElements(NxShaderDataType::USHORT4, "").getComponentCount(), 4);
         EXPECT_EQ(NxBufferElements(NxShaderDataType::NONE, "").getComponentCount(), 0);
     }
 
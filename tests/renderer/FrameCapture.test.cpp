@@ -0,0 +1,373 @@
+//// FrameCapture /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the frame capture and replay
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <gtest/gtest.h>
+
+#include "FrameCapture.hpp"
+#include "GraphicsApi.hpp"
+#include "RenderCommand.hpp"
+#include "RendererExceptions.hpp"
+#include "RenderTargetPool.hpp"
+#include "Renderer3D.hpp"
+#include "ShaderLibrary.hpp"
+#include "headless/HeadlessCommandLog.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nexo::renderer {
+
+    class FrameCaptureTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                m_previousApi = NxGetGraphicsApi();
+                NxSetGraphicsApi(NxGraphicsApi::HEADLESS);
+                NxRenderCommand::init();
+                NxRenderTargetPool::get().clear();
+                NxHeadlessCommandLog::get().clear();
+                resetDrawCommandStats();
+
+                m_shader = NxShader::create("Capture shader", vertexSource, fragmentSource);
+                m_vao = createVertexArray();
+                const auto vertexBuffer = createVertexBuffer(4 * 12);
+                vertexBuffer->setLayout({{NxShaderDataType::FLOAT3, "aPos"}});
+                m_vao->addVertexBuffer(vertexBuffer);
+                std::vector<unsigned int> indices = {0, 1, 2, 2, 3, 0};
+                const auto indexBuffer = createIndexBuffer();
+                indexBuffer->setData(indices.data(), indices.size());
+                m_vao->setIndexBuffer(indexBuffer);
+                m_texture = NxTexture2D::create(8, 4);
+
+                m_pipeline.addRenderPass(std::make_shared<DrawPass>(3, "Draw"));
+                NxFramebufferSpecs specs;
+                specs.width = 32;
+                specs.height = 16;
+                specs.attachments = {NxFrameBufferTextureFormats::RGBA8};
+                m_pipeline.setRenderTarget(NxFramebuffer::create(specs));
+                m_pipeline.setCameraClearColor({0.1f, 0.2f, 0.3f, 1.0f});
+                m_pipeline.setViewUniform("uViewProjection", glm::mat4(2.0f));
+
+                auto shared = std::make_shared<SharedDrawCommands>();
+                DrawCommand command;
+                command.vao = m_vao;
+                command.shader = m_shader;
+                command.range = {3, 3, 0};
+                command.setUniform("uMatModel", glm::mat4(1.0f));
+                command.setUniform("uTint", glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
+                shared->commands.push_back(command);
+                DrawBatch &batch = shared->batches.emplace_back();
+                batch.vao = m_vao;
+                batch.shader = m_shader;
+                batch.albedoTexIndex = 2;
+                batch.specularTexIndex = 3;
+                batch.draws = {{3, 1, 0, 0, 0}, {3, 1, 3, 0, 1}};
+                shared->objects.resize(2);
+                shared->objects[1].info.z = 42;
+                m_pipeline.setSharedDrawCommands(shared);
+
+                DrawCommand fullscreen;
+                fullscreen.type = CommandType::FULL_SCREEN;
+                fullscreen.shader = m_shader;
+                m_pipeline.addDrawCommand(fullscreen);
+
+                const std::vector<NxPointLightData> pointLights(2);
+                const std::vector<NxLightCluster> clusters(NX_CLUSTER_COUNT, NxLightCluster{0, 2, 0, 0});
+                const std::vector<uint32_t> lightIndices = {0, 1};
+                m_pipeline.getLightClusters().restore(pointLights, {}, clusters, lightIndices, {1.5f, -2.0f});
+            }
+
+            void TearDown() override
+            {
+                NxRenderTargetPool::get().clear();
+                NxHeadlessCommandLog::get().clear();
+                NxSetGraphicsApi(m_previousApi);
+            }
+
+            // Packet of the frame built in the pipeline, like the one the application submits
+            NxRenderPacket buildPacket()
+            {
+                NxRenderPacket packet;
+                packet.addView(m_pipeline);
+                packet.textures = {m_texture};
+                return packet;
+            }
+
+            class DrawPass final : public RenderPass {
+                public:
+                    DrawPass(const PassId id, std::string name) : RenderPass(id, std::move(name)) {}
+
+                    void execute(RenderPipeline &pipeline) override
+                    {
+                        pipeline.getRenderTarget()->bind();
+                        pipeline.executeDrawCommands(0xFFFFFFFF);
+                        pipeline.getRenderTarget()->unbind();
+                    }
+            };
+
+            static constexpr auto vertexSource =
+                "#version 430 core\n"
+                "layout(location = 0) in vec3 aPos;\n"
+                "uniform mat4 uViewProjection;\n"
+                "uniform mat4 uMatModel;\n"
+                "void main() { gl_Position = uViewProjection * uMatModel * vec4(aPos, 1.0); }\n";
+
+            static constexpr auto fragmentSource =
+                "#version 430 core\n"
+                "uniform vec4 uTint;\n"
+                "uniform int uBatchAlbedoTex;\n"
+                "uniform int uBatchSpecularTex;\n"
+                "out vec4 color;\n"
+                "void main() { color = uTint * float(1 + uBatchAlbedoTex + uBatchSpecularTex); }\n";
+
+            RenderPipeline m_pipeline;
+            std::shared_ptr<NxShader> m_shader;
+            std::shared_ptr<NxVertexArray> m_vao;
+            std::shared_ptr<NxTexture2D> m_texture;
+
+        private:
+            NxGraphicsApi m_previousApi = NxGraphicsApi::HEADLESS;
+    };
+
+    TEST_F(FrameCaptureTest, RecordsThePacket)
+    {
+        const NxRenderPacket packet = buildPacket();
+        const NxFrameCapture capture = NxFrameCapture::record(packet);
+
+        ASSERT_EQ(capture.shaders.size(), 1u);
+        EXPECT_EQ(capture.shaders[0], "Capture shader");
+        ASSERT_EQ(capture.meshes.size(), 1u);
+        EXPECT_EQ(capture.meshes[0].id, m_vao->getId());
+        EXPECT_EQ(capture.meshes[0].indexCount, 6u);
+        ASSERT_EQ(capture.meshes[0].layouts.size(), 1u);
+        EXPECT_EQ(capture.meshes[0].layouts[0][0].name, "aPos");
+        ASSERT_EQ(capture.textures.size(), 1u);
+        EXPECT_EQ(capture.textures[0].width, 8u);
+        EXPECT_EQ(capture.textureSlots, std::vector<int32_t>{0});
+
+        ASSERT_EQ(capture.sharedLists.size(), 1u);
+        const auto &list = capture.sharedLists[0];
+        ASSERT_EQ(list.commands.size(), 1u);
+        EXPECT_EQ(list.commands[0].range.firstIndex, 3u);
+        // Uniforms are sorted by name
+        ASSERT_EQ(list.commands[0].uniforms.size(), 2u);
+        EXPECT_EQ(list.commands[0].uniforms[0].name, "uMatModel");
+        ASSERT_EQ(list.batches.size(), 1u);
+        EXPECT_EQ(list.batches[0].draws.size(), 2u);
+        EXPECT_EQ(list.batches[0].albedoTexIndex, 2);
+        EXPECT_EQ(list.batches[0].specularTexIndex, 3);
+        EXPECT_EQ(list.objects[1].info.z, 42);
+
+        ASSERT_EQ(capture.views.size(), 1u);
+        const auto &view = capture.views[0];
+        ASSERT_EQ(view.passes.size(), 1u);
+        EXPECT_EQ(view.passes[0].id, 3u);
+        EXPECT_EQ(view.passes[0].name, "Draw");
+        EXPECT_EQ(view.finalOutputPass, 3);
+        EXPECT_EQ(view.renderTarget.width, 32u);
+        EXPECT_EQ(view.clearColor, glm::vec4(0.1f, 0.2f, 0.3f, 1.0f));
+        EXPECT_EQ(view.viewUniforms.size(), 1u);
+        ASSERT_EQ(view.drawCommands.size(), 1u);
+        EXPECT_EQ(view.drawCommands[0].type, CommandType::FULL_SCREEN);
+        EXPECT_EQ(view.drawCommands[0].mesh, -1);
+        EXPECT_EQ(view.sharedList, 0);
+        EXPECT_EQ(view.pointLights.size(), 2u);
+        EXPECT_EQ(view.clusters.size(), NX_CLUSTER_COUNT);
+        EXPECT_EQ(view.depthParams, glm::vec2(1.5f, -2.0f));
+    }
+
+    TEST_F(FrameCaptureTest, SharedListsAreRecordedOnce)
+    {
+        RenderPipeline other;
+        other.addRenderPass(std::make_shared<DrawPass>(0, "Other"));
+        other.setSharedDrawCommands(m_pipeline.getSharedDrawCommands());
+
+        NxRenderPacket packet = buildPacket();
+        packet.addView(other);
+        const NxFrameCapture capture = NxFrameCapture::record(packet);
+
+        ASSERT_EQ(capture.views.size(), 2u);
+        EXPECT_EQ(capture.sharedLists.size(), 1u);
+        EXPECT_EQ(capture.views[1].sharedList, 0);
+        EXPECT_EQ(capture.meshes.size(), 1u);
+    }
+
+    TEST_F(FrameCaptureTest, BytesRoundTrip)
+    {
+        NxFrameCapture capture = NxFrameCapture::record(buildPacket());
+        capture.annotateMesh(m_vao->getId(), {3, 0, 0}, "mesh-asset");
+        capture.annotateTexture(m_texture->getId(), "texture-asset");
+        const auto bytes = capture.toBytes();
+
+        const NxFrameCapture loaded = NxFrameCapture::fromBytes(bytes);
+        EXPECT_EQ(loaded.toBytes(), bytes);
+        ASSERT_EQ(loaded.meshAssets.size(), 1u);
+        EXPECT_EQ(loaded.meshAssets[0].assetId, "mesh-asset");
+        EXPECT_EQ(loaded.textures[0].assetId, "texture-asset");
+        EXPECT_EQ(std::get<glm::vec4>(loaded.sharedLists[0].commands[0].uniforms[1].value),
+                  glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
+    }
+
+    TEST_F(FrameCaptureTest, AnnotationsOfResourcesNotDrawnAreIgnored)
+    {
+        NxFrameCapture capture = NxFrameCapture::record(buildPacket());
+        capture.annotateMesh(m_vao->getId() + 100, {}, "unused-mesh");
+        capture.annotateTexture(m_texture->getId() + 100, "unused-texture");
+
+        EXPECT_TRUE(capture.meshAssets.empty());
+        EXPECT_TRUE(capture.textures[0].assetId.empty());
+    }
+
+    TEST_F(FrameCaptureTest, InvalidDataIsRejected)
+    {
+        const auto bytes = NxFrameCapture::record(buildPacket()).toBytes();
+
+        for (const size_t size : {size_t{0}, size_t{4}, bytes.size() / 2, bytes.size() - 1})
+            EXPECT_THROW(static_cast<void>(NxFrameCapture::fromBytes(std::span(bytes).first(size))), NxInvalidValue);
+
+        auto wrongMagic = bytes;
+        wrongMagic[0] = std::byte{'X'};
+        EXPECT_THROW(static_cast<void>(NxFrameCapture::fromBytes(wrongMagic)), NxInvalidValue);
+
+        auto trailing = bytes;
+        trailing.push_back(std::byte{0});
+        EXPECT_THROW(static_cast<void>(NxFrameCapture::fromBytes(trailing)), NxInvalidValue);
+    }
+
+    TEST_F(FrameCaptureTest, SaveAndLoad)
+    {
+        const NxFrameCapture capture = NxFrameCapture::record(buildPacket());
+        const auto path = std::filesystem::temp_directory_path() / "nexo_frame_capture_test.nxfc";
+        capture.save(path);
+
+        EXPECT_EQ(NxFrameCapture::load(path).toBytes(), capture.toBytes());
+        std::filesystem::remove(path);
+        EXPECT_THROW(static_cast<void>(NxFrameCapture::load(path)), NxFileNotFoundException);
+    }
+
+    TEST_F(FrameCaptureTest, ReplaySubmitsTheCapturedDraws)
+    {
+        const NxFrameCapture capture = NxFrameCapture::fromBytes(NxFrameCapture::record(buildPacket()).toBytes());
+        NxFrameReplay replay(capture, nullptr, [this](const std::string &name) {
+            return name == m_shader->getName() ? m_shader : nullptr;
+        });
+
+        NxHeadlessCommandLog::get().setRecording(true);
+        const NxFrameReplayStats stats = replay.run(3);
+        NxHeadlessCommandLog::get().setRecording(false);
+
+        EXPECT_EQ(stats.iterations, 3u);
+        EXPECT_LE(stats.minTime, stats.maxTime);
+        // One command, one batch and the full screen command per frame
+        EXPECT_EQ(stats.drawStats.drawCalls, 9u);
+        const auto &log = NxHeadlessCommandLog::get().getStats();
+        EXPECT_EQ(log.indirectDraws, 6u);
+        EXPECT_EQ(log.indices, 9u);
+        EXPECT_EQ(log.vertices, 18u);
+        // The batch selects its textures with uniforms, its draws must index the sampler array the same way
+        const auto &commands = NxHeadlessCommandLog::get().getCommands();
+        for (const std::string_view name : {"uBatchAlbedoTex", "uBatchSpecularTex"}) {
+            EXPECT_TRUE(std::ranges::any_of(commands, [name](const NxHeadlessCommand &command) {
+                return command.type == NxHeadlessCommandType::SET_UNIFORM && command.name == name;
+            })) << name;
+        }
+    }
+
+    TEST_F(FrameCaptureTest, StreamedCommandsKeepTheirGeometry)
+    {
+        // Streamed commands are drawn through the rings of the 3D renderer, which sets up its textured shaders
+        auto &library = ShaderLibrary::getInstance();
+        for (const char *name : {"Phong", "Outline pulse transparent flat", "Albedo unshaded transparent"})
+            library.add(name, NxShader::create(name, vertexSource, fragmentSource));
+        NxRenderer3D::get().init();
+
+        DrawCommand streamed;
+        streamed.type = CommandType::STREAMED;
+        streamed.shader = m_shader;
+        streamed.vertices.resize(4);
+        streamed.vertices[2].entityID = 7;
+        streamed.indices = {0, 1, 2, 2, 3, 0};
+        m_pipeline.addDrawCommand(streamed);
+
+        const NxFrameCapture capture = NxFrameCapture::fromBytes(NxFrameCapture::record(buildPacket()).toBytes());
+        ASSERT_EQ(capture.views[0].drawCommands.size(), 2u);
+        const auto &captured = capture.views[0].drawCommands[1];
+        EXPECT_EQ(captured.type, CommandType::STREAMED);
+        EXPECT_EQ(captured.mesh, -1);
+        ASSERT_EQ(captured.vertices.size(), 4u);
+        EXPECT_EQ(captured.vertices[2].entityID, 7);
+        EXPECT_EQ(captured.indices, (std::vector<unsigned int>{0, 1, 2, 2, 3, 0}));
+
+        NxFrameReplay replay(capture, nullptr, [this](const std::string &name) {
+            return name == m_shader->getName() ? m_shader : nullptr;
+        });
+        const NxFrameReplayStats stats = replay.run(2);
+
+        // The command, the batch, the full screen and the streamed commands each frame
+        EXPECT_EQ(stats.drawStats.drawCalls, 8u);
+        const auto &log = NxHeadlessCommandLog::get().getStats();
+        EXPECT_EQ(log.indices, 2u * (3u + 6u));
+        EXPECT_EQ(log.fenceWaits, 0u);
+
+        NxFrameCapture outOfRange = capture;
+        outOfRange.views[0].drawCommands[1].indices.push_back(4);
+        EXPECT_THROW(static_cast<void>(NxFrameCapture::fromBytes(outOfRange.toBytes())), NxInvalidValue);
+        NxRenderer3D::get().shutdown();
+    }
+
+    TEST_F(FrameCaptureTest, ReplayIsDeterministic)
+    {
+        const NxFrameCapture capture = NxFrameCapture::record(buildPacket());
+        auto &log = NxHeadlessCommandLog::get();
+
+        // Unknown shaders are replaced by a stand-in program
+        NxFrameReplay replay(capture, nullptr, [](const std::string &) { return nullptr; });
+        replay.run(1);
+        log.clear();
+        replay.run(1);
+        const NxHeadlessStats first = log.getStats();
+        log.clear();
+        replay.run(1);
+
+        EXPECT_EQ(log.getStats(), first);
+        EXPECT_GT(first.drawCalls, 0u);
+    }
+
+    TEST_F(FrameCaptureTest, ReplayUsesThePassFactory)
+    {
+        const NxFrameCapture capture = NxFrameCapture::record(buildPacket());
+        std::vector<std::string> created;
+        NxFrameReplay replay(capture, [&](const NxFrameCapture::Pass &pass) -> std::shared_ptr<RenderPass> {
+            created.push_back(pass.name);
+            return std::make_shared<DrawPass>(pass.id, pass.name);
+        }, [this](const std::string &) { return m_shader; });
+
+        replay.run(1);
+
+        EXPECT_EQ(created, std::vector<std::string>{"Draw"});
+        // The pass of the factory does not clear, unlike the generic one
+        EXPECT_EQ(NxHeadlessCommandLog::get().getStats().clears, 0u);
+    }
+
+}
@@ -462,4 +462,39 @@ namespace nexo::renderer {
         framebuffer.unbind();
     }
 
+    TEST_F(OpenGLTest, ReadPixelsAsyncRedIntegerAttachment) {
+        NxFramebufferSpecs specs;
+        specs.width = 100;
+        specs.height = 100;
+        specs.samples = 1;
+        specs.attachments.attachments = {
+            { NxFrameBufferTextureFormats::RGBA8 },
+            { NxFrameBufferTextureFormats::RED_INTEGER }
+        };
+
+        NxOpenGlFramebuffer framebuffer(specs);
+        framebuffer.bind();
+        int clearValue = 31;
+        framebuffer.clearAttachmentWrapper(1, &clearValue, typeid(int));
+        framebuffer.unbind();
+
+        NxPixelReadback result;
+        // The region is clipped to the framebuffer
+        framebuffer.readPixelsAsync(1, 90, 95, 20, 20, [&result](const NxPixelReadback &readback) {
+            result = readback;
+        });
+        EXPECT_EQ(framebuffer.getPendingPixelReads(), 1u);
+        framebuffer.pollPixelReads(true);
+        EXPECT_EQ(framebuffer.getPendingPixelReads(), 0u);
+
+        ASSERT_EQ(result.width, 10u);
+        ASSERT_EQ(result.height, 5u);
+        ASSERT_EQ(result.pixels.size(), 50u);
+        for (const int pixel : result.pixels)
+            EXPECT_EQ(pixel, clearValue);
+
+        EXPECT_THROW(framebuffer.readPixelsAsync(0, 0, 0, 1, 1, nullptr), NxFramebufferUnsupportedColorFormat);
+        EXPECT_THROW(framebuffer.readPixelsAsync(2, 0, 0, 1, 1, nullptr), NxFramebufferInvalidIndex);
+    }
+
 }
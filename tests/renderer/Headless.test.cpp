@@ -0,0 +1,293 @@
+//// Headless.test.cpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the headless renderer backend
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "GraphicsApi.hpp"
+#include "RenderCommand.hpp"
+#include "RendererExceptions.hpp"
+#include "headless/HeadlessCommandLog.hpp"
+#include "headless/HeadlessFramebuffer.hpp"
+#include "headless/HeadlessRendererApi.hpp"
+#include "headless/HeadlessShader.hpp"
+#include "headless/HeadlessTexture2D.hpp"
+#include "headless/HeadlessVertexArray.hpp"
+#include "headless/HeadlessWindow.hpp"
+
+namespace nexo::renderer {
+
+    class HeadlessTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                m_previousApi = NxGetGraphicsApi();
+                NxSetGraphicsApi(NxGraphicsApi::HEADLESS);
+                auto &log = NxHeadlessCommandLog::get();
+                log.clear();
+                log.setRecording(true);
+            }
+
+            void TearDown() override
+            {
+                auto &log = NxHeadlessCommandLog::get();
+                log.setRecording(false);
+                log.clear();
+                NxSetGraphicsApi(m_previousApi);
+            }
+
+            static constexpr std::string_view vertexSource =
+                "#version 430 core\n"
+                "layout(location = 0) in vec3 aPos;\n"
+                "layout(location = 2) in vec2 aTexCoord;\n"
+                "uniform mat4 uViewProjection; // camera\n"
+                "uniform mat4 uMatModel;\n"
+                "void main() { gl_Position = uViewProjection * uMatModel * vec4(aPos, 1.0); }\n";
+
+            static constexpr std::string_view fragmentSource =
+                "#version 430 core\n"
+                "#define MAX_POINT_LIGHTS 2\n"
+                "struct PointLight {\n"
+                "    vec3 position;\n"
+                "    vec4 color;\n"
+                "};\n"
+                "uniform PointLight uPointLights[MAX_POINT_LIGHTS];\n"
+                "uniform sampler2D uTexture[4];\n"
+                "uniform int uNbPointLights;\n"
+                "/* uniform float uCommented; */\n"
+                "out vec4 color;\n"
+                "void main() { color = vec4(1.0); }\n";
+
+        private:
+            NxGraphicsApi m_previousApi = NxGraphicsApi::HEADLESS;
+    };
+
+    TEST_F(HeadlessTest, FactoriesReturnHeadlessObjects)
+    {
+        EXPECT_NE(std::dynamic_pointer_cast<NxHeadlessVertexArray>(createVertexArray()), nullptr);
+        EXPECT_NE(std::dynamic_pointer_cast<NxHeadlessWindow>(NxWindow::create(320, 240, "headless")), nullptr);
+        EXPECT_NE(std::dynamic_pointer_cast<NxHeadlessTexture2D>(NxTexture2D::create(4, 4)), nullptr);
+        EXPECT_NE(std::dynamic_pointer_cast<NxHeadlessShader>(
+            NxShader::create("test", std::string(vertexSource), std::string(fragmentSource))), nullptr);
+    }
+
+    TEST_F(HeadlessTest, ShaderReflectsUniformsAndAttributes)
+    {
+        const NxHeadlessShader shader("test", vertexSource, fragmentSource);
+
+        EXPECT_TRUE(shader.hasUniform("uViewProjection"));
+        EXPECT_TRUE(shader.hasUniform("uMatModel"));
+        EXPECT_TRUE(shader.hasUniform("uNbPointLights"));
+        EXPECT_TRUE(shader.hasUniform("uPointLights[0].position"));
+        EXPECT_TRUE(shader.hasUniform("uPointLights[1].color"));
+        EXPECT_FALSE(shader.hasUniform("uPointLights[2].color"));
+        EXPECT_TRUE(shader.hasUniform("uTexture"));
+        EXPECT_TRUE(shader.hasUniform("uTexture[3]"));
+        EXPECT_FALSE(shader.hasUniform("uCommented"));
+
+        EXPECT_TRUE(shader.hasAttribute(0));
+        EXPECT_TRUE(shader.hasAttribute(2));
+        EXPECT_FALSE(shader.hasAttribute(1));
+
+        RequiredAttributes meshAttributes;
+        meshAttributes.bitsUnion.flags.position = true;
+        meshAttributes.bitsUnion.flags.uv0 = true;
+        EXPECT_TRUE(shader.isCompatibleWithMesh(meshAttributes));
+        meshAttributes.bitsUnion.flags.normal = true;
+        EXPECT_FALSE(shader.isCompatibleWithMesh(meshAttributes));
+    }
+
+    TEST_F(HeadlessTest, UniformCacheFiltersRedundantUploads)
+    {
+        const NxHeadlessShader shader("test", vertexSource, fragmentSource);
+        const auto &log = NxHeadlessCommandLog::get();
+
+        EXPECT_TRUE(shader.setUniformInt("uNbPointLights", 2));
+        EXPECT_TRUE(shader.setUniformInt("uNbPointLights", 2));
+        EXPECT_TRUE(shader.setUniformInt("uNbPointLights", 3));
+        EXPECT_FALSE(shader.setUniformFloat("uUnknown", 1.0f));
+        EXPECT_TRUE(shader.setUniformMatrix(NxShaderUniforms::MODEL_MATRIX, glm::mat4(1.0f)));
+
+        EXPECT_EQ(log.count(NxHeadlessCommandType::SET_UNIFORM), 3);
+        EXPECT_EQ(log.getStats().uniformUploads, 3);
+        EXPECT_EQ(log.getCommands().back().name, "uMatModel");
+    }
+
+    TEST_F(HeadlessTest, RendererApiRecordsDrawsAndState)
+    {
+        NxHeadlessRendererApi api;
+        EXPECT_THROW(api.clear(), NxGraphicsApiNotInitialized);
+        api.init();
+
+        const auto vertexArray = createVertexArray();
+        const auto vertexBuffer = createVertexBuffer(64);
+        vertexBuffer->setLayout({{NxShaderDataType::FLOAT3, "aPos"}});
+        vertexArray->addVertexBuffer(vertexBuffer);
+        const auto indexBuffer = createIndexBuffer();
+        std::vector<unsigned int> indices = {0, 1, 2, 2, 3, 0};
+        indexBuffer->setData(indices.data(), indices.size());
+        vertexArray->setIndexBuffer(indexBuffer);
+
+        api.clear();
+        api.setDepthTest(true);
+        vertexArray->bind();
+        api.drawIndexed(vertexArray);
+        api.drawIndexed(vertexArray, 3);
+        api.drawUnIndexed(36);
+        EXPECT_THROW(api.setViewport(0, 0, 0, 600), NxGraphicsApiViewportResizingFailure);
+
+        const auto &stats = NxHeadlessCommandLog::get().getStats();
+        EXPECT_EQ(stats.clears, 1);
+        EXPECT_EQ(stats.stateChanges, 1);
+        EXPECT_EQ(stats.drawCalls, 3);
+        EXPECT_EQ(stats.indices, 9);
+        EXPECT_EQ(stats.vertices, 36);
+        EXPECT_EQ(stats.vertexArrayBinds, 1);
+        EXPECT_EQ(stats.bufferUploads, 1);
+        EXPECT_EQ(stats.uploadedBytes, indices.size() * sizeof(unsigned int));
+    }
+
+    TEST_F(HeadlessTest, WindowClockIsDeterministic)
+    {
+        NxHeadlessWindow window(800, 600, "headless");
+        window.init();
+        EXPECT_DOUBLE_EQ(window.getTime(), 0.0);
+        window.setTimeStep(0.5);
+        window.onUpdate();
+        window.onUpdate();
+        EXPECT_DOUBLE_EQ(window.getTime(), 1.0);
+
+        const auto &log = NxHeadlessCommandLog::get();
+        EXPECT_EQ(log.getStats().frames, 2);
+        EXPECT_EQ(log.count(NxHeadlessCommandType::END_FRAME), 2);
+
+        bool closed = false;
+        window.setCloseCallback([&closed] { closed = true; });
+        EXPECT_TRUE(window.isOpen());
+        window.close();
+        EXPECT_FALSE(window.isOpen());
+        EXPECT_TRUE(closed);
+    }
+
+    TEST_F(HeadlessTest, FrameStatsAreResetOnEndFrame)
+    {
+        NxHeadlessRendererApi api;
+        api.init();
+        auto &log = NxHeadlessCommandLog::get();
+
+        api.drawUnIndexed(3);
+        api.drawUnIndexed(3);
+        EXPECT_EQ(log.getFrameStats().drawCalls, 2);
+        log.endFrame();
+        EXPECT_EQ(log.getFrameStats().drawCalls, 0);
+        EXPECT_EQ(log.getLastFrameStats().drawCalls, 2);
+        api.drawUnIndexed(3);
+        log.endFrame();
+        EXPECT_EQ(log.getLastFrameStats().drawCalls, 1);
+        EXPECT_EQ(log.getStats().drawCalls, 3);
+    }
+
+    TEST_F(HeadlessTest, FramebufferReadsBackClearValues)
+    {
+        NxFramebufferSpecs specs;
+        specs.width = 800;
+        specs.height = 600;
+        specs.attachments.attachments = {
+            {NxFrameBufferTextureFormats::RGBA8},
+            {NxFrameBufferTextureFormats::RED_INTEGER},
+            {NxFrameBufferTextureFormats::DEPTH24STENCIL8}
+        };
+        NxHeadlessFramebuffer framebuffer(specs);
+
+        EXPECT_EQ(framebuffer.getNbColorAttachments(), 2);
+        EXPECT_TRUE(framebuffer.hasDepthAttachment());
+        EXPECT_NE(framebuffer.getColorAttachmentId(0), framebuffer.getColorAttachmentId(1));
+
+        framebuffer.clearAttachment<int>(1, 42);
+        EXPECT_EQ(framebuffer.getPixel<int>(1, 10, 10), 42);
+        framebuffer.clearAttachment<int>(1, -1);
+        EXPECT_EQ(framebuffer.getPixel<int>(1, 799, 599), -1);
+        EXPECT_THROW(framebuffer.clearAttachment<int>(2, 0), NxFramebufferInvalidIndex);
+
+        framebuffer.resize(1024, 768);
+        EXPECT_EQ(framebuffer.getSize(), glm::vec2(1024, 768));
+        EXPECT_THROW(framebuffer.resize(0, 768), NxFramebufferResizingFailed);
+        EXPECT_THROW(framebuffer.resize(9000, 768), NxFramebufferResizingFailed);
+    }
+
+    TEST_F(HeadlessTest, FramebufferReadsPixelsAsynchronously)
+    {
+        NxFramebufferSpecs specs;
+        specs.width = 64;
+        specs.height = 64;
+        specs.attachments.attachments = {
+            {NxFrameBufferTextureFormats::RGBA8},
+            {NxFrameBufferTextureFormats::RED_INTEGER}
+        };
+        NxHeadlessFramebuffer framebuffer(specs);
+        framebuffer.clearAttachment<int>(1, 7);
+        auto &log = NxHeadlessCommandLog::get();
+        const auto before = log.getStats();
+
+        std::vector<NxPixelReadback> results;
+        framebuffer.readPixelsAsync(1, 60, -2, 8, 4, [&results](const NxPixelReadback &readback) {
+            results.push_back(readback);
+        });
+        int picked = 0;
+        framebuffer.readPixelAsync(1, 10, 10, [&picked](const int value) { picked = value; });
+        EXPECT_TRUE(results.empty());
+        EXPECT_EQ(framebuffer.getPendingPixelReads(), 2u);
+
+        framebuffer.pollPixelReads();
+        EXPECT_EQ(framebuffer.getPendingPixelReads(), 0u);
+        ASSERT_EQ(results.size(), 1u);
+        EXPECT_EQ(results[0].x, 60);
+        EXPECT_EQ(results[0].y, 0);
+        EXPECT_EQ(results[0].width, 4u);
+        EXPECT_EQ(results[0].height, 2u);
+        EXPECT_EQ(results[0].at(3, 1), 7);
+        EXPECT_EQ(picked, 7);
+
+        // Regions outside of the framebuffer complete right away
+        framebuffer.readPixelAsync(1, 100, 100, [&picked](const int value) { picked = value; });
+        EXPECT_EQ(picked, -1);
+
+        const auto after = log.getStats();
+        EXPECT_EQ(after.asyncPixelReads - before.asyncPixelReads, 2u);
+        EXPECT_EQ(after.pixelReadStalls, before.pixelReadStalls);
+        EXPECT_THROW(framebuffer.readPixelsAsync(0, 0, 0, 1, 1, nullptr), NxFramebufferUnsupportedColorFormat);
+    }
+
+    TEST_F(HeadlessTest, TextureValidatesAndRecordsUploads)
+    {
+        std::vector<uint8_t> pixels(4 * 4 * 4, 0xFF);
+        NxHeadlessTexture2D texture(pixels.data(), 4, 4, NxTextureFormat::RGBA8);
+        EXPECT_EQ(texture.getWidth(), 4);
+        EXPECT_EQ(texture.getHeight(), 4);
+
+        EXPECT_THROW(texture.setData(pixels.data(), 12), NxTextureSizeMismatch);
+        EXPECT_THROW(NxHeadlessTexture2D(20000, 4), NxTextureInvalidSize);
+        EXPECT_THROW(NxHeadlessTexture2D("does/not/exist.png"), NxFileNotFoundException);
+
+        texture.bind(3);
+        const auto &log = NxHeadlessCommandLog::get();
+        EXPECT_EQ(log.count(NxHeadlessCommandType::UPLOAD_TEXTURE), 1);
+        EXPECT_EQ(log.getCommands().back().type, NxHeadlessCommandType::BIND_TEXTURE);
+        EXPECT_EQ(log.getCommands().back().value, 3);
+    }
+
+}
@@ -0,0 +1,179 @@
+//// LightClusters.test.cpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the clustered light assignment
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "GraphicsApi.hpp"
+#include "LightClusters.hpp"
+#include "headless/HeadlessCommandLog.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace nexo::renderer {
+
+    class LightClustersTest : public ::testing::Test {
+        protected:
+            // Camera at the origin looking down -Z
+            const glm::mat4 m_view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+            const glm::mat4 m_projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+
+            static NxPointLightData pointLight(const glm::vec3 &position, const float range)
+            {
+                return {glm::vec4(position, range), glm::vec4(1.0f), glm::vec4(1.0f, 0.09f, 0.032f, 0.0f)};
+            }
+
+            static NxSpotLightData spotLight(const glm::vec3 &position, const glm::vec3 &direction, const float range)
+            {
+                const float outerCutoff = glm::cos(glm::radians(15.0f));
+                return {glm::vec4(position, range), glm::vec4(direction, glm::cos(glm::radians(12.5f))),
+                        glm::vec4(1.0f), glm::vec4(1.0f, 0.09f, 0.032f, outerCutoff)};
+            }
+
+            static std::vector<uint32_t> pointLightsOf(const NxLightClusterGrid &grid, const int clusterIndex)
+            {
+                const auto &cluster = grid.getClusters()[clusterIndex];
+                const auto &indices = grid.getLightIndices();
+                return {indices.begin() + cluster.offset, indices.begin() + cluster.offset + cluster.pointCount};
+            }
+
+            static std::vector<uint32_t> spotLightsOf(const NxLightClusterGrid &grid, const int clusterIndex)
+            {
+                const auto &cluster = grid.getClusters()[clusterIndex];
+                const auto &indices = grid.getLightIndices();
+                const auto begin = indices.begin() + cluster.offset + cluster.pointCount;
+                return {begin, begin + cluster.spotCount};
+            }
+    };
+
+    TEST_F(LightClustersTest, AssignsPointLightsToTheClustersTheyReach)
+    {
+        NxLightClusterGrid grid;
+        const std::vector lights = {
+            pointLight({0.0f, 0.0f, -10.0f}, 2.0f),
+            pointLight({0.0f, 0.0f, 10.0f}, 2.0f),     // Behind the camera
+            pointLight({5.0f, 1.0f, -30.0f}, 4.0f)
+        };
+        grid.build(m_view, m_projection, 0.1f, 100.0f, lights, {});
+
+        // The light behind the camera reaches no cluster and is dropped
+        ASSERT_EQ(grid.getPointLights().size(), 2u);
+        EXPECT_EQ(grid.getPointLights()[1].position, lights[2].position);
+
+        const int center = grid.getClusterIndex({0.0f, 0.0f, -10.0f});
+        ASSERT_GE(center, 0);
+        EXPECT_EQ(pointLightsOf(grid, center), std::vector<uint32_t>{0});
+        const int farAway = grid.getClusterIndex({0.0f, 0.0f, -90.0f});
+        ASSERT_GE(farAway, 0);
+        EXPECT_TRUE(pointLightsOf(grid, farAway).empty());
+        EXPECT_EQ(grid.getClusterIndex({0.0f, 0.0f, 5.0f}), -1);
+
+        const int second = grid.getClusterIndex({5.0f, 1.0f, -30.0f});
+        ASSERT_GE(second, 0);
+        EXPECT_EQ(pointLightsOf(grid, second), std::vector<uint32_t>{1});
+    }
+
+    TEST_F(LightClustersTest, EveryLightReachesTheClusterOfItsCenter)
+    {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> xy(-20.0f, 20.0f);
+        std::uniform_real_distribution<float> z(-90.0f, -1.0f);
+        std::vector<NxPointLightData> lights;
+        for (int i = 0; i < 500; ++i)
+            lights.push_back(pointLight({xy(rng), xy(rng) * 0.5f, z(rng)}, 3.0f));
+
+        NxLightClusterGrid grid;
+        grid.build(m_view, m_projection, 0.1f, 100.0f, lights, {});
+
+        const auto &visible = grid.getPointLights();
+        size_t totalIndices = 0;
+        for (const auto &cluster : grid.getClusters())
+            totalIndices += cluster.pointCount + cluster.spotCount;
+        EXPECT_EQ(totalIndices, grid.getLightIndices().size());
+
+        for (uint32_t i = 0; i < visible.size(); ++i) {
+            const int cluster = grid.getClusterIndex(glm::vec3(visible[i].position));
+            if (cluster < 0)
+                continue;
+            const auto indices = pointLightsOf(grid, cluster);
+            EXPECT_NE(std::ranges::find(indices, i), indices.end());
+        }
+        // Each cluster only holds a small part of the lights
+        size_t maxPerCluster = 0;
+        for (const auto &cluster : grid.getClusters())
+            maxPerCluster = std::max<size_t>(maxPerCluster, cluster.pointCount);
+        EXPECT_LT(maxPerCluster, visible.size() / 4);
+    }
+
+    TEST_F(LightClustersTest, SpotLightsOnlyReachTheClustersInTheirCone)
+    {
+        NxLightClusterGrid grid;
+        // Looking away from the camera, down the -Z axis
+        const std::vector lights = {spotLight({0.0f, 0.0f, -5.0f}, {0.0f, 0.0f, -1.0f}, 30.0f)};
+        grid.build(m_view, m_projection, 0.1f, 100.0f, {}, lights);
+
+        ASSERT_EQ(grid.getSpotLights().size(), 1u);
+        const int inCone = grid.getClusterIndex({0.0f, 0.0f, -20.0f});
+        ASSERT_GE(inCone, 0);
+        EXPECT_EQ(spotLightsOf(grid, inCone), std::vector<uint32_t>{0});
+        // Within range but behind the light
+        const int behind = grid.getClusterIndex({0.0f, 0.0f, -1.0f});
+        ASSERT_GE(behind, 0);
+        EXPECT_TRUE(spotLightsOf(grid, behind).empty());
+        // Within range but far outside of the cone
+        const int aside = grid.getClusterIndex({8.0f, 0.0f, -10.0f});
+        ASSERT_GE(aside, 0);
+        EXPECT_TRUE(spotLightsOf(grid, aside).empty());
+    }
+
+    TEST_F(LightClustersTest, UploadsAndBindsTheStorageBuffers)
+    {
+        const NxGraphicsApi previousApi = NxGetGraphicsApi();
+        NxSetGraphicsApi(NxGraphicsApi::HEADLESS);
+        auto &log = NxHeadlessCommandLog::get();
+        log.clear();
+        log.setRecording(true);
+
+        NxLightClusterGrid grid;
+        grid.bind();
+        EXPECT_EQ(log.count(NxHeadlessCommandType::BIND_STORAGE_BUFFER), 0u);
+
+        const std::vector lights = {pointLight({0.0f, 0.0f, -10.0f}, 2.0f)};
+        grid.build(m_view, m_projection, 0.1f, 100.0f, lights, {});
+        grid.upload();
+        EXPECT_EQ(log.count(NxHeadlessCommandType::UPLOAD_BUFFER), 2u);
+        // Nothing new to upload
+        grid.upload();
+        EXPECT_EQ(log.count(NxHeadlessCommandType::UPLOAD_BUFFER), 2u);
+
+        grid.bind();
+        std::vector<uint64_t> bindings;
+        for (const auto &command : log.getCommands())
+            if (command.type == NxHeadlessCommandType::BIND_STORAGE_BUFFER)
+                bindings.push_back(command.value);
+        EXPECT_EQ(bindings, (std::vector<uint64_t>{NX_POINT_LIGHTS_BINDING, NX_SPOT_LIGHTS_BINDING,
+                                                   NX_LIGHT_CLUSTERS_BINDING}));
+
+        log.setRecording(false);
+        log.clear();
+        NxSetGraphicsApi(previousApi);
+    }
+
+}
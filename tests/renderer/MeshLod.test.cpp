@@ -0,0 +1,100 @@
+//// MeshLod.test.cpp /////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the mesh levels of detail
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <gtest/gtest.h>
+
+#include "MeshLod.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
+#include <vector>
+
+namespace nexo::renderer {
+
+    class MeshLodTest : public ::testing::Test {
+        protected:
+            // Errors of 0.01, 0.04 and 0.16 object units
+            std::vector<NxMeshLod> lods = {{nullptr, 0.01f}, {nullptr, 0.04f}, {nullptr, 0.16f}};
+
+            glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+            glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 1000.0f);
+
+            [[nodiscard]] float pixelScaleAt(const float distance, const float scale = 1.0f) const
+            {
+                glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -distance));
+                model = glm::scale(model, glm::vec3(scale));
+                return computeLodPixelScale(model, glm::vec3(-0.5f), glm::vec3(0.5f), view, projection, 1000.0f);
+            }
+    };
+
+    TEST_F(MeshLodTest, PixelScaleFollowsDistanceAndObjectScale)
+    {
+        // 90 degrees vertical field of view on 1000 pixels: 500 pixels per unit at one unit from the camera
+        const float radius = std::sqrt(3.0f) * 0.5f;
+        EXPECT_NEAR(pixelScaleAt(10.0f), 500.0f / (10.0f - radius), 1e-2f);
+        EXPECT_GT(pixelScaleAt(10.0f), pixelScaleAt(20.0f));
+        EXPECT_NEAR(pixelScaleAt(20.0f, 2.0f), 2.0f * 500.0f / (20.0f - 2.0f * radius), 1e-2f);
+    }
+
+    TEST_F(MeshLodTest, PixelScaleIsInfiniteInsideTheBounds)
+    {
+        EXPECT_TRUE(std::isinf(pixelScaleAt(0.2f)));
+        EXPECT_EQ(selectMeshLod(lods, pixelScaleAt(0.2f), 1.0f, 3), 0u);
+    }
+
+    TEST_F(MeshLodTest, OrthographicScaleIgnoresDistance)
+    {
+        const glm::mat4 ortho = glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 1000.0f);
+        const glm::mat4 closeModel = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -5.0f));
+        const glm::mat4 distantModel = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -500.0f));
+        const float nearScale = computeLodPixelScale(closeModel, glm::vec3(-0.5f), glm::vec3(0.5f), view, ortho, 1000.0f);
+        const float farScale = computeLodPixelScale(distantModel, glm::vec3(-0.5f), glm::vec3(0.5f), view, ortho, 1000.0f);
+        EXPECT_NEAR(nearScale, 50.0f, 1e-3f);
+        EXPECT_NEAR(farScale, 50.0f, 1e-3f);
+    }
+
+    TEST_F(MeshLodTest, PicksCoarsestLevelUnderThreshold)
+    {
+        EXPECT_EQ(selectMeshLod(lods, 200.0f, 1.0f, 0), 0u);   // 2 pixels at the first level
+        EXPECT_EQ(selectMeshLod(lods, 50.0f, 1.0f, 0), 1u);    // 0.5 then 2 pixels
+        EXPECT_EQ(selectMeshLod(lods, 10.0f, 1.0f, 0), 2u);    // 0.4 then 1.6 pixels
+        EXPECT_EQ(selectMeshLod(lods, 1.0f, 1.0f, 0), 3u);
+    }
+
+    TEST_F(MeshLodTest, ThresholdOrMissingLevelsDrawFullResolution)
+    {
+        EXPECT_EQ(selectMeshLod(lods, 1.0f, 0.0f, 3), 0u);
+        EXPECT_EQ(selectMeshLod({}, 1.0f, 1.0f, 2), 0u);
+    }
+
+    TEST_F(MeshLodTest, RefinesImmediatelyButCoarsensWithHysteresis)
+    {
+        // The first level projects to 0.9 pixels: under the threshold, but not by the hysteresis margin
+        EXPECT_EQ(selectMeshLod(lods, 90.0f, 1.0f, 0), 0u);
+        EXPECT_EQ(selectMeshLod(lods, 90.0f, 1.0f, 1), 1u);
+        EXPECT_EQ(selectMeshLod(lods, 70.0f, 1.0f, 0), 1u);
+        // Over the threshold the mesh refines right away, down to the coarsest acceptable level
+        EXPECT_EQ(selectMeshLod(lods, 110.0f, 1.0f, 1), 0u);
+        EXPECT_EQ(selectMeshLod(lods, 30.0f, 1.0f, 3), 1u);
+        // A previous level out of range is clamped to the coarsest one
+        EXPECT_EQ(selectMeshLod(lods, 1.0f, 1.0f, 10), 3u);
+    }
+
+}
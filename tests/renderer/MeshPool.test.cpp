@@ -0,0 +1,219 @@
+//// MeshPool /////////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the mesh pool and the multi draw indirect submission
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <gtest/gtest.h>
+
+#include "GraphicsApi.hpp"
+#include "MeshPool.hpp"
+#include "RendererExceptions.hpp"
+#include "headless/HeadlessCommandLog.hpp"
+#include "headless/HeadlessRendererApi.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace nexo::renderer {
+
+    class MeshPoolTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                m_previousApi = NxGetGraphicsApi();
+                NxSetGraphicsApi(NxGraphicsApi::HEADLESS);
+                NxMeshPool::get().clear();
+                NxHeadlessCommandLog::get().clear();
+            }
+
+            void TearDown() override
+            {
+                NxMeshPool::get().clear();
+                NxHeadlessCommandLog::get().clear();
+                NxSetGraphicsApi(m_previousApi);
+            }
+
+            static std::vector<std::byte> vertices(const NxVertexFormat format, const size_t count)
+            {
+                return std::vector<std::byte>(count * vertexFormatStride(format));
+            }
+
+            static std::vector<unsigned int> indices(const size_t count)
+            {
+                std::vector<unsigned int> result(count);
+                for (size_t i = 0; i < count; ++i)
+                    result[i] = static_cast<unsigned int>(i % 3);
+                return result;
+            }
+
+        private:
+            NxGraphicsApi m_previousApi = NxGraphicsApi::HEADLESS;
+    };
+
+    TEST(RangeAllocatorTest, AllocatesFirstFit)
+    {
+        NxRangeAllocator allocator(100);
+        EXPECT_EQ(allocator.allocate(30), 0u);
+        EXPECT_EQ(allocator.allocate(50), 30u);
+        EXPECT_EQ(allocator.allocate(30), std::nullopt);
+        EXPECT_EQ(allocator.allocate(0), std::nullopt);
+        EXPECT_EQ(allocator.allocate(20), 80u);
+        EXPECT_EQ(allocator.getUsed(), 100u);
+        EXPECT_EQ(allocator.getLargestFreeRange(), 0u);
+    }
+
+    TEST(RangeAllocatorTest, MergesFreedNeighbours)
+    {
+        NxRangeAllocator allocator(100);
+        const size_t a = *allocator.allocate(20);
+        const size_t b = *allocator.allocate(20);
+        const size_t c = *allocator.allocate(20);
+        ASSERT_TRUE(allocator.allocate(40).has_value());
+
+        allocator.free(a, 20);
+        allocator.free(c, 20);
+        EXPECT_EQ(allocator.getLargestFreeRange(), 20u);
+        // Freeing the middle range joins the three of them
+        allocator.free(b, 20);
+        EXPECT_EQ(allocator.getLargestFreeRange(), 60u);
+        EXPECT_EQ(allocator.getUsed(), 40u);
+        EXPECT_EQ(allocator.allocate(60), 0u);
+    }
+
+    TEST_F(MeshPoolTest, MeshesOfTheSameFormatShareAPage)
+    {
+        auto &pool = NxMeshPool::get();
+        const auto first = pool.allocate(NxVertexFormat::COMPACT, vertices(NxVertexFormat::COMPACT, 4), indices(6));
+        const auto second = pool.allocate(NxVertexFormat::COMPACT, vertices(NxVertexFormat::COMPACT, 8), indices(12));
+
+        EXPECT_EQ(pool.getPageCount(), 1u);
+        EXPECT_EQ(first->vao, second->vao);
+        EXPECT_EQ(first->range.indexCount, 6u);
+        EXPECT_EQ(first->range.firstIndex, 0u);
+        EXPECT_EQ(first->range.baseVertex, 0);
+        EXPECT_EQ(second->range.indexCount, 12u);
+        EXPECT_EQ(second->range.firstIndex, 6u);
+        EXPECT_EQ(second->range.baseVertex, 4);
+
+        // Other formats go to their own page
+        const auto standard = pool.allocate(NxVertexFormat::STANDARD, vertices(NxVertexFormat::STANDARD, 3), indices(3));
+        EXPECT_EQ(pool.getPageCount(), 2u);
+        EXPECT_NE(standard->vao, first->vao);
+    }
+
+    TEST_F(MeshPoolTest, ReleasedRangesAreReused)
+    {
+        auto &pool = NxMeshPool::get();
+        auto first = pool.allocate(NxVertexFormat::COMPACT, vertices(NxVertexFormat::COMPACT, 4), indices(6));
+        const auto second = pool.allocate(NxVertexFormat::COMPACT, vertices(NxVertexFormat::COMPACT, 4), indices(6));
+        EXPECT_EQ(pool.getStats().usedVertices, 8u);
+
+        first.reset();
+        EXPECT_EQ(pool.getStats().allocationCount, 1u);
+        EXPECT_EQ(pool.getStats().usedVertices, 4u);
+        EXPECT_EQ(pool.getStats().usedIndices, 6u);
+
+        const auto third = pool.allocate(NxVertexFormat::COMPACT, vertices(NxVertexFormat::COMPACT, 2), indices(3));
+        EXPECT_EQ(third->range.baseVertex, 0);
+        EXPECT_EQ(third->range.firstIndex, 0u);
+    }
+
+    TEST_F(MeshPoolTest, LevelsOfDetailReuseTheMeshVertices)
+    {
+        auto &pool = NxMeshPool::get();
+        const auto other = pool.allocate(NxVertexFormat::COMPACT, vertices(NxVertexFormat::COMPACT, 3), indices(3));
+        std::shared_ptr<const NxMeshAllocation> base =
+            pool.allocate(NxVertexFormat::COMPACT, vertices(NxVertexFormat::COMPACT, 10), indices(12));
+        auto lod = pool.allocateLod(base, indices(6));
+
+        ASSERT_NE(lod, nullptr);
+        EXPECT_EQ(lod->vao, base->vao);
+        EXPECT_EQ(lod->range.baseVertex, base->range.baseVertex);
+        EXPECT_EQ(lod->range.indexCount, 6u);
+        EXPECT_EQ(pool.getStats().usedVertices, 13u);
+
+        // The level keeps the vertices of the mesh alive
+        const int32_t baseVertex = base->range.baseVertex;
+        base.reset();
+        EXPECT_EQ(pool.getStats().usedVertices, 13u);
+        EXPECT_EQ(lod->range.baseVertex, baseVertex);
+        lod.reset();
+        EXPECT_EQ(pool.getStats().usedVertices, 3u);
+    }
+
+    TEST_F(MeshPoolTest, OversizedMeshesGetADedicatedPage)
+    {
+        auto &pool = NxMeshPool::get();
+        const size_t vertexCount = NxMeshPool::PAGE_VERTEX_CAPACITY + 1;
+        auto large = pool.allocate(NxVertexFormat::COMPACT, vertices(NxVertexFormat::COMPACT, vertexCount), indices(3));
+        EXPECT_EQ(pool.getStats().vertexCapacity, vertexCount);
+
+        // Small meshes never land in a dedicated page
+        const auto small = pool.allocate(NxVertexFormat::COMPACT, vertices(NxVertexFormat::COMPACT, 3), indices(3));
+        EXPECT_NE(small->vao, large->vao);
+        EXPECT_EQ(pool.getPageCount(), 2u);
+
+        large.reset();
+        EXPECT_EQ(pool.getPageCount(), 1u);
+    }
+
+    TEST_F(MeshPoolTest, RejectsInvalidMeshes)
+    {
+        auto &pool = NxMeshPool::get();
+        EXPECT_THROW(pool.allocate(NxVertexFormat::COMPACT, std::vector<std::byte>(5), indices(3)), NxInvalidValue);
+        EXPECT_THROW(pool.allocate(NxVertexFormat::COMPACT, vertices(NxVertexFormat::COMPACT, 3), {}), NxInvalidValue);
+        EXPECT_THROW((void)pool.allocateLod(nullptr, indices(3)), NxInvalidValue);
+    }
+
+    TEST_F(MeshPoolTest, AllocationsSurviveAClear)
+    {
+        auto &pool = NxMeshPool::get();
+        auto mesh = pool.allocate(NxVertexFormat::COMPACT, vertices(NxVertexFormat::COMPACT, 3), indices(3));
+        pool.clear();
+        EXPECT_EQ(pool.getPageCount(), 0u);
+        EXPECT_NE(mesh->vao, nullptr);
+        EXPECT_THROW((void)pool.allocateLod(mesh, indices(3)), NxInvalidValue);
+        // Releasing an allocation of a destroyed page is a no-op
+        mesh.reset();
+        EXPECT_EQ(pool.getStats().allocationCount, 0u);
+    }
+
+    TEST_F(MeshPoolTest, MultiDrawIndirectIsOneDrawCall)
+    {
+        NxHeadlessRendererApi api;
+        api.init();
+        ASSERT_TRUE(api.supportsMultiDrawIndirect());
+
+        auto &pool = NxMeshPool::get();
+        const auto first = pool.allocate(NxVertexFormat::COMPACT, vertices(NxVertexFormat::COMPACT, 4), indices(6));
+        const auto second = pool.allocate(NxVertexFormat::COMPACT, vertices(NxVertexFormat::COMPACT, 4), indices(6));
+        const std::vector<NxDrawIndexedIndirectCommand> draws = {
+            {first->range.indexCount, 1, first->range.firstIndex, first->range.baseVertex, 0},
+            {second->range.indexCount, 1, second->range.firstIndex, second->range.baseVertex, 0}
+        };
+
+        auto &log = NxHeadlessCommandLog::get();
+        log.clear();
+        api.multiDrawIndexedIndirect(first->vao, draws);
+        api.multiDrawIndexedIndirect(first->vao, {});
+        EXPECT_EQ(log.getStats().drawCalls, 1u);
+        EXPECT_EQ(log.getStats().indirectDraws, 2u);
+        EXPECT_THROW(api.multiDrawIndexedIndirect(nullptr, draws), NxInvalidValue);
+    }
+
+}
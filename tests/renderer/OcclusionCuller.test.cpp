@@ -0,0 +1,215 @@
+//// OcclusionCuller.test.cpp /////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the CPU occlusion culler
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include "OcclusionCuller.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <array>
+#include <vector>
+
+namespace nexo::renderer {
+
+    class OcclusionCullerTest : public ::testing::Test {
+        protected:
+            // Camera at the origin looking down -Z
+            const glm::mat4 m_viewProjection = glm::perspective(glm::radians(60.0f), 2.0f, 0.1f, 100.0f) *
+                glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+            // Unit quad facing the camera, in the XY plane
+            const std::array<glm::vec3, 4> m_quadVertices = {
+                glm::vec3(-0.5f, -0.5f, 0.0f), glm::vec3(0.5f, -0.5f, 0.0f),
+                glm::vec3(0.5f, 0.5f, 0.0f), glm::vec3(-0.5f, 0.5f, 0.0f)
+            };
+            const std::array<uint32_t, 6> m_quadIndices = {0, 1, 2, 0, 2, 3};
+
+            static glm::mat4 transform(const glm::vec3 &position, const glm::vec3 &size = glm::vec3(1.0f))
+            {
+                return glm::scale(glm::translate(glm::mat4(1.0f), position), size);
+            }
+
+            // Wall of 20x10 units, 10 units in front of the camera
+            void addWall(NxOcclusionCuller &culler) const
+            {
+                culler.addOccluder(m_quadVertices, m_quadIndices, transform({0.0f, 0.0f, -10.0f}, {20.0f, 10.0f, 1.0f}));
+            }
+
+            static constexpr glm::vec3 unitMin{-0.5f};
+            static constexpr glm::vec3 unitMax{0.5f};
+    };
+
+    TEST_F(OcclusionCullerTest, HierarchyHalvesResolutionDownToOneTexel)
+    {
+        const NxOcclusionCuller culler;
+        EXPECT_EQ(culler.getWidth(), NX_OCCLUSION_BUFFER_WIDTH);
+        EXPECT_EQ(culler.getHeight(), NX_OCCLUSION_BUFFER_HEIGHT);
+        ASSERT_EQ(culler.getLevelCount(), 9u);
+        EXPECT_EQ(culler.getLevelSize(1), glm::uvec2(128, 64));
+        EXPECT_EQ(culler.getLevelSize(7), glm::uvec2(2, 1));
+        EXPECT_EQ(culler.getLevelSize(8), glm::uvec2(1, 1));
+
+        const NxOcclusionCuller odd(5, 3);
+        ASSERT_EQ(odd.getLevelCount(), 4u);
+        EXPECT_EQ(odd.getLevelSize(1), glm::uvec2(3, 2));
+        EXPECT_EQ(odd.getLevelSize(2), glm::uvec2(2, 1));
+    }
+
+    TEST_F(OcclusionCullerTest, NothingIsOccludedWithoutOccluders)
+    {
+        NxOcclusionCuller culler;
+        culler.begin(m_viewProjection);
+        culler.rasterize();
+
+        EXPECT_FALSE(culler.hasOccluders());
+        EXPECT_FALSE(culler.isOccluded(unitMin, unitMax, transform({0.0f, 0.0f, -50.0f})));
+        EXPECT_EQ(culler.getStats().testedCount, 1u);
+        EXPECT_EQ(culler.getStats().occludedCount, 0u);
+    }
+
+    TEST_F(OcclusionCullerTest, RasterizesOccluderDepth)
+    {
+        NxOcclusionCuller culler;
+        culler.begin(m_viewProjection);
+        addWall(culler);
+        culler.rasterize();
+
+        EXPECT_EQ(culler.getStats().occluderTriangles, 2u);
+        // The wall covers the center of the screen, its depth is closer than the cleared far plane
+        const float center = culler.getDepth(NX_OCCLUSION_BUFFER_WIDTH / 2, NX_OCCLUSION_BUFFER_HEIGHT / 2);
+        EXPECT_GT(center, 0.0f);
+        EXPECT_LT(center, 1.0f);
+        // The corners of the screen are outside of the wall
+        EXPECT_FLOAT_EQ(culler.getDepth(0, 0), 1.0f);
+        EXPECT_FLOAT_EQ(culler.getDepth(NX_OCCLUSION_BUFFER_WIDTH - 1, NX_OCCLUSION_BUFFER_HEIGHT - 1), 1.0f);
+        // The coarsest level keeps the farthest depth
+        EXPECT_FLOAT_EQ(culler.getDepth(0, 0, culler.getLevelCount() - 1), 1.0f);
+    }
+
+    TEST_F(OcclusionCullerTest, BoxBehindOccluderIsOccluded)
+    {
+        NxOcclusionCuller culler;
+        culler.begin(m_viewProjection);
+        addWall(culler);
+        culler.rasterize();
+
+        EXPECT_TRUE(culler.isOccluded(unitMin, unitMax, transform({0.0f, 0.0f, -20.0f})));
+        EXPECT_TRUE(culler.isOccluded(unitMin, unitMax, transform({2.0f, 1.0f, -15.0f}, glm::vec3(2.0f))));
+        EXPECT_EQ(culler.getStats().testedCount, 2u);
+        EXPECT_EQ(culler.getStats().occludedCount, 2u);
+    }
+
+    TEST_F(OcclusionCullerTest, BoxInFrontOfOccluderIsVisible)
+    {
+        NxOcclusionCuller culler;
+        culler.begin(m_viewProjection);
+        addWall(culler);
+        culler.rasterize();
+
+        EXPECT_FALSE(culler.isOccluded(unitMin, unitMax, transform({0.0f, 0.0f, -5.0f})));
+        // Crossing the wall
+        EXPECT_FALSE(culler.isOccluded(unitMin, unitMax, transform({0.0f, 0.0f, -10.0f})));
+        EXPECT_EQ(culler.getStats().occludedCount, 0u);
+    }
+
+    TEST_F(OcclusionCullerTest, BoxPeekingAroundOccluderIsVisible)
+    {
+        NxOcclusionCuller culler;
+        culler.begin(m_viewProjection);
+        // Narrow pillar: a wide box behind it stays visible on both sides
+        culler.addOccluder(m_quadVertices, m_quadIndices, transform({0.0f, 0.0f, -10.0f}, {1.0f, 10.0f, 1.0f}));
+        culler.rasterize();
+
+        EXPECT_FALSE(culler.isOccluded(unitMin, unitMax, transform({0.0f, 0.0f, -20.0f}, {8.0f, 1.0f, 1.0f})));
+        EXPECT_TRUE(culler.isOccluded(unitMin, unitMax, transform({0.0f, 0.0f, -20.0f}, {0.5f, 1.0f, 1.0f})));
+    }
+
+    TEST_F(OcclusionCullerTest, BoxCrossingNearPlaneIsVisible)
+    {
+        NxOcclusionCuller culler;
+        culler.begin(m_viewProjection);
+        addWall(culler);
+        culler.rasterize();
+
+        EXPECT_FALSE(culler.isOccluded(unitMin, unitMax, transform({0.0f, 0.0f, 0.0f})));
+        EXPECT_FALSE(culler.isOccluded(unitMin, unitMax, transform({0.0f, 0.0f, 5.0f})));
+    }
+
+    TEST_F(OcclusionCullerTest, OccluderBehindCameraIsDropped)
+    {
+        NxOcclusionCuller culler;
+        culler.begin(m_viewProjection);
+        culler.addOccluder(m_quadVertices, m_quadIndices, transform({0.0f, 0.0f, 10.0f}, {20.0f, 10.0f, 1.0f}));
+        culler.rasterize();
+
+        EXPECT_FALSE(culler.hasOccluders());
+        EXPECT_FALSE(culler.isOccluded(unitMin, unitMax, transform({0.0f, 0.0f, -20.0f})));
+    }
+
+    TEST_F(OcclusionCullerTest, BeginClearsThePreviousFrame)
+    {
+        NxOcclusionCuller culler;
+        culler.begin(m_viewProjection);
+        addWall(culler);
+        culler.rasterize();
+        ASSERT_TRUE(culler.isOccluded(unitMin, unitMax, transform({0.0f, 0.0f, -20.0f})));
+
+        culler.begin(m_viewProjection);
+        culler.rasterize();
+        EXPECT_FALSE(culler.isOccluded(unitMin, unitMax, transform({0.0f, 0.0f, -20.0f})));
+        EXPECT_FLOAT_EQ(culler.getDepth(NX_OCCLUSION_BUFFER_WIDTH / 2, NX_OCCLUSION_BUFFER_HEIGHT / 2), 1.0f);
+        EXPECT_EQ(culler.getStats().testedCount, 1u);
+        EXPECT_EQ(culler.getStats().occludedCount, 0u);
+    }
+
+    TEST_F(OcclusionCullerTest, ParallelRasterizationMatchesSingleOccluder)
+    {
+        // Enough triangles to split the rows over the worker pool: the wall cut in a grid of small quads
+        std::vector<glm::vec3> vertices;
+        std::vector<uint32_t> indices;
+        constexpr unsigned int cells = 16;
+        for (unsigned int y = 0; y <= cells; ++y)
+            for (unsigned int x = 0; x <= cells; ++x)
+                vertices.emplace_back(static_cast<float>(x) / cells - 0.5f, static_cast<float>(y) / cells - 0.5f, 0.0f);
+        for (unsigned int y = 0; y < cells; ++y) {
+            for (unsigned int x = 0; x < cells; ++x) {
+                const uint32_t i = y * (cells + 1) + x;
+                indices.insert(indices.end(), {i, i + 1, i + cells + 2, i, i + cells + 2, i + cells + 1});
+            }
+        }
+        const glm::mat4 wall = transform({0.0f, 0.0f, -10.0f}, {20.0f, 10.0f, 1.0f});
+
+        NxOcclusionCuller reference;
+        reference.begin(m_viewProjection);
+        reference.addOccluder(m_quadVertices, m_quadIndices, wall);
+        reference.rasterize();
+
+        NxOcclusionCuller culler;
+        culler.begin(m_viewProjection);
+        culler.addOccluder(vertices, indices, wall);
+        culler.rasterize();
+        EXPECT_EQ(culler.getStats().occluderTriangles, cells * cells * 2);
+
+        for (unsigned int y = 0; y < NX_OCCLUSION_BUFFER_HEIGHT; y += 7)
+            for (unsigned int x = 0; x < NX_OCCLUSION_BUFFER_WIDTH; x += 5)
+                EXPECT_NEAR(culler.getDepth(x, y), reference.getDepth(x, y), 1e-5f) << x << ", " << y;
+        EXPECT_TRUE(culler.isOccluded(unitMin, unitMax, transform({0.0f, 0.0f, -20.0f})));
+    }
+
+}
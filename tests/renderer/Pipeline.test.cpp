@@ -61,6 +61,9 @@ public:
     MOCK_METHOD(void, copy, (const std::shared_ptr<NxFramebuffer> source), (override));
     MOCK_METHOD(unsigned int, getFramebufferId, (), (const, override));
     MOCK_METHOD(void, getPixelWrapper, (unsigned int attachmentIndex, int x, int y, void* result, const std::type_info& ti), (const, override));
+    MOCK_METHOD(void, readPixelsAsync, (unsigned int attachmentIndex, int x, int y, unsigned int width, unsigned int height, NxPixelReadCallback callback), (override));
+    MOCK_METHOD(void, pollPixelReads, (bool wait), (override));
+    MOCK_METHOD(size_t, getPendingPixelReads, (), (const, override));
     MOCK_METHOD(void, clearAttachmentWrapper, (unsigned int attachmentIndex, const void* value, const std::type_info& ti), (const, override));
     MOCK_METHOD(NxFramebufferSpecs&, getSpecs, (), (override));
     MOCK_METHOD(const NxFramebufferSpecs&, getSpecs, (), (const, override));
@@ -299,6 +302,33 @@ TEST_F(RenderPipelineTest, DrawCommandsManagement) {
     EXPECT_TRUE(pipeline.getDrawCommands().empty());
 }
 
+TEST_F(RenderPipelineTest, SharedDrawCommandsAreReferencedNotCopied) {
+    auto shared = std::make_shared<SharedDrawCommands>();
+    shared->commands.resize(2);
+    shared->uniforms["uAmbientLight"] = glm::vec3(0.5f);
+
+    RenderPipeline otherPipeline;
+    auto mockRenderTarget = createMockFramebuffer();
+
+    pipeline.setSharedDrawCommands(shared);
+    otherPipeline.setSharedDrawCommands(shared);
+    pipeline.setViewUniform("uCamPos", glm::vec3(1.0f));
+    otherPipeline.setViewUniform("uCamPos", glm::vec3(2.0f));
+
+    // Both views point to the same list, only the view uniforms differ
+    EXPECT_EQ(pipeline.getSharedDrawCommands().get(), otherPipeline.getSharedDrawCommands().get());
+    EXPECT_EQ(shared.use_count(), 3);
+    EXPECT_EQ(std::get<glm::vec3>(pipeline.getViewUniforms().at("uCamPos")), glm::vec3(1.0f));
+    EXPECT_EQ(std::get<glm::vec3>(otherPipeline.getViewUniforms().at("uCamPos")), glm::vec3(2.0f));
+
+    // The reference is released after execution, view uniforms are kept for the next frame
+    pipeline.setRenderTarget(mockRenderTarget);
+    pipeline.execute();
+    EXPECT_EQ(pipeline.getSharedDrawCommands(), nullptr);
+    EXPECT_EQ(shared.use_count(), 2);
+    EXPECT_TRUE(pipeline.getViewUniforms().contains("uCamPos"));
+}
+
 TEST_F(RenderPipelineTest, CameraClearColor) {
     glm::vec4 clearColor(0.1f, 0.2f, 0.3f, 1.0f);
 
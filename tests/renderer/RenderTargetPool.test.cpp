@@ -0,0 +1,187 @@
+//// RenderTargetPool.test.cpp ////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the transient render target pool
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "GraphicsApi.hpp"
+#include "RenderPipeline.hpp"
+#include "RenderTargetPool.hpp"
+
+#include <vector>
+
+namespace nexo::renderer {
+
+    // Pass writing a transient target of its own and recording the framebuffers it was given
+    class TransientTargetPass final : public RenderPass {
+        public:
+            explicit TransientTargetPass(const PassId id) : RenderPass(id, "Transient target pass") {}
+
+            void setup(RenderPipeline &pipeline) override
+            {
+                NxFramebufferSpecs specs;
+                specs.attachments = {NxFrameBufferTextureFormats::RGBA8, NxFrameBufferTextureFormats::DEPTH24STENCIL8};
+                outputs = {pipeline.createTransientTarget(specs)};
+            }
+
+            void execute(RenderPipeline &pipeline) override
+            {
+                written.push_back(pipeline.getTransientTarget(outputs.front()));
+                for (const PassId prereq : prerequisites) {
+                    const auto pass = pipeline.getRenderPass(prereq);
+                    for (const ResourceId output : pass->getOutputs())
+                        read.push_back(pipeline.getTransientTarget(output));
+                }
+            }
+
+            std::vector<std::shared_ptr<NxFramebuffer>> written;
+            std::vector<std::shared_ptr<NxFramebuffer>> read;
+    };
+
+    class RenderTargetPoolTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                m_previousApi = NxGetGraphicsApi();
+                NxSetGraphicsApi(NxGraphicsApi::HEADLESS);
+                NxRenderTargetPool::get().clear();
+            }
+
+            void TearDown() override
+            {
+                NxRenderTargetPool::get().clear();
+                NxSetGraphicsApi(m_previousApi);
+            }
+
+            static std::shared_ptr<NxFramebuffer> createRenderTarget(const unsigned int width, const unsigned int height)
+            {
+                NxFramebufferSpecs specs;
+                specs.width = width;
+                specs.height = height;
+                specs.attachments = {NxFrameBufferTextureFormats::RGBA8, NxFrameBufferTextureFormats::Depth};
+                return NxFramebuffer::create(specs);
+            }
+
+        private:
+            NxGraphicsApi m_previousApi = NxGraphicsApi::HEADLESS;
+    };
+
+    TEST_F(RenderTargetPoolTest, ReusesReleasedTargetsWithTheSameSpecs)
+    {
+        auto &pool = NxRenderTargetPool::get();
+        NxFramebufferSpecs specs;
+        specs.width = 128;
+        specs.height = 64;
+        specs.attachments = {NxFrameBufferTextureFormats::RGBA8};
+
+        const auto first = pool.acquire(specs);
+        const auto second = pool.acquire(specs);
+        EXPECT_NE(first, second);
+        EXPECT_EQ(pool.getTargetsInUse(), 2u);
+
+        pool.release(first);
+        EXPECT_EQ(pool.acquire(specs), first);
+
+        // Different attachments never share a framebuffer
+        specs.attachments = {NxFrameBufferTextureFormats::RED_INTEGER};
+        pool.release(second);
+        EXPECT_NE(pool.acquire(specs), second);
+        EXPECT_EQ(pool.getTargetCount(), 3u);
+    }
+
+    TEST_F(RenderTargetPoolTest, ResizesIdleTargetsLazilyAndEvictsUnusedOnes)
+    {
+        auto &pool = NxRenderTargetPool::get();
+        NxFramebufferSpecs specs;
+        specs.width = 128;
+        specs.height = 64;
+        specs.attachments = {NxFrameBufferTextureFormats::RGBA8};
+
+        const auto target = pool.acquire(specs);
+        pool.release(target);
+
+        // Still used this frame, another view may ask for this size again
+        specs.width = 256;
+        const auto other = pool.acquire(specs);
+        EXPECT_NE(other, target);
+        pool.release(other);
+
+        pool.endFrame();
+        specs.width = 512;
+        EXPECT_EQ(pool.acquire(specs), target);
+        EXPECT_EQ(target->getSpecs().width, 512u);
+        pool.release(target);
+
+        for (int frame = 0; frame < 4; ++frame)
+            pool.endFrame();
+        EXPECT_EQ(pool.getTargetCount(), 0u);
+    }
+
+    TEST_F(RenderTargetPoolTest, PipelineAliasesTargetsWithDisjointLifetimes)
+    {
+        RenderPipeline pipeline;
+        const auto first = std::make_shared<TransientTargetPass>(0);
+        const auto second = std::make_shared<TransientTargetPass>(1);
+        const auto third = std::make_shared<TransientTargetPass>(2);
+        pipeline.addRenderPass(first);
+        pipeline.addRenderPass(second);
+        pipeline.addRenderPass(third);
+        pipeline.addPrerequisite(1, 0);
+        pipeline.addEffect(0, 1);
+        pipeline.addPrerequisite(2, 1);
+        pipeline.addEffect(1, 2);
+        pipeline.setFinalOutputPass(2);
+        pipeline.setRenderTarget(createRenderTarget(320, 240));
+
+        pipeline.execute();
+
+        // The first target lives until the second pass read it, the third pass can reuse it
+        ASSERT_EQ(second->read.size(), 1u);
+        EXPECT_EQ(second->read[0], first->written[0]);
+        EXPECT_NE(second->written[0], first->written[0]);
+        EXPECT_EQ(third->written[0], first->written[0]);
+        EXPECT_EQ(first->written[0]->getSpecs().width, 320u);
+        EXPECT_EQ(NxRenderTargetPool::get().getTargetCount(), 2u);
+        EXPECT_EQ(NxRenderTargetPool::get().getTargetsInUse(), 0u);
+        EXPECT_EQ(pipeline.getTransientTarget(0), nullptr);
+    }
+
+    TEST_F(RenderTargetPoolTest, PipelinesShareTargetsAcrossCameras)
+    {
+        std::vector<RenderPipeline> pipelines(3);
+        std::vector<std::shared_ptr<TransientTargetPass>> passes;
+        for (auto &pipeline : pipelines) {
+            passes.push_back(std::make_shared<TransientTargetPass>(0));
+            pipeline.addRenderPass(passes.back());
+            pipeline.setRenderTarget(createRenderTarget(640, 480));
+        }
+
+        for (auto &pipeline : pipelines)
+            pipeline.execute();
+        EXPECT_EQ(passes[1]->written[0], passes[0]->written[0]);
+        EXPECT_EQ(passes[2]->written[0], passes[0]->written[0]);
+        EXPECT_EQ(NxRenderTargetPool::get().getTargetCount(), 1u);
+
+        // A resize only affects the render target, the transient one follows on the next execution
+        pipelines[0].resize(800, 600);
+        EXPECT_EQ(passes[0]->written[0]->getSpecs().width, 640u);
+        NxRenderTargetPool::get().endFrame();
+        pipelines[0].execute();
+        EXPECT_EQ(passes[0]->written[1]->getSpecs().width, 800u);
+    }
+
+}
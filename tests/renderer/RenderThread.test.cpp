@@ -0,0 +1,215 @@
+//// RenderThread /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the render thread and its render packets
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include "GraphicsApi.hpp"
+#include "RenderThread.hpp"
+#include "RenderTargetPool.hpp"
+#include "headless/HeadlessCommandLog.hpp"
+#include "headless/HeadlessWindow.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace nexo::renderer {
+
+    struct PassRecord {
+        std::string name;
+        std::thread::id thread;
+        std::thread::id contextThread;
+        glm::vec4 clearColor;
+    };
+
+    // Pass recording which thread executed it and whether the context was current there
+    class RecordingPass final : public RenderPass {
+        public:
+            RecordingPass(const PassId id, std::string name, const NxHeadlessWindow &window,
+                          std::vector<PassRecord> &records)
+                : RenderPass(id, std::move(name)), m_window(window), m_records(records) {}
+
+            void execute(RenderPipeline &pipeline) override
+            {
+                if (throwOnExecute)
+                    throw std::runtime_error("pass failed");
+                m_records.push_back({getName(), std::this_thread::get_id(), m_window.getContextThread(),
+                                     pipeline.getFrame().clearColor});
+            }
+
+            bool throwOnExecute = false;
+
+        private:
+            const NxHeadlessWindow &m_window;
+            std::vector<PassRecord> &m_records;
+    };
+
+    class RenderThreadTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                m_previousApi = NxGetGraphicsApi();
+                NxSetGraphicsApi(NxGraphicsApi::HEADLESS);
+                NxRenderTargetPool::get().clear();
+                NxHeadlessCommandLog::get().clear();
+                m_window = std::make_shared<NxHeadlessWindow>();
+            }
+
+            void TearDown() override
+            {
+                NxRenderTargetPool::get().clear();
+                NxHeadlessCommandLog::get().clear();
+                NxSetGraphicsApi(m_previousApi);
+            }
+
+            std::shared_ptr<RecordingPass> addPipeline(const std::string &name)
+            {
+                auto &pipeline = m_pipelines.emplace_back(std::make_unique<RenderPipeline>());
+                auto pass = std::make_shared<RecordingPass>(0, name, *m_window, m_records);
+                pipeline->addRenderPass(pass);
+                NxFramebufferSpecs specs;
+                specs.width = 64;
+                specs.height = 64;
+                specs.attachments = {NxFrameBufferTextureFormats::RGBA8};
+                pipeline->setRenderTarget(NxFramebuffer::create(specs));
+                return pass;
+            }
+
+            NxRenderPacket buildPacket(const bool present = false) const
+            {
+                NxRenderPacket packet;
+                for (const auto &pipeline : m_pipelines)
+                    packet.addView(*pipeline);
+                if (present)
+                    packet.presentWindow = m_window;
+                return packet;
+            }
+
+            std::shared_ptr<NxHeadlessWindow> m_window;
+            std::vector<std::unique_ptr<RenderPipeline>> m_pipelines;
+            std::vector<PassRecord> m_records;
+
+        private:
+            NxGraphicsApi m_previousApi = NxGraphicsApi::HEADLESS;
+    };
+
+    TEST_F(RenderThreadTest, SubmitExecutesInlineWhenNotStarted)
+    {
+        addPipeline("First");
+        addPipeline("Second");
+        NxRenderThread renderThread(m_window);
+
+        renderThread.submit(buildPacket(true));
+
+        ASSERT_EQ(m_records.size(), 2u);
+        EXPECT_EQ(m_records[0].name, "First");
+        EXPECT_EQ(m_records[1].name, "Second");
+        EXPECT_EQ(m_records[0].thread, std::this_thread::get_id());
+        EXPECT_EQ(m_records[0].contextThread, std::this_thread::get_id());
+        EXPECT_EQ(NxHeadlessCommandLog::get().getStats().frames, 1u);
+        EXPECT_EQ(renderThread.getStats().packetCount, 1u);
+    }
+
+    TEST_F(RenderThreadTest, PacketsExecuteOnTheRenderThread)
+    {
+        addPipeline("View");
+        NxRenderThread renderThread(m_window);
+        renderThread.start();
+        ASSERT_TRUE(renderThread.isRunning());
+
+        for (int frame = 0; frame < 3; ++frame) {
+            m_pipelines[0]->setCameraClearColor(glm::vec4(static_cast<float>(frame)));
+            renderThread.submit(buildPacket(true));
+            // The next frame can be built while this one executes
+            m_pipelines[0]->setCameraClearColor(glm::vec4(-1.0f));
+            renderThread.sync();
+            EXPECT_EQ(m_window->getContextThread(), std::this_thread::get_id());
+        }
+        renderThread.stop();
+        EXPECT_FALSE(renderThread.isRunning());
+
+        ASSERT_EQ(m_records.size(), 3u);
+        for (int frame = 0; frame < 3; ++frame) {
+            EXPECT_NE(m_records[frame].thread, std::this_thread::get_id());
+            // The context followed the packet
+            EXPECT_EQ(m_records[frame].contextThread, m_records[frame].thread);
+            EXPECT_EQ(m_records[frame].clearColor, glm::vec4(static_cast<float>(frame)));
+        }
+        EXPECT_EQ(NxHeadlessCommandLog::get().getStats().frames, 3u);
+        EXPECT_EQ(renderThread.getStats().packetCount, 3u);
+        EXPECT_EQ(m_window->getContextThread(), std::this_thread::get_id());
+    }
+
+    TEST_F(RenderThreadTest, SubmitWaitsForThePacketInFlight)
+    {
+        addPipeline("View");
+        NxRenderThread renderThread(m_window);
+        renderThread.start();
+
+        // Without a sync in between, each submit waits for the previous packet to be done
+        for (int frame = 0; frame < 4; ++frame)
+            renderThread.submit(buildPacket());
+        renderThread.sync();
+
+        EXPECT_EQ(m_records.size(), 4u);
+        EXPECT_EQ(renderThread.getStats().packetCount, 4u);
+    }
+
+    TEST_F(RenderThreadTest, ExecutionErrorsAreRethrownOnSync)
+    {
+        const auto pass = addPipeline("View");
+        pass->throwOnExecute = true;
+        NxRenderThread renderThread(m_window);
+        renderThread.start();
+
+        renderThread.submit(buildPacket());
+        EXPECT_THROW(renderThread.sync(), std::runtime_error);
+        // The context is back and the thread keeps going
+        EXPECT_EQ(m_window->getContextThread(), std::this_thread::get_id());
+        pass->throwOnExecute = false;
+        renderThread.submit(buildPacket());
+        EXPECT_NO_THROW(renderThread.sync());
+        EXPECT_EQ(m_records.size(), 1u);
+    }
+
+    TEST_F(RenderThreadTest, ThreadedRenderingCanBeToggledBetweenFrames)
+    {
+        addPipeline("View");
+        // The application starts the thread by default when the window can hand its context over
+        ASSERT_TRUE(m_window->supportsContextHandoff());
+        NxRenderThread renderThread(m_window);
+
+        // Toggled the way Application::setThreadedRendering does it, between two frames
+        renderThread.start();
+        renderThread.submit(buildPacket());
+        renderThread.stop();
+        renderThread.submit(buildPacket());
+        renderThread.start();
+        renderThread.submit(buildPacket());
+        renderThread.sync();
+
+        ASSERT_EQ(m_records.size(), 3u);
+        EXPECT_NE(m_records[0].thread, std::this_thread::get_id());
+        EXPECT_EQ(m_records[1].thread, std::this_thread::get_id());
+        EXPECT_NE(m_records[2].thread, std::this_thread::get_id());
+        EXPECT_EQ(m_window->getContextThread(), std::this_thread::get_id());
+    }
+
+}
@@ -21,6 +21,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp>
+#include <vector>
 
 #include "renderer/Renderer3D.hpp"
 #include "renderer/Texture.hpp"
@@ -109,4 +110,67 @@ namespace nexo::renderer {
 	    renderer3D->init();
 	}
 
+
+    TEST_F(Renderer3DTest, DrawGeometryBatchesTheScene)
+    {
+        const std::vector<NxVertex> vertices(3);
+        const std::vector<unsigned int> indices = {0, 1, 2};
+
+        renderer3D->beginScene(glm::mat4(1.0f), glm::vec3(0.0f));
+        EXPECT_NO_THROW(renderer3D->drawGeometry(vertices, indices));
+        EXPECT_NO_THROW(renderer3D->drawGeometry(vertices, indices));
+        EXPECT_NO_THROW(renderer3D->endScene());
+
+        const auto stats = renderer3D->getStats();
+        EXPECT_EQ(stats.drawCalls, 1u);
+        EXPECT_EQ(stats.dynamicVertexCount, 6u);
+        EXPECT_EQ(stats.dynamicStreamStalls, 0u);
+    }
+
+    TEST_F(Renderer3DTest, DrawGeometryWithoutScene)
+    {
+        const std::vector<NxVertex> vertices(3);
+        const std::vector<unsigned int> indices = {0, 1, 2};
+        EXPECT_THROW(renderer3D->drawGeometry(vertices, indices), NxRendererSceneLifeCycleFailure);
+    }
+
+    TEST_F(Renderer3DTest, DynamicBatchGrowsTheStreamRings)
+    {
+        const auto storage = renderer3D->getInternalStorage();
+        const std::vector<NxVertex> vertices(NxRenderer3DStorage::initialStreamVertices + 1);
+        const std::vector<unsigned int> indices = {0, 1, 2};
+
+        renderer3D->beginScene(glm::mat4(1.0f), glm::vec3(0.0f));
+        EXPECT_NO_THROW(renderer3D->drawGeometry(vertices, indices));
+        EXPECT_GT(storage->vertexRing.getCapacity(), NxRenderer3DStorage::initialStreamVertices);
+        // The ring is full of the first batch, which the GPU may still read once flushed
+        EXPECT_NO_THROW(renderer3D->drawGeometry(vertices, indices));
+        EXPECT_NO_THROW(renderer3D->endScene());
+
+        const auto stats = renderer3D->getStats();
+        EXPECT_EQ(stats.drawCalls, 2u);
+        EXPECT_EQ(stats.dynamicStreamStalls, 0u);
+    }
+
+    TEST_F(Renderer3DTest, TextureIndicesStartANewPageWhenSlotsRunOut)
+    {
+        constexpr unsigned int slots = NxRenderer3DStorage::maxTextureSlots;
+        std::vector<std::shared_ptr<NxTexture2D>> textures;
+        for (unsigned int i = 0; i < slots + 8; ++i)
+            textures.push_back(NxTexture2D::create(1, 1));
+
+        // Slot 0 of every page holds the white texture
+        for (unsigned int i = 0; i < slots - 1; ++i)
+            EXPECT_EQ(renderer3D->getTextureIndex(textures[i]), static_cast<int>(i + 1));
+        EXPECT_EQ(renderer3D->reserveTextureSlots(1), 1u);
+        for (unsigned int i = slots - 1; i < textures.size(); ++i)
+            EXPECT_EQ(renderer3D->getTextureIndex(textures[i]), static_cast<int>(i - slots + 2));
+
+        const auto frameTextures = renderer3D->takeTextureSlots();
+        ASSERT_EQ(frameTextures.size(), slots + 1 + (textures.size() - (slots - 1)));
+        EXPECT_EQ(frameTextures[slots], renderer3D->getInternalStorage()->whiteTexture);
+        EXPECT_EQ(frameTextures[slots + 1], textures[slots - 1]);
+        EXPECT_EQ(renderer3D->reserveTextureSlots(1), 0u);
+    }
+
 }
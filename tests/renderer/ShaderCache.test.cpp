@@ -0,0 +1,164 @@
+//// ShaderCache.test.cpp /////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the shader program binary cache
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "ShaderCache.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace nexo::renderer {
+
+    class ShaderCacheTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                m_directory = std::filesystem::temp_directory_path() / "nexo_shader_cache_test";
+                std::filesystem::remove_all(m_directory);
+                cache().setDirectory(m_directory);
+                cache().setDriverIdentity("Vendor|Renderer|4.5");
+                cache().setEnabled(true);
+                cache().resetStats();
+            }
+
+            void TearDown() override
+            {
+                cache().waitForPrefetch();
+                cache().setDriverIdentity("");
+                cache().setDirectory({});
+                std::filesystem::remove_all(m_directory);
+            }
+
+            static NxShaderBinaryCache &cache() { return NxShaderBinaryCache::get(); }
+
+            static NxShaderBinary makeBinary()
+            {
+                NxShaderBinary binary;
+                binary.format = 0x8e21;
+                binary.data = {1, 2, 3, 4, 5, 6, 7, 8};
+                binary.uniforms["uViewProjection"] = {"uViewProjection", 0, 0x8b5c, 1};
+                binary.uniforms["uTexture[0]"] = {"uTexture[0]", 3, 0x8b5e, 32};
+                binary.attributes[0] = {"aPos", 0, 0x8b51, 1};
+                return binary;
+            }
+
+            [[nodiscard]] size_t entryCount() const
+            {
+                if (!std::filesystem::exists(m_directory))
+                    return 0;
+                return static_cast<size_t>(std::distance(std::filesystem::directory_iterator(m_directory),
+                                                         std::filesystem::directory_iterator{}));
+            }
+
+            std::filesystem::path m_directory;
+    };
+
+    TEST_F(ShaderCacheTest, StoreAndLoadRoundTrip)
+    {
+        const uint64_t key = NxShaderBinaryCache::makeKey(cache().getDriverIdentity(), "void main() {}");
+        cache().store(key, makeBinary());
+        EXPECT_EQ(entryCount(), 1u);
+
+        const auto loaded = cache().load(key);
+        ASSERT_TRUE(loaded.has_value());
+        EXPECT_EQ(loaded->format, 0x8e21u);
+        EXPECT_EQ(loaded->data, makeBinary().data);
+        ASSERT_EQ(loaded->uniforms.size(), 2u);
+        EXPECT_EQ(loaded->uniforms.at("uTexture[0]").location, 3);
+        EXPECT_EQ(loaded->uniforms.at("uTexture[0]").size, 32);
+        ASSERT_EQ(loaded->attributes.size(), 1u);
+        EXPECT_EQ(loaded->attributes.at(0).name, "aPos");
+    }
+
+    TEST_F(ShaderCacheTest, KeyDependsOnSourceAndDriver)
+    {
+        const uint64_t key = NxShaderBinaryCache::makeKey("Vendor|Renderer|4.5", "source");
+        EXPECT_EQ(key, NxShaderBinaryCache::makeKey("Vendor|Renderer|4.5", "source"));
+        EXPECT_NE(key, NxShaderBinaryCache::makeKey("Vendor|Renderer|4.6", "source"));
+        EXPECT_NE(key, NxShaderBinaryCache::makeKey("Vendor|Renderer|4.5", "source2"));
+
+        cache().store(key, makeBinary());
+        EXPECT_FALSE(cache().load(NxShaderBinaryCache::makeKey("Vendor|Renderer|4.6", "source")).has_value());
+    }
+
+    TEST_F(ShaderCacheTest, CorruptedEntryIsDiscarded)
+    {
+        const uint64_t key = NxShaderBinaryCache::makeKey(cache().getDriverIdentity(), "source");
+        cache().store(key, makeBinary());
+        const auto entry = std::filesystem::directory_iterator(m_directory)->path();
+        std::filesystem::resize_file(entry, std::filesystem::file_size(entry) - 3);
+
+        EXPECT_FALSE(cache().load(key).has_value());
+        EXPECT_FALSE(std::filesystem::exists(entry));
+    }
+
+    TEST_F(ShaderCacheTest, RejectRemovesEntry)
+    {
+        const uint64_t key = NxShaderBinaryCache::makeKey(cache().getDriverIdentity(), "source");
+        cache().store(key, makeBinary());
+        cache().reject(key);
+
+        EXPECT_EQ(entryCount(), 0u);
+        EXPECT_FALSE(cache().load(key).has_value());
+        EXPECT_EQ(cache().getStats().rejectedBinaries, 1u);
+    }
+
+    TEST_F(ShaderCacheTest, DisabledWithoutDriverIdentity)
+    {
+        cache().setDriverIdentity("");
+        EXPECT_FALSE(cache().isEnabled());
+        cache().store(42, makeBinary());
+        EXPECT_EQ(entryCount(), 0u);
+        EXPECT_FALSE(cache().load(42).has_value());
+    }
+
+    TEST_F(ShaderCacheTest, PrefetchServesEntriesFromMemory)
+    {
+        std::filesystem::create_directories(m_directory);
+        const auto sourcePath = m_directory / "shader.glsl";
+        const std::string source = "#type vertex\nvoid main() {}\n";
+        std::ofstream(sourcePath) << source;
+        const uint64_t key = NxShaderBinaryCache::makeKey(cache().getDriverIdentity(), source);
+        cache().store(key, makeBinary());
+
+        cache().prefetch({sourcePath.string()});
+        cache().waitForPrefetch();
+        std::filesystem::remove_all(m_directory);
+
+        const auto loaded = cache().load(key);
+        ASSERT_TRUE(loaded.has_value());
+        EXPECT_EQ(loaded->data, makeBinary().data);
+        // Prefetched entries are handed out once
+        EXPECT_FALSE(cache().load(key).has_value());
+    }
+
+    TEST_F(ShaderCacheTest, RecordsColdAndWarmBuildsSeparately)
+    {
+        cache().recordBuild(false, std::chrono::milliseconds(30));
+        cache().recordBuild(true, std::chrono::milliseconds(2));
+        cache().recordBuild(true, std::chrono::milliseconds(3));
+
+        const auto &stats = cache().getStats();
+        EXPECT_EQ(stats.coldBuilds, 1u);
+        EXPECT_EQ(stats.warmBuilds, 2u);
+        EXPECT_EQ(stats.coldBuildTime, std::chrono::milliseconds(30));
+        EXPECT_EQ(stats.warmBuildTime, std::chrono::milliseconds(5));
+    }
+
+}
@@ -0,0 +1,173 @@
+//// ShaderHotReload.test.cpp /////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for shader includes and hot reloading
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "GraphicsApi.hpp"
+#include "ShaderHotReload.hpp"
+#include "ShaderLibrary.hpp"
+#include "RendererExceptions.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace nexo::renderer {
+
+    class ShaderHotReloadTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                m_previousApi = NxGetGraphicsApi();
+                NxSetGraphicsApi(NxGraphicsApi::HEADLESS);
+                m_directory = (std::filesystem::temp_directory_path() / "nexo_shader_hot_reload_test").lexically_normal();
+                std::filesystem::remove_all(m_directory);
+                std::filesystem::create_directories(m_directory / "lighting");
+            }
+
+            void TearDown() override
+            {
+                std::filesystem::remove_all(m_directory);
+                NxSetGraphicsApi(m_previousApi);
+            }
+
+            std::string writeFile(const std::string &name, const std::string &content) const
+            {
+                const auto path = m_directory / name;
+                std::ofstream(path) << content;
+                return path.string();
+            }
+
+            // Files rewritten within the same tick would keep their timestamp
+            std::string rewriteFile(const std::string &name, const std::string &content) const
+            {
+                const auto previous = std::filesystem::last_write_time(m_directory / name);
+                const std::string path = writeFile(name, content);
+                std::filesystem::last_write_time(path, previous + std::chrono::seconds(2));
+                return path;
+            }
+
+            [[nodiscard]] std::string writeProgram(const std::string &name) const
+            {
+                return writeFile(name, "#type vertex\n"
+                                       "#version 450 core\n"
+                                       "layout(location = 0) in vec3 aPos;\n"
+                                       "uniform mat4 uViewProjection;\n"
+                                       "void main() { gl_Position = uViewProjection * vec4(aPos, 1.0); }\n"
+                                       "#type fragment\n"
+                                       "#version 450 core\n"
+                                       "#include \"lighting/common.glsl\"\n"
+                                       "out vec4 color;\n"
+                                       "void main() { color = lighting(); }\n");
+            }
+
+            std::filesystem::path m_directory;
+            NxGraphicsApi m_previousApi = NxGraphicsApi::HEADLESS;
+    };
+
+    TEST_F(ShaderHotReloadTest, IncludesAreExpandedOnceRelativeToTheIncludingFile)
+    {
+        writeFile("lighting/common.glsl", "vec4 lighting() { return vec4(1.0); }");
+        writeFile("lighting/point.glsl", "#include \"common.glsl\"\nvec4 point() { return lighting(); }");
+        const std::string path = writeFile("main.glsl", "#include \"lighting/common.glsl\"\n"
+                                                        "  #include <lighting/point.glsl>\n"
+                                                        "void main() {}");
+
+        std::vector<std::string> dependencies;
+        const std::string source = NxShader::loadSource(path, &dependencies);
+
+        EXPECT_EQ(source.find("vec4 lighting()"), source.rfind("vec4 lighting()"));
+        EXPECT_NE(source.find("vec4 point()"), std::string::npos);
+        EXPECT_EQ(source.find("#include"), std::string::npos);
+        ASSERT_EQ(dependencies.size(), 3u);
+        EXPECT_EQ(dependencies[0], path);
+        EXPECT_EQ(dependencies[1], (m_directory / "lighting/common.glsl").string());
+        EXPECT_EQ(dependencies[2], (m_directory / "lighting/point.glsl").string());
+    }
+
+    TEST_F(ShaderHotReloadTest, IncludeCyclesAreBroken)
+    {
+        writeFile("a.glsl", "#include \"b.glsl\"\nfloat a;");
+        writeFile("b.glsl", "#include \"a.glsl\"\nfloat b;");
+
+        const std::string source = NxShader::loadSource((m_directory / "a.glsl").string());
+        EXPECT_NE(source.find("float a;"), std::string::npos);
+        EXPECT_NE(source.find("float b;"), std::string::npos);
+    }
+
+    TEST_F(ShaderHotReloadTest, InvalidIncludesThrow)
+    {
+        const std::string missing = writeFile("missing.glsl", "#include \"nowhere.glsl\"\n");
+        EXPECT_THROW(NxShader::loadSource(missing), NxFileNotFoundException);
+        const std::string malformed = writeFile("malformed.glsl", "void f();\n#include nowhere.glsl\n");
+        EXPECT_THROW(NxShader::loadSource(malformed), NxShaderCreationFailed);
+    }
+
+    TEST_F(ShaderHotReloadTest, ModifiedIncludeReloadsDependentPrograms)
+    {
+        auto &library = ShaderLibrary::getInstance();
+        auto &reloader = NxShaderHotReloader::get();
+        writeFile("lighting/common.glsl", "vec4 lighting() { return vec4(1.0); }\n");
+        const auto previous = library.load("HotReloadTest", writeProgram("hot_reload.glsl"));
+        library.load("HotReloadOther", writeFile("other.glsl", "#type vertex\nvoid main() {}\n"
+                                                               "#type fragment\nvoid main() {}\n"));
+
+        const std::string include = (m_directory / "lighting/common.glsl").string();
+        EXPECT_EQ(reloader.getDependents(include), std::vector<std::string>{"HotReloadTest"});
+
+        // Listeners outlive the test, they must not capture its locals
+        auto reloaded = std::make_shared<std::vector<std::string>>();
+        library.addReloadListener([reloaded](const std::string &name, const std::shared_ptr<NxShader> &) {
+            reloaded->push_back(name);
+        });
+
+        reloader.poll();
+        EXPECT_EQ(reloader.pendingCount(), 0u);
+
+        rewriteFile("lighting/common.glsl", "uniform vec4 uTint;\nvec4 lighting() { return uTint; }\n");
+        reloader.poll();
+        EXPECT_EQ(reloader.pendingCount(), 1u);
+        EXPECT_EQ(reloader.processReloads(), 1u);
+
+        const auto current = library.get("HotReloadTest");
+        EXPECT_NE(current, previous);
+        EXPECT_TRUE(current->hasUniform("uTint"));
+        EXPECT_FALSE(previous->hasUniform("uTint"));
+        EXPECT_EQ(*reloaded, std::vector<std::string>{"HotReloadTest"});
+    }
+
+    TEST_F(ShaderHotReloadTest, BrokenSourcesKeepThePreviousProgram)
+    {
+        auto &library = ShaderLibrary::getInstance();
+        auto &reloader = NxShaderHotReloader::get();
+        writeFile("lighting/common.glsl", "vec4 lighting() { return vec4(1.0); }\n");
+        const auto previous = library.load("HotReloadBroken", writeProgram("broken.glsl"));
+
+        // Broken includes are caught while expanding the sources, before any program gets built
+        rewriteFile("broken.glsl", "#include \"nowhere.glsl\"\n");
+        reloader.poll();
+        EXPECT_EQ(reloader.pendingCount(), 0u);
+
+        // Programs the backend fails to build are reported on the graphics thread
+        rewriteFile("broken.glsl", "#type vertex\nvoid main() {}\n");
+        reloader.poll();
+        EXPECT_EQ(reloader.pendingCount(), 1u);
+        EXPECT_EQ(reloader.processReloads(), 0u);
+        EXPECT_EQ(library.get("HotReloadBroken"), previous);
+    }
+
+}
@@ -0,0 +1,166 @@
+//// StreamBuffer.test.cpp ////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the stream buffers and the ring streaming dynamic geometry
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include "GraphicsApi.hpp"
+#include "RendererExceptions.hpp"
+#include "StreamBuffer.hpp"
+#include "headless/HeadlessCommandLog.hpp"
+#include "headless/HeadlessStreamBuffer.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace nexo::renderer {
+
+    class StreamBufferTest : public ::testing::Test {
+        protected:
+            static constexpr size_t capacity = 16;
+
+            void SetUp() override
+            {
+                m_previousApi = NxGetGraphicsApi();
+                NxSetGraphicsApi(NxGraphicsApi::HEADLESS);
+                auto &log = NxHeadlessCommandLog::get();
+                log.clear();
+                log.setRecording(true);
+                ring.setBuffer(createStreamBuffer(capacity * sizeof(unsigned int)));
+            }
+
+            void TearDown() override
+            {
+                auto &log = NxHeadlessCommandLog::get();
+                log.setRecording(false);
+                log.clear();
+                NxSetGraphicsApi(m_previousApi);
+            }
+
+            NxStreamRing ring{sizeof(unsigned int)};
+
+        private:
+            NxGraphicsApi m_previousApi = NxGraphicsApi::HEADLESS;
+    };
+
+    TEST_F(StreamBufferTest, FactoryReturnsHeadlessBuffer)
+    {
+        const auto buffer = createStreamBuffer(64);
+        EXPECT_NE(std::dynamic_pointer_cast<NxHeadlessStreamBuffer>(buffer), nullptr);
+        EXPECT_EQ(buffer->getSize(), 64u);
+        EXPECT_NE(buffer->getMapping(), nullptr);
+    }
+
+    TEST_F(StreamBufferTest, RegionGrowsContiguously)
+    {
+        EXPECT_EQ(ring.getCapacity(), capacity);
+        EXPECT_EQ(ring.append(4), 0u);
+        EXPECT_EQ(ring.append(6), 4u);
+        EXPECT_EQ(ring.getRegionStart(), 0u);
+        EXPECT_EQ(ring.getRegionCount(), 10u);
+
+        ring.close();
+        EXPECT_EQ(ring.getRegionCount(), 0u);
+        EXPECT_EQ(ring.append(2), 10u);
+        EXPECT_EQ(ring.getRegionStart(), 10u);
+    }
+
+    TEST_F(StreamBufferTest, ClosedRegionsStayLockedUntilTheEndOfTheFrame)
+    {
+        ring.append(12);
+        ring.close();
+
+        // Does not fit before the end of the buffer, wraps to the region the GPU is reading
+        EXPECT_FALSE(ring.canAppend(8));
+        EXPECT_TRUE(ring.canAppend(4));
+
+        NxHeadlessCommandLog::get().endFrame();
+        EXPECT_TRUE(ring.canAppend(8));
+        EXPECT_EQ(ring.append(8), 0u);
+        EXPECT_EQ(ring.getStallCount(), 0u);
+    }
+
+    TEST_F(StreamBufferTest, AppendWaitsForLockedRanges)
+    {
+        ring.append(12);
+        ring.close();
+
+        EXPECT_EQ(ring.append(8), 0u);
+        EXPECT_EQ(ring.getStallCount(), 1u);
+        EXPECT_EQ(NxHeadlessCommandLog::get().getStats().fenceWaits, 1u);
+        EXPECT_EQ(NxHeadlessCommandLog::get().count(NxHeadlessCommandType::WAIT_FENCE), 1u);
+    }
+
+    TEST_F(StreamBufferTest, OpenRegionsDoNotWrap)
+    {
+        ring.append(12);
+        EXPECT_FALSE(ring.canAppend(8));
+        EXPECT_THROW(static_cast<void>(ring.append(8)), NxInvalidValue);
+        EXPECT_THROW(static_cast<void>(ring.append(capacity + 1)), NxInvalidValue);
+
+        ring.close();
+        EXPECT_THROW(static_cast<void>(ring.append(capacity + 1)), NxInvalidValue);
+    }
+
+    TEST_F(StreamBufferTest, SetBufferStartsOver)
+    {
+        ring.append(12);
+        ring.close();
+
+        ring.setBuffer(createStreamBuffer(capacity * 2 * sizeof(unsigned int)));
+        EXPECT_EQ(ring.getCapacity(), capacity * 2);
+        EXPECT_TRUE(ring.canAppend(20));
+        EXPECT_EQ(ring.append(20), 0u);
+        EXPECT_EQ(ring.getStallCount(), 0u);
+    }
+
+    TEST_F(StreamBufferTest, ElementsAreWrittenToTheMapping)
+    {
+        const size_t offset = ring.append(3);
+        constexpr std::array<unsigned int, 3> indices = {7, 8, 9};
+        std::memcpy(ring.getElement(offset), indices.data(), sizeof(indices));
+
+        unsigned int read[3] = {};
+        std::memcpy(read, ring.getBuffer()->getMapping(), sizeof(read));
+        EXPECT_EQ(read[0], 7u);
+        EXPECT_EQ(read[2], 9u);
+    }
+
+    TEST_F(StreamBufferTest, VertexAndIndexBuffersReadFromTheStreamBuffer)
+    {
+        const auto buffer = ring.getBuffer();
+        const NxBufferLayout layout = {{NxShaderDataType::FLOAT3, "aPos"}};
+        const auto vertexBuffer = createStreamVertexBuffer(buffer, layout);
+        const auto indexBuffer = createStreamIndexBuffer(buffer);
+
+        EXPECT_EQ(vertexBuffer->getId(), buffer->getId());
+        EXPECT_EQ(vertexBuffer->getLayout().getStride(), 12u);
+        EXPECT_EQ(indexBuffer->getCount(), capacity);
+
+        constexpr unsigned int index = 42;
+        indexBuffer->setSubData(&index, 1, 5);
+        unsigned int read = 0;
+        std::memcpy(&read, buffer->getMapping() + 5 * sizeof(unsigned int), sizeof(read));
+        EXPECT_EQ(read, 42u);
+
+        EXPECT_THROW(indexBuffer->setSubData(&index, 1, capacity), NxInvalidValue);
+        EXPECT_THROW(vertexBuffer->setSubData(&index, sizeof(index), buffer->getSize()), NxInvalidValue);
+        EXPECT_THROW(static_cast<void>(createStreamIndexBuffer(nullptr)), NxInvalidValue);
+    }
+
+}
@@ -0,0 +1,90 @@
+//// TextureRegistry.test.cpp /////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the persistent texture registry
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "GraphicsApi.hpp"
+#include "TextureRegistry.hpp"
+
+#include <set>
+#include <vector>
+
+namespace nexo::renderer {
+
+    class TextureRegistryTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                m_previousApi = NxGetGraphicsApi();
+                NxSetGraphicsApi(NxGraphicsApi::HEADLESS);
+            }
+
+            void TearDown() override
+            {
+                NxSetGraphicsApi(m_previousApi);
+            }
+
+        private:
+            NxGraphicsApi m_previousApi = NxGraphicsApi::HEADLESS;
+    };
+
+    TEST_F(TextureRegistryTest, TexturesAreRegisteredAtCreation)
+    {
+        std::vector<std::shared_ptr<NxTexture2D>> textures;
+        std::set<NxTextureHandle> handles;
+        for (int i = 0; i < 8; ++i) {
+            textures.push_back(NxTexture2D::create(4, 4));
+            handles.insert(textures.back()->getHandle());
+        }
+
+        EXPECT_EQ(handles.size(), textures.size());
+        EXPECT_FALSE(handles.contains(NX_INVALID_TEXTURE_HANDLE));
+        for (const auto &texture : textures)
+            EXPECT_EQ(NxTextureRegistry::get().resolve(texture->getHandle()), texture);
+    }
+
+    TEST_F(TextureRegistryTest, RegisteringTwiceKeepsTheHandle)
+    {
+        const auto texture = NxTexture2D::create(4, 4);
+        const NxTextureHandle handle = texture->getHandle();
+
+        EXPECT_EQ(NxTextureRegistry::get().add(texture), handle);
+        EXPECT_EQ(texture->getHandle(), handle);
+        EXPECT_EQ(NxTextureRegistry::get().add(nullptr), NX_INVALID_TEXTURE_HANDLE);
+    }
+
+    TEST_F(TextureRegistryTest, DestroyedTexturesDoNotResolve)
+    {
+        auto texture = NxTexture2D::create(4, 4);
+        const NxTextureHandle handle = texture->getHandle();
+
+        texture.reset();
+        EXPECT_EQ(NxTextureRegistry::get().resolve(handle), nullptr);
+        EXPECT_EQ(NxTextureRegistry::get().resolve(NX_INVALID_TEXTURE_HANDLE), nullptr);
+    }
+
+    TEST_F(TextureRegistryTest, HandlesOfDestroyedTexturesAreRecycled)
+    {
+        const size_t capacity = NxTextureRegistry::get().capacity();
+        // Enough short lived textures to force the table to grow several times
+        for (size_t i = 0; i < capacity + 64; ++i)
+            static_cast<void>(NxTexture2D::create(1, 1));
+        EXPECT_LE(NxTextureRegistry::get().capacity(), 2 * (capacity + 1) + 64);
+    }
+
+}
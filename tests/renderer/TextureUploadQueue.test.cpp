@@ -0,0 +1,137 @@
+//// TextureUploadQueue.test.cpp //////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the asynchronous texture upload queue
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "GraphicsApi.hpp"
+#include "TextureUploadQueue.hpp"
+#include "RendererExceptions.hpp"
+
+#include <vector>
+
+namespace nexo::renderer {
+
+    class TextureUploadQueueTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                m_previousApi = NxGetGraphicsApi();
+                NxSetGraphicsApi(NxGraphicsApi::HEADLESS);
+                m_placeholder = NxTexture2D::create(1, 1);
+                queue().setPlaceholder(m_placeholder);
+                queue().setFrameBudget(NxTextureUploadQueue::DEFAULT_FRAME_BUDGET);
+            }
+
+            void TearDown() override
+            {
+                queue().finish();
+                queue().setPlaceholder(nullptr);
+                NxSetGraphicsApi(m_previousApi);
+            }
+
+            static NxTextureUploadQueue &queue() { return NxTextureUploadQueue::get(); }
+
+            static NxTextureUploadQueue::Decoder solidImage(const unsigned int size)
+            {
+                return [size] {
+                    NxTextureImage image;
+                    image.width = size;
+                    image.height = size;
+                    image.format = NxTextureFormat::RGBA8;
+                    image.pixels.assign(static_cast<size_t>(size) * size * 4, 0xff);
+                    return image;
+                };
+            }
+
+            std::shared_ptr<NxTexture2D> m_placeholder;
+
+        private:
+            NxGraphicsApi m_previousApi = NxGraphicsApi::HEADLESS;
+    };
+
+    TEST_F(TextureUploadQueueTest, PlaceholderIsShownUntilUpload)
+    {
+        const auto texture = queue().enqueue(solidImage(8));
+
+        EXPECT_EQ(texture->getStatus(), NxStreamedTexture2D::Status::PENDING);
+        EXPECT_EQ(texture->getId(), m_placeholder->getId());
+        EXPECT_EQ(texture->getWidth(), 1u);
+        EXPECT_NE(texture->getHandle(), NX_INVALID_TEXTURE_HANDLE);
+
+        queue().finish();
+
+        EXPECT_TRUE(texture->isResident());
+        EXPECT_NE(texture->getId(), m_placeholder->getId());
+        EXPECT_EQ(texture->getWidth(), 8u);
+        EXPECT_EQ(texture->getHeight(), 8u);
+        EXPECT_EQ(queue().pendingCount(), 0u);
+    }
+
+    TEST_F(TextureUploadQueueTest, UploadsAreSpreadByTheFrameBudget)
+    {
+        std::vector<std::shared_ptr<NxStreamedTexture2D>> textures;
+        for (int i = 0; i < 4; ++i)
+            textures.push_back(queue().enqueue(solidImage(4)));
+        queue().waitForDecodes();
+
+        constexpr size_t imageSize = 4 * 4 * 4;
+        EXPECT_EQ(queue().processUploads(imageSize * 2), imageSize * 2);
+        EXPECT_EQ(queue().pendingCount(), 2u);
+        // A texture larger than the budget still goes through, one per frame
+        EXPECT_EQ(queue().processUploads(1), imageSize);
+        EXPECT_EQ(queue().processUploads(1), imageSize);
+        EXPECT_EQ(queue().processUploads(1), 0u);
+
+        for (const auto &texture : textures)
+            EXPECT_TRUE(texture->isResident());
+    }
+
+    TEST_F(TextureUploadQueueTest, FailedDecodeKeepsThePlaceholder)
+    {
+        const auto texture = queue().enqueue([]() -> NxTextureImage {
+            THROW_EXCEPTION(NxFileNotFoundException, "missing.png");
+        }, "missing.png");
+
+        queue().finish();
+
+        EXPECT_EQ(texture->getStatus(), NxStreamedTexture2D::Status::FAILED);
+        EXPECT_EQ(texture->getId(), m_placeholder->getId());
+    }
+
+    TEST_F(TextureUploadQueueTest, ReleasedTexturesAreNotUploaded)
+    {
+        auto texture = queue().enqueue(solidImage(4));
+        queue().waitForDecodes();
+        texture.reset();
+
+        EXPECT_EQ(queue().processUploads(), 0u);
+        EXPECT_EQ(queue().pendingCount(), 0u);
+    }
+
+    TEST_F(TextureUploadQueueTest, ShutdownReleasesThePlaceholder)
+    {
+        auto texture = queue().enqueue(solidImage(4));
+        queue().shutdown();
+
+        EXPECT_EQ(queue().pendingCount(), 0u);
+        EXPECT_EQ(texture->getStatus(), NxStreamedTexture2D::Status::PENDING);
+        texture.reset();
+        EXPECT_EQ(m_placeholder.use_count(), 1);
+    }
+
+}
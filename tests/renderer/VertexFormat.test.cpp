@@ -0,0 +1,161 @@
+//// VertexFormat.test.cpp ////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the compact vertex formats
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include "VertexFormat.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace nexo::renderer {
+
+    static NxVertex makeVertex(const glm::vec3 &position, const glm::vec2 &texCoord, const glm::vec3 &normal,
+                               const glm::vec3 &tangent, const glm::vec3 &bitangent)
+    {
+        NxVertex vertex{};
+        vertex.position = position;
+        vertex.texCoord = texCoord;
+        vertex.normal = normal;
+        vertex.tangent = tangent;
+        vertex.bitangent = bitangent;
+        return vertex;
+    }
+
+    TEST(VertexFormatTest, StridesMatchTheLayouts)
+    {
+        for (const auto format : {NxVertexFormat::STANDARD, NxVertexFormat::COMPACT, NxVertexFormat::COMPACT_QUANTIZED})
+            EXPECT_EQ(vertexFormatLayout(format).getStride(), vertexFormatStride(format));
+        EXPECT_EQ(vertexFormatStride(NxVertexFormat::STANDARD), sizeof(NxVertex));
+        EXPECT_EQ(vertexFormatStride(NxVertexFormat::COMPACT), 24u);
+        EXPECT_EQ(vertexFormatStride(NxVertexFormat::COMPACT_QUANTIZED), 20u);
+    }
+
+    TEST(VertexFormatTest, HalfFloatRoundTrip)
+    {
+        for (const float value : {0.0f, 1.0f, -1.0f, 0.5f, 0.25f, 2048.0f, 65504.0f, -65504.0f})
+            EXPECT_EQ(halfToFloat(floatToHalf(value)), value);
+
+        // 11 bits of precision
+        for (const float value : {0.1f, 0.333f, 3.14159f, -7.77f, 0.0001f})
+            EXPECT_NEAR(halfToFloat(floatToHalf(value)), value, std::abs(value) / 1024.0f);
+
+        EXPECT_TRUE(std::isinf(halfToFloat(floatToHalf(100000.0f))));
+        EXPECT_TRUE(std::isnan(halfToFloat(floatToHalf(std::numeric_limits<float>::quiet_NaN()))));
+        EXPECT_EQ(halfToFloat(floatToHalf(1e-10f)), 0.0f);
+        // Smallest subnormal half float
+        EXPECT_EQ(halfToFloat(floatToHalf(std::ldexp(1.0f, -24))), std::ldexp(1.0f, -24));
+    }
+
+    TEST(VertexFormatTest, OctahedralRoundTrip)
+    {
+        float maxError = 0.0f;
+        for (int i = 0; i < 64; ++i) {
+            for (int j = 0; j < 32; ++j) {
+                const float phi = static_cast<float>(i) / 64.0f * 6.2831853f;
+                const float theta = (static_cast<float>(j) + 0.5f) / 32.0f * 3.1415926f;
+                const glm::vec3 direction(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+                const glm::vec3 decoded = decodeOctahedral(encodeOctahedral(direction));
+                maxError = std::max(maxError, glm::length(decoded - direction));
+            }
+        }
+        EXPECT_LT(maxError, 1e-4f);
+
+        const glm::vec3 axes[] = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+        for (const glm::vec3 &axis : axes)
+            EXPECT_LT(glm::length(decodeOctahedral(encodeOctahedral(axis)) - axis), 1e-4f);
+
+        // Unnormalized and null vectors
+        EXPECT_LT(glm::length(decodeOctahedral(encodeOctahedral({0.0f, 3.0f, 0.0f})) - glm::vec3(0, 1, 0)), 1e-4f);
+        EXPECT_LT(glm::length(decodeOctahedral(encodeOctahedral(glm::vec3(0.0f))) - glm::vec3(0, 0, 1)), 1e-4f);
+    }
+
+    TEST(VertexFormatTest, TangentKeepsItsHandedness)
+    {
+        const glm::vec3 tangent = glm::normalize(glm::vec3(0.3f, -0.8f, -0.5f));
+        for (const float sign : {1.0f, -1.0f}) {
+            const glm::vec4 decoded = decodeTangent(encodeTangent(tangent, sign));
+            EXPECT_EQ(decoded.w, sign);
+            EXPECT_LT(glm::length(glm::vec3(decoded.x, decoded.y, decoded.z) - tangent), 1e-3f);
+        }
+    }
+
+    TEST(VertexFormatTest, PackCompactVertices)
+    {
+        const std::vector<NxVertex> vertices = {
+            makeVertex({1.5f, -2.0f, 3.25f}, {0.5f, 2.0f}, {0, 1, 0}, {1, 0, 0}, {0, 0, -1}),
+            makeVertex({-4.0f, 0.0f, 0.125f}, {0.75f, -1.0f}, {0, 0, 1}, {1, 0, 0}, {0, -1, 0})
+        };
+        const NxPackedVertices packed = packVertices(vertices, NxVertexFormat::COMPACT);
+        ASSERT_EQ(packed.data.size(), 2 * sizeof(NxCompactVertex));
+        EXPECT_EQ(packed.decode.format, NxVertexFormat::COMPACT);
+
+        std::vector<NxCompactVertex> compact(2);
+        std::memcpy(compact.data(), packed.data.data(), packed.data.size());
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            EXPECT_EQ(compact[i].position, vertices[i].position);
+            EXPECT_EQ(halfToFloat(compact[i].texCoord[0]), vertices[i].texCoord.x);
+            EXPECT_EQ(halfToFloat(compact[i].texCoord[1]), vertices[i].texCoord.y);
+            EXPECT_LT(glm::length(decodeOctahedral(compact[i].normal) - vertices[i].normal), 1e-4f);
+        }
+        // cross(normal, tangent) is -Z for the first vertex, the bitangent agrees
+        EXPECT_EQ(decodeTangent(compact[0].tangent).w, 1.0f);
+        // cross(normal, tangent) is +Y for the second one, the bitangent is mirrored
+        EXPECT_EQ(decodeTangent(compact[1].tangent).w, -1.0f);
+    }
+
+    TEST(VertexFormatTest, PackQuantizedVerticesRelativeToTheirBounds)
+    {
+        std::vector<NxVertex> vertices;
+        for (int i = 0; i <= 10; ++i) {
+            const float t = static_cast<float>(i) / 10.0f;
+            // Flat along Y
+            vertices.push_back(makeVertex({-5.0f + 15.0f * t, 2.0f, 100.0f * t * t}, {t, t}, {0, 1, 0}, {1, 0, 0}, {0, 0, 1}));
+        }
+        const NxPackedVertices packed = packVertices(vertices, NxVertexFormat::COMPACT_QUANTIZED);
+        ASSERT_EQ(packed.data.size(), vertices.size() * sizeof(NxQuantizedVertex));
+        EXPECT_EQ(packed.decode.positionMin, glm::vec3(-5.0f, 2.0f, 0.0f));
+        EXPECT_FLOAT_EQ(packed.decode.positionExtent.x, 15.0f);
+        EXPECT_FLOAT_EQ(packed.decode.positionExtent.z, 100.0f);
+
+        std::vector<NxQuantizedVertex> quantized(vertices.size());
+        std::memcpy(quantized.data(), packed.data.data(), packed.data.size());
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            const glm::vec3 normalized(quantized[i].position[0] / 65535.0f,
+                                       quantized[i].position[1] / 65535.0f,
+                                       quantized[i].position[2] / 65535.0f);
+            const glm::vec3 decoded = packed.decode.positionMin + normalized * packed.decode.positionExtent;
+            // Within a quantization step of the largest axis
+            EXPECT_LT(glm::length(decoded - vertices[i].position), 100.0f / 65535.0f);
+            EXPECT_EQ(decoded.y, 2.0f);
+        }
+    }
+
+    TEST(VertexFormatTest, PackStandardVerticesCopiesThem)
+    {
+        const std::vector<NxVertex> vertices = {makeVertex({1, 2, 3}, {4, 5}, {0, 0, 1}, {1, 0, 0}, {0, 1, 0})};
+        const NxPackedVertices packed = packVertices(vertices, NxVertexFormat::STANDARD);
+        ASSERT_EQ(packed.data.size(), sizeof(NxVertex));
+        EXPECT_EQ(std::memcmp(packed.data.data(), vertices.data(), sizeof(NxVertex)), 0);
+        EXPECT_TRUE(packVertices({}, NxVertexFormat::COMPACT_QUANTIZED).data.empty());
+    }
+
+}
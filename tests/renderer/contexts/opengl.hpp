@@ -79,6 +79,7 @@ namespace nexo::renderer {
         MOCK_METHOD(void, setLayout, (const NxBufferLayout &layout), (override));
         MOCK_METHOD(NxBufferLayout, getLayout, (), (const, override));
         MOCK_METHOD(void, setData, (void *data, size_t size), (override));
+        MOCK_METHOD(void, setSubData, (const void *data, size_t size, size_t offset), (override));
         MOCK_METHOD(unsigned int, getId, (), (const, override));
     };
 
@@ -87,6 +88,7 @@ namespace nexo::renderer {
         MOCK_METHOD(void, bind, (), (const, override));
         MOCK_METHOD(void, unbind, (), (const, override));
         MOCK_METHOD(void, setData, (unsigned int *data, size_t size), (override));
+        MOCK_METHOD(void, setSubData, (const unsigned int *data, size_t count, size_t offset), (override));
         MOCK_METHOD(size_t, getCount, (), (const, override));
         MOCK_METHOD(unsigned int, getId, (), (const, override));
     };